@@ -37,6 +37,7 @@
 #include "Driver_I2C.h"
 #include "Driver_SAI.h"
 #include "Board_Audio.h"
+#include "i2c.h"
 
 
 // WM8994 Outputs (Available: Headphone1 and speaker output)
@@ -189,15 +190,19 @@ static int32_t WM8994_RegRead (uint16_t reg, uint16_t *reg_val) {
   reg_addr[0] = (uint8_t)(reg >> 8);
   reg_addr[1] = (uint8_t)reg;
 
+  I2cBusLock ();                        // bus shared with touch controller
   if (ptrI2C->MasterTransmit (WM8994_I2C_ADDR, reg_addr, 2U, true) != ARM_DRIVER_OK) {
+    I2cBusUnlock ();
     return -1;
   }
-  while (ptrI2C->GetStatus().busy);
+  I2cBusWait (ptrI2C);
 
   if (ptrI2C->MasterReceive  (WM8994_I2C_ADDR, buf, 2U, false) != ARM_DRIVER_OK) {
+    I2cBusUnlock ();
     return -1;
   }
-  while (ptrI2C->GetStatus().busy);
+  I2cBusWait (ptrI2C);
+  I2cBusUnlock ();
 
   *reg_val  = buf[0] << 8;
   *reg_val |= buf[1];
@@ -222,10 +227,13 @@ static int32_t WM8994_RegWrite (uint16_t reg, uint16_t reg_val) {
   buf[2] = (uint8_t)(reg_val >> 8);
   buf[3] = (uint8_t)(reg_val     );
 
+  I2cBusLock ();
   if (ptrI2C->MasterTransmit (WM8994_I2C_ADDR, buf, 4U, false) != ARM_DRIVER_OK) {
+    I2cBusUnlock ();
     return -1;
   }
-  while (ptrI2C->GetStatus().busy);
+  I2cBusWait (ptrI2C);
+  I2cBusUnlock ();
 
   return 0;
 }
@@ -244,6 +252,7 @@ static int32_t WM8994_RegModify (uint16_t reg, uint16_t mask, uint16_t val) {
   uint8_t   buf[4];
   uint16_t  rd_val;
 
+  I2cBusLock ();                        // read and write in one bus access
   WM8994_RegRead (reg, &rd_val);
   val |= (rd_val & ~mask);
 
@@ -253,9 +262,11 @@ static int32_t WM8994_RegModify (uint16_t reg, uint16_t mask, uint16_t val) {
   buf[3] = (uint8_t)(val     );
 
   if (ptrI2C->MasterTransmit (WM8994_I2C_ADDR, buf, 4U, false) != ARM_DRIVER_OK) {
+    I2cBusUnlock ();
     return -1;
   }
-  while (ptrI2C->GetStatus().busy);
+  I2cBusWait (ptrI2C);
+  I2cBusUnlock ();
 
   return 0;
 }
@@ -361,11 +372,13 @@ int32_t Audio_Initialize (Audio_SignalEvent_t cb_event) {
   // Start transmitter to run Codec clock
   Audio.Out.SAI->Control (ARM_SAI_CONTROL_TX, 1U, 0U);
 
-  // I2C Initialization and configuration
-  ptrI2C->Initialize   (NULL);
+  // I2C Initialization and configuration (shared with touch controller)
+  I2cBusLock ();
+  ptrI2C->Initialize   (I2cBusEvent);
   ptrI2C->PowerControl (ARM_POWER_FULL);
   ptrI2C->Control      (ARM_I2C_BUS_SPEED, ARM_I2C_BUS_SPEED_STANDARD);
   ptrI2C->Control      (ARM_I2C_BUS_CLEAR, 0U);
+  I2cBusUnlock ();
 
 
   // WM8994 Reset
@@ -2,6 +2,7 @@
 
 #include "stm32f7_i2c.h"
 #include "Driver_I2C.h"
+#include "i2c.h"
 
 /* I2C Driver */
 extern ARM_DRIVER_I2C Driver_I2C3;
@@ -17,15 +18,14 @@ static ARM_DRIVER_I2C * I2Cdrv = &Driver_I2C3;
 #define A_RD                  1         /* Master will read from the I2C      */
 
 static uint8_t wr_buf[256];
-uint8_t  gI2CAccess = 0;
 bool_t i2cInit(I2C_TypeDef* i2c)
 {
-	gI2CAccess = 1;
-  I2Cdrv->Initialize   (NULL);
+	I2cBusLock();													// bus shared with audio codec
+  I2Cdrv->Initialize   (I2cBusEvent);
   I2Cdrv->PowerControl (ARM_POWER_FULL);
   I2Cdrv->Control      (ARM_I2C_BUS_SPEED, ARM_I2C_BUS_SPEED_STANDARD);
   I2Cdrv->Control      (ARM_I2C_BUS_CLEAR, 0);
-	gI2CAccess = 0;
+	I2cBusUnlock();
  
  
   return 1;			// just says no error
@@ -34,15 +34,17 @@ bool_t i2cInit(I2C_TypeDef* i2c)
 
 void i2cWriteReg(I2C_TypeDef* i2c, uint8_t slaveAddr, uint8_t regAddr, uint8_t value)
 {
+	int32_t count;
+	I2cBusLock();													// wr_buf is used with bus
 	wr_buf[0] = regAddr;
 	wr_buf[1] = value;
-	gI2CAccess = 1;
 
   I2Cdrv->MasterTransmit (slaveAddr/2, wr_buf, 2, false);
-  while (I2Cdrv->GetStatus().busy);
-  if (I2Cdrv->GetDataCount () != 2) return;
+  I2cBusWait(I2Cdrv);
+  count = I2Cdrv->GetDataCount ();
+	I2cBusUnlock();
+  if (count != 2) return;
   /* Acknowledge polling */	
-		gI2CAccess = 0;
 
 //  do {
 //    I2Cdrv->MasterReceive (DeviceAddr, &wr_buf[0], 1, false);
@@ -54,14 +56,16 @@ void i2cWriteReg(I2C_TypeDef* i2c, uint8_t slaveAddr, uint8_t regAddr, uint8_t v
 uint8_t i2cReadByte(I2C_TypeDef* i2c, uint8_t slaveAddr, uint8_t regAddr)
 {
 	uint8_t ret = 0;
-	gI2CAccess = 1;
+	int32_t count;
+	I2cBusLock();
 
   I2Cdrv->MasterTransmit (slaveAddr/2, &regAddr, 1, true);
-  while (I2Cdrv->GetStatus().busy);
+  I2cBusWait(I2Cdrv);
   I2Cdrv->MasterReceive (slaveAddr/2, &ret, 1, false);
-  while (I2Cdrv->GetStatus().busy);
-  if (I2Cdrv->GetDataCount () != 1) return 0xAA;
- 	gI2CAccess = 0;
+  I2cBusWait(I2Cdrv);
+  count = I2Cdrv->GetDataCount ();
+	I2cBusUnlock();
+  if (count != 1) return 0xAA;
 
 	return ret;
 }
@@ -69,14 +73,16 @@ uint8_t i2cReadByte(I2C_TypeDef* i2c, uint8_t slaveAddr, uint8_t regAddr)
 uint16_t i2cReadWord(I2C_TypeDef* i2c, uint8_t slaveAddr, uint8_t regAddr)
 {
 	uint8_t ret[2] = { 0, 0 };
-	gI2CAccess = 1;
+	int32_t count;
+	I2cBusLock();
 
   I2Cdrv->MasterTransmit (slaveAddr/2, &regAddr, 1, true);
-  while (I2Cdrv->GetStatus().busy);
+  I2cBusWait(I2Cdrv);
   I2Cdrv->MasterReceive (slaveAddr/2, ret, 2, false);
-  while (I2Cdrv->GetStatus().busy);
-  if (I2Cdrv->GetDataCount () != 2) return 0xAAAA;
- 	gI2CAccess = 0;
+  I2cBusWait(I2Cdrv);
+  count = I2Cdrv->GetDataCount ();
+	I2cBusUnlock();
+  if (count != 2) return 0xAAAA;
 
 	return (uint16_t)((ret[0] << 8) | (ret[1] & 0x00FF));
 }
@@ -4,17 +4,264 @@
 /// \author Pascal Sartoretti (sap at hevs dot ch)
 /// \version 1.0 - original
 /// \date  2018-02
+///
+/// The cues are stored in IMA-ADPCM (4 bits per sample, see
+/// tools/pcm2adpcm.py). Each cue to play gets a voice, the voices are decoded
+/// and mixed (fixed-point gain per cue) in two small buffers: the audio
+/// callback sends the next buffer at the end of the current one and wakes up
+/// the thread to mix again in the free one. A new cue never stops another.
 //////////////////////////////////////////////////////////////////////////////////
 #include "stm32f7xx_hal.h"
 
 #include <stdio.h>
+#include <string.h>
 #include "main.h"
 #include "audio_msg.c"
 #include "audio_error.c"
 #include "audio_clock.c"
 #include "Board_Audio.h"
 
-extern uint8_t gI2CAccess;
+#define AUDIO_BUF_SAMPLES	256					// samples per mix buffer (16 ms)
+#define AUDIO_VOICES			4						// cues played at the same time
+#define AUDIO_GAIN_MSG		256					// gain of message cue (256 = 1.0)
+#define AUDIO_GAIN_ERROR	256					// gain of error cue
+#define AUDIO_GAIN_CLOCK	128					// gain of clock cue
+
+//--------------------------------------------------------------------------------
+// IMA-ADPCM decoder state
+//--------------------------------------------------------------------------------
+struct adpcm_t
+{
+	const uint8_t *	dataPtr;						///< next byte of cue
+	uint32_t				samples;						///< samples to decode
+	int32_t					predictor;					///< last sample
+	int8_t					index;							///< step index
+	uint16_t				gain;								///< mix gain (256 = 1.0, 0 if free)
+};
+
+static const int8_t adpcmIndex[16] = {
+	-1,-1,-1,-1,2,4,6,8,-1,-1,-1,-1,2,4,6,8};
+static const uint16_t adpcmStep[89] = {
+	7,8,9,10,11,12,13,14,16,17,19,21,23,25,28,31,34,37,41,45,
+	50,55,60,66,73,80,88,97,107,118,130,143,157,173,190,209,230,253,279,307,
+	337,371,408,449,494,544,598,658,724,796,876,963,1060,1166,1282,1411,1552,1707,1878,2066,
+	2272,2499,2749,3024,3327,3660,4026,4428,4871,5358,5894,6484,7132,7845,8630,9493,10442,11487,12635,13899,
+	15289,16818,18500,20350,22385,24623,27086,29794,32767};
+
+static struct adpcm_t voices[AUDIO_VOICES];	// cues being played
+static int16_t audioBuf[2][AUDIO_BUF_SAMPLES];	// mixed samples
+static volatile uint32_t audioBufSize[2];	// samples in buffer (0 if free)
+static volatile uint8_t audioBusy;					// a buffer is being sent
+static volatile uint8_t audioSending;				// buffer being sent
+static int32_t mixSum[AUDIO_BUF_SAMPLES];		// sum of voices
+static int16_t mixVoice[AUDIO_BUF_SAMPLES];	// samples of one voice
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Decode one sample
+/// \param adpcmPtr The decoder state
+/// \param nibble The 4 bits code
+/// \return The sample
+//////////////////////////////////////////////////////////////////////////////////
+static int16_t AdpcmSample(struct adpcm_t * adpcmPtr,uint8_t nibble)
+{
+	int32_t step = adpcmStep[adpcmPtr->index];
+	int32_t diff = step >> 3;
+
+	if((nibble & 4) != 0)	diff += step;
+	if((nibble & 2) != 0)	diff += step >> 1;
+	if((nibble & 1) != 0)	diff += step >> 2;
+	if((nibble & 8) != 0)
+	{
+		adpcmPtr->predictor -= diff;
+		if(adpcmPtr->predictor < -32768)
+		{
+			adpcmPtr->predictor = -32768;
+		}
+	}
+	else
+	{
+		adpcmPtr->predictor += diff;
+		if(adpcmPtr->predictor > 32767)
+		{
+			adpcmPtr->predictor = 32767;
+		}
+	}
+	adpcmPtr->index += adpcmIndex[nibble];
+	if(adpcmPtr->index < 0)
+	{
+		adpcmPtr->index = 0;
+	}
+	else if(adpcmPtr->index > 88)
+	{
+		adpcmPtr->index = 88;
+	}
+	return (int16_t)adpcmPtr->predictor;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Decode the next samples of a cue
+/// \param adpcmPtr The decoder state
+/// \param bufPtr Where to write the samples
+/// \return The number of samples (0 at end of cue)
+//////////////////////////////////////////////////////////////////////////////////
+static uint32_t AdpcmDecode(struct adpcm_t * adpcmPtr,int16_t * bufPtr)
+{
+	uint32_t count = 0;
+	uint8_t byte;
+
+	while((count < AUDIO_BUF_SAMPLES) && (adpcmPtr->samples >= 2))
+	{
+		byte = *adpcmPtr->dataPtr++;						// low nibble first
+		bufPtr[count++] = AdpcmSample(adpcmPtr,byte & 0x0F);
+		bufPtr[count++] = AdpcmSample(adpcmPtr,byte >> 4);
+		adpcmPtr->samples -= 2;
+	}
+	return count;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Audio driver callback (SAI interrupt): send next buffer if ready
+/// \param event The audio events
+//////////////////////////////////////////////////////////////////////////////////
+static void AudioEvent(uint32_t event)
+{
+	uint8_t next;
+
+	if((event & AUDIO_EVENT_SEND_COMPLETE) != 0)
+	{
+		audioBufSize[audioSending] = 0;				// buffer is free
+		next = audioSending ^ 1;
+		if(audioBufSize[next] != 0)						// no gap between buffers
+		{
+			audioSending = next;
+			Audio_SendData(audioBuf[next],audioBufSize[next]);
+		}
+		else
+		{
+			audioBusy = 0;
+		}
+		osEventFlagsSet(eventFlag_id,AUDIO_BUF_EVT);	// mix in free buffer
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Start a cue on a free voice (or on the one nearest to its end)
+/// \param dataPtr The IMA-ADPCM cue
+/// \param size The size of the cue (bytes)
+/// \param gain The mix gain (256 = 1.0)
+//////////////////////////////////////////////////////////////////////////////////
+static void AudioStart(const uint8_t * dataPtr,uint32_t size,uint16_t gain)
+{
+	struct adpcm_t * voicePtr = &voices[0];
+	uint8_t i;
+
+	for(i=0;i<AUDIO_VOICES;i++)
+	{
+		if(voices[i].gain == 0)								// free voice
+		{
+			voicePtr = &voices[i];
+			break;
+		}
+		if(voices[i].samples < voicePtr->samples)
+		{
+			voicePtr = &voices[i];
+		}
+	}
+	voicePtr->dataPtr = dataPtr;
+	voicePtr->samples = size * 2;
+	voicePtr->predictor = 0;
+	voicePtr->index = 0;
+	voicePtr->gain = gain;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Mix the next samples of all voices
+/// \param bufPtr Where to write the samples
+/// \return The number of samples (0 if no voice is playing)
+//////////////////////////////////////////////////////////////////////////////////
+static uint32_t AudioMix(int16_t * bufPtr)
+{
+	uint32_t count = 0;
+	uint32_t size;
+	uint32_t i;
+	uint8_t v;
+
+	memset(mixSum,0,sizeof(mixSum));
+	for(v=0;v<AUDIO_VOICES;v++)
+	{
+		if(voices[v].gain == 0)
+		{
+			continue;
+		}
+		size = AdpcmDecode(&voices[v],mixVoice);
+		for(i=0;i<size;i++)
+		{
+			mixSum[i] += (mixVoice[i] * voices[v].gain) >> 8;
+		}
+		if(size > count)
+		{
+			count = size;
+		}
+		if(size < AUDIO_BUF_SAMPLES)					// end of cue
+		{
+			voices[v].gain = 0;
+		}
+	}
+	for(i=0;i<count;i++)										// saturate sum
+	{
+		if(mixSum[i] > 32767)
+		{
+			mixSum[i] = 32767;
+		}
+		else if(mixSum[i] < -32768)
+		{
+			mixSum[i] = -32768;
+		}
+		bufPtr[i] = (int16_t)mixSum[i];
+	}
+	return count;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Mix in all free buffers (never waits)
+//////////////////////////////////////////////////////////////////////////////////
+static void AudioFill(void)
+{
+	uint32_t primask;
+	uint32_t count;
+	uint8_t buf;
+
+	for (;;)
+	{
+		if(audioBufSize[0] == 0)							// find a free buffer
+		{
+			buf = 0;
+		}
+		else if(audioBufSize[1] == 0)
+		{
+			buf = 1;
+		}
+		else																	// both are waiting to be sent
+		{
+			return;
+		}
+		count = AudioMix(audioBuf[buf]);
+		if(count == 0)												// nothing more to play
+		{
+			return;
+		}
+		primask = __get_PRIMASK();						// callback changes state
+		__disable_irq();
+		audioBufSize[buf] = count;
+		if(audioBusy == 0)										// start sending
+		{
+			audioBusy = 1;
+			audioSending = buf;
+			Audio_SendData(audioBuf[buf],count);
+		}
+		__set_PRIMASK(primask);
+	}
+}
 
 //////////////////////////////////////////////////////////////////////////////////
 // THREAD AUDIO
@@ -24,23 +271,15 @@ void AudioPlayer(void *argument)
 	int32_t	eventFlag;											// current flag	
 
 	//------------------------------------------------------------------------------
-	// Initialize the audio interface (need to be intialised first)
-	// this thread has a most important priority and block kernel switch when
-	// intilalising the audio interface
+	// Initialize the audio interface (the codec registers accesses share the
+	// I2C bus with the touch controller, see i2c_bus.c)
 	//------------------------------------------------------------------------------
-	while(gI2CAccess != 0){}
-	osKernelLock();
-  Audio_Initialize   (NULL);
+  Audio_Initialize   (AudioEvent);
   Audio_SetDataFormat(AUDIO_STREAM_OUT, AUDIO_DATA_16_MONO);
   Audio_SetFrequency (AUDIO_STREAM_OUT,16000);
   Audio_SetMute      (AUDIO_STREAM_OUT, AUDIO_CHANNEL_MASTER, false);
   Audio_SetVolume    (AUDIO_STREAM_OUT, AUDIO_CHANNEL_MASTER, 50);
   Audio_Start        (AUDIO_STREAM_OUT);
-	//------------------------------------------------------------------------------
-	// Bacause of audio initialize use the I2C interrupts and the uGFX touch
-	// protocol don't use it, we neeed to clear this register
-//	I2C3->CR1 = 0;	
-	osKernelUnlock();
 	
 	//------------------------------------------------------------------------------
   while (1) 															// forever
@@ -50,7 +289,7 @@ void AudioPlayer(void *argument)
 		//----------------------------------------------------------------------------
 		eventFlag = osEventFlagsWait(
 			eventFlag_id,
-			AUDIO_MSG_EVT | AUDIO_ERROR_EVT| AUDIO_CLOCK_EVT,
+			AUDIO_MSG_EVT | AUDIO_ERROR_EVT| AUDIO_CLOCK_EVT | AUDIO_BUF_EVT,
 			osFlagsWaitAny,
 			osWaitForever); 	
 		if(eventFlag < 0)				// case of error
@@ -58,16 +297,17 @@ void AudioPlayer(void *argument)
 		//----------------------------------------------------------------------------
 		if((eventFlag & AUDIO_MSG_EVT) == AUDIO_MSG_EVT)		// play incoming message
 		{
-				Audio_SendData(audio_msg, sizeof(audio_msg)/2);
+				AudioStart(audio_msg, sizeof(audio_msg), AUDIO_GAIN_MSG);
 		}
 		if((eventFlag & AUDIO_ERROR_EVT) == AUDIO_ERROR_EVT)	// play error message
 		{
-				Audio_SendData(audio_error, sizeof(audio_error)/2);
+				AudioStart(audio_error, sizeof(audio_error), AUDIO_GAIN_ERROR);
 		}
 		if((eventFlag & AUDIO_CLOCK_EVT) == AUDIO_CLOCK_EVT)	// play clock message
 		{
-				Audio_SendData(audio_clock, sizeof(audio_clock)/2);
+				AudioStart(audio_clock, sizeof(audio_clock), AUDIO_GAIN_CLOCK);
 		}
+		AudioFill();														// mix in free buffers
   }
 }
 
@@ -1,392 +1,133 @@
 #include "stm32f7xx_hal.h"
 
-const uint16_t audio_clock[]={
-65497, 65481, 65477, 65474, 65473, 65466, 65458, 65451,
-65448, 65460, 65476, 65504, 65534,    29,    53,    70,
-   64,    53,    21, 65530, 65509, 65503, 65518, 65531,
-   28,    34,    45,    28,     8, 65516, 65503, 65497,
-65516,     2,    31,    40,    45,    25,     5, 65515,
-65490, 65472, 65446, 65429, 65401, 65380, 65358, 65342,
-65341, 65347, 65368, 65396, 65425, 65449, 65464, 65463,
-65468, 65462, 65472, 65483, 65498, 65513, 65513, 65508,
-65485, 65462, 65427, 65406, 65388, 65390, 65416, 65455,
-65508,    35,    74,   124,   142,   165,   173,   182,
-  178,   167,   144,   115,    80,    53,    23,     8,
-65528, 65520, 65512, 65507, 65510, 65513, 65524, 65533,
-65530, 65529, 65507, 65492, 65465, 65448, 65426, 65418,
-65410, 65413, 65418, 65428, 65433, 65439, 65438, 65438,
-65432, 65435, 65420, 65428, 65420, 65437, 65455, 65486,
-65523,    26,    72,   118,   175,   227,   275,   307,
-  311,   286,   230,   147,    59, 65500, 65434, 65396,
-65399, 65443, 65506,    56,   138,   227,   299,   363,
-  397,   400,   362,   293,   189,    93, 65518, 65438,
-65365, 65310, 65274, 65254, 65255, 65285, 65330, 65393,
-65456, 65517,    38,    79,   112,   127,   130,   126,
-  125,   135,   159,   188,   213,   215,   201,   162,
-  119,    78,    50,    36,    35,    43,    48,    54,
-   56,    58,    71,    94,   123,   154,   170,   164,
-  144,   110,    83,    65,    61,    59,    58,    36,
-    2, 65493, 65438, 65399, 65366, 65352, 65356, 65368,
-65392, 65422, 65455, 65498,     2,    40,    61,    67,
-   50,    25, 65534, 65514, 65508, 65497, 65490, 65469,
-65447, 65429, 65413, 65417, 65420, 65436, 65451, 65474,
-65506,     4,    49,    88,   126,   159,   177,   190,
-  181,   158,   121,    76,    36,     2, 65514, 65493,
-65468, 65438, 65391, 65354, 65308, 65307, 65321, 65379,
-65448, 65510,    24,    46,    65,    79,   119,   153,
-  203,   217,   192,   106, 65487, 65277, 65047, 64830,
-64684, 64624, 64668, 64793, 64975, 65195, 65415,    98,
-  282,   425,   514,   537,   504,   406,   270,   116,
-65501, 65400, 65317, 65285, 65243, 65208, 65157, 65134,
-65124, 65172, 65229, 65316, 65381, 65452, 65481, 65504,
-65484, 65469, 65457, 65488,    15,    81,   106,    65,
-65488, 65351, 65225, 65151, 65128, 65157, 65217, 65295,
-65379, 65429, 65441, 65403, 65364, 65354, 65426,     8,
-  141,   227,   235,   187,   113,    66,    61,    93,
-  148,   187,   180,   114, 65504, 65331, 65173, 65108,
-65172, 65354,    62,   289,   428,   453,   374,   230,
-   82, 65522, 65506,    46,   157,   246,   249,   148,
-65521, 65367, 65286, 65310, 65407, 65530,    81,    97,
-   35, 65454, 65336, 65275, 65340,     3,   296,   598,
-  787,   799,   632,   346,    63, 65404, 65347, 65419,
-   20,   148,   207,   162,    38, 65419, 65300, 65274,
-65347, 65506,   159,   339,   468,   544,   559,   546,
-  519,   515,   545,   600,   655,   658,   577,   401,
-  154, 65415, 65168, 64996, 64919, 64965, 65093, 65276,
-65448,    16,    47,     5, 65492, 65474, 65513,    65,
-  159,   218,   211,   131, 65530, 65372, 65231, 65147,
-65140, 65204, 65326, 65462,    69,   199,   325,   455,
-  582,   697,   778,   801,   766,   657,   508,   313,
-  126, 65481, 65344, 65238, 65165, 65119, 65088, 65088,
-65105, 65169, 65243, 65339, 65411, 65451, 65440, 65374,
-65281, 65181, 65123, 65106, 65140, 65181, 65211, 65207,
-65190, 65188, 65245, 65365,     4,   203,   367,   495,
-  543,   535,   479,   395,   308,   227,   164,    96,
-   39, 65504, 65441, 65396, 65372, 65379, 65395, 65427,
-65449, 65484, 65523,    37,    99,   150,   186,   183,
-  127,    33, 65421, 65266, 65124, 65021, 64989, 65007,
-65069, 65148, 65225, 65299, 65375, 65463,    33,   150,
-  271,   386,   478,   544,   544,   483,   333,   130,
-65448, 65251, 65136, 65070, 65065, 65054, 65034, 64993,
-64966, 64978, 65055, 65184, 65357, 65533,   163,   293,
-  369,   395,   354,   270,   146,    22, 65435, 65334,
-65247, 65172, 65122, 65095, 65122, 65193, 65322, 65483,
-  132,   319,   494,   636,   724,   745,   680,   553,
-  369,   160, 65487, 65276, 65092, 64923, 64792, 64701,
-64660, 64668, 64722, 64820, 64956, 65122, 65308, 65495,
-  141,   294,   413,   481,   489,   436,   330,   205,
-   88,    13, 65510, 65502, 65499, 65496, 65497, 65519,
-   37,   131,   242,   373,   489,   601,   662,   678,
-  616,   500,   352,   208,   100,    26, 65509, 65462,
-65399, 65339, 65287, 65252, 65257, 65288, 65357, 65446,
-65521,    21, 65518, 65413, 65277, 65175, 65155, 65230,
-65376, 65522,    92,   120,    82,    19, 65508, 65505,
-   24,   104,   182,   215,   192,   133,    82,    87,
-  161,   286,   395,   439,   367,   199, 65507, 65296,
-65157, 65138, 65230, 65420,    92,   270,   356,   345,
-  265,   168,    98,    76,    82,    75,    52, 65523,
-65471, 65433, 65436, 65467, 65515,    14,    36,    13,
-65487, 65373, 65227, 65100, 65046, 65122, 65335,   110,
-  427,   644,   687,   514,   176, 65252, 64776, 64343,
-64017, 63832, 63802, 63932, 64197, 64582, 65028, 65522,
-  485,   961,  1384,  1680,  1789,  1667,  1307,   793,
-  231, 65277, 64941, 64762, 64704, 64711, 64734, 64765,
-64811, 64883, 65007, 65178, 65403,   120,   352,   524,
-  577,   524,   397,   263,   184,   147,   120,    28,
-65369, 65082, 64761, 64493, 64330, 64311, 64401, 64570,
-64752, 64915, 65044, 65147, 65268, 65413,    59,   247,
-  388,   471,   474,   445,   410,   398,   409,   421,
-  413,   364,   284,   181,    74, 65531, 65483, 65488,
-65535,    64,   148,   232,   353,   505,   690,   854,
-  930,   871,   665,   365,    48, 65320, 65151, 65057,
-65011, 64963, 64900, 64815, 64751, 64740, 64827, 65022,
-65290,    44,   273,   379,   356,   220,    55, 65463,
-65422, 65473,    45,   137,   161,    72, 65417, 65170,
-64942, 64783, 64748, 64820, 65003, 65247,     3,   306,
-  586,   818,   965,  1028,  1018,   964,   899,   838,
-  787,   723,   641,   516,   363,   194,    43, 65487,
-65465, 65524,    86,   170,   195,   108, 65479, 65273,
-65121, 65098, 65230, 65488,   250,   473,   569,   507,
-  377,   236,   172,   173,   206,   201,   101, 65447,
-65184, 64922, 64723, 64625, 64677, 64837, 65090, 65348,
-   28,   176,   268,   348,   465,   611,   772,   881,
-  901,   819,   672,   491,   351,   257,   231,   260,
-  305,   366,   409,   437,   451,   452,   445,   429,
-  395,   339,   249,   134, 65521, 65373, 65229, 65110,
-65019, 64935, 64849, 64750, 64646, 64585, 64587, 64685,
-64859, 65078, 65291, 65472,    64,   131,   141,    95,
-    6, 65441, 65353, 65304, 65298, 65331, 65380, 65439,
-65509,    37,   104,   135,   143,   101,    50, 65524,
-65490, 65487, 65517,    43,   134,   249,   376,   520,
-  643,   753,   815,   823,   765,   637,   448,   215,
-65496, 65245, 65016, 64837, 64731, 64704, 64758, 64863,
-64971, 65056, 65077, 65064, 65022, 65008, 65022, 65083,
-65160, 65229, 65261, 65232, 65165, 65057, 64978, 64924,
-64944, 65008, 65109, 65216, 65322, 65427,    15,   149,
-  293,   413,   487,   498,   454,   380,   306,   263,
-  255,   280,   322,   359,   391,   409,   427,   438,
-  446,   436,   406,   339,   257,   145,    48, 65497,
-65444, 65421, 65405, 65374, 65302, 65182, 65047, 64931,
-64892, 64936, 65050, 65176, 65252, 65257, 65181, 65083,
-65004, 64988, 65045, 65139, 65247, 65322, 65363, 65388,
-65431, 65533,   172,   405,   654,   860,   974,   970,
-  863,   701,   534,   417,   359,   346,   349,   325,
-  277,   202,   143,   116,   143,   207,   280,   344,
-  372,   378,   360,   336,   308,   262,   199,    92,
-65498, 65341, 65192, 65066, 64984, 64948, 64947, 64973,
-65003, 65046, 65086, 65139, 65191, 65240, 65264, 65255,
-65205, 65127, 65049, 65006, 65022, 65115, 65265, 65447,
-   87,   232,   330,   395,   426,   448,   453,   438,
-  401,   334,   251,   173,   114,    96,   128,   198,
-  313,   442,   576,   688,   762,   788,   757,   681,
-  561,   413,   252,    84, 65465, 65330, 65225, 65153,
-65116, 65112, 65131, 65185, 65253, 65345, 65441, 65515,
-   29,    17, 65506, 65416, 65322, 65235, 65177, 65143,
-65128, 65117, 65096, 65075, 65046, 65049, 65081, 65175,
-65316, 65503,   162,   343,   477,   563,   591,   596,
-  569,   555,   539,   534,   538,   532,   528,   501,
-  464,   403,   334,   255,   179,   110,    51, 65530,
-65472, 65406, 65340, 65269, 65219, 65182, 65186, 65211,
-65270, 65334, 65393, 65439, 65443, 65432, 65392, 65348,
-65296, 65244, 65175, 65097, 65004, 64921, 64865, 64865,
-64926, 65043, 65196, 65350, 65494,    70,   159,   228,
-  289,   337,   379,   387,   372,   305,   215,   104,
-   10, 65488, 65493,    17,   119,   230,   311,   359,
-  366,   352,   338,   317,   300,   251,   182,    68,
-65489, 65371, 65284, 65230, 65193, 65177, 65146, 65113,
-65068, 65027, 65001, 64996, 65012, 65049, 65086, 65123,
-65137, 65131, 65108, 65078, 65061, 65068, 65107, 65175,
-65265, 65370, 65480,    53,   154,   226,   268,   261,
-  207,   118,    20, 65472, 65433, 65442, 65496,    45,
-  135,   221,   290,   348,   397,   444,   481,   512,
-  511,   487,   426,   337,   235,   121,    16, 65460,
-65383, 65330, 65291, 65274, 65264, 65269, 65282, 65302,
-65331, 65359, 65385, 65405, 65415, 65416, 65413, 65407,
-65401, 65394, 65382, 65367, 65347, 65339, 65334, 65359,
-65391, 65459, 65527,    85,   171,   260,   336,   395,
-  430,   441,   423,   393,   345,   311,   271,   271,
-  276,   314,   366,   415,   463,   487,   496,   481,
-  457,   423,   392,   346,   307,   241,   186,   117,
-   63,    21, 65527, 65512, 65493, 65471, 65434, 65387,
-65337, 65292, 65263, 65251, 65260, 65281, 65310, 65329,
-65349, 65349, 65360, 65371, 65404, 65460, 65528,    74,
-  136,   187,   203,   202,   181,   169,   150,   158,
-  158,   172,   176,   181,   185,   190,   213,   244,
-  287,   335,   369,   386,   371,   329,   264,   197,
-  129,    85,    56,    39,    27,     2, 65499, 65454,
-65400, 65360, 65329, 65312, 65296, 65284, 65256, 65235,
-65205, 65192, 65189, 65198, 65209, 65211, 65200, 65164,
-65132, 65093, 65093, 65113, 65179, 65261, 65359, 65442,
-65502, 65531,     1, 65529, 65524, 65526,     2,    19,
-   27,    30,     8, 65525, 65487, 65469, 65447, 65449,
-65452, 65467, 65484, 65496, 65517, 65524,     6,     5,
-    7, 65525, 65499, 65461, 65418, 65370, 65334, 65304,
-65286, 65283, 65277, 65281, 65266, 65255, 65219, 65191,
-65153, 65126, 65107, 65101, 65106, 65116, 65127, 65140,
-65149, 65167, 65190, 65227, 65277, 65338, 65398, 65454,
-65485, 65503, 65497, 65484, 65478, 65486, 65527,    55,
-  138,   221,   296,   339,   359,   350,   330,   307,
-  286,   273,   252,   229,   182,   126,    54, 65523,
-65464, 65426, 65396, 65383, 65361, 65344, 65311, 65293,
-65279, 65289, 65326, 65365, 65414, 65439, 65435, 65412,
-65355, 65314, 65265, 65258, 65258, 65282, 65314, 65328,
-65351, 65347, 65362, 65375, 65413, 65466,     4,    82,
-  160,   223,   265,   288,   278,   262,   225,   203,
-  183,   187,   203,   238,   267,   296,   307,   300,
-  289,   265,   251,   243,   243,   244,   252,   243,
-  240,   226,   210,   198,   178,   160,   133,   100,
-   67,    37,    16,     7,     3,     3, 65531, 65512,
-65485, 65452, 65433, 65423, 65443, 65473, 65515,    17,
-   41,    47,    44,    33,    30,    42,    69,   112,
-  166,   221,   278,   321,   366,   393,   419,   427,
-  429,   410,   389,   348,   312,   267,   233,   205,
-  186,   183,   180,   190,   188,   185,   157,   121,
-   63,     3, 65484, 65441, 65426, 65430, 65453, 65484,
-65510, 65515, 65509, 65470, 65433, 65381, 65343, 65314,
-65303, 65305, 65320, 65338, 65369, 65399, 65437, 65479,
-65528,    34,    84,   111,   132,   130,   105,    67,
-   13, 65496, 65453, 65427, 65433, 65460, 65511,    33,
-   87,   124,   136,   128,   109,    88,    86,    95,
-  132,   163,   192,   189,   158,    91,    10, 65448,
-65367, 65293, 65240, 65197, 65163, 65143, 65143, 65173,
-65245, 65356, 65502,   111,   224,   269,   205,    37,
-65296, 64953, 64611, 64327, 64189, 64242, 64507, 64960,
-65522,   549,   990,  1204,  1137,   798,   271, 65202,
-64674, 64310, 64197, 64317, 64627, 65050, 65499,   373,
-  705,   923,  1031,   997,   840,   553,   176, 65311,
-64942, 64710, 64634, 64749, 64999, 65321,    91,   312,
-  414,   398,   305,   176,    52, 65502, 65441, 65425,
-65421, 65442, 65485, 65534,    62,   104,   105,    51,
-65461, 65289, 65096, 64928, 64818, 64797, 64857, 64992,
-65166, 65356,     0,   160,   286,   390,   455,   495,
-  496,   456,   380,   267,   139,    20, 65473, 65466,
-   14,   192,   438,   681,   865,   891,   742,   402,
-65496, 65053, 64747, 64670, 64870, 65283,   270,   741,
- 1031,  1067,   856,   483,    65, 65256, 65035, 64951,
-64939, 64950, 64923, 64876, 64836, 64881, 65045, 65346,
-  172,   530,   759,   812,   675,   402,    90, 65382,
-65268, 65319, 65491,   177,   360,   431,   361,   152,
-65405, 65108, 64894, 64821, 64918, 65187,    25,   435,
-  786,   998,  1042,   908,   651,   343,    51, 65378,
-65254, 65231, 65248, 65306, 65348, 65406, 65466,    21,
-  149,   289,   436,   528,   561,   499,   356,   155,
-65464, 65257, 65107, 65037, 65066, 65181, 65354,    17,
-  187,   297,   324,   264,   152,    16, 65435, 65361,
-65325, 65323, 65318, 65301, 65265, 65239, 65250, 65333,
-65498,   186,   426,   622,   710,   669,   500,   246,
-65509, 65293, 65170, 65187, 65299, 65491,   144,   293,
-  358,   337,   250,   133,    43, 65521,    13,    63,
-  148,   200,   197,   125, 65533, 65365, 65219, 65103,
-65058, 65071, 65124, 65194, 65244, 65275, 65274, 65267,
-65267, 65298, 65355, 65441, 65517,    43,    49,    13,
-65465, 65365, 65281, 65243, 65274, 65384,    14,   223,
-  417,   584,   672,   687,   620,   491,   324,   141,
-65493, 65332, 65185, 65082, 65004, 64992, 65027, 65145,
-65319,     5,   240,   441,   567,   592,   489,   289,
-   14, 65256, 64995, 64803, 64714, 64728, 64827, 64996,
-65189, 65385,    23,   153,   235,   269,   249,   198,
-  110,    16, 65451, 65362, 65297, 65251, 65242, 65254,
-65287, 65336, 65378, 65419, 65439, 65447, 65439, 65434,
-65429, 65452, 65484,     7,    64,   108,   132,   109,
-   63, 65524, 65455, 65402, 65395, 65430, 65513,    87,
-  199,   303,   365,   393,   367,   303,   201,    75,
-65476, 65341, 65236, 65155, 65134, 65149, 65225, 65322,
-65445,    17,   101,   139,   124,    56, 65489, 65372,
-65257, 65181, 65141, 65160, 65218, 65317, 65434,    24,
-  146,   257,   345,   422,   457,   475,   457,   411,
-  346,   265,   177,   109,    52,    30,    31,    51,
-   81,   113,   142,   161,   183,   190,   192,   167,
-  104,    11, 65415, 65272, 65150, 65063, 65058, 65124,
-65254, 65432,    64,   219,   311,   353,   337,   287,
-  213,   135,    63, 65533, 65465, 65398, 65313, 65226,
-65149, 65090, 65086, 65134, 65233, 65373, 65510,   105,
-  190,   236,   237,   214,   170,   123,    70,    16,
-65489, 65424, 65355, 65297, 65272, 65276, 65343, 65450,
-   62,   217,   345,   426,   431,   371,   264,   133,
-   17, 65463, 65411, 65387, 65395, 65401, 65424, 65437,
-65451, 65479, 65506,    24,    79,   151,   208,   253,
-  260,   229,   161,    64, 65497, 65403, 65343, 65320,
-65337, 65381, 65434, 65488, 65530,    31,    60,    86,
-  118,   139,   170,   179,   196,   198,   197,   202,
-  190,   198,   188,   189,   186,   175,   168,   153,
-  138,   125,   109,    91,    75,    46,    17, 65520,
-65488, 65475, 65470, 65490, 65526,    30,    74,   111,
-  134,   154,   148,   139,   103,    55, 65528, 65458,
-65395, 65348, 65321, 65332, 65378, 65457,    37,   150,
-  270,   353,   401,   403,   361,   292,   203,   105,
-   15, 65459, 65387, 65320, 65271, 65248, 65251, 65293,
-65371, 65480,    73,   202,   309,   387,   406,   383,
-  299,   187,    45, 65447, 65317, 65228, 65158, 65132,
-65121, 65144, 65173, 65231, 65293, 65378, 65462,    10,
-   71,    97,    86,    32, 65503, 65429, 65386, 65374,
-65402, 65462, 65530,    60,   104,   118,   107,    66,
-   18, 65501, 65452, 65413, 65375, 65338, 65301, 65258,
-65221, 65184, 65175, 65179, 65224, 65297, 65404, 65529,
-  134,   255,   359,   418,   431,   393,   316,   203,
-   87, 65495, 65402, 65314, 65276, 65253, 65280, 65319,
-65397, 65475,    36,   113,   185,   225,   239,   231,
-  194,   143,    85,    15, 65485, 65419, 65353, 65299,
-65260, 65239, 65254, 65291, 65358, 65447,     5,   104,
-  184,   245,   270,   268,   231,   184,   133,    85,
-   67,    42,    44,    25,     7, 65515, 65471, 65438,
-65395, 65372, 65345, 65339, 65333, 65354, 65380, 65437,
-65499,    44,   120,   193,   253,   299,   331,   353,
-  359,   356,   324,   275,   183,    69, 65462, 65316,
-65181, 65081, 65036, 65054, 65137, 65269, 65441,    80,
-  261,   404,   522,   592,   620,   602,   539,   441,
-  304,   157, 65522, 65372, 65233, 65134, 65077, 65062,
-65092, 65157, 65240, 65339, 65428, 65512,    46,   105,
-  161,   202,   238,   256,   253,   231,   194,   146,
-  109,    79,    71,    79,    97,   117,   125,   116,
-   86,    33, 65513, 65448, 65407, 65377, 65373, 65392,
-65417, 65462, 65505,    18,    75,   119,   162,   171,
-  164,   112,    44, 65486, 65390, 65295, 65223, 65166,
-65148, 65150, 65181, 65235, 65301, 65386, 65464,    16,
-   81,   135,   164,   159,   138,    82,    21, 65485,
-65424, 65363, 65329, 65301, 65299, 65313, 65347, 65397,
-65465, 65531,    66,   112,   148,   150,   138,   102,
-   62,    23, 65522, 65506, 65490, 65490, 65484, 65477,
-65464, 65442, 65421, 65400, 65382, 65378, 65372, 65381,
-65380, 65382, 65374, 65369, 65364, 65380, 65407, 65459,
-65526,    62,   138,   198,   242,   258,   249,   211,
-  151,    75, 65524, 65439, 65359, 65296, 65255, 65238,
-65249, 65276, 65324, 65376, 65434, 65490,    11,    62,
-  113,   157,   192,   219,   231,   235,   221,   210,
-  181,   154,   117,    68,    15, 65488, 65430, 65380,
-65359, 65356, 65388, 65435, 65490,    14,    53,    87,
-   88,    91,    64,    53,    25,    21,    19,    37,
-   59,    86,   102,   111,   100,    88,    67,    57,
-   48,    55,    51,    58,    47,    45,    33,    35,
-   35,    47,    60,    76,    87,    93,    84,    70,
-   48,    28,    17,     8,     6, 65534, 65515, 65490,
-65450, 65421, 65393, 65393, 65415, 65460, 65516,    38,
-   76,    98,    85,    53,     4, 65484, 65432, 65386,
-65355, 65334, 65329, 65327, 65343, 65356, 65388, 65421,
-65466, 65512,    25,    70,   106,   131,   141,   136,
-  121,    96,    62,    37,     3, 65521, 65503, 65494,
-65495, 65494, 65500, 65501, 65502, 65491, 65490, 65474,
-65479, 65474, 65489, 65500, 65528,    15,    46,    66,
-   85,    87,    87,    75,    62,    40,    22, 65535,
-65514, 65497, 65473, 65457, 65434, 65416, 65398, 65380,
-65377, 65373, 65390, 65409, 65440, 65476, 65513,    15,
-   50,    80,   103,   119,   124,   120,   111,    90,
-   78,    64,    54,    54,    46,    49,    47,    47,
-   55,    59,    63,    67,    57,    50,    32,    12,
-65531, 65507, 65504, 65494, 65504, 65515, 65525,     6,
-   10,    18,    18,    14,    14,    10,    20,    28,
-   41,    52,    54,    53,    40,    29,    12,     5,
-65530, 65533, 65527,     4,     2,    14,    13,     8,
-    6, 65525, 65519, 65501, 65489, 65481, 65479, 65496,
-65522,    31,    76,   123,   146,   164,   146,   129,
-   83,    48,     5, 65514, 65491, 65480, 65472, 65466,
-65469, 65468, 65477, 65493, 65500, 65526, 65529,    17,
-   20,    37,    42,    53,    60,    67,    77,    79,
-   86,    80,    73,    54,    34,     2, 65511, 65475,
-65455, 65432, 65428, 65430, 65444, 65466, 65495, 65526,
-   22,    53,    77,    94,    99,    91,    76,    49,
-   30,     8,     0,     3,    12,    36,    53,    70,
-   76,    69,    55,    33,    11, 65526, 65518, 65507,
-65516, 65517, 65529, 65534,     3,     7,     8,    11,
-   17,    15,    27,    24,    32,    37,    39,    50,
-   55,    72,    82,   100,   112,   116,   121,   110,
-   99,    84,    65,    53,    39,    39,    35,    42,
-   46,    47,    50,    40,    35,    18,     9, 65535,
-    1,     8,    27,    45,    61,    76,    78,    79,
-   75,    66,    66,    57,    59,    50,    46,    35,
-   22,     6, 65530, 65511, 65501, 65487, 65475, 65470,
-65464, 65466, 65475, 65484, 65499, 65512, 65525, 65531,
-    5,     1,     3, 65533, 65533, 65528, 65528, 65525,
-65521, 65514, 65504, 65486, 65469, 65448, 65430, 65417,
-65409, 65415, 65414, 65434, 65435, 65453, 65455, 65465,
-65469, 65477, 65484, 65496, 65507, 65517, 65527, 65530,
-65532, 65527, 65513, 65499, 65477, 65453, 65433, 65408,
-65397, 65379, 65378, 65365, 65376, 65371, 65388, 65392,
-65407, 65415, 65420, 65427, 65422, 65433, 65427, 65440,
-65439, 65447, 65454, 65456, 65462, 65464, 65462, 65465,
-65462, 65465, 65465, 65471, 65472, 65474, 65476, 65467,
-65469, 65460, 65465, 65469, 65475, 65488, 65490, 65501,
-65496, 65500, 65494, 65498, 65492, 65501, 65501, 65512,
-65525,     0,    19,    33,    47,    63,    68,    78,
-   71,    71,    56,    53,    42,    42,    41,    41,
-   45,    43,    44,    41,    38,    35,    29,    26,
-   22,    20,    21,    20,    29,    33,    40,    50,
-   52,    63,    65,    73,    75,    77,    75,    74,
-   66,    63,    49,    46,    33,    27,    23,    18,
-   23,    26,    37,    51,    67,    92,   104,   125,
-  126,   132,   125,   119,   110,    96,    91,    77,
-   80,    73,    81,    82,    85,    89,    86,    82,
-   69,    52,    30,     3, 65522, 65503, 65505, 65500,
-65519, 65525,    14,    29,    51,    69,    83,    90,
-   98,    95,    97,    95,    90,    93,    86,    83,
-   79,    65,    56,    36,    19,     1, 65524, 65516,
-65509, 65509, 65506, 65511, 65510, 65514, 65511, 65507,
-65503, 65500, 65506, 65516, 65531,     5,    12,     9,
-65533, 65520, 65495, 65475, 65453, 65435, 65425, 65417,
-65417, 65417, 65421, 65427, 65434, 65443, 65446, 65451,
-65450, 65451, 65454, 65459, 65458, 65464, 65454, 65454,
-65445, 65435, 65431, 65416, 65416, 65412, 65416, 65427,
-65436, 65447, 65460, 65474, 65489, 65505, 65505, 65512,
-65497, 65498, 65485, 65484, 65478, 65476, 65475, 65487,
-65502, 65521
-};
-
+// 3090 samples IMA-ADPCM (tools/pcm2adpcm.py)
+const uint8_t audio_clock[]={
+0xFF, 0x0A, 0x98, 0x99, 0x28, 0x54, 0x34, 0x23, 0xA8, 0xAE, 0x9A, 0x22,
+0x05, 0xA1, 0xDA, 0x99, 0x33, 0x05, 0xB1, 0xCB, 0xAB, 0x9D, 0xAC, 0x9A,
+0x08, 0x34, 0x25, 0x01, 0x90, 0x22, 0x33, 0xA0, 0xBF, 0xAD, 0x89, 0x63,
+0x54, 0x21, 0x11, 0x10, 0x98, 0xBA, 0xBC, 0x9B, 0x9A, 0x99, 0x10, 0x22,
+0x09, 0xBF, 0xAD, 0x8B, 0x09, 0x20, 0x11, 0x00, 0x1B, 0x2E, 0x5B, 0x54,
+0x34, 0x35, 0x34, 0x23, 0xA0, 0xCE, 0xCC, 0x99, 0x28, 0x52, 0x42, 0x12,
+0x01, 0xC9, 0xBC, 0xAC, 0x9B, 0x8A, 0x28, 0x52, 0x32, 0x33, 0x02, 0x80,
+0x00, 0x43, 0x83, 0xE9, 0xAC, 0x9A, 0x00, 0x10, 0x08, 0x42, 0x44, 0x81,
+0xDA, 0xAA, 0x80, 0xB8, 0xCE, 0xAC, 0x9A, 0x10, 0x32, 0x44, 0x43, 0x01,
+0xA9, 0xAB, 0x99, 0xC9, 0xBB, 0x1B, 0x40, 0x53, 0x44, 0x25, 0x23, 0x12,
+0xB9, 0xCD, 0xBA, 0xAA, 0xCA, 0xAD, 0x8B, 0x61, 0x24, 0x03, 0x11, 0x23,
+0x05, 0xF9, 0xDD, 0xCB, 0x9A, 0x21, 0x34, 0x25, 0x23, 0x01, 0xA8, 0xBC,
+0xAB, 0x8B, 0x99, 0x9A, 0x38, 0x63, 0x32, 0x11, 0x99, 0x28, 0x45, 0x90,
+0xBF, 0x9C, 0x08, 0x22, 0x23, 0xA0, 0x8A, 0x55, 0x24, 0x90, 0x9B, 0x18,
+0x23, 0xC8, 0xDF, 0x9B, 0x42, 0x44, 0x01, 0xA9, 0xAA, 0x18, 0x33, 0xC0,
+0xBD, 0x0A, 0x43, 0x02, 0xCA, 0xAB, 0x72, 0x36, 0x01, 0xCA, 0xBB, 0x18,
+0x22, 0x91, 0xCB, 0x9A, 0x52, 0x34, 0x12, 0x00, 0x09, 0x20, 0x02, 0xFC,
+0xCD, 0xAA, 0x08, 0x22, 0x14, 0x80, 0x89, 0x21, 0x13, 0xC0, 0xDC, 0xAA,
+0x10, 0x43, 0x24, 0x33, 0x24, 0x02, 0xC8, 0xCC, 0xBC, 0x9A, 0x8A, 0x09,
+0x20, 0x33, 0x23, 0xC8, 0xBD, 0x8A, 0x21, 0x81, 0x88, 0x75, 0x44, 0x23,
+0x81, 0xA9, 0xAB, 0xBA, 0xCA, 0xAA, 0x09, 0x21, 0x31, 0x53, 0x34, 0x82,
+0xEC, 0xCD, 0xAA, 0x08, 0x21, 0x23, 0x43, 0x34, 0x25, 0x22, 0x98, 0xCE,
+0xBC, 0x99, 0x80, 0x98, 0x08, 0x52, 0x44, 0x32, 0x01, 0xB8, 0xCB, 0xAC,
+0xAA, 0x89, 0x30, 0x46, 0x34, 0x33, 0x02, 0xBA, 0xBF, 0xBC, 0xBA, 0xAA,
+0x09, 0x31, 0x45, 0x43, 0x33, 0x12, 0x90, 0xCB, 0xAB, 0x89, 0x88, 0x10,
+0x63, 0x44, 0x33, 0x11, 0xDA, 0xBC, 0xAB, 0x99, 0xAB, 0x9A, 0x10, 0x45,
+0x22, 0xDA, 0xAD, 0x28, 0x44, 0x02, 0x99, 0x89, 0x32, 0x14, 0xB9, 0x0A,
+0x55, 0x13, 0xFA, 0xBC, 0x0A, 0x41, 0x43, 0x81, 0xA9, 0x89, 0x88, 0xA8,
+0x9A, 0x28, 0x32, 0xA1, 0xFD, 0xBC, 0x29, 0x47, 0x24, 0xA0, 0xDC, 0xAC,
+0x9A, 0x18, 0x52, 0x43, 0x33, 0x14, 0x91, 0xDB, 0xAC, 0x9A, 0x08, 0x80,
+0x01, 0x31, 0x43, 0x33, 0x80, 0xBB, 0x99, 0xB8, 0xDF, 0xAC, 0x8A, 0x21,
+0x33, 0x22, 0x33, 0x45, 0x12, 0x88, 0x88, 0x00, 0xA8, 0xDB, 0xAB, 0x0A,
+0x32, 0x44, 0x54, 0x34, 0x91, 0xDD, 0xBB, 0x9A, 0x98, 0x99, 0x89, 0x62,
+0x35, 0x13, 0xA8, 0xAB, 0x19, 0x23, 0xB1, 0xDF, 0xAB, 0x18, 0x53, 0x44,
+0x22, 0x02, 0x90, 0x98, 0x99, 0xBA, 0xCD, 0x9A, 0x19, 0x23, 0xB0, 0xCE,
+0x0B, 0x62, 0x24, 0x91, 0xA9, 0x09, 0x80, 0xDA, 0xBD, 0x9B, 0x30, 0x45,
+0x22, 0x11, 0x31, 0x23, 0xA1, 0xCD, 0x9A, 0x19, 0x20, 0x01, 0x81, 0x88,
+0xBA, 0xCE, 0xBD, 0xBB, 0xBA, 0xCA, 0xAB, 0x40, 0x46, 0x33, 0x22, 0x98,
+0xBA, 0x9B, 0x18, 0x33, 0x34, 0x14, 0xB0, 0xDA, 0x89, 0x32, 0x37, 0x35,
+0x33, 0x01, 0xDA, 0xDD, 0xBB, 0xAC, 0x89, 0x20, 0x22, 0x80, 0x89, 0x20,
+0x24, 0x91, 0xEB, 0xAA, 0x21, 0x44, 0x43, 0x43, 0x24, 0x82, 0xA9, 0x9A,
+0x18, 0x12, 0x12, 0x11, 0x90, 0xFB, 0xCD, 0xBB, 0x8A, 0xA8, 0xFB, 0xBC,
+0x18, 0x43, 0x02, 0xBB, 0x9B, 0x53, 0x24, 0x11, 0x51, 0x55, 0x24, 0x81,
+0xB9, 0xBA, 0x89, 0x80, 0xAA, 0x9A, 0x31, 0x34, 0x02, 0xA9, 0xCA, 0xDD,
+0xDC, 0xBA, 0x8A, 0x18, 0x11, 0x21, 0x23, 0x81, 0xCC, 0xAC, 0x41, 0x37,
+0x24, 0x12, 0x00, 0x80, 0xB9, 0xBB, 0x9B, 0x52, 0x45, 0x33, 0x12, 0xB9,
+0xDD, 0xCB, 0xAB, 0x9B, 0x09, 0x20, 0x42, 0x24, 0x81, 0xC9, 0xAC, 0x9A,
+0x88, 0x99, 0x09, 0x72, 0x46, 0x33, 0x23, 0x00, 0x89, 0x88, 0x80, 0x98,
+0xDA, 0xDB, 0xBA, 0xBA, 0xCB, 0xCB, 0xAA, 0x10, 0x44, 0x22, 0x80, 0xBB,
+0xCC, 0xDB, 0xBC, 0x89, 0x63, 0x34, 0x24, 0x12, 0x12, 0x01, 0xB8, 0xDC,
+0xAA, 0x20, 0x44, 0x12, 0x90, 0x88, 0xA9, 0xEC, 0xCB, 0x9A, 0x89, 0x98,
+0xAA, 0x89, 0x21, 0x33, 0x92, 0xCA, 0x1A, 0x65, 0x35, 0x34, 0x24, 0x00,
+0xCA, 0xBB, 0x09, 0x52, 0x43, 0x22, 0x12, 0x12, 0xA0, 0xDC, 0xCC, 0xAB,
+0xAB, 0x89, 0x88, 0x11, 0x22, 0x22, 0x00, 0x88, 0x99, 0xBB, 0xAC, 0x68,
+0x74, 0x63, 0x32, 0x23, 0x11, 0xA9, 0xAB, 0x8B, 0x40, 0x35, 0x13, 0x91,
+0xBB, 0xCC, 0xEB, 0xBB, 0xAC, 0x89, 0xA9, 0xCB, 0xCB, 0x8A, 0x20, 0x13,
+0x83, 0x12, 0x66, 0x34, 0x33, 0x00, 0x99, 0x09, 0x10, 0x10, 0x10, 0x54,
+0x35, 0x13, 0xD9, 0xBD, 0x9C, 0x99, 0xA8, 0xBB, 0xAD, 0x9A, 0x99, 0xAA,
+0x9C, 0x18, 0x01, 0xF9, 0xCA, 0x10, 0x46, 0x34, 0x02, 0x80, 0x80, 0x01,
+0x01, 0x9B, 0x9D, 0x0A, 0x10, 0x22, 0x23, 0x03, 0xD0, 0xDD, 0xCB, 0xAB,
+0x89, 0x19, 0x9A, 0xBE, 0xBB, 0x9A, 0x11, 0x32, 0x42, 0x64, 0x35, 0x34,
+0x12, 0x98, 0x08, 0x45, 0x45, 0x12, 0x81, 0x99, 0x89, 0x9A, 0xCC, 0xAD,
+0x9B, 0x8A, 0x99, 0x9B, 0x19, 0x44, 0x14, 0x98, 0xAD, 0x8C, 0x10, 0x12,
+0x82, 0x21, 0x55, 0x44, 0x33, 0x11, 0x88, 0xAB, 0x09, 0x51, 0x22, 0x81,
+0xB9, 0x9A, 0x08, 0xA1, 0xC8, 0xAC, 0xBC, 0xBE, 0xBC, 0x9A, 0x08, 0xBA,
+0xDD, 0x99, 0x42, 0x34, 0x02, 0x98, 0x18, 0x55, 0x34, 0x43, 0x22, 0x11,
+0x98, 0xDA, 0xCB, 0xAA, 0x0A, 0x18, 0x88, 0xCD, 0xCD, 0xAA, 0x09, 0x31,
+0x02, 0xD8, 0xDB, 0x9A, 0x09, 0x11, 0x24, 0x34, 0x25, 0x23, 0x01, 0xCB,
+0xCC, 0xAA, 0x20, 0x35, 0x14, 0x81, 0xA9, 0x18, 0x24, 0x83, 0xFB, 0xBE,
+0xBB, 0xAA, 0x9A, 0x20, 0x56, 0x44, 0x12, 0xCA, 0xBF, 0xBC, 0x09, 0x73,
+0x34, 0x12, 0xA8, 0xCD, 0xAA, 0x08, 0x42, 0x23, 0x13, 0x81, 0xC9, 0xBC,
+0x9C, 0x19, 0x33, 0x24, 0x81, 0x99, 0xAA, 0x09, 0x08, 0x21, 0x12, 0xB0,
+0xCF, 0xBC, 0x8A, 0x41, 0x53, 0x32, 0x22, 0x11, 0x90, 0xCB, 0xBC, 0x8A,
+0x73, 0x44, 0x82, 0xE9, 0xBC, 0x8A, 0x51, 0x43, 0x02, 0xBA, 0xBC, 0x99,
+0x80, 0x90, 0x08, 0x73, 0x43, 0x02, 0xB9, 0xBC, 0x19, 0x32, 0x13, 0xC9,
+0xBE, 0x9A, 0x41, 0x45, 0x12, 0x80, 0xCB, 0xAA, 0x89, 0x18, 0x10, 0x21,
+0x43, 0x23, 0xA1, 0xDD, 0xCB, 0x8A, 0x20, 0x53, 0x22, 0x90, 0xCA, 0x9A,
+0x09, 0x88, 0x99, 0x40, 0x47, 0x24, 0x81, 0xDB, 0xBB, 0x0A, 0x42, 0x33,
+0x81, 0xBB, 0xAA, 0x21, 0x33, 0xC8, 0xCF, 0xBA, 0x08, 0x21, 0x11, 0x88,
+0x10, 0x44, 0x33, 0x98, 0xBE, 0x9B, 0x51, 0x46, 0x23, 0x02, 0xBA, 0xCC,
+0xAC, 0xAA, 0x89, 0x30, 0x46, 0x33, 0x02, 0xDA, 0xCC, 0xAA, 0x89, 0x22,
+0x34, 0x23, 0x11, 0x98, 0xBB, 0xAC, 0xAA, 0x08, 0x22, 0x23, 0x11, 0x89,
+0x38, 0x74, 0x32, 0x91, 0xCC, 0xAC, 0x10, 0x45, 0x43, 0x11, 0xA9, 0xCC,
+0xBC, 0xBA, 0x08, 0x43, 0x34, 0x12, 0xA8, 0xCD, 0xAA, 0x09, 0x42, 0x34,
+0x34, 0x22, 0x01, 0xA8, 0xDB, 0xBB, 0x9A, 0x10, 0x22, 0x12, 0x12, 0xB8,
+0xFF, 0xCC, 0xAA, 0x28, 0x44, 0x24, 0x02, 0x98, 0xB9, 0xAA, 0xAB, 0xAD,
+0xAB, 0x28, 0x46, 0x43, 0x02, 0x80, 0xA9, 0xAA, 0xCB, 0xAB, 0x89, 0x55,
+0x44, 0x13, 0xA0, 0xCB, 0xBB, 0x99, 0x00, 0x01, 0x11, 0x42, 0x44, 0x22,
+0xA0, 0xDC, 0xBC, 0x8A, 0x20, 0x23, 0x23, 0x22, 0x22, 0x13, 0x02, 0x00,
+0x2A, 0x0A, 0xB9, 0xEB, 0xBB, 0xCC, 0xDB, 0xBC, 0x9C, 0x28, 0x35, 0x25,
+0x21, 0x98, 0xCC, 0xBD, 0xBB, 0x1A, 0x73, 0x35, 0x24, 0x81, 0xA9, 0xBC,
+0xCB, 0xBA, 0x99, 0x20, 0x64, 0x43, 0x23, 0x90, 0xCB, 0xBD, 0xAB, 0x9A,
+0x18, 0x21, 0x34, 0x25, 0x03, 0xA8, 0xBC, 0x8A, 0x41, 0x34, 0x11, 0xB8,
+0xDB, 0xBA, 0xAA, 0xCB, 0xAB, 0x09, 0x55, 0x36, 0x25, 0x12, 0x80, 0xCB,
+0xDB, 0xAA, 0x98, 0x11, 0x33, 0x35, 0x12, 0x91, 0xB9, 0xCC, 0xBB, 0xBB,
+0x9B, 0x31, 0x47, 0x43, 0x23, 0x00, 0xAA, 0xBB, 0xA9, 0xA0, 0xBA, 0xAE,
+0xAB, 0x8B, 0x39, 0x74, 0x53, 0x33, 0x23, 0x12, 0x00, 0xDB, 0xCE, 0xBD,
+0xAB, 0x09, 0x53, 0x44, 0x23, 0x13, 0x80, 0xC9, 0xDB, 0xAC, 0xAA, 0x89,
+0x20, 0x33, 0x24, 0x23, 0x22, 0x12, 0xA8, 0xDA, 0x9A, 0x19, 0x21, 0x90,
+0xEC, 0xCB, 0xAA, 0x18, 0x42, 0x43, 0x24, 0x12, 0xD8, 0xEB, 0xCB, 0x9A,
+0x09, 0x31, 0x53, 0x43, 0x22, 0x01, 0xC9, 0xBB, 0xBC, 0x9A, 0x18, 0x43,
+0x35, 0x24, 0x01, 0xB8, 0xBA, 0x9C, 0x88, 0x98, 0xB9, 0xBB, 0x9B, 0x29,
+0x08, 0xAA, 0x7A, 0x56, 0x45, 0x23, 0x12, 0xA9, 0xDC, 0xCB, 0xAB, 0x8A,
+0x10, 0x43, 0x43, 0x33, 0x43, 0x21, 0x81, 0x89, 0xBB, 0xDD, 0xCB, 0xBB,
+0x89, 0x43, 0x34, 0x23, 0x00, 0x9B, 0x9B, 0x30, 0x63, 0x11, 0x99, 0xAB,
+0x1A, 0x18, 0x8B, 0x0C, 0x40, 0x34, 0x23, 0xDB, 0xBD, 0xAA, 0xA0, 0xDD,
+0xAD, 0x8A, 0x62, 0x34, 0x12, 0xA9, 0xCC, 0xBB, 0xAA, 0x08, 0x11, 0x35,
+0x44, 0x33, 0x23, 0x80, 0xB9, 0xAE, 0xAA, 0x8A, 0x08, 0x00, 0xB0, 0xD0,
+0x91, 0x33, 0x37, 0x24, 0x02, 0xA8, 0xCA, 0xCB, 0xBB, 0xAC, 0xAC, 0xAB,
+0x89, 0x34, 0x46, 0x43, 0x23, 0x22, 0x80, 0xBA, 0xBA, 0x0A, 0x0A, 0x08,
+0x13, 0x22, 0xAE, 0xBE, 0xBC, 0xA9, 0x32, 0x52, 0x11, 0x90, 0x98, 0x33,
+0x26, 0x81, 0xBC, 0x9D, 0x1B, 0x4A, 0x38, 0x98, 0xF9, 0xB9, 0x9B, 0x59,
+0x65, 0x43, 0x11, 0x99, 0xBC, 0xAC, 0x99, 0x88, 0x80, 0x21, 0x61, 0x20,
+0x30, 0x20, 0x21, 0x02, 0xA2, 0xFA, 0xCC, 0xDB, 0xAA, 0x08, 0x32, 0x35,
+0x34, 0x22, 0x90, 0xDA, 0xBA, 0x08, 0x51, 0x22, 0x91, 0xCB, 0xBC, 0xA9,
+0x82, 0x13, 0x11, 0x11, 0x92, 0x87, 0x22, 0x40, 0x51, 0x42, 0x03, 0xB1,
+0xDB, 0xAC, 0x0B, 0x29, 0x01, 0xC1, 0xF9, 0xA9, 0x20, 0x34, 0x24, 0x81,
+0xB8, 0xB0, 0xB1, 0xDA, 0xCC, 0xCB, 0xBA, 0x9A, 0x0A, 0x43, 0x44, 0x13,
+0x92, 0xA0, 0xA0, 0xB0, 0xCB, 0xFC, 0xBB, 0xAC, 0x19, 0x58, 0x30, 0x20,
+0x20, 0x42, 0x33, 0x13, 0xB1, 0xCE, 0xBD, 0xDB, 0xA9, 0xA8, 0x92, 0x04,
+0x23, 0x20, 0x39, 0x5A, 0x28, 0x12, 0x12, 0x29, 0x2A, 0x30, 0x12, 0xD2,
+0xB0, 0x12, 0x73, 0x31, 0x19, 0x2B, 0x4B, 0x40, 0x25, 0x35, 0x42, 0x20,
+0x89, 0x8C, 0x8A, 0x08, 0x91, 0xA1, 0xB9, 0xBB, 0xAB, 0x91, 0x25, 0x42,
+0x41, 0x30, 0x01, 0x09, 0x9D, 0x9D, 0x9C, 0x99, 0x11, 0x35, 0x55, 0x31,
+0x10, 0x99, 0xBA, 0xCA, 0xA0, 0x03, 0x11, 0xB9, 0xCF, 0xBD, 0xBB, 0x80,
+0x14, 0x15, 0x24, 0x11, 0x81, 0x80, 0x19, 0x9A, 0xE9, 0xCA, 0xCB, 0xAA,
+0x09, 0x19, 0x18, 0x99, 0x9A, 0x73, 0x33, 0x92, 0xBC, 0xCF, 0xAA, 0x9A,
+0x00, 0x10, 0x22, 0x21, 0x19, 0x31, 0x39, 0x0D, 0xBC, 0xE9, 0x90, 0x31,
+0x43, 0x34, 0x34, 0x10, 0x0C, 0x9B, 0x99, 0x58, 0x54};
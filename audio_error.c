@@ -1,2140 +1,717 @@
 #include "stm32f7xx_hal.h"
 
-const uint16_t audio_error[]={
-    0,     0,     0,     0, 65535,     0,     2,     0,
-65534,     0,     2,     0, 65534,     0,     2,     1,
-65535, 65534,     1,     2, 65535, 65535,     1,     0,
-65535,     1,     1, 65535,     0, 65535, 65535,     3,
-    1, 65532, 65535,     4,     2, 65533, 65534,     2,
-    2, 65533, 65534,     4,     1, 65532,     0,     4,
-65535, 65533,     1,     1, 65535,     0,     1,     0,
-65535,     1,     0, 65535,     1,     0,     0,     1,
-65535, 65534,     1,     3, 65535, 65533,     0,     2,
-    3, 65535, 65532,     0,     3,     1, 65534, 65535,
-    1,     0, 65535,     1,     2, 65534, 65534,     3,
-    1, 65532,     0,     3, 65535, 65535,     1, 65535,
-    0,     3, 65535, 65532,     1,     3,     0, 65534,
-    0,     1,     0, 65535,     0,     2,     0, 65534,
-    0,     3,     0, 65533,     0,     1,     1,     0,
-65534, 65535,     2,     3, 65535, 65533,     0,     2,
-    1, 65535, 65535, 65535,     1,     3, 65535, 65532,
-    1,     4, 65535, 65533,     2,     2, 65534, 65535,
-    1,     0,     0,     0,     0,     0,     0,     1,
-    1, 65534, 65533,     3,     4, 65533, 65532,     2,
-    4, 65535, 65532,     0,     3,     1, 65535, 65535,
-65535,     0,     2,     1, 65534, 65534,     1,     3,
-    0, 65533,     0,     2,     0, 65535,     0,     0,
-65535,     1,     1, 65535, 65535,     0,     1,     1,
-    0, 65535,     0,     1,     0,     0,     0, 65535,
-    0,     0,     0,     2,     0, 65533,     0,     3,
-65535, 65533,     2,     2, 65534,     0,     0,     0,
-    1,     0, 65534, 65535,     2,     0, 65535,     1,
-    0, 65534,     0,     3,     0, 65532,     0,     5,
-    0, 65530,     0,     6,     1, 65531, 65533,     4,
-    3, 65534, 65534, 65535,     1,     3,     0, 65533,
-    0,     3,     0, 65534,     0,     1,     1,     0,
-65534, 65535,     3,     2, 65534, 65534,     1,     2,
-65535, 65534,     2,     1, 65534,     0,     2,     0,
-65534,     0,     2,     0, 65534, 65535,     2,     1,
-65534, 65535,     3,     1, 65533, 65535,     2,     1,
-    0, 65534, 65534,     2,     3, 65534, 65533,     2,
-    3, 65535, 65534,     1,     1, 65535, 65535,     0,
-    1,     1,     0, 65535, 65535,     1,     1, 65535,
-65535,     0,     1,     1, 65534, 65535,     3,     1,
-65533, 65535,     2,     1, 65535,     0, 65535, 65535,
-    2,     1, 65534, 65535,     2,     1, 65535, 65535,
-    0,     1,     0, 65535, 65535,     1,     2,     1,
-65535, 65533,     0,     3,     0, 65533,     0,     2,
-    0, 65535, 65535,     0,     2,     1, 65533, 65534,
-    4,     3, 65532, 65532,     4,     3, 65532, 65534,
-    3,     2, 65534, 65534,     2,     2, 65534, 65533,
-    2,     4, 65534, 65532,     2,     4, 65534, 65533,
-    1,     1,     0,     1,     0, 65533,     1,     4,
-65534, 65533,     2,     1, 65534,     0,     1, 65535,
-    0,     1, 65535,     1,     2, 65534, 65534,     1,
-    2,     0, 65534, 65535,     1,     2,     0, 65535,
-    0, 65535,     0,     2,     0, 65534, 65535,     2,
-    1, 65534,     0,     2,     0, 65533,     0,     3,
-    0, 65533, 65535,     2,     2,     0, 65534, 65535,
-    1,     1,     1, 65535, 65534,     1,     3, 65535,
-65532,     2,     3, 65533, 65535,     4,     1, 65532,
-65535,     2,     0, 65535,     1,     0, 65535,     2,
-    2, 65533, 65533,     2,     2, 65535,     0,     1,
-65534, 65535,     4,     1, 65533, 65535,     1,     1,
-    1, 65535, 65533,     1,     3, 65535, 65535,     2,
-65535, 65533,     1,     2, 65535, 65535,     0,     1,
-    2,     0, 65533,     0,     3, 65534, 65533,     3,
-    2, 65533,     0,     2, 65535,     0,     1, 65535,
-    0,     1, 65535, 65535,     1,     1, 65535, 65534,
-    1,     3,     0, 65533, 65535,     3,     1, 65533,
-65534,     2,     3, 65535, 65534,     0,     0,     2,
-    1, 65533, 65534,     3,     2, 65534, 65535,     1,
-    0, 65535,     1,     1, 65535, 65534,     0,     3,
-    1, 65534, 65535,     0,     2,     2, 65533, 65533,
-    4,     2, 65531,     0,     5, 65535, 65532,     1,
-    2,     0,     0,     0, 65534, 65534,     3,     4,
-65533, 65531,     4,     6, 65531, 65531,     5,     3,
-65532, 65534,     2,     2,     1, 65534, 65533,     3,
-    3, 65531, 65534,     5,     0, 65532,     2,     4,
-65534, 65533,     0,     1,     2,     1, 65532, 65532,
-    6,     8, 65527, 65524,    14,    16, 65515, 65513,
-   33,    34, 65480, 65480,   609,   602,  1365,  1376,
- 1032,  1065,   756,   799,   796,   841,   843,   892,
-  623,   676, 65365, 65414, 64860, 64888, 65208, 65206,
-65071, 65070, 65130, 65114, 65482, 65470,    35,    31,
-  647,   638,  1284,  1300,  1544,  1579,  1522,  1585,
- 1648,  1722,  1580,  1670,   761,   849, 65128, 65204,
-64279, 64325, 64093, 64092, 63997, 63979, 63687, 63649,
-63678, 63612, 63965, 63894, 63960, 63881, 63658, 63578,
-63302, 63220, 62739, 62640, 62281, 62164, 62614, 62476,
-63587, 63436, 64764, 64621,   351,   249,  1041,   968,
- 1225,  1198,   899,   903,   187,   205, 65207, 65213,
-64934, 64929, 65034, 65007,   293,   260,  1681,  1649,
- 2983,  2992,  3865,  3912,  4637,  4751,  5499,  5661,
- 6040,  6262,  6212,  6476,  6031,  6325,  5297,  5619,
- 4491,  4810,  3683,  3984,  2870,  3147,  1915,  2153,
-  708,   908, 64881, 65036, 63538, 63632, 62056, 62079,
-60456, 60405, 59374, 59249, 59201, 59006, 59813, 59576,
-60915, 60650, 62153, 61911, 63245, 63020, 63945, 63778,
-64258, 64132, 64271, 64181, 64060, 63975, 64018, 63947,
-64347, 64272, 64767, 64708, 64942, 64885, 64666, 64625,
-64231, 64181, 63984, 63913, 63671, 63594, 63148, 63057,
-62458, 62342, 61827, 61683, 61474, 61290, 61483, 61270,
-61880, 61649, 62658, 62420, 63797, 63561, 65023, 64818,
-  438,   268,   809,   696,   590,   503,    55, 65535,
-65134, 65075, 64879, 64814, 65032, 64957,   262,   179,
- 1616,  1545,  3139,  3093,  4288,  4303,  4734,  4817,
- 4448,  4579,  3663,  3819,  2638,  2810,  1561,  1716,
-  637,   752,    35,   110, 65222, 65271, 64987, 65011,
-64742, 64746, 64491, 64481, 64318, 64294, 64331, 64301,
-64473, 64430, 64660, 64632, 64868, 64828, 65086, 65077,
-65431, 65412,   301,   305,   648,   656,   757,   793,
-  716,   757,   524,   584,   152,   210, 65135, 65190,
-64523, 64573, 64030, 64052, 63667, 63667, 63425, 63401,
-63425, 63377, 63643, 63586, 64141, 64063, 64911, 64835,
-  323,   266,  1267,  1230,  1928,  1926,  2233,  2256,
- 2154,  2209,  1820,  1906,  1560,  1645,  1584,  1657,
- 2025,  2101,  2796,  2864,  3661,  3744,  4392,  4501,
- 4851,  4995,  5130,  5305,  5294,  5503,  5531,  5753,
- 5896,  6129,  6258,  6527,  6313,  6607,  5689,  6012,
- 4397,  4720,  2627,  2931,   578,   843, 63862, 64058,
-61592, 61700, 59685, 59708, 58438, 58367, 57947, 57781,
-58274, 58014, 59418, 59108, 61198, 60892, 63194, 62909,
-64892, 64663,   460,   302,   973,   908,  1128,  1143,
- 1063,  1112,   819,   874,   557,   625,   515,   571,
-  720,   760,   803,   838,   380,   400, 64992, 64996,
-63883, 63864, 62907, 62857, 62350, 62257, 62421, 62313,
-63334, 63218, 64891, 64810,  1100,  1039,  2379,  2378,
- 2923,  2976,  2857,  2972,  2603,  2727,  2555,  2691,
- 2967,  3116,  3876,  4044,  5145,  5349,  6354,  6615,
- 6873,  7200,  6426,  6768,  5192,  5572,  3527,  3904,
- 1700,  1986, 65420,    75, 63687, 63824, 62134, 62210,
-60809, 60817, 59647, 59520, 58657, 58446, 58005, 57748,
-57824, 57479, 58116, 57697, 58774, 58341, 59738, 59289,
-60921, 60520, 62300, 61951, 63750, 63455, 65057, 64826,
-  416,   282,   716,   650,   429,   371, 65329, 65246,
-64564, 64464, 63780, 63688, 63020, 62933, 62271, 62172,
-61553, 61455, 60905, 60824, 60515, 60424, 60593, 60445,
-61357, 61152, 62846, 62562, 64767, 64440,  1081,   784,
- 2463,  2286,  3268,  3213,  3458,  3531,  3136,  3286,
- 2564,  2740,  2078,  2223,  1886,  1966,  2050,  2080,
- 2528,  2537,  3281,  3318,  4327,  4441,  5556,  5791,
- 6864,  7218,  8153,  8615,  9261,  9838, 10021, 10715,
-10201, 10965,  9579, 10370,  8118,  8882,  5981,  6645,
- 3501,  4032,   932,  1300, 64036, 64249, 61849, 61910,
-59837, 59756, 58013, 57780, 56455, 56096, 55574, 55015,
-55548, 54784, 56306, 55489, 57767, 56949, 59637, 58866,
-61589, 60935, 63297, 62820, 64584, 64337, 65440, 65383,
-  429,   413,   596,   666,   579,   667,   431,   496,
-   11,    84, 64824, 64857, 63951, 63906, 63179, 63085,
-62890, 62733, 63233, 63026, 64226, 63973,    49, 65393,
- 1519,  1399,  2788,  2757,  3761,  3747,  4401,  4452,
- 4877,  5000,  5426,  5635,  6113,  6375,  6839,  7205,
- 7696,  8181,  8713,  9284,  9706, 10353, 10411, 11120,
-10711, 11414, 10549, 11183,  9820, 10409,  8516,  9046,
- 6576,  7098,  4148,  4660,  1464,  1949, 64230, 64657,
-61566, 61878, 59176, 59318, 57346, 57292, 56319, 56030,
-56126, 55615, 56572, 55874, 57381, 56598, 58320, 57476,
-59094, 58195, 59413, 58539, 59274, 58462, 58794, 58043,
-58212, 57556, 57751, 57173, 57451, 56934, 57087, 56646,
-56509, 56118, 55679, 55389, 54627, 54417, 53470, 53329,
-52600, 52521, 52442, 52406, 53355, 53303, 55400, 55263,
-58359, 58087, 61815, 61431, 65130, 64700,  2290,  1858,
- 4195,  3833,  5342,  5070,  5835,  5711,  5919,  5933,
- 5826,  5941,  5781,  5947,  5853,  6042,  6081,  6272,
- 6346,  6596,  7103,  7082,  8279,  7965,  9523,  9455,
-11283, 11448, 13272, 13558, 14919, 15368, 15729, 16430,
-15329, 16499, 14088, 15470, 12298, 13455,  9682, 10783,
- 6885,  7785,  4162,  4780,  1546,  1987, 65122, 65175,
-63628, 63282, 62405, 61802, 61465, 60726, 61004, 60008,
-60782, 59619, 60520, 59505, 60409, 59728, 60727, 60343,
-61578, 61328, 62461, 62494, 63042, 63487, 63290, 64031,
-63098, 63963, 62284, 63329, 61034, 62283, 59638, 61006,
-58306, 59832, 57506, 59054, 57629, 58885, 58568, 59310,
-60025, 60205, 61729, 61396, 63362, 62697, 64722, 63944,
-  180, 65047,   851,   439,  1374,  1152,  1700,  1623,
- 1951,  1936,  2368,  2135,  2975,  2371,  3711,  2777,
- 4596,  3487,  5767,  4469,  7072,  5544,  8157,  6551,
- 8828,  7294,  8947,  7587,  8341,  7254,  7120,  6262,
- 5391,  4688,  3378,  2769,  1179,   672, 64440, 64108,
-62235, 62182, 60349, 60664, 58827, 59584, 57657, 58900,
-57017, 58518, 56914, 58340, 57242, 58361, 57810, 58478,
-58404, 58597, 58850, 58691, 59115, 58776, 59291, 58892,
-59470, 59102, 59592, 59300, 59624, 59389, 59561, 59283,
-59281, 59042, 58744, 58622, 58008, 58192, 57413, 57893,
-57288, 57994, 57638, 58564, 58524, 59750, 59952, 61781,
-61816, 63875, 63920,   232,   456,  2107,  2298,  3736,
- 3822,  4899,  4976,  5467,  5720,  5536,  6068,  5685,
- 6039,  5799,  5859,  5683,  5734,  5887,  5839,  6218,
- 6205,  6767,  6905,  7696,  7965,  8697,  9232,  9643,
-10452, 10547, 11401, 11413, 11973, 11912, 12161, 11902,
-11975, 11536, 11432, 10996, 10489, 10226,  9261,  9011,
- 7811,  7475,  6268,  5943,  4687,  4398,  3214,  2781,
- 1954,  1303,  1001,    32,   327, 64422, 65328, 63597,
-64840, 63197, 64375, 63081, 64049, 63218, 63969, 63565,
-64141, 64003, 64375, 64395, 64428, 64490, 64183, 64264,
-63586, 63815, 62659, 63170, 61576, 62547, 60589, 62218,
-59950, 62206, 59736, 62396, 59969, 62778, 60623, 63474,
-61613, 64394, 62839, 65310, 64182,   625, 65471,  1257,
-  952,  1636,  1597,  1862,  1755,  1863,  1481,  1613,
-  947,  1065,   507,   467,   459,    70,  1009,    64,
- 2061,   393,  3450,  1068,  4896,  2110,  6160,  3366,
- 7012,  4480,  7310,  5121,  7016,  5050,  6176,  4246,
- 4839,  2784,  3029,   872,   862, 64250, 64099, 62116,
-61869, 60320, 59813, 58925, 58010, 57819, 56519, 56925,
-55507, 56185, 54999, 55729, 54985, 55589, 55421, 55607,
-56224, 55708, 57252, 55875, 58268, 56120, 59004, 56369,
-59281, 56505, 59077, 56467, 58489, 56298, 57672, 56088,
-56731, 55793, 55879, 55421, 55192, 54911, 54734, 54369,
-54459, 53990, 54422, 54021, 54807, 54663, 55803, 56044,
-57433, 58169, 59584, 60836, 62057, 63625, 64615,   594,
- 1363,  2500,  3102,  3718,  4090,  4333,  4484,  4492,
- 4604,  4512,  4883,  4693,  5576,  5249,  6774,  6209,
- 8394,  7455, 10222,  8876, 11966, 10385, 13357, 11883,
-14349, 13314, 15070, 14592, 15509, 15592, 15559, 16208,
-15203, 16421, 14434, 16238, 13373, 15701, 12045, 14814,
-10555, 13670,  9072, 12341,  7625, 10765,  6184,  8910,
- 4697,  6782,  3146,  4501,  1635,  2232,   278,   125,
-64713, 63897, 63902, 62655, 63350, 61918, 62996, 61703,
-62663, 61849, 62233, 62111, 61564, 62214, 60650, 61964,
-59468, 61282, 58076, 60270, 56612, 59078, 55296, 57964,
-54301, 57100, 53796, 56626, 53892, 56607, 54684, 57000,
-56075, 57731, 57810, 58727, 59624, 59975, 61304, 61397,
-62701, 62835, 63658, 64105, 64155, 65068, 64341,    92,
-64409,   235, 64581,   139, 65026,    21,   309,   120,
- 1604,   534,  3359,  1336,  5451,  2510,  7601,  3918,
- 9465,  5265, 10785,  6359, 11381,  7015, 11083,  7138,
- 9902,  6647,  7974,  5552,  5609,  3985,  3082,  2140,
-  655,   297, 63994, 64122, 62038, 62570, 60358, 61292,
-59042, 60448, 58252, 60089, 58126, 60117, 58637, 60381,
-59664, 60763, 60931, 61239, 62150, 61642, 63045, 61914,
-63475, 62059, 63423, 62140, 62960, 62208, 62221, 62103,
-61308, 61721, 60253, 60980, 59091, 59983, 57841, 58879,
-56658, 57944, 55847, 57415, 55664, 57516, 56265, 58365,
-57670, 59799, 59700, 61529, 62009, 63291, 64286, 64923,
-  688,   748,  2213,  1744,  3325,  2335,  4135,  2626,
- 4814,  2798,  5568,  3003,  6516,  3374,  7742,  4031,
- 9263,  5077, 10965,  6524, 12729,  8269, 14385, 10159,
-15712, 11998, 16589, 13570, 16878, 14781, 16480, 15540,
-15571, 15821, 14276, 15638, 12794, 15027, 11268, 14118,
- 9822, 12974,  8435, 11591,  7108,  9982,  5801,  8130,
- 4456,  6062,  3065,  3927,  1578,  1797,    36, 65381,
-64010, 63714, 62491, 62518, 61066, 61756, 59800, 61302,
-58665, 60965, 57531, 60561, 56266, 59902, 54818, 58941,
-53150, 57648, 51332, 56137, 49578, 54580, 48181, 53125,
-47440, 52036, 47493, 51451, 48369, 51426, 49953, 52024,
-51951, 53186, 54056, 54729, 56059, 56529, 57828, 58417,
-59328, 60193, 60578, 61726, 61664, 62932, 62656, 63736,
-63625, 64233, 64643, 64525,   233, 64848,  1611, 65377,
- 3345,   678,  5511,  1788,  7989,  3113, 10536,  4517,
-12814,  5910, 14487,  7149, 15347,  8089, 15311,  8621,
-14391,  8611, 12727,  8104, 10506,  7113,  7954,  5718,
- 5342,  4057,  2883,  2258,   813,   537, 64658, 64569,
-63376, 63352, 62577, 62441, 62235, 61820, 62181, 61527,
-62384, 61562, 62753, 61921, 63284, 62534, 63808, 63285,
-64123, 64039, 64161, 64612, 63791, 64834, 63020, 64636,
-61939, 64104, 60657, 63355, 59344, 62498, 58198, 61676,
-57428, 61051, 57120, 60805, 57292, 61033, 57973, 61690,
-59121, 62686, 60612, 63956, 62262, 65331, 63937,  1159,
-65487,  2346,  1223,  3200,  2149,  3664,  2761,  3795,
- 3214,  3695,  3673,  3453,  4339,  3259,  5340,  3332,
- 6599,  3804,  8045,  4705,  9529,  5942, 10837,  7374,
-11828,  8818, 12400, 10029, 12579, 10847, 12425, 11235,
-11967, 11166, 11287, 10710, 10503, 10032,  9613,  9184,
- 8656,  8151,  7621,  6930,  6537,  5575,  5426,  4078,
- 4301,  2524,  3178,  1015,  2034, 65246,   914, 64237,
-65353, 63543, 64273, 63151, 63175, 62971, 62000, 62800,
-60731, 62444, 59343, 61862, 57851, 61037, 56254, 59938,
-54634, 58596, 53061, 57085, 51627, 55497, 50472, 53977,
-49673, 52667, 49352, 51731, 49546, 51282, 50238, 51438,
-51319, 52312, 52663, 53829, 54129, 55734, 55623, 57798,
-57039, 59693, 58281, 61267, 59370, 62392, 60331, 63058,
-61281, 63377, 62346, 63522, 63515, 63642, 64820, 63932,
-  748, 64513,  2388, 65405,  4168,  1031,  5960,  2402,
- 7644,  3804,  9172,  5065, 10309,  6071, 10922,  6708,
-10936,  6926, 10327,  6713,  9226,  6067,  7766,  5065,
- 6113,  3727,  4411,  2189,  2861,   578,  1567, 64580,
-  555, 63222, 65351, 62127, 64826, 61394, 64526, 61058,
-64447, 61125, 64557, 61553, 64799, 62251, 65063, 63084,
-65188, 63847, 65038, 64385, 64537, 64594, 63719, 64391,
-62635, 63776, 61441, 62838, 60245, 61757, 59178, 60673,
-58350, 59771, 57856, 59239, 57755, 59170, 58091, 59606,
-58843, 60470, 59937, 61672, 61240, 63051, 62589, 64474,
-63840,   227, 64929,  1322,   279,  2185,  1014,  2823,
- 1739,  3314,  2595,  3724,  3681,  4184,  4991,  4819,
- 6508,  5676,  8050,  6686,  9481,  7799, 10672,  8917,
-11575,  9964, 12150, 10820, 12383, 11398, 12306, 11667,
-11981, 11622, 11474, 11347, 10800, 10851,  9962, 10157,
- 9031,  9311,  8065,  8380,  7138,  7419,  6279,  6488,
- 5512,  5605,  4827,  4870,  4240,  4280,  3691,  3779,
- 3073,  3356,  2312,  2995,  1330,  2577,   112,  1993,
-64187,  1152, 62496,    52, 60625, 64188, 58629, 62557,
-56602, 60741, 54606, 58841, 52768, 56980, 51213, 55276,
-50099, 53857, 49525, 52815, 49489, 52208, 49951, 52161,
-50781, 52632, 51832, 53565, 53020, 54842, 54253, 56318,
-55469, 57836, 56595, 59245, 57701, 60462, 58867, 61452,
-60155, 62253, 61522, 62938, 62987, 63620, 64603, 64408,
-  798, 65364,  2743,   984,  4756,  2328,  6776,  3754,
- 8687,  5163, 10345,  6443, 11636,  7455, 12411,  8130,
-12644,  8441, 12416,  8373, 11768,  7911, 10718,  7051,
- 9331,  5799,  7716,  4275,  5957,  2584,  4150,   870,
- 2429, 64858,   894, 63573, 65221, 62684, 64416, 62221,
-64045, 62183, 64046, 62509, 64253, 63061, 64520, 63720,
-64661, 64368, 64535, 64852, 64062, 65045, 63271, 64904,
-62277, 64407, 61161, 63628, 60022, 62660, 58989, 61646,
-58149, 60767, 57554, 60163, 57280, 59914, 57359, 60033,
-57794, 60496, 58496, 61221, 59369, 62120, 60298, 63060,
-61214, 63935, 62079, 64669, 62903, 65301, 63759,   294,
-64640,   792,   131,  1279,  1352,  1823,  2786,  2465,
- 4311,  3208,  5818,  4015,  7253,  4881,  8553,  5749,
- 9663,  6600, 10496,  7362, 11057,  8012, 11326,  8488,
-11339,  8732, 11122,  8735, 10687,  8469, 10075,  7940,
- 9344,  7243,  8599,  6457,  7884,  5661,  7271,  4940,
- 6827,  4325,  6572,  3842,  6448,  3498,  6327,  3285,
- 6111,  3214,  5752,  3209,  5183,  3211,  4379,  3138,
- 3306,  2857,  1951,  2298,   349,  1396, 64089,   169,
-62128, 64218, 60089, 62545, 58082, 60850, 56272, 59278,
-54812, 57938, 53751, 56926, 53157, 56290, 52989, 56072,
-53235, 56299, 53801, 56934, 54561, 57873, 55402, 58992,
-56256, 60211, 57129, 61390, 58036, 62465, 59004, 63371,
-60064, 64139, 61281, 64841, 62700,    17, 64310,   770,
-  498,  1556,  2328,  2358,  4214,  3142,  6040,  3923,
- 7675,  4673,  9036,  5351, 10070,  5915, 10730,  6313,
-10991,  6471, 10802,  6347, 10188,  5884,  9174,  5038,
- 7803,  3829,  6131,  2289,  4267,   517,  2345, 64166,
-  503, 62353, 64409, 60733, 63019, 59432, 61958, 58493,
-61202, 57967, 60735, 57863, 60425, 58094, 60183, 58544,
-59899, 59116, 59489, 59630, 58889, 59936, 58066, 59921,
-57024, 59567, 55850, 58876, 54654, 57954, 53577, 56967,
-52753, 56098, 52238, 55488, 52110, 55255, 52339, 55432,
-52843, 55988, 53506, 56820, 54306, 57775, 55150, 58727,
-56003, 59590, 56860, 60343, 57753, 61008, 58795, 61633,
-60012, 62300, 61406, 63036, 62961, 63873, 64666, 64763,
-  920,   164,  2728,  1137,  4482,  2229,  6167,  3400,
- 7742,  4662,  9124,  5975, 10274,  7238, 11096,  8362,
-11608,  9240, 11783,  9793, 11699, 10004, 11382,  9912,
-10900,  9591, 10381,  9130,  9889,  8588,  9479,  8011,
- 9197,  7464,  9066,  6993,  9084,  6662,  9180,  6502,
- 9335,  6572,  9484,  6851,  9523,  7243,  9363,  7661,
- 8922,  7970,  8197,  8011,  7158,  7673,  5777,  6892,
- 4126,  5724,  2281,  4240,   405,  2630, 64195,  1071,
-62699, 65235, 61549, 64125, 60748, 63351, 60303, 62929,
-60116, 62850, 60080, 63038, 60099, 63442, 60176, 64027,
-60308, 64692, 60519, 65356, 60825,   409, 61261,   926,
-61907,  1346, 62705,  1731, 63673,  2088, 64768,  2423,
-  430,  2754,  1737,  3114,  3098,  3520,  4437,  3917,
- 5730,  4317,  6886,  4711,  7847,  5061,  8516,  5268,
- 8801,  5255,  8659,  5002,  8114,  4436,  7194,  3510,
- 5972,  2230,  4517,   671,  2945, 64396,  1352, 62452,
-65331, 60529, 63847, 58743, 62495, 57203, 61323, 55991,
-60351, 55179, 59620, 54783, 59058, 54718, 58669, 54953,
-58342, 55421, 57993, 55975, 57534, 56490, 56855, 56858,
-55990, 57006, 55037, 56916, 54069, 56654, 53230, 56301,
-52626, 55961, 52300, 55736, 52283, 55746, 52501, 55992,
-52904, 56428, 53388, 57019, 53872, 57692, 54324, 58403,
-54783, 59090, 55301, 59711, 55846, 60284, 56518, 60821,
-57328, 61320, 58318, 61813, 59547, 62352, 60983, 63000,
-62600, 63799, 64348, 64751,   615,   314,  2414,  1554,
- 4150,  2871,  5761,  4226,  7176,  5526,  8370,  6722,
- 9298,  7725,  9946,  8511, 10302,  9029, 10405,  9272,
-10283,  9249, 10030,  9017,  9747,  8639,  9503,  8167,
- 9327,  7696,  9247,  7326,  9285,  7121,  9441,  7168,
- 9704,  7440, 10030,  7907, 10344,  8490, 10540,  9084,
-10478,  9528, 10085,  9705,  9276,  9514,  8064,  8924,
- 6514,  7955,  4749,  6675,  2930,  5199,  1199,  3670,
-65238,  2226, 64026,   951, 63093, 65492, 62406, 64760,
-61948, 64314, 61684, 64164, 61545, 64239, 61513, 64515,
-61553, 64919, 61706, 65385, 61974,   330, 62338,   762,
-62847,  1137, 63516,  1473, 64319,  1824, 65285,  2160,
-  828,  2545,  2044,  2953,  3308,  3434,  4576,  3986,
- 5812,  4613,  6948,  5281,  7960,  5920,  8761,  6500,
- 9324,  6915,  9600,  7079,  9548,  6865,  9181,  6259,
- 8510,  5280,  7550,  3924,  6385,  2256,  5074,   379,
- 3671, 63946,  2207, 61971,   795, 60139, 65024, 58537,
-63855, 57291, 62826, 56432, 61925, 55960, 61139, 55805,
-60390, 55870, 59618, 56064, 58788, 56255, 57856, 56389,
-56853, 56366, 55819, 56176, 54824, 55861, 53936, 55450,
-53231, 55048, 52708, 54707, 52426, 54512, 52361, 54516,
-52473, 54709, 52701, 55062, 52971, 55547, 53258, 56082,
-53553, 56632, 53863, 57177, 54261, 57705, 54784, 58243,
-55495, 58791, 56445, 59409, 57652, 60071, 59080, 60816,
-60660, 61667, 62351, 62644, 64099, 63754,   276, 64973,
- 1943,   722,  3500,  2030,  4903,  3292,  6080,  4449,
- 6994,  5465,  7614,  6262,  7933,  6823,  7967,  7134,
- 7761,  7179,  7391,  6995,  6938,  6598,  6485,  6075,
- 6163,  5513,  6037,  5045,  6148,  4762,  6508,  4743,
- 7044,  5010,  7693,  5553,  8291,  6264,  8720,  7007,
- 8840,  7606,  8591,  7922,  7936,  7891,  6896,  7454,
- 5576,  6661,  4061,  5550,  2453,  4269,   893,  2931,
-65035,  1694, 63836,   634, 62884, 65386, 62181, 64861,
-61700, 64523, 61387, 64374, 61197, 64357, 61132, 64455,
-61145, 64643, 61179, 64902, 61308, 65265, 61571,   115,
-61968,   513, 62481,   899, 63167,  1253, 64006,  1595,
-65021,  1977,   615,  2426,  1823,  3007,  3081,  3724,
- 4296,  4539,  5456,  5411,  6506,  6223,  7383,  6913,
- 8077,  7411,  8577,  7665,  8853,  7618,  8835,  7238,
- 8537,  6503,  7996,  5404,  7226,  4004,  6276,  2351,
- 5177,   535,  4058, 64202,  2917, 62401,  1844, 60820,
-  835, 59531, 65448, 58582, 64568, 57925, 63714, 57518,
-62858, 57300, 61983, 57209, 61043, 57122, 60025, 56993,
-58972, 56764, 57915, 56472, 56909, 56135, 56018, 55785,
-55309, 55480, 54790, 55250, 54479, 55146, 54352, 55200,
-54330, 55420, 54397, 55758, 54493, 56224, 54622, 56761,
-54777, 57337, 54971, 57888, 55270, 58423, 55707, 58951,
-56300, 59478, 57070, 60002, 58062, 60554, 59239, 61173,
-60612, 61908, 62097, 62791, 63698, 63822, 65309, 64966,
- 1333,   641,  2773,  1893,  4019,  3151,  5078,  4356,
- 5923,  5476,  6545,  6443,  6934,  7230,  7088,  7756,
- 7055,  8005,  6858,  7967,  6551,  7701,  6177,  7284,
- 5838,  6809,  5664,  6416,  5697,  6170,  5963,  6123,
- 6426,  6287,  7023,  6653,  7632,  7130,  8098,  7637,
- 8271,  8059,  8063,  8319,  7465,  8337,  6482,  7998,
- 5237,  7325,  3830,  6353,  2381,  5201,   970,  3951,
-65211,  2725, 64035,  1600, 63005,   621, 62117, 65381,
-61398, 64803, 60809, 64393, 60355, 64166, 60043, 64096,
-59874, 64154, 59797, 64296, 59805, 64451, 59876, 64600,
-60035, 64728, 60295, 64843, 60712, 64952, 61336, 65101,
-62188, 65317, 63241,   101, 64454,   556,   205,  1166,
- 1539,  1920,  2837,  2773,  4055,  3682,  5149,  4580,
- 6094,  5409,  6874,  6102,  7481,  6557,  7869,  6721,
- 8016,  6505,  7954,  5909,  7687,  4988,  7237,  3801,
- 6673,  2443,  6056,  1013,  5461, 65175,  4902, 63950,
- 4381, 62908,  3854, 62052,  3309, 61426,  2731, 60992,
- 2092, 60743,  1365, 60606,   560, 60496, 65241, 60368,
-64348, 60206, 63455, 59987, 62581, 59706, 61792, 59394,
-61106, 59109, 60546, 58941, 60123, 58910, 59835, 59025,
-59660, 59285, 59585, 59693, 59536, 60186, 59458, 60705,
-59400, 61189, 59381, 61626, 59422, 61966, 59507, 62223,
-59712, 62415, 60053, 62547, 60562, 62704, 61222, 62922,
-61999, 63220, 62932, 63573, 63963, 64021, 65031, 64581,
-  549, 65306,  1554,   619,  2510,  1589,  3365,  2606,
- 4060,  3570,  4568,  4386,  4882,  4973,  4981,  5300,
- 4884,  5323,  4602,  5105,  4180,  4688,  3721,  4147,
- 3288,  3547,  2987,  2992,  2858,  2558,  2941,  2266,
- 3237,  2176,  3662,  2277,  4091,  2539,  4415,  2888,
- 4521,  3211,  4381,  3433,  3951,  3456,  3258,  3205,
- 2357,  2673,  1281,  1906,    96,   917, 64374, 65347,
-63070, 64188, 61793, 63075, 60575, 62070, 59485, 61243,
-58571, 60632, 57851, 60258, 57312, 60139, 56963, 60216,
-56741, 60465, 56649, 60802, 56631, 61145, 56721, 61473,
-56914, 61753, 57258, 62023, 57729, 62281, 58372, 62567,
-59179, 62920, 60164, 63373, 61318, 63967, 62600, 64711,
-63998,    62, 65452,  1090,  1391,  2248,  2835,  3488,
- 4166,  4733,  5340,  5858,  6315,  6780,  7040,  7416,
- 7488,  7719,  7683,  7638,  7667,  7218,  7516,  6484,
- 7249,  5506,  6937,  4380,  6607,  3217,  6241,  2086,
- 5841,  1081,  5402,   249,  4915, 65132,  4370, 64604,
- 3759, 64174,  3109, 63797,  2398, 63465,  1646, 63159,
-  863, 62849,    77, 62532, 64816, 62183, 64020, 61808,
-63302, 61462, 62716, 61179, 62267, 60976, 61925, 60923,
-61722, 61036, 61579, 61293, 61439, 61643, 61267, 62031,
-61085, 62398, 60927, 62719, 60859, 62956, 60913, 63118,
-61119, 63255, 61471, 63345, 61956, 63452, 62577, 63586,
-63293, 63788, 64095, 64081, 64971, 64478,   411, 65011,
- 1446,   126,  2519,   860,  3539,  1645,  4471,  2436,
- 5211,  3178,  5725,  3783,  5989,  4211,  5978,  4456,
- 5715,  4495,  5256,  4320,  4673,  3960,  4064,  3454,
- 3510,  2894,  3098,  2357,  2856,  1936,  2834,  1678,
- 2958,  1616,  3212,  1770,  3494,  2074,  3763,  2438,
- 3905,  2747,  3878,  2941,  3597,  2940,  3059,  2691,
- 2304,  2196,  1318,  1528,   207,   687, 64543, 65271,
-63304, 64229, 62098, 63181, 60967, 62191, 59927, 61336,
-59011, 60652, 58251, 60195, 57647, 59967, 57190, 59936,
-56856, 60047, 56635, 60249, 56534, 60499, 56545, 60751,
-56657, 60996, 56878, 61208, 57218, 61421, 57662, 61682,
-58230, 62039, 58973, 62499, 59870, 63095, 60915, 63820,
-62122, 64673, 63438,    95, 64805,  1126,   605,  2236,
- 1854,  3379,  2974,  4475,  3919,  5452,  4619,  6215,
- 5112,  6700,  5395,  6849,  5507,  6670,  5553,  6179,
- 5542,  5463,  5498,  4623,  5399,  3755,  5256,  2898,
- 5045,  2075,  4728,  1342,  4307,   676,  3834,    83,
- 3286, 65115,  2719, 64658,  2071, 64275,  1388, 63938,
-  646, 63613, 65411, 63285, 64640, 62946, 63902, 62591,
-63233, 62272, 62679, 62015, 62246, 61858, 61928, 61843,
-61710, 61937, 61536, 62133, 61405, 62397, 61261, 62706,
-61117, 63000, 61017, 63266, 60996, 63504, 61057, 63687,
-61220, 63825, 61511, 63918, 61951, 64030, 62536, 64192,
-63221, 64450, 64042, 64797, 64972, 65265,   483,   292,
- 1612,   962,  2774,  1692,  3906,  2429,  4944,  3144,
- 5813,  3782,  6480,  4364,  6911,  4810,  7129,  5102,
- 7134,  5199,  6957,  5107,  6639,  4867,  6238,  4510,
- 5814,  4117,  5439,  3717,  5160,  3391,  5031,  3192,
- 5126,  3138,  5365,  3236,  5713,  3483,  6061,  3830,
- 6317,  4189,  6405,  4489,  6266,  4617,  5872,  4518,
- 5265,  4164,  4452,  3577,  3490,  2805,  2423,  1896,
- 1273,   923,    74, 65487, 64417, 64589, 63244, 63755,
-62158, 63067, 61190, 62523, 60403, 62133, 59747, 61894,
-59214, 61798, 58813, 61820, 58493, 61877, 58254, 61932,
-58090, 61938, 58057, 61921, 58138, 61880, 58345, 61840,
-58645, 61840, 59067, 61922, 59637, 62104, 60321, 62427,
-61180, 62923, 62168, 63595, 63258, 64398, 64425, 65338,
-   47,   802,  1096,  1792,  1968,  2692,  2639,  3407,
- 3108,  3892,  3411,  4120,  3564,  4070,  3648,  3798,
- 3692,  3352,  3692,  2735,  3648,  2028,  3536,  1279,
- 3344,   517,  3059, 65329,  2691, 64684,  2239, 64118,
- 1705, 63670,  1110, 63308,   489, 62993, 65385, 62681,
-64716, 62346, 64056, 62006, 63405, 61639, 62798, 61264,
-62249, 60936, 61748, 60688, 61316, 60559, 60924, 60532,
-60595, 60638, 60315, 60839, 60079, 61110, 59874, 61402,
-59693, 61698, 59557, 62001, 59456, 62284, 59437, 62559,
-59510, 62837, 59721, 63107, 60058, 63390, 60591, 63688,
-61294, 64002, 62162, 64369, 63204, 64784, 64362, 65290,
-   45,   340,  1295,  1013,  2471,  1732,  3552,  2450,
- 4464,  3111,  5177,  3657,  5706,  4018,  6027,  4185,
- 6164,  4178,  6107,  4015,  5925,  3727,  5641,  3340,
- 5323,  2913,  5054,  2513,  4900,  2197,  4902,  1973,
- 5061,  1929,  5382,  2052,  5768,  2361,  6172,  2796,
- 6482,  3267,  6643,  3734,  6649,  4045,  6435,  4130,
- 6030,  3947,  5453,  3514,  4710,  2859,  3856,  2067,
- 2899,  1185,  1880,   281,   830, 64947, 65329, 64155,
-64357, 63480, 63443, 62943, 62654, 62574, 61955, 62370,
-61382, 62331, 60903, 62404, 60488, 62514, 60140, 62640,
-59841, 62740, 59622, 62811, 59472, 62859, 59435, 62895,
-59531, 62941, 59806, 63004, 60240, 63133, 60849, 63366,
-61635, 63741, 62571, 64289, 63618, 64989, 64716,   326,
-  252,  1324,  1222,  2365,  2077,  3364,  2747,  4203,
- 3208,  4854,  3476,  5264,  3618,  5425,  3683,  5309,
- 3690,  4973,  3646,  4458,  3541,  3798,  3350,  3031,
- 3079,  2197,  2680,  1375,  2182,   571,  1609, 65385,
-  988, 64732,   328, 64148, 65182, 63660, 64470, 63200,
-63740, 62761, 63016, 62298, 62298, 61811, 61625, 61333,
-61013, 60889, 60475, 60500, 60007, 60234, 59592, 60078,
-59233, 60047, 58938, 60095, 58712, 60220, 58515, 60367,
-58402, 60554, 58350, 60746, 58343, 60969, 58369, 61231,
-58464, 61559, 58650, 61947, 58979, 62354, 59454, 62787,
-60129, 63240, 61021, 63741, 62117, 64279, 63367, 64901,
-64716,    35,   546,   772,  1878,  1557,  3119,  2343,
- 4192,  3050,  5062,  3654,  5700,  4081,  6140,  4370,
- 6370,  4462,  6418,  4410,  6296,  4237,  6079,  3985,
- 5805,  3712,  5546,  3427,  5359,  3223,  5299,  3113,
- 5370,  3168,  5549,  3342,  5840,  3681,  6169,  4103,
- 6485,  4579,  6717,  5007,  6842,  5318,  6840,  5460,
- 6678,  5401,  6350,  5121,  5871,  4631,  5254,  3967,
- 4514,  3173,  3687,  2312,  2777,  1441,  1822,   636,
-  881, 65510,     9, 64998, 64752, 64642, 64035, 64428,
-63414, 64316, 62915, 64264, 62495, 64270, 62150, 64250,
-61831, 64218, 61554, 64159, 61335, 64068, 61198, 63972,
-61177, 63862, 61304, 63762, 61586, 63724, 62034, 63790,
-62643, 63984, 63371, 64311, 64141, 64782, 64936, 65400,
-  168,   595,   901,  1397,  1554,  2189,  2092,  2938,
- 2540,  3540,  2909,  3944,  3196,  4114,  3429,  4057,
- 3583,  3804,  3660,  3386,  3660,  2872,  3593,  2301,
- 3433,  1718,  3150,  1122,  2764,   518,  2266, 65443,
- 1715, 64827,  1065, 64215,   369, 63613, 65179, 63046,
-64436, 62489, 63673, 61958, 62950, 61442, 62262, 60918,
-61623, 60396, 61059, 59915, 60552, 59529, 60125, 59261,
-59727, 59119, 59375, 59112, 59037, 59205, 58720, 59369,
-58423, 59554, 58145, 59781, 57932, 60034, 57775, 60337,
-57721, 60671, 57808, 61043, 58063, 61426, 58470, 61827,
-59081, 62273, 59888, 62771, 60885, 63341, 62036, 64026,
-63299, 64801, 64625,    94,   405,   927,  1621,  1734,
- 2680,  2432,  3548,  2997,  4191,  3404,  4607,  3650,
- 4837,  3760,  4865,  3697,  4746,  3498,  4509,  3186,
- 4259,  2843,  4026,  2517,  3873,  2285,  3809,  2188,
- 3894,  2258,  4075,  2493,  4356,  2862,  4673,  3309,
- 4995,  3757,  5262,  4152,  5469,  4445,  5571,  4584,
- 5551,  4546,  5372,  4309,  5065,  3928,  4622,  3375,
- 4021,  2738,  3315,  2051,  2513,  1366,  1681,   707,
-  862,   118,    79, 65183, 64893, 64817, 64272, 64629,
-63728, 64544, 63264, 64561, 62886, 64636, 62548, 64690,
-62263, 64689, 62001, 64607, 61818, 64452, 61730, 64255,
-61765, 64074, 61913, 63925, 62213, 63869, 62613, 63911,
-63134, 64089, 63758, 64403, 64446, 64851, 65181, 65424,
-  397,   564,  1157,  1303,  1846,  2051,  2456,  2754,
- 2965,  3339,  3411,  3760,  3763,  3993,  4057,  4029,
- 4285,  3890,  4461,  3595,  4555,  3184,  4557,  2717,
- 4467,  2214,  4261,  1686,  3949,  1151,  3532,   581,
- 3065,    19,  2537, 65018,  1940, 64458,  1305, 63868,
-  607, 63249, 65441, 62628, 64708, 62023, 64008, 61424,
-63346, 60892, 62764, 60419, 62243, 60056, 61784, 59791,
-61333, 59602, 60880, 59504, 60412, 59471, 59951, 59520,
-59475, 59643, 59025, 59852, 58606, 60094, 58263, 60367,
-58021, 60638, 57925, 60924, 57995, 61226, 58231, 61554,
-58649, 61960, 59253, 62442, 60034, 63024, 60969, 63678,
-62010, 64385, 63108, 65102, 64200,   273, 65255,   982,
-  654,  1629,  1434,  2156,  2023,  2536,  2399,  2752,
- 2591,  2807,  2589,  2694,  2474,  2436,  2262,  2089,
- 2046,  1712,  1856,  1379,  1754,  1105,  1725,   939,
- 1831,   917,  2032,  1072,  2332,  1362,  2660,  1747,
- 2983,  2167,  3252,  2548,  3468,  2846,  3578,  2986,
- 3618,  2967,  3548,  2791,  3362,  2501,  3055,  2099,
- 2623,  1614,  2063,  1061,  1422,   493,   752, 65478,
-   75, 65016, 64976, 64630, 64384, 64386, 63870, 64269,
-63440, 64283, 63020, 64381, 62653, 64510, 62337, 64624,
-62072, 64704, 61879, 64731, 61753, 64711, 61731, 64648,
-61826, 64614, 62040, 64625, 62341, 64716, 62750, 64901,
-63268, 65193, 63908,    78, 64624,   579, 65410,  1165,
-  671,  1795,  1467,  2490,  2249,  3206,  2932,  3898,
- 3557,  4510,  4132,  5037,  4669,  5448,  5162,  5744,
- 5591,  5882,  5949,  5843,  6211,  5689,  6405,  5443,
- 6466,  5135,  6424,  4758,  6277,  4350,  6022,  3904,
- 5684,  3451,  5220,  2928,  4674,  2326,  4027,  1661,
- 3333,   959,  2570,   247,  1813, 65065,  1044, 64345,
-  318, 63650, 65154, 63028, 64483, 62499, 63844, 62050,
-63243, 61710, 62680, 61459, 62127, 61318, 61592, 61235,
-61079, 61156, 60588, 61101, 60126, 61040, 59739, 61022,
-59451, 61045, 59247, 61114, 59210, 61261, 59301, 61477,
-59557, 61778, 59994, 62152, 60613, 62608, 61414, 63172,
-62349, 63844, 63380, 64597, 64456, 65383, 65505,   584,
-  892,  1247,  1697,  1740,  2323,  2063,  2746,  2197,
- 2973,  2159,  3004,  1980,  2891,  1708,  2640,  1371,
- 2317,  1026,  1993,   708,  1721,   449,  1536,   279,
- 1455,   224,  1490,   275,  1614,   450,  1792,   721,
- 1978,  1051,  2170,  1372,  2328,  1668,  2452,  1865,
- 2533,  1947,  2558,  1895,  2469,  1698,  2258,  1383,
- 1897,   969,  1397,   495,   777,     3,    97, 65058,
-64956, 64646, 64299, 64341, 63711, 64133, 63195, 64018,
-62733, 63971, 62310, 63968, 61936, 63970, 61592, 63930,
-61282, 63859, 61031, 63742, 60844, 63593, 60762, 63439,
-60766, 63294, 60859, 63168, 61084, 63131, 61400, 63185,
-61833, 63367, 62364, 63678, 62956, 64133, 63618, 64714,
-64311, 65368, 65036,   518,   254,  1222,   997,  1891,
- 1739,  2524,  2444,  3078,  3107,  3537,  3701,  3907,
- 4225,  4174,  4675,  4342,  5075,  4417,  5398,  4390,
- 5657,  4278,  5819,  4073,  5864,  3786,  5774,  3425,
- 5550,  3019,  5203,  2588,  4754,  2150,  4227,  1686,
- 3657,  1176,  3052,   617,  2420, 65519,  1777, 64860,
- 1169, 64194,   592, 63584,    57, 63067, 65087, 62657,
-64585, 62353, 64075, 62113, 63526, 61920, 62943, 61749,
-62324, 61593, 61735, 61471, 61181, 61392, 60727, 61369,
-60360, 61401, 60080, 61484, 59918, 61615, 59867, 61810,
-59972, 62063, 60237, 62422, 60718, 62879, 61421, 63453,
-62306, 64140, 63295, 64896, 64344,   132, 65357,   864,
-  750,  1519,  1543,  2026,  2174,  2350,  2627,  2487,
- 2879,  2442,  2970,  2256,  2884,  1967,  2673,  1593,
- 2383,  1186,  2068,   803,  1805,   463,  1604,   201,
- 1493,    61,  1463,    40,  1525,   148,  1627,   335,
- 1776,   577,  1943,   813,  2102,  1054,  2229,  1224,
- 2300,  1306,  2299,  1290,  2211,  1162,  2015,   939,
- 1717,   624,  1317,   241,   816, 65375,   235, 64972,
-65165, 64598, 64513, 64267, 63893, 64010, 63296, 63834,
-62791, 63733, 62324, 63692, 61929, 63669, 61586, 63637,
-61302, 63590, 61052, 63499, 60873, 63397, 60771, 63300,
-60750, 63239, 60835, 63235, 60998, 63301, 61237, 63441,
-61574, 63649, 61955, 63915, 62417, 64272, 62913, 64700,
-63466, 65203, 64067,   225, 64686,   829, 65302,  1435,
-  383,  2015,  1002,  2538,  1616,  2990,  2224,  3379,
- 2834,  3678,  3427,  3927,  3946,  4094,  4370,  4180,
- 4685,  4190,  4878,  4130,  4948,  3977,  4928,  3757,
- 4817,  3483,  4609,  3146,  4278,  2753,  3864,  2297,
- 3369,  1792,  2826,  1260,  2286,   694,  1745,   119,
- 1243, 65104,   752, 64558,   308, 64091, 65418, 63662,
-64971, 63292, 64479, 62972, 63961, 62707, 63405, 62478,
-62854, 62269, 62290, 62056, 61740, 61877, 61219, 61704,
-60755, 61559, 60365, 61472, 60089, 61461, 59955, 61585,
-59993, 61854, 60257, 62290, 60771, 62863, 61494, 63575,
-62398, 64354, 63418, 65183, 64507,   451,    30,  1220,
- 1007,  1903,  1879,  2467,  2595,  2849,  3150,  3047,
- 3517,  3051,  3720,  2886,  3764,  2612,  3667,  2243,
- 3479,  1867,  3235,  1510,  2970,  1209,  2722,   998,
- 2559,   876,  2494,   857,  2535,   915,  2642,  1066,
- 2802,  1274,  2991,  1497,  3172,  1716,  3312,  1866,
- 3377,  1937,  3362,  1903,  3240,  1793,  3039,  1568,
- 2728,  1259,  2326,   873,  1833,   450,  1253,    17,
-  634, 65156,     7, 64814, 64914, 64564, 64303, 64409,
-63737, 64323, 63250, 64289, 62823, 64246, 62453, 64193,
-62166, 64099, 61961, 64012, 61827, 63891, 61730, 63795,
-61638, 63726, 61571, 63692, 61519, 63702, 61510, 63765,
-61592, 63881, 61770, 64044, 62056, 64280, 62487, 64554,
-62991, 64898, 63533, 65310, 64085,   224, 64645,   736,
-65214,  1250,   263,  1774,   886,  2275,  1556,  2740,
- 2233,  3146,  2869,  3477,  3430,  3744,  3895,  3912,
- 4217,  4018,  4416,  4033,  4480,  3963,  4431,  3830,
- 4251,  3605,  3974,  3311,  3616,  2922,  3208,  2490,
- 2746,  1995,  2293,  1488,  1787,   918,  1542,   568,
- 1428,   339,  1208,     8,  1255, 65517,  1327,    48,
- 1163, 65528,   785, 65340,   115, 64889, 64406, 63916,
-62676, 62462, 60956, 60997, 59746, 60009, 59013, 59481,
-58679, 59332, 58758, 59594, 59110, 60147, 59589, 60810,
-59997, 61326, 60093, 61493, 60215, 61609, 60632, 61981,
-61243, 62510, 62128, 63273, 63182, 64174, 64129, 64932,
-64774, 65329, 65242, 65472,   169, 65513,   366, 65261,
-  276, 64709,   287, 64291,   517, 64140,  1035, 64347,
- 1705, 64818,  2349, 65339,  3043,   449,  3630,  1003,
- 4015,  1384,  4208,  1590,  4270,  1716,  4335,  1883,
- 4349,  2017,  4524,  2326,  5050,  2986,  5699,  3766,
- 6176,  4346,  6361,  4595,  6235,  4508,  5732,  4015,
- 5010,  3297,  4329,  2639,  3879,  2269,  3708,  2211,
- 3724,  2453,  3876,  2906,  4055,  3478,  4033,  3908,
- 3675,  3993,  3063,  3818,  2363,  3504,  1615,  3042,
-  889,  2526,   258,  2026, 65242,  1531, 64771,  1085,
-64351,   646, 63802,    90, 63092, 64896, 62237, 64016,
-61268, 63025, 60392, 62094, 59841, 61467, 59700, 61200,
-59875, 61251, 60304, 61542, 60885, 62000, 61453, 62475,
-61802, 62775, 61901, 62852, 61888, 62778, 61803, 62621,
-61781, 62463, 61941, 62451, 62388, 62696, 63096, 63220,
-63990, 63950, 64867, 64699, 65507, 65218,   247, 65408,
-  164, 65230, 65331, 64782, 64813, 64207, 64295, 63638,
-63849, 63132, 63510, 62738, 63298, 62474, 63129, 62222,
-62842, 61862, 62336, 61309, 61606, 60587, 60720, 59750,
-59798, 58917, 59039, 58266, 58530, 57904, 58305, 57857,
-58330, 58086, 58545, 58484, 58808, 58982, 59099, 59502,
-59387, 60049, 59719, 60638, 60131, 61285, 60650, 62037,
-61281, 62874, 62061, 63829, 62988, 64905, 64038,   521,
-65136,  1714,   726,  2886,  1828,  3974,  2881,  4919,
- 3861,  5698,  4749,  6303,  5580,  6782,  6369,  7173,
- 7070,  7454,  7600,  7602,  7917,  7567,  8001,  7394,
- 7932,  7138,  7784,  6857,  7649,  6613,  7600,  6463,
- 7628,  6411,  7703,  6409,  7748,  6426,  7706,  6374,
- 7579,  6269,  7408,  6151,  7226,  6036,  7035,  5895,
- 6844,  5690,  6637,  5388,  6391,  5010,  6059,  4541,
- 5599,  4014,  5010,  3424,  4275,  2793,  3409,  2144,
- 2493,  1505,  1550,   857,   580,   123, 65057, 64847,
-63949, 63925, 62779, 62961, 61614, 61960, 60470, 60957,
-59396, 60013, 58493, 59204, 57814, 58593, 57432, 58242,
-57340, 58138, 57472, 58258, 57750, 58554, 58086, 58918,
-58389, 59268, 58589, 59502, 58645, 59620, 58611, 59644,
-58557, 59617, 58572, 59616, 58700, 59702, 59046, 59953,
-59643, 60455, 60519, 61219, 61636, 62221, 62964, 63431,
-64414, 64751,   348,   545,  1765,  1813,  3052,  2950,
- 4195,  3951,  5170,  4831,  6009,  5618,  6700,  6277,
- 7214,  6791,  7567,  7185,  7794,  7423,  7922,  7550,
- 7933,  7541,  7780,  7374,  7486,  7040,  7059,  6569,
- 6547,  6035,  6033,  5504,  5555,  5048,  5184,  4747,
- 4926,  4618,  4767,  4644,  4635,  4746,  4493,  4845,
- 4332,  4899,  4156,  4890,  3912,  4778,  3557,  4498,
- 3056,  4038,  2423,  3438,  1683,  2793,   858,  2118,
-65495,  1404, 64557,   690, 63657,     8, 62911, 64977,
-62422, 64588, 62233, 64401, 62357, 64427, 62734, 64645,
-63263, 64954, 63793, 65237, 64158, 65325, 64242, 65091,
-64043, 64544, 63632, 63817, 63106, 62995, 62598, 62232,
-62263, 61648, 62163, 61339, 62313, 61307, 62591, 61436,
-62840, 61578, 62902, 61570, 62664, 61309, 62130, 60782,
-61369, 60030, 60542, 59194, 59807, 58422, 59283, 57804,
-59040, 57408, 59073, 57278, 59359, 57418, 59829, 57789,
-60427, 58322, 61061, 58990, 61629, 59628, 62019, 60180,
-62189, 60554, 62149, 60757, 61953, 60818, 61682, 60821,
-61457, 60862, 61395, 61031, 61550, 61405, 61952, 61955,
-62585, 62681, 63379, 63525, 64295, 64488, 65280, 65483,
-  685,   906,  1534,  1797,  2252,  2597,  2873,  3321,
- 3407,  3958,  3846,  4484,  4189,  4897,  4440,  5192,
- 4595,  5358,  4694,  5476,  4737,  5547,  4787,  5612,
- 4847,  5670,  4956,  5737,  5165,  5842,  5461,  5992,
- 5820,  6159,  6173,  6293,  6425,  6371,  6552,  6355,
- 6554,  6257,  6427,  6078,  6178,  5832,  5857,  5517,
- 5490,  5174,  5056,  4792,  4613,  4349,  4140,  3836,
- 3596,  3230,  2965,  2563,  2273,  1823,  1537,  1003,
-  748,    99, 65510, 64727, 64780, 63857, 64141, 63119,
-63571, 62510, 63033, 62015, 62445, 61549, 61713, 61002,
-60787, 60244, 59644, 59270, 58399, 58137, 57171, 56961,
-56105, 55922, 55315, 55181, 54962, 54915, 55067, 55162,
-55584, 55905, 56407, 56968, 57382, 58181, 58322, 59351,
-59125, 60277, 59691, 60928, 60051, 61288, 60277, 61477,
-60453, 61589, 60701, 61742, 61072, 61994, 61613, 62350,
-62309, 62824, 63138, 63404, 64064, 64063, 65039, 64792,
-  499,    29,  1506,   858,  2443,  1707,  3277,  2498,
- 3983,  3201,  4561,  3793,  5039,  4303,  5453,  4757,
- 5849,  5193,  6301,  5626,  6647,  6006,  6987,  6333,
- 7358,  6578,  7632,  6777,  7794,  6871,  7870,  6903,
- 7773,  6899,  7520,  6925,  7232,  7019,  7116,  7200,
- 7197,  7434,  7382,  7725,  7633,  8031,  7910,  8315,
- 8122,  8537,  8143,  8619,  7834,  8495,  7175,  8107,
- 6331,  7468,  5288,  6590,  4120,  5526,  2894,  4381,
- 1635,  3172,   292,  1964, 64496,   809, 63342, 65328,
-62385, 64481, 61585, 63800, 60991, 63241, 60644, 62766,
-60500, 62350, 60535, 61986, 60608, 61669, 60728, 61363,
-60865, 61091, 61042, 60911, 61241, 60839, 61495, 60884,
-61839, 61054, 62234, 61342, 62631, 61714, 63120, 62116,
-63563, 62438, 63836, 62627, 63827, 62590, 63537, 62299,
-62987, 61753, 62225, 61041, 61460, 60239, 60842, 59480,
-60535, 58928, 60533, 58621, 60823, 58596, 61316, 58814,
-61873, 59184, 62271, 59601, 62486, 59946, 62496, 60187,
-62353, 60301, 62069, 60297, 61708, 60163, 61297, 59991,
-60899, 59786, 60551, 59600, 60279, 59466, 60045, 59449,
-59915, 59598, 59916, 59964, 60104, 60581, 60527, 61449,
-61207, 62508, 62048, 63672, 62962, 64869, 63873,   455,
-64707,  1478, 65414,  2385,   455,  3206,   969,  3945,
- 1446,  4632,  1972,  5257,  2548,  5815,  3182,  6270,
- 3854,  6596,  4521,  6795,  5120,  6866,  5554,  6831,
- 5756,  6672,  5691,  6417,  5407,  6049,  5025,  5663,
- 4673,  5325,  4467,  5220,  4440,  5371,  4619,  5670,
- 4893,  6137,  5120,  6587,  5168,  6813,  4950,  6734,
- 4543,  6339,  4034,  5610,  3572,  4657,  3228,  3704,
- 3041,  2997,  2984,  2577,  2983,  2359,  2938,  2256,
- 2734,  2150,  2297,  1858,  1615,  1236,   718,   223,
-65198, 64517, 64126, 63274, 63138, 62124, 62375, 61227,
-61890, 60669, 61719, 60396, 61800, 60371, 62072, 60504,
-62394, 60814, 62715, 61124, 62955, 61330, 63097, 61479,
-63146, 61559, 63116, 61612, 63000, 61598, 62825, 61513,
-62564, 61385, 62305, 61224, 62110, 61080, 62096, 61045,
-62284, 61157, 62712, 61479, 63314, 61935, 64024, 62531,
-64750, 63278, 65430, 64084,   497, 64853,  1076,    15,
- 1587,   656,  2032,  1194,  2413,  1655,  2732,  2074,
- 3002,  2488,  3191,  2895,  3327,  3273,  3376,  3591,
- 3332,  3803,  3163,  3854,  2906,  3732,  2603,  3518,
- 2333,  3338,  2159,  3259,  2144,  3342,  2309,  3660,
- 2644,  4161,  3105,  4818,  3622,  5564,  4142,  6272,
- 4607,  6847,  4997,  7201,  5239,  7276,  5304,  7084,
- 5129,  6677,  4724,  6115,  4074,  5412,  3196,  4595,
- 2126,  3732,   952,  2821, 65311,  1883, 64252,   914,
-63394,    40, 62815, 64821, 62553, 64214, 62609, 63830,
-62964, 63702, 63552, 63825, 64325, 64145, 65183, 64602,
-  529, 65095,  1413,     8,  2272,   412,  3101,   761,
- 3862,  1083,  4515,  1399,  5018,  1665,  5302,  1793,
- 5340,  1776,  5098,  1567,  4568,  1110,  3800,   379,
- 2850, 64970,  1807, 63846,   741, 62654, 65242, 61439,
-64302, 60344, 63481, 59402, 62800, 58656, 62256, 58110,
-61845, 57724, 61540, 57512, 61356, 57437, 61217, 57488,
-61083, 57611, 60877, 57788, 60580, 57930, 60190, 58045,
-59721, 58075, 59221, 58077, 58720, 58091, 58314, 58200,
-58080, 58495, 58081, 58977, 58330, 59680, 58804, 60553,
-59435, 61561, 60163, 62609, 60814, 63569, 61296, 64335,
-61517, 64824, 61505, 65033, 61330, 65015, 61085, 64885,
-60904, 64756, 60912, 64751, 61151, 64924, 61617, 65248,
-62265,   130, 62971,   601, 63632,  1063, 64217,  1507,
-64672,  1953, 65030,  2421, 65308,  2896,    57,  3391,
-  383,  3899,   740,  4394,  1151,  4825,  1553,  5133,
- 1966,  5315,  2329,  5366,  2655,  5311,  2907,  5160,
- 3118,  4941,  3287,  4682,  3429,  4376,  3539,  4026,
- 3619,  3664,  3684,  3286,  3700,  2868,  3621,  2397,
- 3407,  1839,  3024,  1208,  2497,   464,  1824, 65167,
- 1035, 64236,   162, 63214, 64780, 62165, 63854, 61119,
-62978, 60113, 62226, 59228, 61652, 58536, 61283, 58099,
-61145, 57952, 61220, 58080, 61492, 58445, 61862, 58997,
-62258, 59646, 62609, 60311, 62879, 60951, 63049, 61492,
-63135, 61930, 63196, 62211, 63210, 62393, 63235, 62510,
-63267, 62619, 63332, 62752, 63437, 62936, 63587, 63210,
-63818, 63592, 64148, 64092, 64559, 64705, 65049, 65391,
-   52,   556,   623,  1290,  1194,  1999,  1729,  2683,
- 2185,  3321,  2530,  3906,  2781,  4436,  2946,  4865,
- 3010,  5160,  3032,  5359,  3011,  5470,  2944,  5511,
- 2842,  5570,  2697,  5649,  2568,  5783,  2477,  5976,
- 2492,  6263,  2696,  6629,  3118,  7092,  3802,  7588,
- 4694,  8133,  5744,  8659,  6817,  9172,  7769,  9666,
- 8470, 10078,  8863, 10368,  8898, 10506,  8617, 10457,
- 8049, 10177,  7285,  9610,  6380,  8733,  5383,  7647,
- 4372,  6372,  3371,  4993,  2454,  3631,  1632,  2336,
-  982,  1235,   546,   349,   356, 65246,   405, 64785,
-  681, 64482,  1155, 64282,  1768, 64202,  2518, 64251,
- 3327, 64424,  4133, 64739,  4855, 65187,  5474,   183,
- 5915,   750,  6201,  1266,  6294,  1685,  6201,  1962,
- 5906,  2022,  5422,  1801,  4739,  1292,  3897,   477,
- 2895, 64955,  1798, 63722,   673, 62380, 65129, 61069,
-64146, 59902, 63295, 58972, 62542, 58303, 61851, 57891,
-61169, 57697, 60461, 57656, 59695, 57685, 58858, 57671,
-57925, 57555, 56968, 57336, 56022, 57068, 55212, 56812,
-54588, 56654, 54221, 56628, 54105, 56787, 54232, 57110,
-54505, 57614, 54900, 58210, 55355, 58860, 55833, 59521,
-56311, 60144, 56802, 60732, 57342, 61290, 57927, 61842,
-58541, 62374, 59251, 62888, 60012, 63408, 60842, 63936,
-61691, 64481, 62537, 65046, 63360,    98, 64157,   702,
-64893,  1295,     4,  1884,   556,  2438,   986,  2895,
- 1322,  3262,  1612,  3526,  1856,  3695,  2079,  3754,
- 2295,  3737,  2562,  3691,  2891,  3676,  3273,  3690,
- 3716,  3795,  4175,  3958,  4647,  4168,  5080,  4363,
- 5398,  4465,  5597,  4443,  5636,  4275,  5545,  3979,
- 5341,  3622,  5052,  3215,  4681,  2800,  4251,  2391,
- 3749,  1962,  3177,  1488,  2525,   896,  1819,   178,
- 1067, 64881,   328, 63966, 65167, 63052, 64573, 62219,
-64071, 61543, 63713, 61066, 63465, 60834, 63349, 60801,
-63319, 60962, 63333, 61211, 63379, 61505, 63379, 61753,
-63317, 61927, 63130, 61951, 62839, 61838, 62445, 61625,
-62044, 61389, 61709, 61177, 61541, 61041, 61586, 61044,
-61834, 61190, 62257, 61514, 62774, 61976, 63322, 62576,
-63835, 63282, 64335, 64034, 64771, 64818, 65204,    18,
-   24,   701,   362,  1326,   681,  1880,   927,  2348,
- 1087,  2713,  1125,  2982,  1058,  3146,   875,  3252,
-  661,  3285,   413,  3292,   239,  3307,   152,  3341,
-  240,  3452,   517,  3637,  1003,  3924,  1664,  4288,
- 2457,  4714,  3332,  5214,  4223,  5774,  5060,  6371,
- 5805,  6974,  6416,  7586,  6883,  8120,  7167,  8567,
- 7295,  8876,  7261,  8999,  7068,  8930,  6722,  8666,
- 6276,  8212,  5742,  7596,  5161,  6873,  4555,  6041,
- 3951,  5174,  3402,  4270,  2960,  3434,  2646,  2684,
- 2493,  2038,  2495,  1523,  2645,  1144,  2919,   890,
- 3269,   748,  3664,   716,  4095,   798,  4523,  1009,
- 4920,  1321,  5254,  1723,  5524,  2174,  5672,  2576,
- 5674,  2824,  5520,  2862,  5210,  2618,  4733,  2089,
- 4117,  1283,  3382,   238,  2538, 64556,  1633, 63259,
-  687, 61954, 65265, 60714, 64292, 59635, 63288, 58704,
-62304, 57962, 61317, 57360, 60359, 56893, 59408, 56504,
-58480, 56164, 57560, 55850, 56702, 55570, 55945, 55325,
-55320, 55170, 54845, 55120, 54541, 55211, 54427, 55477,
-54498, 55894, 54735, 56434, 55099, 57057, 55532, 57710,
-56011, 58297, 56491, 58813, 56962, 59203, 57368, 59486,
-57724, 59618, 58050, 59677, 58357, 59679, 58658, 59706,
-58977, 59828, 59376, 60097, 59847, 60551, 60408, 61179,
-61062, 61968, 61775, 62863, 62532, 63822, 63298, 64802,
-64032,   209, 64691,  1081, 65260,  1862,   212,  2532,
-  639,  3134,  1001,  3650,  1345,  4111,  1687,  4511,
- 2058,  4823,  2465,  5068,  2885,  5209,  3309,  5269,
- 3683,  5256,  4002,  5199,  4231,  5158,  4377,  5134,
- 4449,  5121,  4426,  5102,  4289,  5038,  4063,  4872,
- 3707,  4565,  3247,  4091,  2660,  3449,  1962,  2645,
- 1164,  1729,   309,   728, 65011, 65250, 64215, 64285,
-63561, 63431, 63032, 62768, 62725, 62320, 62624, 62111,
-62744, 62130, 63017, 62345, 63367, 62680, 63757, 63058,
-64113, 63417, 64403, 63703, 64584, 63859, 64660, 63875,
-64616, 63757, 64496, 63512, 64324, 63206, 64132, 62877,
-63973, 62609, 63866, 62438, 63870, 62416, 63986, 62516,
-64235, 62768, 64607, 63157, 65075, 63634,    58, 64195,
-  595, 64790,  1119, 65412,  1584,   511,  1997,  1156,
- 2292,  1786,  2462,  2364,  2496,  2899,  2403,  3376,
- 2208,  3764,  1947,  4086,  1650,  4317,  1367,  4470,
- 1147,  4559,  1048,  4624,  1092,  4710,  1307,  4837,
- 1703,  5022,  2245,  5296,  2957,  5663,  3759,  6111,
- 4610,  6618,  5445,  7197,  6224,  7795,  6880,  8416,
- 7371,  9010,  7617,  9516,  7660,  9889,  7449, 10050,
- 7028,  9964,  6403,  9605,  5639,  8969,  4757,  8096,
- 3843,  7081,  2953,  5989,  2141,  4884,  1459,  3814,
-  947,  2809,   648,  1916,   554,  1140,   652,   493,
-  938,    16,  1374, 65256,  1932, 65133,  2569, 65215,
- 3249, 65475,  3914,   311,  4538,   775,  5092,  1250,
- 5549,  1721,  5904,  2087,  6103,  2324,  6161,  2352,
- 6080,  2212,  5882,  1855,  5561,  1289,  5141,   564,
- 4664, 65265,  4132, 64386,  3554, 63516,  2941, 62705,
- 2264, 61989,  1506, 61371,   686, 60849, 65327, 60397,
-64372, 59968, 63368, 59532, 62334, 59064, 61316, 58587,
-60324, 58105, 59417, 57663, 58633, 57316, 57995, 57085,
-57551, 57036, 57307, 57149, 57262, 57438, 57379, 57817,
-57611, 58271, 57878, 58743, 58184, 59183, 58480, 59574,
-58765, 59885, 59034, 60120, 59318, 60281, 59623, 60399,
-59978, 60508, 60368, 60667, 60817, 60906, 61294, 61232,
-61785, 61672, 62270, 62182, 62746, 62749, 63148, 63323,
-63494, 63903, 63755, 64461, 63935, 64990, 64012, 65478,
-64040,   396, 64058,   842, 64118,  1219, 64255,  1524,
-64492,  1759, 64836,  1934, 65264,  2065,   196,  2172,
-  649,  2264,  1027,  2331,  1291,  2360,  1463,  2384,
- 1554,  2387,  1542,  2369,  1463,  2315,  1340,  2235,
- 1139,  2104,   864,  1904,   507,  1604,    69,  1168,
-65110,   623, 64568, 65523, 64048, 64840, 63575, 64130,
-63205, 63478, 62940, 62917, 62787, 62469, 62774, 62160,
-62875, 61987, 63072, 61945, 63299, 61997, 63548, 62100,
-63752, 62235, 63894, 62373, 63958, 62483, 63943, 62512,
-63867, 62476, 63736, 62388, 63578, 62270, 63420, 62161,
-63313, 62091, 63273, 62117, 63367, 62260, 63600, 62537,
-64001, 62927, 64540, 63424, 65195, 63986,   338, 64575,
-  991, 65172,  1537,   194,  1967,   694,  2246,  1160,
- 2402,  1597,  2447,  2019,  2405,  2396,  2319,  2767,
- 2151,  3112,  1951,  3437,  1681,  3732,  1400,  3990,
- 1122,  4245,   858,  4492,   673,  4734,   590,  4975,
-  673,  5215,   898,  5438,  1262,  5673,  1755,  5934,
- 2332,  6208,  2936,  6512,  3494,  6821,  3961,  7127,
- 4310,  7398,  4522,  7606,  4589,  7731,  4468,  7769,
- 4231,  7729,  3878,  7595,  3464,  7364,  2970,  7029,
- 2443,  6574,  1932,  6020,  1456,  5390,  1021,  4690,
-  652,  3961,   383,  3259,   240,  2598,   197,  2026,
-  305,  1545,   502,  1188,   781,   927,  1135,   757,
- 1533,   649,  1960,   625,  2392,   648,  2843,   732,
- 3287,   846,  3709,   989,  4077,  1109,  4383,  1173,
- 4614,  1161,  4755,  1022,  4783,   758,  4693,   330,
- 4511, 65325,  4245, 64659,  3889, 63915,  3472, 63134,
- 3008, 62368,  2487, 61667,  1909, 61048,  1280, 60511,
-  581, 60065, 65399, 59666, 64663, 59282, 63964, 58927,
-63304, 58608, 62727, 58342, 62255, 58182, 61871, 58147,
-61593, 58278, 61413, 58562, 61314, 58990, 61274, 59494,
-61280, 60050, 61311, 60583, 61356, 61062, 61410, 61464,
-61464, 61757, 61513, 61956, 61549, 62084, 61624, 62129,
-61716, 62153, 61876, 62156, 62110, 62194, 62395, 62293,
-62748, 62482, 63149, 62807, 63556, 63261, 63949, 63855,
-64312, 64577, 64604, 65366, 64826,   638, 64981,  1392,
-65064,  2072, 65105,  2637, 65111,  3075, 65115,  3389,
-65116,  3575, 65140,  3649, 65155,  3651, 65186,  3597,
-65260,  3537, 65383,  3453, 65532,  3392,   160,  3349,
-  316,  3296,   443,  3196,   477,  3042,   382,  2804,
-  168,  2486, 65376,  2073, 64922,  1551, 64361,   941,
-63709,   231, 63002, 64987, 62265, 64115, 61518, 63220,
-60798, 62319, 60156, 61463, 59620, 60680, 59218, 60006,
-58973, 59473, 58896, 59104, 58989, 58918, 59234, 58887,
-59611, 59013, 60087, 59237, 60610, 59526, 61144, 59817,
-61642, 60088, 62063, 60307, 62417, 60472, 62681, 60598,
-62917, 60715, 63144, 60861, 63416, 61058, 63726, 61338,
-64104, 61683, 64518, 62096, 64981, 62557, 65471, 63055,
-  466, 63562,  1029, 64084,  1589, 64608,  2136, 65150,
- 2623,   198,  3065,   805,  3413,  1441,  3641,  2085,
- 3760,  2717,  3766,  3304,  3671,  3859,  3510,  4337,
- 3251,  4775,  3010,  5164,  2771,  5553,  2617,  5951,
- 2568,  6369,  2677,  6796,  2968,  7239,  3439,  7697,
- 4068,  8143,  4798,  8579,  5575,  9011,  6346,  9435,
- 7065,  9869,  7654, 10288,  8083, 10679,  8298, 10969,
- 8321, 11148,  8117, 11167,  7736, 11017,  7182, 10676,
- 6516, 10182,  5776,  9550,  5002,  8825,  4208,  8027,
- 3473,  7189,  2837,  6351,  2309,  5526,  1940,  4745,
- 1732,  4036,  1671,  3402,  1710,  2866,  1847,  2430,
- 2011,  2088,  2222,  1821,  2439,  1593,  2651,  1392,
- 2848,  1180,  3007,   959,  3133,   714,  3218,   440,
- 3239,   130,  3206, 65309,  3126, 64900,  2994, 64416,
- 2801, 63887,  2533, 63283,  2193, 62629,  1774, 61948,
- 1323, 61254,   828, 60556,   310, 59886, 65315, 59228,
-64755, 58603, 64181, 58020, 63576, 57524, 62934, 57076,
-62257, 56712, 61587, 56438, 60949, 56272, 60379, 56220,
-59902, 56293, 59532, 56458, 59298, 56746, 59160, 57098,
-59135, 57538, 59175, 58011, 59282, 58510, 59464, 59030,
-59701, 59523, 60008, 59998, 60351, 60422, 60759, 60814,
-61205, 61148, 61667, 61450, 62135, 61725, 62590, 62029,
-63028, 62349, 63445, 62754, 63856, 63210, 64249, 63732,
-64639, 64292, 64993, 64939, 65308,    58,    41,   723,
-  222,  1364,   351,  1933,   429,  2418,   477,  2785,
-  546,  3023,   632,  3183,   778,  3263,   949,  3329,
- 1162,  3396,  1360,  3484,  1559,  3585,  1713,  3697,
- 1814,  3804,  1853,  3852,  1835,  3853,  1749,  3756,
- 1608,  3582,  1397,  3299,  1119,  2903,   752,  2421,
-  315,  1857, 65355,  1231, 64795,   569, 64186, 65416,
-63542, 64705, 62875, 63973, 62233, 63259, 61634, 62551,
-61111, 61881, 60677, 61235, 60362, 60674, 60151, 60179,
-60013, 59770, 59944, 59466, 59975, 59242, 60049, 59096,
-60196, 59008, 60364, 58990, 60550, 59024, 60751, 59110,
-60961, 59238, 61153, 59394, 61358, 59594, 61567, 59831,
-61812, 60108, 62083, 60404, 62410, 60757, 62779, 61165,
-63168, 61624, 63582, 62121, 64026, 62637, 64471, 63166,
-64891, 63712, 65294, 64238,    92, 64772,   397, 65291,
-  630,   278,   792,   814,   853,  1366,   852,  1946,
-  797,  2547,   730,  3167,   692,  3784,   706,  4419,
-  806,  5039,  1039,  5639,  1410,  6216,  1923,  6753,
- 2551,  7261,  3258,  7737,  4025,  8192,  4809,  8623,
- 5551,  9019,  6215,  9413,  6749,  9757,  7149, 10075,
- 7381, 10331,  7460, 10522,  7394, 10596,  7219, 10528,
- 6931, 10312,  6567,  9952,  6156,  9493,  5694,  8924,
- 5240,  8312,  4780,  7678,  4360,  7041,  3962,  6423,
- 3597,  5834,  3283,  5259,  3007,  4717,  2761,  4177,
- 2582,  3684,  2435,  3240,  2348,  2830,  2311,  2468,
- 2318,  2151,  2373,  1874,  2473,  1619,  2591,  1355,
- 2743,  1105,  2866,   825,  2944,   533,  2976,   188,
- 2905, 65345,  2758, 64895,  2506, 64371,  2159, 63762,
- 1712, 63076,  1190, 62353,   597, 61598, 65498, 60857,
-64832, 60142, 64147, 59482, 63483, 58887, 62864, 58383,
-62309, 57972, 61812, 57650, 61370, 57420, 60997, 57279,
-60688, 57222, 60463, 57254, 60326, 57390, 60262, 57613,
-60261, 57933, 60319, 58320, 60417, 58765, 60533, 59225,
-60647, 59687, 60776, 60089, 60904, 60426, 61045, 60678,
-61202, 60882, 61405, 61060, 61664, 61216, 61993, 61414,
-62396, 61674, 62861, 62024, 63371, 62477, 63895, 63018,
-64433, 63672, 64946, 64391, 65417, 65143,   304,   365,
-  682,  1101,  1013,  1800,  1291,  2429,  1494,  2973,
- 1660,  3421,  1780,  3788,  1891,  4059,  1972,  4261,
- 2067,  4396,  2193,  4492,  2351,  4578,  2550,  4633,
- 2762,  4682,  2985,  4694,  3157,  4676,  3270,  4580,
- 3310,  4416,  3253,  4156,  3080,  3823,  2812,  3391,
- 2416,  2874,  1916,  2283,  1294,  1631,   589,   942,
-65358,   223, 64539, 65033, 63724, 64299, 62956, 63572,
-62277, 62872, 61692, 62225, 61270, 61636, 60976, 61121,
-60819, 60692, 60776, 60365, 60847, 60134, 60986, 59978,
-61179, 59909, 61387, 59902, 61590, 59969, 61783, 60060,
-61939, 60179, 62085, 60303, 62203, 60437, 62328, 60578,
-62441, 60738, 62596, 60915, 62785, 61130, 63024, 61391,
-63307, 61702, 63651, 62054, 64035, 62441, 64447, 62874,
-64873, 63321, 65301, 63799,   126, 64277,   432, 64750,
-  638, 65208,   739,   118,   714,   552,   583,   967,
-  376,  1398,   131,  1827, 65438,  2241, 65240,  2639,
-65133,  3029, 65119,  3410, 65258,  3787,     3,  4173,
-  418,  4577,   976,  5019,  1615,  5494,  2343,  6021,
- 3114,  6586,  3912,  7140,  4680,  7680,  5365,  8170,
- 5930,  8576,  6342,  8873,  6543,  9050,  6574,  9107,
- 6422,  9044,  6150,  8861,  5777,  8553,  5372,  8158,
- 4937,  7672,  4509,  7124,  4111,  6519,  3751,  5906,
- 3425,  5312,  3126,  4766,  2893,  4301,  2714,  3901,
- 2612,  3580,  2559,  3321,  2578,  3116,  2644,  2911,
- 2741,  2720,  2857,  2517,  2966,  2308,  3069,  2092,
- 3136,  1863,  3182,  1625,  3187,  1363,  3191,  1080,
- 3143,   766,  3074,   389,  2971, 65511,  2795, 65024,
- 2540, 64471,  2198, 63872,  1747, 63222,  1216, 62548,
-  591, 61847, 65467, 61143, 64786, 60455, 64085, 59796,
-63415, 59165, 62762, 58610, 62172, 58118, 61594, 57724,
-61071, 57442, 60590, 57290, 60160, 57234, 59808, 57288,
-59556, 57410, 59416, 57605, 59360, 57847, 59366, 58105,
-59425, 58393, 59510, 58679, 59624, 58969, 59775, 59260,
-59975, 59538, 60211, 59789, 60489, 60044, 60802, 60281,
-61144, 60543, 61503, 60839, 61876, 61198, 62249, 61623,
-62642, 62127, 63034, 62712, 63445, 63339, 63841, 64020,
-64220, 64712, 64588, 65403, 64948,   526, 65292,  1127,
-   77,  1663,   389,  2128,   682,  2558,   937,  2925,
- 1182,  3266,  1406,  3577,  1608,  3860,  1807,  4097,
- 2010,  4279,  2222,  4407,  2449,  4480,  2653,  4501,
- 2829,  4465,  2953,  4350,  3014,  4168,  2995,  3891,
- 2872,  3537,  2679,  3103,  2387,  2616,  2046,  2113,
- 1635,  1603,  1179,  1108,   692,   625,   171,   161,
-65184, 65227, 64641, 64698, 64081, 64135, 63564, 63540,
-63088, 62932, 62673, 62340, 62360, 61815, 62139, 61381,
-62038, 61023, 62059, 60792, 62141, 60622, 62277, 60528,
-62417, 60477, 62542, 60471, 62650, 60511, 62744, 60593,
-62823, 60711, 62899, 60867, 63013, 61056, 63174, 61270,
-63370, 61499, 63590, 61749, 63829, 61992, 64069, 62259,
-64306, 62524, 64525, 62781, 64708, 63068, 64846, 63345,
-64933, 63653, 64976, 63976, 64951, 64342, 64872, 64744,
-64747, 65188, 64572,   125, 64389,   633, 64201,  1156,
-64046,  1672, 63951,  2182, 63956,  2680, 64091,  3180,
-64367,  3685, 64801,  4196, 65363,  4737,   477,  5298,
- 1160,  5875,  1846,  6428,  2511,  6983,  3094,  7471,
- 3587,  7899,  3997,  8260,  4319,  8547,  4582,  8754,
- 4752,  8882,  4861,  8917,  4887,  8818,  4837,  8625,
- 4716,  8318,  4542,  7926,  4310,  7461,  4065,  6954,
- 3816,  6449,  3593,  5972,  3394,  5525,  3220,  5119,
- 3081,  4757,  2966,  4440,  2889,  4157,  2838,  3900,
- 2822,  3672,  2859,  3452,  2951,  3231,  3113,  2995,
- 3344,  2756,  3627,  2513,  3925,  2255,  4186,  2006,
- 4390,  1722,  4479,  1400,  4465,  1014,  4311,   572,
- 4032,    41,  3636, 64992,  3156, 64324,  2605, 63610,
- 1990, 62878,  1325, 62147,   628, 61449, 65448, 60786,
-64751, 60202, 64088, 59682, 63504, 59273, 63019, 58939,
-62652, 58706, 62388, 58554, 62195, 58489, 62060, 58486,
-61933, 58544, 61816, 58648, 61687, 58759, 61541, 58892,
-61381, 59019, 61214, 59170, 61068, 59304, 60929, 59422,
-60840, 59530, 60792, 59667, 60798, 59812, 60882, 60010,
-61034, 60251, 61247, 60577, 61521, 60974, 61852, 61442,
-62213, 61963, 62613, 62536, 63023, 63117, 63433, 63704,
-63829, 64293, 64195, 64864, 64535, 65431, 64824,   425,
-65069,   960, 65274,  1458, 65445,  1926,    52,  2354,
-  200,  2756,   367,  3157,   555,  3540,   820,  3934,
- 1129,  4330,  1488,  4719,  1887,  5073,  2293,  5365,
- 2682,  5569,  3017,  5648,  3278,  5606,  3451,  5424,
- 3521,  5142,  3486,  4752,  3341,  4300,  3082,  3781,
- 2710,  3243,  2257,  2693,  1714,  2117,  1141,  1523,
-  533,   908, 65489,   306, 64944, 65252, 64462, 64675,
-64081, 64128, 63796, 63609, 63605, 63131, 63514, 62692,
-63471, 62275, 63470, 61892, 63494, 61530, 63501, 61222,
-63495, 60952, 63469, 60744, 63429, 60573, 63373, 60433,
-63311, 60333, 63233, 60272, 63169, 60238, 63135, 60250,
-63156, 60304, 63243, 60420, 63400, 60565, 63626, 60738,
-63909, 60948, 64221, 61181, 64525, 61446, 64771, 61736,
-64929, 62054, 64995, 62387, 64948, 62728, 64810, 63075,
-64593, 63425, 64310, 63777, 64003, 64134, 63689, 64507,
-63398, 64891, 63174, 65299, 63050,   190, 63051,   678,
-63188,  1213, 63488,  1797, 63938,  2424, 64538,  3083,
-65257,  3777,   514,  4473,  1331,  5177,  2144,  5851,
- 2881,  6467,  3518,  7024,  4025,  7482,  4397,  7836,
- 4651,  8038,  4805,  8117,  4860,  8069,  4835,  7921,
- 4745,  7697,  4628,  7405,  4467,  7087,  4304,  6745,
- 4151,  6415,  3985,  6090,  3845,  5814,  3695,  5570,
- 3558,  5357,  3427,  5169,  3299,  4983,  3201,  4792,
- 3128,  4586,  3102,  4357,  3124,  4101,  3188,  3821,
- 3285,  3511,  3384,  3193,  3484,  2851,  3559,  2505,
- 3591,  2158,  3592,  1811,  3536,  1468,  3418,  1109,
- 3240,   725,  2994,   296,  2666, 65354,  2267, 64801,
- 1780, 64168,  1219, 63476,   605, 62750, 65484, 62015,
-64811, 61304, 64145, 60638, 63499, 60034, 62894, 59509,
-62348, 59072, 61870, 58727, 61474, 58466, 61149, 58297,
-60898, 58207, 60699, 58203, 60538, 58257, 60409, 58363,
-60311, 58491, 60273, 58647, 60241, 58787, 60276, 58951,
-60349, 59093, 60453, 59237, 60561, 59400, 60667, 59578,
-60782, 59798, 60911, 60048, 61061, 60335, 61236, 60651,
-61441, 61013, 61673, 61415, 61938, 61862, 62214, 62333,
-62523, 62833, 62836, 63364, 63169, 63909, 63503, 64453,
-63841, 65008, 64156,    13, 64439,   547, 64705,  1069,
-64956,  1573, 65183,  2055, 65403,  2525,    78,  2977,
-  302,  3385,   553,  3747,   807,  4075,  1080,  4327,
- 1346,  4542,  1618,  4650,  1856,  4683,  2069,  4599,
- 2231,  4439,  2352,  4197,  2389,  3897,  2356,  3566,
- 2248,  3232,  2053,  2903,  1781,  2558,  1442,  2222,
- 1060,  1842,   646,  1426,   225,   977, 65363,   489,
-64987, 65524, 64668, 64990, 64395, 64484, 64183, 63991,
-64052, 63549, 63976, 63151, 63979, 62811, 64039, 62537,
-64142, 62320, 64280, 62180, 64400, 62101, 64520, 62081,
-64615, 62122, 64693, 62193, 64770, 62285, 64867, 62369,
-64983, 62433, 65119, 62489, 65282, 62532, 65466, 62576,
-  104, 62636,   295, 62702,   476, 62801,   633, 62942,
-  750, 63120,   794, 63342,   785, 63602,   686, 63895,
-  505, 64221,   259, 64558, 65508, 64915, 65196, 65253,
-64904,    60, 64663,   404, 64494,   773, 64403,  1138,
-64409,  1504, 64517,  1907, 64732,  2351, 65037,  2861,
-65436,  3417,   363,  4016,   904,  4659,  1515,  5349,
- 2085,  5982,  2632,  6553,  3106,  7032,  3501,  7406,
- 3809,  7666,  4044,  7803,  4203,  7835,  4310,  7757,
- 4347,  7594,  4339,  7351,  4252,  7060,  4111,  6718,
- 3928,  6343,  3678,  5961,  3400,  5570,  3092,  5201,
- 2799,  4841,  2527,  4510,  2302,  4225,  2103,  3965,
- 1974,  3728,  1902,  3530,  1905,  3328,  1957,  3136,
- 2074,  2941,  2230,  2770,  2409,  2584,  2583,  2383,
- 2754,  2148,  2894,  1872,  2975,  1541,  2988,  1162,
- 2922,   728,  2775,   247,  2517, 65254,  2181, 64677,
- 1771, 64050,  1283, 63387,   743, 62700,   181, 62022,
-65170, 61373, 64650, 60769, 64164, 60240, 63725, 59810,
-63349, 59478, 63009, 59253, 62731, 59103, 62499, 59016,
-62314, 58977, 62175, 58955, 62094, 58953, 62017, 58930,
-61957, 58924, 61888, 58918, 61819, 58933, 61734, 58961,
-61673, 59023, 61640, 59110, 61645, 59257, 61713, 59448,
-61811, 59688, 61940, 59973, 62083, 60310, 62234, 60687,
-62372, 61116, 62532, 61575, 62695, 62041, 62882, 62514,
-63087, 62986, 63308, 63430, 63503, 63847, 63695, 64249,
-63868, 64654, 64021, 65059, 64169, 65467, 64317,   354,
-64468,   793, 64611,  1253, 64745,  1708, 64872,  2169,
-65013,  2621, 65160,  3062, 65362,  3470,    52,  3834,
-  337,  4136,   648,  4346,   961,  4481,  1281,  4502,
- 1540,  4434,  1745,  4284,  1863,  4062,  1892,  3797,
- 1822,  3484,  1659,  3172,  1431,  2845,  1139,  2515,
-  817,  2172,   478,  1821,   146,  1461, 65380,  1078,
-65124,   684, 64911,   275, 64773, 65399, 64683, 64988,
-64658, 64604, 64667, 64257, 64733, 63947, 64799, 63667,
-64886, 63447, 64954, 63249, 65006, 63093, 65052, 62960,
-65082, 62857, 65111, 62797, 65122, 62751, 65160, 62735,
-65215, 62739, 65301, 62748, 65422, 62751,    48, 62772,
-  246, 62802,   463, 62862,   667, 62963,   846, 63082,
-  970, 63232,  1027, 63390,  1016, 63551,   943, 63705,
-  806, 63887,   620, 64053,   404, 64253,   132, 64438,
-65377, 64653, 65073, 64872, 64780, 65106, 64556, 65359,
-64406,    97, 64366,   422, 64427,   791, 64600,  1203,
-64851,  1657, 65179,  2145, 65523,  2659,   351,  3172,
-  708,  3666,  1052,  4112,  1366,  4488,  1629,  4767,
- 1833,  4933,  1979,  4999,  2055,  4969,  2061,  4865,
- 2027,  4712,  1963,  4547,  1888,  4368,  1805,  4188,
- 1730,  4029,  1660,  3866,  1601,  3724,  1529,  3588,
- 1469,  3471,  1410,  3389,  1358,  3323,  1314,  3283,
- 1273,  3243,  1268,  3207,  1293,  3144,  1341,  3081,
- 1437,  2963,  1550,  2834,  1693,  2672,  1828,  2492,
- 1969,  2294,  2086,  2096,  2192,  1887,  2259,  1657,
- 2286,  1395,  2268,  1088,  2193,   727,  2074,   303,
- 1910, 65379,  1692, 64866,  1421, 64328,  1099, 63790,
-  737, 63272,   349, 62799, 65499, 62372, 65119, 62007,
-64758, 61696, 64428, 61452, 64140, 61270, 63888, 61134,
-63667, 61062, 63457, 61010, 63270, 60989, 63109, 60966,
-62970, 60937, 62860, 60891, 62813, 60848, 62784, 60811,
-62806, 60799, 62837, 60824, 62886, 60902, 62910, 61015,
-62932, 61175, 62953, 61349, 62980, 61559, 63016, 61773,
-63076, 62005, 63146, 62251, 63237, 62479, 63307, 62721,
-63373, 62954, 63436, 63190, 63477, 63453, 63537, 63735,
-63620, 64050, 63736, 64387, 63876, 64763, 64061, 65162,
-64227,    51, 64384,   494, 64502,   942, 64591,  1383,
-64675,  1802, 64763,  2196, 64870,  2541, 65007,  2831,
-65196,  3075, 65397,  3260,    95,  3389,   336,  3463,
-  580,  3488,   795,  3476,   979,  3433,  1124,  3351,
- 1218,  3237,  1248,  3105,  1225,  2940,  1129,  2728,
-  992,  2489,   789,  2203,   558,  1885,   284,  1523,
-    7,  1140, 65268,   736, 64999,   324, 64772, 65452,
-64577, 65064, 64463, 64672, 64397, 64344, 64400, 64055,
-64451, 63832, 64544, 63690, 64648, 63603, 64766, 63576,
-64887, 63582, 65019, 63603, 65149, 63622, 65289, 63627,
-65439, 63628,    51, 63619,   212, 63599,   381, 63565,
-  546, 63537,   698, 63512,   848, 63495,   966, 63483,
- 1049, 63502,  1098, 63543,  1117, 63639,  1101, 63767,
- 1052, 63932,   949, 64123,   805, 64340,   626, 64558,
-  440, 64772,   230, 64990,    32, 65216, 65403, 65451,
-65290,   178, 65244,   488, 65244,   814, 65306,  1184,
-65427,  1584,    74,  2023,   317,  2487,   606,  2958,
-  932,  3419,  1261,  3840,  1566,  4219,  1832,  4532,
- 2048,  4784,  2242,  4968,  2379,  5070,  2487,  5097,
- 2557,  5051,  2601,  4934,  2601,  4751,  2560,  4546,
- 2489,  4296,  2383,  4068,  2235,  3828,  2076,  3593,
- 1891,  3389,  1710,  3174,  1533,  2982,  1371,  2791,
- 1228,  2606,  1118,  2442,  1061,  2297,  1058,  2170,
- 1100,  2055,  1185,  1975,  1303,  1896,  1454,  1820,
- 1605,  1738,  1759,  1623,  1859,  1469,  1918,  1246,
- 1916,   976,  1863,   628,  1765,   233,  1609, 65329,
- 1423, 64854,  1208, 64368,   955, 63875,   669, 63391,
-  377, 62922,    70, 62496, 65318, 62126, 65037, 61824,
-64786, 61591, 64541, 61420, 64319, 61325, 64121, 61254,
-63929, 61226, 63762, 61186, 63594, 61157, 63438, 61105,
-63306, 61041, 63179, 60976, 63060, 60906, 62974, 60847,
-62900, 60806, 62881, 60803, 62893, 60824, 62942, 60909,
-63014, 61052, 63102, 61262, 63209, 61509, 63332, 61808,
-63449, 62128, 63580, 62452, 63724, 62774, 63870, 63065,
-64010, 63339, 64137, 63579, 64248, 63812, 64306, 64028,
-64347, 64247, 64348, 64467, 64336, 64710, 64319, 64977,
-64319, 65273, 64354,    66, 64409,   430, 64490,   821,
-64580,  1227, 64684,  1634, 64792,  2028, 64917,  2374,
-65050,  2671, 65222,  2900, 65431,  3081,   119,  3198,
-  374,  3253,   611,  3262,   832,  3236,   971,  3157,
- 1046,  3050,  1048,  2902,   963,  2712,   804,  2502,
-  573,  2238,   301,  1960,    18,  1678, 65272,  1375,
-65006,  1073, 64785,   753, 64602,   450, 64484,   150,
-64404, 65402, 64381, 65124, 64384, 64873, 64398, 64651,
-64442, 64458, 64503, 64299, 64564, 64158, 64629, 64039,
-64692, 63944, 64753, 63855, 64795, 63793, 64834, 63735,
-64876, 63695, 64935, 63651, 65016, 63597, 65119, 63544,
-65251, 63498, 65428, 63474,    75, 63472,   262, 63498,
-  434, 63562,   564, 63625,   675, 63730,   732, 63819,
-  746, 63934,   704, 64053,   620, 64185,   536, 64336,
-  406, 64500,   290, 64668,   141, 64841,    26, 65026,
-65450, 65221, 65379, 65453, 65337,   171, 65375,   489,
-65465,   842,    83,  1237,   286,  1670,   514,  2115,
-  765,  2554,   996,  2968,  1221,  3318,  1409,  3606,
- 1569,  3816,  1701,  3953,  1784,  4004,  1836,  3984,
- 1845,  3915,  1848,  3800,  1836,  3676,  1824,  3522,
- 1815,  3387,  1789,  3248,  1747,  3142,  1678,  3044,
- 1601,  2967,  1500,  2901,  1409,  2827,  1308,  2758,
- 1219,  2666,  1147,  2584,  1084,  2468,  1052,  2370,
- 1040,  2274,  1032,  2181,  1063,  2096,  1095,  1995,
- 1139,  1898,  1177,  1781,  1223,  1640,  1262,  1489,
- 1296,  1303,  1318,  1091,  1316,   851,  1294,   562,
- 1228,   245,  1125, 65434,   993, 65066,   838, 64695,
-  664, 64332,   474, 63983,   280, 63669,    66, 63381,
-65400, 63141, 65163, 62942, 64910, 62777, 64665, 62674,
-64403, 62591, 64171, 62545, 63952, 62496, 63776, 62455,
-63647, 62388, 63573, 62313, 63543, 62231, 63535, 62148,
-63557, 62090, 63592, 62053, 63624, 62043, 63659, 62072,
-63708, 62140, 63770, 62236, 63840, 62367, 63928, 62510,
-64004, 62651, 64082, 62811, 64138, 62946, 64186, 63089,
-64237, 63207, 64277, 63331, 64334, 63445, 64395, 63590,
-64472, 63742, 64571, 63927, 64663, 64141, 64740, 64409,
-64802, 64716, 64832, 65053, 64863, 65404, 64871,   213,
-64896,   558, 64928,   886, 64982,  1191, 65052,  1461,
-65152,  1691, 65259,  1889, 65396,  2021,     8,  2119,
-  167,  2169,   359,  2206,   542,  2212,   732,  2227,
-  880,  2230,   995,  2228,  1038,  2217,  1020,  2177,
-  950,  2103,   816,  1982,   649,  1808,   454,  1609,
-  241,  1365,    29,  1103, 65361,   835, 65154,   558,
-64966,   282, 64805,    33, 64676, 65328, 64594, 65122,
-64541, 64913, 64543, 64757, 64586, 64617, 64644, 64531,
-64730, 64470, 64813, 64440, 64903, 64436, 64977, 64446,
-65059, 64461, 65148, 64458, 65247, 64449, 65349, 64418,
-65463, 64368,    23, 64303,   109, 64233,   181, 64163,
-  224, 64116,   269, 64088,   305, 64099,   335, 64134,
-  370, 64201,   396, 64287,   414, 64382,   408, 64500,
-  393, 64625,   374, 64765,   344, 64911,   299, 65063,
-  256, 65219,   213, 65379,   161,     5,   125,   192,
-   83,   400,    72,   642,    82,   919,   148,  1205,
-  231,  1509,   357,  1815,   496,  2089,   646,  2327,
-  797,  2527,   942,  2669,  1084,  2772,  1214,  2825,
- 1347,  2840,  1455,  2846,  1543,  2823,  1590,  2789,
- 1613,  2747,  1603,  2675,  1569,  2590,  1495,  2471,
- 1404,  2347,  1276,  2205,  1144,  2063,   999,  1925,
-  860,  1797,   757,  1704,   696,  1626,   683,  1590,
-  709,  1550,   775,  1542,   846,  1542,   946,  1530,
- 1037,  1527,  1127,  1509,  1190,  1460,  1238,  1385,
- 1257,  1261,  1251,  1090,  1214,   862,  1160,   589,
- 1079,   269,   988, 65451,   869, 65084,   735, 64708,
-  594, 64374,   439, 64067,   277, 63803,   101, 63611,
-65504, 63460, 65361, 63380, 65237, 63327, 65116, 63300,
-64993, 63300, 64867, 63288, 64745, 63275, 64607, 63243,
-64473, 63191, 64345, 63116, 64224, 63021, 64118, 62913,
-64021, 62800, 63948, 62703, 63906, 62619, 63886, 62573,
-63892, 62560, 63928, 62595, 63962, 62659, 64025, 62762,
-64087, 62882, 64161, 63023, 64247, 63171, 64346, 63321,
-64438, 63468, 64541, 63613, 64620, 63768, 64685, 63912,
-64731, 64070, 64758, 64231, 64769, 64386, 64777, 64555,
-64765, 64741, 64759, 64931, 64732, 65151, 64709, 65393,
-64677,   120, 64651,   410, 64632,   705, 64648,   980,
-64696,  1228, 64799,  1428, 64948,  1595, 65124,  1705,
-65309,  1787, 65492,  1856,    96,  1894,   232,  1928,
-  325,  1946,   399,  1941,   433,  1916,   438,  1870,
-  409,  1789,   345,  1666,   255,  1542,   137,  1375,
-   12,  1221, 65424,  1035, 65297,   841, 65188,   652,
-65096,   453, 65016,   276, 64945,   100, 64907, 65490,
-64882, 65353, 64894, 65241, 64899, 65136, 64933, 65040,
-64963, 64946, 65018, 64884, 65074, 64829, 65133, 64796,
-65197, 64779, 65261, 64776, 65340, 64776, 65415, 64765,
-65498, 64755,    47, 64741,   139, 64717,   219, 64697,
-  282, 64651,   320, 64625,   350, 64587,   352, 64575,
-  347, 64555,   332, 64544,   307, 64547,   291, 64564,
-  257, 64600,   218, 64640,   148, 64686,    60, 64750,
-65507, 64831, 65414, 64944, 65332, 65081, 65267, 65276,
-65248, 65489, 65264,   191, 65327,   456, 65424,   727,
-   10,  1000,   139,  1241,   296,  1474,   433,  1660,
-  555,  1820,   672,  1933,   782,  2019,   876,  2054,
-  972,  2068,  1054,  2056,  1117,  2040,  1167,  2019,
- 1162,  1981,  1142,  1953,  1061,  1913,   989,  1872,
-  888,  1824,   810,  1775,   751,  1725,   718,  1683,
-  708,  1645,   705,  1624,   715,  1601,   737,  1607,
-  766,  1601,   810,  1601,   854,  1594,   920,  1574,
-  979,  1553,  1051,  1515,  1098,  1475,  1137,  1425,
- 1148,  1368,  1150,  1290,  1155,  1192,  1142,  1057,
- 1135,   890,  1117,   681,  1102,   444,  1088,   186,
- 1045, 65446,   999, 65172,   911, 64905,   812, 64661,
-  680, 64447,   521, 64271,   350, 64134,   178, 64011,
-    5, 63938, 65376, 63863, 65215, 63803, 65066, 63733,
-64924, 63654, 64801, 63577, 64693, 63503, 64607, 63439,
-64549, 63382, 64513, 63349, 64502, 63330, 64519, 63325,
-64541, 63332, 64560, 63338, 64567, 63352, 64555, 63374,
-64538, 63409, 64506, 63473, 64496, 63546, 64477, 63637,
-64480, 63718, 64499, 63798, 64534, 63869, 64573, 63924,
-64616, 64004, 64649, 64092, 64686, 64215, 64702, 64366,
-64707, 64540, 64709, 64726, 64689, 64932, 64691, 65138,
-64685, 65350, 64713,    31, 64741,   226, 64779,   435,
-64821,   615, 64864,   774, 64908,   909, 64970,  1013,
-65042,  1103, 65151,  1178, 65269,  1253, 65405,  1328,
-    8,  1400,   139,  1473,   266,  1533,   358,  1586,
-  434,  1609,   485,  1591,   497,  1534,   477,  1434,
-  417,  1292,   324,  1116,   206,   907,    52,   688,
-65443,   463, 65302,   242, 65171,    38, 65070, 65397,
-64992, 65233, 64939, 65101, 64900, 64994, 64893, 64927,
-64884, 64876, 64916, 64867, 64976, 64867, 65061, 64903,
-65178, 64949, 65297, 65002, 65440, 65073,    15, 65115,
-  135, 65149,   227, 65146,   290, 65124,   321, 65070,
-  323, 64997,   312, 64924,   291, 64851,   275, 64794,
-  264, 64757,   266, 64742,   269, 64733,   267, 64752,
-  271, 64761,   262, 64781,   231, 64796,   194, 64826,
-  154, 64858,   110, 64914,    75, 64994,    40, 65102,
-    9, 65228, 65535, 65386, 65522,    11, 65518,   170,
-65511,   334, 65520,   473, 65525,   613,    14,   728,
-   38,   833,    87,   937,   177,  1034,   280,  1123,
-  409,  1205,   526,  1280,   641,  1336,   725,  1379,
-  783,  1410,   805,  1425,   794,  1424,   766,  1415,
-  703,  1379,   637,  1356,   541,  1298,   450,  1260,
-  358,  1205,   284,  1172,   239,  1137,   224,  1128,
-  251,  1127,   306,  1139,   383,  1159,   480,  1179,
-  570,  1199,   653,  1214,   723,  1221,   775,  1219,
-  832,  1199,   869,  1158,   897,  1076,   905,   962,
-  895,   803,   860,   611,   811,   389,   739,   153,
-  654, 65471,   559, 65256,   468, 65075,   382, 64920,
-  308, 64812,   232, 64732,   162, 64674,   101, 64638,
-   38, 64599, 65510, 64562, 65442, 64525, 65370, 64469,
-65291, 64402, 65204, 64321, 65126, 64241, 65046, 64166,
-64966, 64086, 64910, 64026, 64860, 63980, 64835, 63957,
-64817, 63941, 64823, 63956, 64829, 63987, 64847, 64026,
-64857, 64081, 64863, 64140, 64867, 64216, 64867, 64279,
-64872, 64356, 64877, 64423, 64902, 64488, 64918, 64549,
-64934, 64595, 64944, 64637, 64937, 64672, 64909, 64702,
-64876, 64745, 64847, 64793, 64823, 64887, 64807, 64992,
-64809, 65143, 64820, 65312, 64848, 65487, 64878,   133,
-64913,   311, 64968,   485, 65022,   625, 65090,   758,
-65159,   851, 65241,   943, 65327,  1003, 65408,  1050,
-65497,  1094,    38,  1124,   105,  1145,   163,  1149,
-  183,  1126,   192,  1091,   161,  1024,   111,   952,
-   58,   856, 65530,   750, 65486,   648, 65439,   541,
-65400,   437, 65368,   329, 65330,   223, 65301,   110,
-65267,    12, 65243, 65439, 65217, 65343, 65214, 65253,
-65207, 65174, 65229, 65111, 65236, 65072, 65270, 65047,
-65302, 65038, 65360, 65045, 65416, 65062, 65492, 65081,
-   11, 65091,    70, 65097,   129, 65102,   172, 65103,
-  210, 65110,   229, 65120,   245, 65120,   245, 65123,
-  240, 65112,   221, 65090,   217, 65069,   193, 65021,
-  169, 64981,   144, 64941,   110, 64906,    58, 64877,
-   12, 64876, 65500, 64880, 65450, 64929, 65423, 64988,
-65415, 65105, 65422, 65226, 65444, 65392, 65473,    19,
-65509,   177,     0,   330,    17,   450,    53,   544,
-   79,   608,   140,   669,   198,   709,   275,   744,
-  355,   768,   445,   795,   528,   808,   608,   833,
-  655,   847,   691,   861,   697,   889,   686,   930,
-  660,   975,   616,  1011,   582,  1052,   534,  1077,
-  504,  1102,   463,  1107,   449,  1109,   430,  1098,
-  439,  1094,   463,  1085,   499,  1069,   550,  1070,
-  606,  1063,   661,  1067,   708,  1079,   730,  1092,
-  746,  1098,   759,  1102,   776,  1094,   791,  1068,
-  785,  1004,   806,   926,   813,   820,   818,   697,
-  806,   559,   787,   412,   736,   255,   671,   110,
-  572, 65503,   471, 65374,   349, 65245,   218, 65133,
-   77, 65020, 65478, 64928, 65335, 64843, 65196, 64768,
-65069, 64689, 64974, 64616, 64895, 64547, 64853, 64475,
-64844, 64411, 64852, 64366, 64881, 64319, 64910, 64297,
-64948, 64276, 64971, 64267, 64992, 64260, 64991, 64249,
-64992, 64246, 64976, 64245, 64956, 64251, 64929, 64260,
-64896, 64284, 64869, 64305, 64848, 64324, 64833, 64352,
-64842, 64366, 64862, 64393, 64896, 64416, 64936, 64459,
-64969, 64515, 65001, 64581, 65020, 64664, 65042, 64774,
-65053, 64901, 65067, 65033, 65095, 65177, 65123, 65309,
-65156, 65442, 65178,    13, 65209,   117, 65234,   197,
-65260,   269, 65299,   335, 65348,   396, 65416,   464,
-65493,   530,    25,   596,    94,   664,   153,   721,
-  200,   770,   224,   795,   238,   801,   235,   784,
-  221,   740,   190,   683,   152,   600,    78,   491,
-   15,   384, 65483,   269, 65413,   157, 65342,    46,
-65277, 65494, 65222, 65411, 65170, 65349, 65141, 65309,
-65114, 65294, 65113, 65298, 65135, 65317, 65172, 65353,
-65229, 65392, 65296, 65429, 65385, 65456, 65470, 65482,
-   23, 65498,    86, 65496,   150, 65481,   183, 65465,
-  197, 65449,   184, 65430,   175, 65414,   144, 65405,
-  118, 65399,    81, 65397,    50, 65392,    30, 65388,
-   14, 65380,    11, 65382,    12, 65382,    24, 65379,
-   32, 65385,    52, 65383,    53, 65404,    52, 65425,
-   35, 65460,    15, 65501, 65520,    22, 65486,    83,
-65442,   157, 65415,   223, 65381,   279, 65367,   322,
-65359,   356, 65379,   377, 65414,   395, 65468,   410,
-65534,   424,    68,   444,   152,   474,   227,   494,
-  310,   530,   370,   549,   432,   563,   467,   564,
-  483,   551,   468,   534,   431,   504,   371,   468,
-  312,   441,   241,   404,   195,   390,   167,   366,
-  168,   363,   197,   373,   239,   399,   284,   432,
-  330,   474,   385,   526,   433,   569,   484,   611,
-  532,   642,   564,   664,   605,   680,   610,   665,
-  611,   641,   606,   573,   581,   487,   570,   366,
-  554,   226,   535,    88,   517, 65482,   478, 65371,
-  433, 65279,   376, 65229,   307, 65197,   228, 65183,
-  142, 65164,    59, 65158, 65511, 65134, 65444, 65110,
-65363, 65054, 65308, 65011, 65250, 64949, 65211, 64900,
-65174, 64848, 65158, 64800, 65141, 64758, 65150, 64733,
-65152, 64704, 65172, 64693, 65191, 64683, 65214, 64710,
-65221, 64749, 65239, 64819, 65239, 64895, 65232, 64975,
-65236, 65054, 65229, 65108, 65244, 65149, 65248, 65165,
-65258, 65159, 65265, 65132, 65261, 65111, 65262, 65100,
-65260, 65096, 65249, 65100, 65250, 65132, 65252, 65175,
-65260, 65234, 65280, 65300, 65283, 65381, 65299, 65479,
-65312,    39, 65340,   149, 65350,   262, 65384,   359,
-65401,   458, 65443,   532, 65471,   609, 65508,   654,
-   10,   701,    50,   725,    92,   745,   135,   748,
-  153,   734,   176,   701,   165,   655,   145,   597,
-  102,   529,    52,   454,    11,   368, 65508,   283,
-65481,   196, 65444,   122, 65421,    44, 65386,     2,
-65349, 65477, 65316, 65431, 65266, 65381, 65229, 65346,
-65180, 65296, 65147, 65257, 65128, 65206, 65126, 65166,
-65143, 65131, 65163, 65105, 65197, 65100, 65250, 65103,
-65300, 65120, 65343, 65158, 65391, 65187, 65426, 65236,
-65466, 65253, 65474, 65279, 65487, 65294, 65475, 65316,
-65467, 65331, 65453, 65353, 65438, 65366, 65431, 65373,
-65435, 65365, 65439, 65339, 65456, 65308, 65469, 65259,
-65483, 65229, 65490, 65191, 65499, 65191, 65495, 65211,
-65501, 65258, 65504, 65333, 65501, 65415, 65508, 65509,
-65508,    56, 65526,   155, 65533,   221,    15,   298,
-   47,   328,    76,   359,   112,   366,   155,   357,
-  203,   347,   260,   319,   322,   301,   389,   282,
-  458,   271,   515,   280,   573,   285,   596,   315,
-  613,   342,   608,   373,   589,   399,   573,   415,
-  535,   423,   505,   424,   470,   415,   449,   410,
-  431,   396,   412,   387,   411,   369,   410,   359,
-  417,   357,   421,   349,   423,   366,   418,   387,
-  391,   413,   370,   452,   330,   484,   314,   508,
-  283,   519,   289,   520,   290,   500,   311,   467,
-  329,   415,   342,   368,   342,   310,   330,   254,
-  303,   193,   268,   129,   222,    68,   160,    10,
-   82, 65486,     6, 65425, 65456, 65353, 65362, 65304,
-65270, 65241, 65196, 65200, 65129, 65149, 65087, 65106,
-65058, 65064, 65042, 65035, 65049, 65017, 65064, 65008,
-65090, 65013, 65106, 65023, 65136, 65039, 65153, 65057,
-65184, 65077, 65209, 65090, 65242, 65107, 65260, 65111,
-65278, 65117, 65289, 65119, 65306, 65121, 65301, 65126,
-65314, 65111, 65317, 65108, 65333, 65090, 65359, 65087,
-65376, 65083, 65405, 65090, 65413, 65106, 65414, 65135,
-65412, 65175, 65397, 65219, 65376, 65268, 65365, 65311,
-65354, 65356, 65342, 65388, 65340, 65434, 65347, 65467,
-65366, 65510, 65404,    11, 65441,    50, 65491,   109,
-65530,   160,    29,   211,    51,   262,    76,   301,
-   90,   334,   108,   353,   108,   353,   117,   332,
-  100,   297,    74,   250,    34,   190, 65528,   129,
-65485,    58, 65444,     7, 65411, 65496, 65381, 65443,
-65366, 65398, 65331, 65364, 65313, 65338, 65268, 65331,
-65235, 65331, 65197, 65331, 65181, 65349, 65167, 65372,
-65168, 65397, 65185, 65421, 65219, 65446, 65261, 65462,
-65308, 65488, 65365, 65497, 65413, 65501, 65466, 65510,
-65490, 65507, 65510, 65511, 65511, 65513, 65501, 65513,
-65477, 65525, 65456, 65531, 65424,     3, 65416,     5,
-65405,    19, 65410,    20, 65425,    20, 65449,    13,
-65495,     8, 65515,     1,    18, 65535,    34,    10,
-   62,    22,    80,    50,    85,    76,    86,   111,
-   87,   145,    79,   187,    79,   212,    72,   234,
-   74,   236,    71,   229,    84,   213,    99,   191,
-  111,   174,   145,   155,   168,   155,   209,   152,
-  252,   164,   285,   170,   329,   186,   360,   189,
-  386,   194,   407,   196,   405,   191,   402,   184,
-  391,   174,   373,   160,   357,   148,   334,   129,
-  324,   120,   313,   107,   302,   105,   288,   113,
-  286,   130,   271,   157,   265,   186,   252,   224,
-  241,   263,   229,   292,   218,   328,   202,   351,
-  190,   366,   177,   363,   169,   348,   172,   319,
-  181,   280,   194,   238,   216,   187,   226,   144,
-  236,    90,   230,    59,   223,    16,   183,     4,
-  144, 65513,    88, 65500,    33, 65479, 65516, 65458,
-65457, 65439, 65402, 65405, 65348, 65368, 65307, 65326,
-65266, 65283, 65254, 65246, 65242, 65203, 65242, 65178,
-65250, 65163, 65264, 65144, 65274, 65158, 65297, 65165,
-65308, 65199, 65330, 65235, 65342, 65277, 65360, 65320,
-65374, 65362, 65388, 65396, 65397, 65420, 65408, 65438,
-65417, 65439, 65426, 65425, 65423, 65396, 65414, 65363,
-65412, 65327, 65405, 65292, 65402, 65273, 65397, 65252,
-65394, 65254, 65381, 65253, 65368, 65273, 65355, 65291,
-65347, 65324, 65339, 65360, 65345, 65406, 65363, 65451,
-65387, 65508, 65425,    13, 65473,    70, 65521,   127,
-   17,   179,    67,   234,   103,   274,   132,   304,
-  155,   328,   169,   332,   169,   337,   161,   312,
-  138,   282,   118,   237,    96,   186,    69,   129,
-   54,    77,    27,    30,    14, 65530, 65528, 65513,
-65521, 65488, 65503, 65477, 65492, 65465, 65480, 65445,
-65447, 65426, 65427, 65396, 65395, 65370, 65376, 65344,
-65360, 65324, 65352, 65309, 65363, 65302, 65380, 65306,
-65402, 65308, 65446, 65321, 65467, 65342, 65509, 65359,
-65519, 65390,     5, 65412, 65530, 65455, 65518, 65481,
-65496, 65515, 65468, 65535, 65441, 65534, 65412,     2,
-65399, 65532, 65381, 65511, 65384, 65478, 65381, 65441,
-65387, 65407, 65403, 65382, 65403, 65372, 65422, 65364,
-65428, 65374, 65444, 65396, 65453, 65427, 65458, 65470,
-65458, 65515, 65455,    23, 65456,    69, 65451,   121,
-65445,   156, 65455,   195, 65459,   215, 65482,   233,
-65506,   234,     4,   224,    34,   208,    80,   184,
-  119,   177,   163,   155,   194,   168,   217,   170,
-  232,   187,   243,   196,   243,   202,   245,   201,
-  242,   195,   232,   184,   233,   169,   218,   154,
-  214,   139,   207,   130,   200,   112,   189,   101,
-  185,    89,   187,    82,   185,    81,   192,    98,
-  191,   118,   190,   149,   193,   178,   176,   200,
-  179,   218,   170,   224,   183,   219,   186,   214,
-  214,   197,   233,   180,   262,   171,   282,   158,
-  290,   154,   288,   144,   270,   133,   244,   116,
-  216,    93,   175,    66,   134,    25,    83, 65528,
-   38, 65493, 65523, 65448, 65481, 65412, 65433, 65376,
-65412, 65347, 65383, 65314, 65373, 65296, 65363, 65274,
-65357, 65264, 65361, 65262, 65359, 65260, 65375, 65278,
-65376, 65292, 65389, 65320, 65387, 65331, 65398, 65357,
-65390, 65367, 65392, 65384, 65386, 65387, 65398, 65386,
-65405, 65388, 65423, 65382, 65436, 65382, 65443, 65377,
-65450, 65372, 65432, 65372, 65416, 65371, 65376, 65377,
-65345, 65372, 65318, 65376, 65298, 65372, 65292, 65384,
-65294, 65389, 65300, 65403, 65316, 65411, 65333, 65422,
-65356, 65438, 65379, 65450, 65411, 65471, 65446, 65499,
-65491, 65529, 65531,    41,    21,    97,    49,   152,
-   63,   207,    72,   242,    63,   263,    61,   255,
-   42,   237,    43,   194,    38,   162,    35,   106,
-   44,    65,    52,    34,    59, 65532,    65, 65515,
-   57, 65473,    53, 65454,    41, 65425,    29, 65412,
-   20, 65402,     4, 65397,     0, 65389, 65526, 65393,
-65519, 65393, 65509, 65401, 65506, 65407, 65498, 65415,
-65512, 65426, 65514, 65438, 65535, 65443, 65535, 65457,
-   14, 65459,    29, 65475,    32, 65490,    22, 65504,
-    8, 65527, 65523,     1, 65496,    18, 65462,    31,
-65436,    27, 65420,    33, 65423,    13, 65416,     5,
-65437, 65532, 65444, 65520, 65464, 65513, 65478, 65520,
-65482, 65529, 65483,     7, 65476,    26, 65460,    50,
-65440,    77, 65410,    99, 65399,   128, 65371,   154,
-65362,   171, 65356,   189, 65364,   198, 65378,   199,
-65401,   195, 65431,   194, 65464,   189, 65497,   188,
-65522,   183,     6,   188,    22,   183,    49,   176,
-   63,   166,    83,   147,    83,   133,    94,   123,
-   88,   108,    95,    92,   101,    72,   115,    51,
-  132,    25,   149,     6,   173, 65530,   182, 65518,
-  185, 65516,   187, 65529,   183,     6,   180,    28,
-  173,    53,   176,    71,   172,    86,   181,    97,
-  185,   105,   194,   108,   201,   102,   208,   101,
-  221,    78,   231,    72,   235,    45,   252,    28,
-  259,    14,   267,    11,   271,     5,   266,     4,
-  250,     7,   222,     0,   184, 65530,   151, 65506,
-  102, 65491,    62, 65471,    17, 65448, 65522, 65425,
-65491, 65400, 65463, 65385, 65452, 65357, 65442, 65344,
-65443, 65323, 65447, 65320, 65453, 65317, 65454, 65324,
-65458, 65340, 65447, 65361, 65455, 65387, 65449, 65414,
-65461, 65445, 65466, 65469, 65479, 65496, 65501, 65526,
-65514,     1, 65526,    23, 65533,    30, 65530,    38,
-65517,    23, 65497,     7, 65478, 65528, 65450, 65503,
-65427, 65492, 65392, 65483, 65363, 65482, 65336, 65489,
-65316, 65492, 65307, 65494, 65307, 65493, 65324, 65493,
-65350, 65489, 65382, 65495, 65422, 65515, 65460,     2,
-65501,    34,     0,    82,    11,   126,    37,   167,
-   41,   203,    46,   231,    50,   246,    44,   250,
-   42,   245,    45,   228,    46,   201,    51,   172,
-   41,   134,    36,   100,    20,    60,     6,    25,
-65530, 65534, 65513, 65514, 65491, 65478, 65477, 65459,
-65455, 65430, 65445, 65412, 65425, 65394, 65424, 65380,
-65422, 65365, 65431, 65357, 65443, 65347, 65461, 65341,
-65477, 65339, 65500, 65340, 65512, 65343, 65525, 65358,
-65530, 65376, 65532, 65400,     2, 65425, 65528, 65442,
-65531, 65459, 65514, 65471, 65512, 65485, 65495, 65484,
-65480, 65481, 65468, 65472, 65448, 65458, 65439, 65433,
-65430, 65415, 65428, 65388, 65435, 65377, 65438, 65366,
-65448, 65368, 65455, 65386, 65459, 65401, 65460, 65422,
-65452, 65446, 65442, 65465, 65433, 65486, 65416, 65499,
-65414, 65515, 65406, 65535, 65418,    17, 65426,    40,
-65450,    59, 65476,    78, 65503,   100, 65530,   108,
-   15,   127,    42,   126,    64,   145,    83,   149,
-   97,   164,   104,   169,   124,   169,   128,   171,
-  147,   167,   151,   156,   173,   145,   176,   124,
-  188,   108,   189,    82,   186,    63,   179,    40,
-  167,    33,   154,    22,   139,    34,   125,    48,
-  119,    73,   105,    86,   111,   104,   107,   123,
-  117,   132,   124,   136,   137,   140,   147,   135,
-  159,   131,   166,   127,   181,   125,   182,   131,
-  188,   132,   184,   138,   187,   147,   178,   142,
-  172,   145,   158,   138,   134,   127,   117,   109,
-   78,    84,    54,    52,    16,    27,     6,     1,
-65519, 65518, 65518, 65494, 65505, 65483, 65506, 65464,
-65502, 65468, 65492, 65452, 65487, 65450, 65473, 65443,
-65463, 65434, 65442, 65430, 65437, 65423, 65424, 65428,
-65426, 65431, 65425, 65444, 65436, 65449, 65452, 65461,
-65465, 65463, 65484, 65467, 65494, 65467, 65509, 65467,
-65509, 65464, 65507, 65460, 65490, 65467, 65466, 65463,
-65434, 65472, 65400, 65462, 65376, 65467, 65348, 65454,
-65332, 65442, 65316, 65424, 65313, 65408, 65317, 65391,
-65331, 65379, 65346, 65376, 65378, 65384, 65406, 65400,
-65449, 65431, 65476, 65463, 65510, 65507, 65529,     2,
-    6,    32,    15,    56,    23,    73,    27,    82,
-   25,    88,    28,    78,    29,    74,    34,    62,
-   35,    48,    42,    32,    43,    24,    41,     6,
-   43, 65535,    32, 65528,    21, 65517,     8, 65515,
-65535, 65508, 65535, 65511,     2, 65506,     2, 65504,
-   20, 65504,    39, 65498,    43, 65492,    62, 65493,
-   68, 65490,    73, 65495,    78, 65496,    81, 65504,
-   76, 65516,    76, 65531,    70,     6,    55,    28,
-   40,    37,    14,    61, 65531,    61, 65512,    64,
-65489,    54, 65482,    41, 65467,    23, 65469,     5,
-65465, 65534, 65471, 65520, 65479, 65516, 65484, 65511,
-65495, 65509, 65493, 65519, 65500, 65510, 65491, 65522,
-65484, 65523, 65466, 65529, 65452,     2, 65437, 65535,
-65421,    13, 65414,    20, 65409,    23, 65419,    32,
-65429,    31, 65452,    38, 65471,    38, 65493,    48,
-65507,    48, 65525,    56, 65533,    61,     2,    65,
-    2,    64,     9,    63,     6,    64,    20,    63,
-   25,    56,    39,    56,    60,    43,    75,    38,
-   96,    16,   103,     8,   119, 65534,   115, 65527,
-  116, 65519,   109, 65521,   101, 65526,    95, 65535,
-   88,     4,    85,    30,    80,    42,    78,    63,
-   74,    72,    75,    75,    74,    72,    75,    70,
-   81,    63,    90,    59,   102,    57,   115,    63,
-  121,    68,   123,    74,   121,    79,   122,    76,
-  111,    67,   105,    51,    89,    31,    81,     9,
-   64, 65526,    54, 65504,    35, 65485,    24, 65467,
-    5, 65456,     1, 65446, 65527, 65443, 65525, 65439,
-65512, 65442, 65507, 65443, 65498, 65448, 65482, 65457,
-65473, 65461, 65461, 65471, 65456, 65474, 65456, 65484,
-65457, 65490, 65458, 65496, 65468, 65499, 65481, 65509,
-65496, 65514, 65513, 65516, 65522, 65519, 65533, 65527,
-65535, 65524, 65534, 65534, 65524, 65532, 65513,     2,
-65494, 65535, 65472,     0, 65449,     0, 65426,     2,
-65409, 65524, 65399, 65522, 65393, 65506, 65396, 65502,
-65405, 65491, 65421, 65493, 65440, 65494, 65467, 65501,
-65498, 65513, 65515, 65533,     3,     2,     9,    24,
-   19,    42,    27,    56,    24,    70,    37,    84,
-   31,    88,    48,    92,    55,    88,    71,    85,
-   80,    74,    90,    69,    89,    49,    90,    42,
-   79,    28,    68,    15,    48,     6,    32, 65532,
-    5, 65527, 65535, 65514, 65514, 65507, 65505, 65495,
-65499, 65481, 65496, 65472, 65509, 65450, 65512, 65442,
-65531, 65424, 65533, 65420,     4, 65424,     2, 65428,
-    8, 65441, 65535, 65457,     2, 65477, 65533, 65495,
-65525, 65507, 65517, 65520, 65504, 65529, 65490, 65530,
-65482, 65532, 65465, 65526, 65461, 65519, 65450, 65510,
-65451, 65503, 65449, 65496, 65454, 65494, 65462, 65489,
-65467, 65488, 65472, 65489, 65480, 65488, 65481, 65487,
-65485, 65494, 65482, 65491, 65484, 65496, 65482, 65495,
-65479, 65498, 65478, 65492, 65476, 65495, 65480, 65495,
-65478, 65508, 65490, 65511, 65494, 65532, 65513,     0,
-65524,    10,     1,    30,     8,    38,    17,    57,
-   26,    70,    31,    84,    41,   101,    45,   104,
-   54,   115,    68,   110,    78,   111,    94,    99,
-  107,    90,   115,    75,   123,    66,   121,    48,
-  119,    42,   106,    31,    91,    35,    80,    36,
-   58,    42,    51,    46,    35,    49,    37,    46,
-   30,    51,    33,    40,    32,    46,    31,    40,
-   40,    42,    42,    46,    52,    53,    58,    66,
-   71,    75,    75,    88,    82,    97,    75,   103,
-   70,   107,    57,    95,    46,    91,    34,    73,
-   20,    53,    15,    29,     9,     9,    14, 65527,
-   13, 65516,    19, 65493,     7, 65494,     6, 65479,
-65532, 65481, 65524, 65477, 65511, 65482, 65501, 65481,
-65493, 65484, 65488, 65484, 65489, 65491, 65481, 65483,
-65485, 65483, 65482, 65482, 65487, 65475, 65501, 65480,
-65509, 65476, 65525, 65477,     2, 65481,     8, 65484,
-   19, 65496,    24, 65500,    16, 65509,    13, 65522,
-65531, 65526, 65521,     1, 65495,     0, 65477, 65535,
-65453, 65531, 65441, 65522, 65430, 65516, 65427, 65506,
-65429, 65500, 65440, 65493, 65450, 65494, 65466, 65498,
-65478, 65503, 65491, 65513, 65506, 65527, 65519,     0,
-65529,     8,     0,    17,     5,    28,    11,    35,
-   18,    39,    19,    35,    29,    40,    32,    28,
-   39,    27,    45,    13,    50,    10,    60,     3,
-   56,     0,    56,     0,    46,     0,    37, 65535,
-   27,     1,    15,     0,     3, 65530,     2, 65521,
-65533, 65511,     2, 65503,     2, 65492,     5, 65489,
-   18, 65482,    17, 65476,    30, 65480,    23, 65477,
-   29, 65485,    16, 65487,    17, 65502,     6, 65512,
-    1, 65525,     0,     0, 65530,     7, 65518,    21,
-65511,    23, 65498,    29, 65492,    26, 65483,    26,
-65483,    28, 65479,    18, 65477,    18, 65482,    20,
-65482,    19, 65483,    25, 65483,    24, 65483,    31,
-65483,    25, 65489,    28, 65491,    16, 65496,    10,
-65494, 65535, 65503, 65534, 65506, 65524, 65509, 65520,
-65515, 65521, 65513, 65526, 65516, 65532, 65515, 65533,
-65519,     6, 65520,     8, 65518,    25, 65529,    22,
-65524,    35, 65533,    36, 65535,    38, 65535,    36,
-    2,    31,    11,    18,    21,     9,    36, 65534,
-   46, 65532,    63, 65519,    69, 65512,    81, 65503,
-   83, 65506,    85, 65502,    76, 65506,    66, 65507,
-   54, 65515,    30, 65515,    20, 65525, 65535, 65528,
-65534,     0, 65526,     0, 65525,     1, 65528, 65535,
-65535,     1,     2, 65534,    13,     5,    28,    12,
-   31,    26,    45,    36,    44,    52,    51,    58,
-   43,    65,    44,    58,    37,    55,    30,    39,
-   28,    26,    25,     9,    28, 65534,    23, 65524,
-   19, 65507,    22, 65496,    14, 65488,    16, 65482,
-    5, 65480,     5, 65480, 65535, 65489,     0, 65493,
-    1, 65508,     0, 65513,     8, 65528,     8, 65528,
-   17,     3,    22, 65533,    30,     3,    32, 65531,
-   38, 65532,    43, 65529,    41, 65535,    45,     1,
-   40,     0,    43,    14,    37,    19,    28,    28,
-   16,    36,     3,    41, 65533,    40, 65512,    46,
-65504,    37, 65485,    37, 65478,    30, 65469,    25,
-65461,    14, 65462,    14, 65463,     9, 65470,    12,
-65472,    12, 65480,    19, 65487,    18, 65489,    27,
-65490,    29, 65496,    31, 65498,    37, 65501,    33,
-65508,    41, 65514,    32, 65522,    33, 65535,    31,
-    1,    23,     7,    17,    12,    15,    16, 65535,
-   13,     4,     9, 65532,     0, 65534, 65534, 65524,
-65530, 65522, 65516, 65510, 65516, 65507, 65501, 65493,
-65502, 65488, 65492, 65474, 65497, 65470, 65497, 65451,
-65511, 65446, 65516, 65440, 65533, 65435,     2, 65438,
-    8, 65443,    12, 65450,    10, 65458,     7, 65474,
-    0, 65485, 65533, 65498, 65527, 65517, 65522, 65527,
-65521,     2, 65519, 65534, 65522,     2, 65518,     2,
-65522, 65533, 65513,     4, 65522, 65533, 65517,     2,
-65530,     1, 65529,     6,     1,    16,     1,    15,
-    5,    17,     4,    13,     8,     4,     2,     0,
-    5, 65531, 65534, 65516,     0, 65508, 65528, 65499,
-65526, 65493, 65524, 65495, 65520, 65497, 65520, 65504,
-65520, 65513, 65528, 65523, 65524,     0, 65533,     7,
-65535,    19,     1,    31,     8,    35,    16,    47,
-   26,    46,    36,    50,    45,    43,    54,    40,
-   56,    28,    66,    21,    62,    10,    63,     2,
-   55,     1,    51, 65534,    38,     2,    34, 65535,
-   18,     0,    14,     1, 65534,     2, 65535,     9,
-65526,    15, 65515,    18, 65517,    20, 65514,    27,
-65519,    29, 65525,    40, 65534,    45, 65535,    54,
-    4,    60,     6,    71,    11,    68,    11,    80,
-    8,    79,    11,    83,    11,    83,    10,    78,
-   18,    73,    16,    63,    23,    50,    19,    37,
-   23,    27,    14,    15,    12,     4,     0, 65535,
-    2,     2, 65532, 65527, 65532, 65535, 65522, 65525,
-65524, 65523, 65518, 65518, 65521, 65517, 65520, 65506,
-65519, 65502, 65521, 65495, 65529, 65487, 65534, 65486,
-    9, 65480,    18, 65485,    32, 65482,    37, 65493,
-   44, 65498,    39, 65510,    38, 65515,    31, 65530,
-   22, 65529,    10,     4,     1, 65533, 65528,     2,
-65515, 65535, 65495,     0, 65491, 65525, 65474, 65519,
-65477, 65511, 65469, 65507, 65476, 65504, 65482, 65504,
-65489, 65508, 65501, 65510, 65508, 65519, 65515, 65526,
-65523, 65533, 65526, 65535, 65525,     1, 65525, 65534,
-65526,     3, 65524, 65533, 65526,     3, 65518, 65533,
-65527,     3, 65523, 65533, 65533,     2, 65532, 65534,
-    2,     1,     2,     0,    11,     0,    13,    10,
-   17,     8,    23,    19,    18,    17,    24,    23,
-   20,    12,    22,     8,    20, 65533,    23, 65526,
-   11, 65512,    20, 65499,    13, 65491,    18, 65485,
-   15, 65481,    16, 65485,    17, 65484,    14, 65500,
-   18, 65506,    13, 65519,    19, 65529,    13, 65532,
-   11,     4,     5,     5,     4,    14,     0,    14,
-65535,    16, 65535,    18, 65525,    20, 65524,    24,
-65521,    30, 65514,    22, 65515,    38, 65515,    26,
-65520,    34, 65520,    21, 65528,    25, 65528,    11,
-65535,    14,     1, 65534, 65535,     4,     0, 65532,
-    1, 65534, 65534, 65529,     3, 65530, 65532, 65529,
-65534, 65532, 65524, 65530, 65526,     3, 65522, 65532,
-65516,     5, 65514,     6, 65516,     6, 65513,     9,
-65522,     4, 65529,     6, 65534,     0,     4,     1,
-   10, 65535,    17,     1,    20, 65528,    26, 65531,
-   29, 65522,    31, 65528,    29, 65525,    19, 65524,
-   10, 65528,     2, 65522, 65525, 65529, 65517, 65522,
-65497, 65528, 65502, 65522, 65487, 65523, 65498, 65527,
-65491, 65526, 65505, 65531, 65509,     3, 65517, 65535,
-65532,    18, 65535,    20,     8,    35,    16,    36,
-   22,    48,    26,    46,    23,    49,    23,    46,
-   13,    40,    16,    35,     7,    25,     6,    13,
-    5,     6,     6, 65534,     4, 65532,    11, 65521,
-   10, 65520,    10, 65520,    12, 65523,     8, 65527,
-   18, 65530,    13, 65531,    20, 65533,    26, 65532,
-   29, 65531,    39, 65530,    34, 65526,    40, 65523,
-   33, 65519,    42, 65517,    32, 65515,    34, 65513,
-   31, 65519,    31, 65520,    32, 65529,    26, 65531,
-   22,     2,    17,     4,     5,    14, 65533,    15,
-65529,    16, 65515,    13, 65514,     8, 65502,     3,
-65500,     0, 65490, 65534, 65497,     3, 65484, 65534,
-65494,     1, 65483, 65535, 65493,     7, 65484,     7,
-65492,    20, 65492,    12, 65495,    28, 65496,    20,
-65506,    31, 65505,    28, 65518,    34, 65518,    28,
-65531,    27, 65533,    18,     1,    22,     1,    11,
-65533,    12,     8,    12,     0,     3,     8,    10,
-65532, 65534,     2,     4,     0, 65533, 65535,     2,
-    1, 65534,     0, 65533, 65535, 65524,     2, 65515,
-    6, 65506,     8, 65500,    14, 65490,    18, 65491,
-   23, 65483,    23, 65486,    29, 65488,    25, 65490,
-   23, 65493,    13, 65497,    12, 65503,     1, 65503,
-65535, 65504,     2, 65506, 65527, 65507, 65529, 65512,
-65523, 65514, 65526, 65515, 65525, 65527, 65530, 65525,
-65530, 65532,     3,     2, 65533, 65534,     3,     4,
-65534,     7,     1,    10,     0,    11,     0,     8,
-65535,     2,     2,     2, 65531, 65533, 65534, 65532,
-65528, 65522, 65531, 65520, 65532, 65522, 65529, 65518,
-65531, 65530, 65531, 65527, 65530,     3, 65528, 65535,
-65525,     6, 65525,    15, 65530,    18, 65530,    28,
-65533,    24, 65535,    28,     1,    22,     0,    19,
-    2,    13,     9,    10,     7,     3,    18,     6,
-   13, 65533,    19,     3,     9,     5,    10,     6,
-    4,    10,     1,    11,     0,    10, 65530,    11,
-65524,    10, 65523,     5, 65515,     4, 65516,     4,
-65515, 65532, 65518,     4, 65524, 65533, 65526,     5,
-65535,     9, 65534,    12,     3,    25, 65532,    23,
-   10,    42,     4,    38,    15,    49,    11,    47,
-   20,    49,    21,    43,    26,    45,    28,    33,
-   34,    37,    29,    25,    35,    24,    27,    13,
-   27,    11,    17,     2,    17,     1,     8, 65533,
-    7, 65529,     3, 65526,     0, 65523,     0, 65529,
-65535, 65520,     1, 65521, 65535, 65517,     5, 65510,
-    9, 65509,    14, 65502,    18, 65504,    24, 65503,
-   22, 65506,    30, 65507,    21, 65517,    22, 65516,
-   17, 65524,    11, 65522,     2, 65528,     0, 65523,
-65527, 65528, 65518, 65521, 65508, 65522, 65500, 65519,
-65501, 65521, 65496, 65520, 65500, 65520, 65500, 65525,
-65500, 65524, 65511, 65531, 65507, 65531, 65512,     1,
-65513,     0, 65517,     5, 65512,    11, 65518,    10,
-65511,    11, 65519,    10, 65511,    11, 65517,     3,
-65514,     8, 65518,     1, 65522,     1, 65521, 65535,
-65529,     2, 65531,     4,     3,     7, 65534,     4,
-    6,    13,    11,    10,    17,    10,    16,    11,
-   17,    10,    14,    11,    18,     8,    13, 65535,
-   15,     0,     7, 65533,    13, 65522,     9, 65520,
-   12, 65510,     2, 65509,     8, 65510,     3, 65508,
-    7, 65513,     5, 65516,     5, 65519,     5, 65524,
-    5, 65524,     6, 65529,     5, 65530,     5, 65531,
-    6, 65531,     4, 65531,     7, 65530,     3,     0,
-    3, 65535, 65534,     2,     1,     2,     0,     9,
-65535,     9,     1,    12,     0,    11, 65535,    12,
-    1,    11,     0,     9,     0,    11, 65535,     3,
-    2,     1,     5,     0,     5,     0,     7, 65535,
-    3,     2,     3, 65534, 65534,     0,     2,     1,
-65533,     0, 65531, 65535, 65531,     2, 65528, 65533,
-65528,     3, 65529, 65535, 65532,     0, 65533,     1,
-    1, 65535,     0,     1,     6, 65535,    11,     1,
-   16,     0,    15,     0,    15,     0,     8, 65535,
-    7,     1,     2,     0, 65532, 65535, 65532,     2,
-65515, 65530, 65517, 65534, 65507, 65523, 65504, 65528,
-65501, 65523, 65497, 65528, 65500, 65530, 65501,     2,
-65508, 65535, 65513,     0, 65519,     4, 65527,     5,
-65531,    12,     0,    12,     1,    18, 65535,    14,
-    1,    18,     0,    17, 65535,    16,     1,    14,
-65534,    10,     3,     5, 65532,     2,     4, 65535,
-65533,     0,     2,     1, 65534, 65535,     2,     0,
-65534,     1,     4,     4,     6,     6,     4,     5,
-   10,     0,    11, 65535,    18,     2,    18, 65533,
-   23, 65533,    26, 65528,    26, 65529,    35, 65523,
-   30, 65527,    31, 65525,    34, 65526,    29, 65530,
-   34,     0,    29, 65534,    22,     5,    20,     5,
-   12,     5,     3,     5,     5,     3, 65531, 65535,
-    3,     0, 65525, 65532, 65535, 65526, 65527, 65528,
-65525, 65521, 65525, 65533, 65521, 65527, 65517,     0,
-65520, 65535, 65511,     0, 65518,     0, 65512,     4,
-65517,     8, 65513,    11, 65522,    10, 65517,    16,
-65524,    15, 65523,    17, 65526,    15, 65528,    16,
-65531,    15, 65531,    10,     0,    10,     0,    11,
-    0,    10,     0,    12,     0,    10, 65535,    10,
-    2,     5, 65535,     4, 65535,     2,     2, 65535,
-65534, 65535,     2, 65532, 65535, 65527, 65535, 65528,
-    2, 65522, 65533, 65525, 65530, 65517, 65532, 65522,
-65529, 65519, 65532, 65517, 65530, 65513, 65531, 65518,
-65531, 65510, 65530, 65519, 65532, 65512, 65529, 65517,
-65531, 65520, 65532, 65519, 65530, 65521,     4, 65526,
-65532, 65528,     4, 65535,     2, 65534,     9,     2,
-   10, 65534,    10,     3,    10, 65533,     4,     3,
-    6, 65533,     6, 65533,     0, 65530,     1, 65522,
-    0, 65523,     0, 65516, 65535, 65522,     2, 65513,
-    1, 65522,    11, 65520, 65535, 65522,    11, 65531,
-    1, 65532,     9,     2,    12, 65534,     9,     2,
-   12,     6,    18,     5,    13,     6,    19,     2,
-   14, 65535,    17,     0,    14,     1,    25,     0,
-   17,     0,    26, 65535,    15,     3,    17,     1,
-   14,    13,     6,     7,     5,    15, 65535,    16,
-65534,    16, 65535,    15, 65527,    17, 65527,    14,
-65525,    14, 65517,     7, 65522,    15, 65520,     6,
-65519,    14, 65522,     8, 65517,    13, 65522,     9,
-65520,    17, 65520,    16, 65520,    21, 65523,    24,
-65526,    26, 65526,    27, 65532,    26, 65530,    28,
-    2,    25, 65535,    28,     1,    26, 65535,    19,
-    6,    25,     5,    16,     3,    20,     1,     9,
-65534,    11,     0,     7,     2,     3, 65534,     1,
-    1,     0,     0, 65535, 65535, 65535,     1, 65525,
-    0, 65525, 65535, 65518,     3, 65515,     6, 65512,
-   11, 65510,    15, 65509,    17, 65510,    14, 65513,
-   19, 65514,    13, 65519,    16, 65520,     8, 65520,
-   11, 65527,     3, 65523,     3, 65526, 65534, 65516,
-    1, 65523, 65530, 65518, 65531, 65517, 65531, 65515,
-65531, 65520, 65531, 65520, 65535, 65523,     0, 65525,
-    0, 65533,     1, 65527, 65534, 65535,     2, 65527,
-65535, 65533, 65533, 65529, 65530, 65532, 65527, 65532,
-65524, 65535, 65525, 65535, 65517,     1, 65522,     0,
-65525, 65535, 65526,     2, 65525, 65533, 65530,     6,
-65532,     2, 65531,    12,     4,     9, 65533,    12,
-    2,    16, 65534,    15,     4,    17,     5,    15,
-    7,    11,     4,     8,     3,     6, 65534,     0,
-    2,     0, 65535,     1,     0, 65534,     1,     2,
-65535, 65535,     1,     1, 65534, 65534,     2,     4,
-65535,     2,     0,     8,     2,     4, 65533,     5,
-    2,     7, 65535,     3,     0, 65535,     0,     1,
-    5, 65534,     5,     2,     5, 65534, 65534,     2,
-    1, 65535,     0,     0, 65535,     0,     3,     0,
-65532,     0,     4,     1, 65532, 65535,     3, 65535,
-65535,     2,     7, 65531,     4, 65531,     5, 65531,
-    6, 65529,     5, 65532,     5, 65531,     7, 65530,
-    2, 65532,    10, 65529,     0, 65532,     4, 65530,
-65534, 65531,     2, 65531, 65534, 65529,     2, 65533,
-65534, 65528,     9, 65534,     2, 65527,    10, 65531,
-   12, 65530,     8, 65530,    14, 65532,     6, 65531,
-   15, 65529,     3, 65534,     7, 65533,     0,     3,
-65535, 65534, 65533,     1, 65526, 65535, 65522,     1,
-65520,     0, 65516,     0, 65514, 65535, 65515,     1,
-65516,     0, 65516,     3, 65525,     9, 65521,     1,
-65528,     9, 65529,     7, 65531,    12, 65531,     7,
-    0,     5, 65535,     5,     1,     6, 65535,     4,
-    1,     7, 65535,     3,     0,     7,     0,     5,
-65535,     4,     2,     8, 65535,     2,     0,    10,
-    0,     8,     1,    14, 65534,     7,     2,    15,
-65535,     6, 65535,    15,     2,     6, 65535,     5,
-65535, 65534,     3,     1,     3, 65532,     7, 65528,
-    6, 65526,     3, 65525,     9, 65524,     8, 65528,
-   13, 65528,     8, 65534,    15,     2,    16, 65533,
-   12,     3,    12, 65534,     8,     0,    11,     0,
-    4,     1,     5, 65535,     3,     1, 65533, 65535,
-    2,     0, 65534,     1,     1, 65530,     0, 65533,
-    1, 65527, 65532, 65535, 65531, 65527, 65530,     1,
-65531,     0, 65531, 65534, 65530,     2, 65532,     0,
-65528, 65535, 65534,     2, 65529, 65533,     5,     2,
-65533, 65535,     1,     1,     0, 65535,     0,     1,
-    0, 65535,     0,     6,     0,     5,     1,     5,
-65534,     7,     2,     4, 65534,     5,     1,     6,
-    0,     2,     0,     1,     0,     0,     0,     0,
-65535, 65535,     2,     2, 65533, 65533,     4,     4,
-65527, 65531,     0,     4, 65527, 65529, 65532, 65531,
-65532, 65532, 65528, 65528, 65534, 65533, 65528, 65531,
-65532, 65528, 65530, 65534, 65532, 65528, 65534,     0,
-    2,     1, 65532, 65535,     5,     0, 65531,     1,
-    9, 65535,     2,     1,     7, 65535,     4,     1,
-    6, 65534,     6,     3,     5, 65534,     5,     0,
-    6, 65530,     4, 65531,     7, 65525,     4, 65526,
-    6, 65524,     6, 65527,     4, 65524,     7, 65528,
-    3, 65533,     6, 65534,     8,     1,     2,     0,
-    8, 65535,     4,     1,     4,     0,     9, 65535,
-    2,     2,     7, 65534,    10,     1,    11,     1,
-   11, 65534,     9,     3,    13, 65532,     8,     4,
-    9, 65533,     3,     2,     3, 65534, 65535,     4,
-    0,     6,     1,     4, 65533,     8, 65531,     2,
-65531,     7, 65529,     5, 65527,     5, 65523,     6,
-65528,     4, 65522,     6, 65529,     5, 65523,     6,
-65527,     4, 65524,     6, 65526,     3, 65527,     9,
-65531,     1, 65531,     9, 65530,     3, 65530,     6,
-    2,     6, 65534,     4,     1,     6, 65535,     5,
-    1,     6, 65535,     2,     2,     7, 65534,     4,
-    1,     6,     0,     5, 65535,     5,     3,     6,
-65532,     5,     4,     2, 65532, 65534,     4,     1,
-65532,     0,     5, 65535, 65532,     1,     2, 65527,
-    0, 65532, 65534, 65530,     7, 65531,     4, 65530,
-    5, 65533,     6, 65527,     4, 65533,     7, 65530,
-    4, 65533,     6,     1, 65534,     0,     2, 65534,
-65533, 65532,     3, 65532, 65534, 65529,     2, 65533,
-65534, 65532,     1,     2, 65535, 65535,     1,     0,
-    0,     1,     0, 65535, 65535,     1,     2,     0,
-65533, 65535,     4,     2, 65531, 65534,     5, 65534,
-65532, 65529,     3, 65531, 65535, 65532,     0, 65529,
-65535, 65532,     2, 65531, 65533,     1,     4, 65535,
-65532,     0,     3,     1, 65533, 65535,     4,     0,
-65532,     5,     3,     2, 65535,    10,     0,     2,
-    0,     6,     1,     7, 65534, 65534,     3,     3,
-65534, 65533,     1,     2, 65535, 65535,     0,     1,
-    1,     0,     0, 65534, 65535,     3,     1, 65533,
-65535,     2,     1,     0, 65535, 65535,     1,     0,
-65535,     1,     1, 65534, 65535,     3,     1, 65534,
-    0,     0, 65535,     1,     2, 65535, 65533,     9,
-    2,     2, 65535,     8,     1,     3, 65535,     5,
-    1, 65534, 65535,     1,     1, 65535,     1,     2,
-    4, 65533,     7,     4,     3, 65532,     7,     2,
-    5, 65533,     5, 65529,     6, 65532,     2, 65529,
-    0, 65532,     0,     0,     0,     1,     1, 65534,
-65534,     1,     2,     0, 65534, 65535,     2,     2,
-65534, 65534,     2,     1, 65534, 65530,     6, 65531,
-    5, 65531,     5, 65530,     6, 65531,     5, 65531,
-    6, 65533,     3,     5,     2, 65530, 65534,     5,
-    3, 65533, 65533,     2,     1, 65535, 65528,     0,
-65533,     0, 65529,     0, 65532,     0, 65529,     1,
-65533, 65534, 65529,     2, 65532, 65534, 65529,     2,
-65532, 65535, 65530,     0, 65532,     1, 65535,     6,
-    0,     7,     0,     1,     0,     2,     1, 65533,
-65535,     3,     1, 65534, 65535,     3,     1, 65531,
-65535,     5,     1, 65531, 65535,     4,     1, 65535,
-65535, 65535,     1,     1, 65535, 65535,     1,     1,
-    0, 65535,     0,     1,     1, 65534, 65534,     2,
-    2, 65534, 65534,     2,     2, 65534, 65534,     1,
-    2, 65535, 65534,     1,     2, 65535, 65535,     2,
-65535, 65533,     1,     4, 65535, 65532,     2,     3,
-65534, 65534,     1,     2, 65535, 65534,     0,     1,
-    1, 65535, 65534,     1,     3,     0, 65532,     0,
-    4, 65535, 65533,     1,     2, 65535, 65535,     1,
-65535, 65535,     2,     2, 65535, 65533,     0,     3,
-    0, 65534,     0,     1,     0,     1,     0, 65533,
-    1,     3, 65533, 65534,     4,     0, 65532,     3,
-    3, 65531,     0,     6, 65533, 65530,     5,     4,
-65529, 65534,     7,     1, 65531,     0,     3,     0,
-65535, 65535, 65535,     1,     2, 65535, 65535,     0,
-65535,     2,     1, 65533, 65535,     3,     0, 65533,
-    2,     2, 65533,     0,     2, 65535, 65534,     2,
-    3, 65533, 65533,     4,     3, 65532, 65533,     3,
-    2, 65535, 65535, 65535,     1,     2, 65535, 65533,
-    0,     4,     1, 65532, 65534,     3,     2, 65534,
-65534,     0,     2,     2, 65535, 65534,     0,     1,
-    0, 65535,     0,     1,     0, 65535,     0,     1,
-    0, 65535,     0,     0,     0,     2,     0, 65533,
-    1,     3, 65534, 65533,     2,     3, 65534, 65535,
-    2, 65535, 65534,     2,     2, 65534, 65534,     2,
-    2, 65535, 65535, 65535, 65535,     2,     2, 65534,
-65534,     2,     2, 65535, 65535,     0, 65535,     0,
-    1,     0,     0,     0, 65535,     1,     2, 65535,
-65533,     0,     3,     0, 65534,     0,     1,     0,
-    0,     0, 65535,     0,     1, 65535,     0,     2,
-    0, 65534,     1,     1, 65534,     0,     1,     0,
-    0,     0,     1,     0, 65535, 65535,     1,     1,
-65535, 65535,     1,     2, 65535, 65533,     0,     3,
-    1, 65534,     0,     0, 65535,     1,     1, 65534,
-65534,     2,     2, 65535, 65535,     1,     1, 65535,
-65535,     1,     2, 65535, 65532,     0,     4,     1,
-65533, 65535,     2,     1,     0,     0, 65533, 65535,
-    4,     1, 65533,     0,     2, 65535, 65534,     2,
-    2, 65534, 65534,     1,     3,     0, 65533,     0,
-    2, 65535, 65534,     2,     3, 65533, 65533,     3,
-    3, 65534, 65532,     1,     4,     0, 65532, 65535,
-    4,     2, 65533, 65533,     1,     3,     1, 65533,
-65534,     3,     2, 65533, 65534,     2,     1, 65535,
-    1,     0, 65535,     1,     1, 65535, 65535,     0,
-    1,     0, 65535, 65535,     1,     2, 65535, 65534,
-    1,     2, 65534, 65535,     3, 65535, 65532,     3,
-    4, 65533, 65533,     3,     1, 65533,     0,     3,
-    0, 65533,     1,     4, 65535, 65531,     0,     5,
-    0, 65531, 65535,     6,     3, 65530, 65532,     5,
-    4, 65532, 65532,     3,     3, 65534, 65534,     2,
-    1, 65534,     0,     2,     0, 65533, 65535,     3,
-    1, 65534, 65535,     2,     1, 65534,     0,     1,
-65534, 65535,     2,     2, 65535, 65534,     0,     1,
-    2,     0, 65532, 65535,     4,     1, 65532, 65535,
-    3,     1, 65534,     0,     1, 65535, 65535,     1,
-    1, 65535, 65535,     1,     0,     0,     2, 65535,
-65533,     2,     3, 65534, 65534,     2,     0, 65533,
-    2,     4, 65533, 65532,     3,     3, 65533, 65534,
-    3,     1, 65533, 65535,     3,     1, 65534, 65535,
-    1,     1, 65535,     0,     1, 65535,     0,     1,
-    0, 65535, 65535,     0,     2,     1, 65533, 65535,
-    3,     2, 65534, 65534, 65535,     0,     4,     1,
-65532, 65535,     3,     1, 65534, 65535,     1,     1,
-65535, 65535,     1,     0, 65535,     0,     1,     1,
-65535, 65535,     1,     0, 65535,     1,     1, 65534,
-65535,     3,     1, 65533, 65535,     3,     2, 65534,
-65534,     1,     2,     0, 65534, 65535,     2,     2,
-65534, 65533,     3,     3, 65533, 65535,     3,     0,
-65533,     0,     2,     0, 65535, 65535,     0,     3,
-    1, 65532, 65534,     4,     2, 65532, 65534,     4,
-    2, 65533, 65535,     2,     0,     0,     0, 65534,
-    1,     3, 65534, 65533,     2,     2, 65534, 65535,
-    1,     1,     1, 65534, 65533,     2,     3, 65535,
-65534,     0,     2,     0, 65534,     0,     1,     1,
-65535, 65535,     0,     0,     1,     0, 65534,     1,
-    2, 65535, 65535,     1, 65535, 65534,     2,     2,
-65534, 65535,     1,     1,     1, 65535, 65533,     1,
-    4, 65534, 65533,     3,     2, 65533, 65535,     3,
-    0, 65534,     1,     0, 65534,     2,     3, 65533,
-65533,     3,     3, 65534, 65534,     1,     0,     0,
-    1,     0, 65534,     0,     2,     0, 65535,     0,
-    0,     0,     1,     1, 65535, 65535, 65535,     0,
-    3,     0, 65532,     1,     4, 65534, 65533,     2,
-    1, 65534,     0,     1,     0,     0,     0, 65535,
-    1,     2, 65533, 65534,     5,     2, 65531, 65535,
-    3,     0, 65535,     0, 65535,     0,     2,     0,
-65535,     0, 65535,     0,     3,     0, 65531,     1,
-    6, 65533, 65531,     4,     4, 65532, 65533,     3,
-    2, 65535, 65535, 65535,     1,     1, 65535,     1,
-    0, 65534,     1,     3,     0, 65533, 65535,     1,
-    1,     0, 65534,     0,     4,     1, 65532, 65535,
-    3,     0, 65533,     0,     2,     0, 65535,     0,
-    1, 65535, 65535,     2,     1, 65533, 65535,     3,
-    0, 65534,     1,     0, 65535,     1,     0, 65535,
-    2,     1, 65533, 65535,     3,     1, 65534, 65535,
-    1,     1, 65535,     0,     2, 65535, 65532,     1,
-    5,     0, 65532,     0,     3,     0, 65534,     0,
-    1,     0, 65535,     0,     1,     1, 65535, 65534,
-    1,     2, 65535, 65534,     1,     2, 65535, 65535,
-    0, 65535,     1,     1, 65534, 65535,     3,     1,
-65533,     0,     2, 65535, 65534,     1,     2, 65534,
-65535,     3,     0, 65533,     1,     3, 65535, 65532,
-    0,     3,     1,     0, 65534, 65535,     3,     1,
-65533, 65535,     2,     0, 65534,     2,     2, 65534,
-65535,     2,     1, 65534, 65535,     2,     0, 65534,
-    0,     2,     1, 65534, 65535,     2,     2, 65534,
-65533,     2,     2, 65534, 65535,     1,     1, 65535,
-65535,     1,     1,     0,     0,     0, 65535,     0,
-    2, 65535, 65534,     0,     1,     1,     0,     0,
-65535,     0,     2,     0, 65535, 65535,     0,     2,
-    0, 65534, 65535,     3,     2, 65532, 65535,     3,
-65535, 65534};
+// 17090 samples IMA-ADPCM (tools/pcm2adpcm.py)
+const uint8_t audio_error[]={
+0x00, 0x00, 0x19, 0x91, 0x19, 0x91, 0x19, 0x01, 0x99, 0x11, 0x99, 0x01,
+0x19, 0x91, 0x90, 0x30, 0xB9, 0x31, 0xB9, 0x30, 0xB0, 0x30, 0xB9, 0x32,
+0xAB, 0x03, 0x09, 0x91, 0x19, 0x90, 0x01, 0x10, 0x99, 0x21, 0x9B, 0x21,
+0xB1, 0x3A, 0x92, 0x1B, 0x01, 0x19, 0xA1, 0x30, 0xB9, 0x22, 0x0B, 0x91,
+0x21, 0xAB, 0x23, 0x9A, 0x11, 0x99, 0x11, 0x99, 0x21, 0xAA, 0x12, 0x90,
+0x09, 0x12, 0x9B, 0x21, 0x99, 0x09, 0x21, 0xAB, 0x33, 0xAB, 0x13, 0x1B,
+0x01, 0x00, 0x00, 0x10, 0xA0, 0x39, 0xC2, 0x38, 0xB1, 0x3B, 0x92, 0x0A,
+0x10, 0x01, 0x0A, 0x12, 0xB9, 0x12, 0x99, 0x01, 0x19, 0x91, 0x19, 0x01,
+0x99, 0x11, 0x09, 0x90, 0x01, 0x10, 0xA9, 0x22, 0x9B, 0x03, 0x1B, 0x01,
+0x91, 0x09, 0x92, 0x19, 0x99, 0x21, 0xBA, 0x33, 0xBB, 0x33, 0xBA, 0x40,
+0xA8, 0x10, 0x21, 0xAA, 0x22, 0x9A, 0x11, 0x90, 0x09, 0x93, 0x0B, 0x12,
+0x9A, 0x93, 0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x92, 0x1A, 0x93, 0x1B, 0x92,
+0x99, 0x39, 0xB1, 0x39, 0xB1, 0x29, 0x90, 0x19, 0x01, 0x99, 0x10, 0x91,
+0x19, 0x01, 0x1A, 0x93, 0x1B, 0x92, 0x09, 0x09, 0x92, 0x1A, 0x92, 0x99,
+0x11, 0x99, 0x10, 0x01, 0xA9, 0x22, 0xAA, 0x12, 0x99, 0x10, 0x01, 0x1B,
+0x13, 0x0C, 0x93, 0x1C, 0x92, 0x9B, 0x03, 0x9B, 0x23, 0xBB, 0x33, 0xAB,
+0x03, 0x19, 0xA9, 0x23, 0xAB, 0x03, 0x1A, 0x91, 0x11, 0x19, 0xB1, 0x20,
+0x91, 0x1A, 0x11, 0x99, 0x91, 0x11, 0x99, 0x20, 0xA9, 0x21, 0xB9, 0x22,
+0xAA, 0x31, 0x90, 0x1A, 0x11, 0x90, 0x19, 0xB2, 0x3A, 0xB2, 0x30, 0xB9,
+0x21, 0x99, 0x91, 0x29, 0xB0, 0x39, 0xA1, 0x11, 0x1A, 0x93, 0x1B, 0x11,
+0x90, 0x3A, 0xA1, 0x20, 0x9A, 0x12, 0x0A, 0x11, 0x91, 0x2B, 0xB2, 0x39,
+0xB0, 0x21, 0x1A, 0x91, 0x10, 0x99, 0x11, 0x99, 0x21, 0xAA, 0x31, 0xB9,
+0x31, 0xB1, 0x19, 0x11, 0xB0, 0x31, 0xB0, 0x11, 0x90, 0x11, 0x99, 0x21,
+0xB9, 0x11, 0x11, 0x9B, 0x94, 0x3B, 0xB4, 0x39, 0x92, 0x09, 0x99, 0x13,
+0xBB, 0x15, 0x0C, 0x83, 0x1B, 0x02, 0xA9, 0x39, 0xC1, 0x31, 0xBB, 0x23,
+0xAB, 0x12, 0x91, 0x9B, 0x06, 0x8D, 0x06, 0x8E, 0x05, 0x8E, 0x77, 0x07,
+0x09, 0x0A, 0x80, 0x00, 0x0A, 0x9F, 0x8B, 0x83, 0x09, 0x80, 0x85, 0x81,
+0x07, 0x84, 0x01, 0x08, 0x10, 0x09, 0x9F, 0x8F, 0x8A, 0x88, 0x08, 0x89,
+0x88, 0x83, 0x80, 0x8B, 0x9C, 0x8E, 0x9B, 0x95, 0x07, 0x85, 0x03, 0x82,
+0x81, 0x09, 0x0D, 0x8A, 0x89, 0x81, 0x87, 0x06, 0x83, 0x83, 0x03, 0x13,
+0x12, 0x18, 0x2B, 0x0F, 0x0E, 0x1B, 0x1D, 0x0C, 0x0B, 0x0D, 0x0C, 0x8B,
+0x0C, 0x0B, 0x88, 0x82, 0x86, 0x83, 0x84, 0x82, 0x82, 0x80, 0x98, 0x80,
+0x83, 0x84, 0x82, 0x8A, 0x8D, 0x99, 0x8A, 0x8E, 0x8D, 0x9B, 0x99, 0xA1,
+0x97, 0x86, 0x84, 0x84, 0x83, 0x82, 0x88, 0x8A, 0x8A, 0x89, 0x92, 0x07,
+0x07, 0x85, 0x02, 0x81, 0x08, 0x0C, 0x0C, 0x0B, 0x0C, 0x0B, 0x09, 0x0A,
+0x89, 0x89, 0x89, 0x00, 0x81, 0x84, 0x83, 0x04, 0x05, 0x85, 0x03, 0x00,
+0x08, 0x1C, 0x0F, 0x0C, 0x0D, 0x0B, 0x8A, 0x89, 0x80, 0x93, 0x87, 0x86,
+0x04, 0x03, 0x83, 0x01, 0x08, 0x0B, 0x1B, 0x19, 0x05, 0x07, 0x05, 0x02,
+0x02, 0x10, 0x10, 0x20, 0x21, 0x42, 0x4B, 0x0F, 0x8F, 0x0E, 0x0C, 0x0C,
+0x0C, 0x8A, 0x0A, 0x89, 0x81, 0x84, 0x85, 0x84, 0x84, 0x82, 0x81, 0x00,
+0x88, 0x08, 0x89, 0x08, 0x01, 0x08, 0x0C, 0x8F, 0x0D, 0x8B, 0x89, 0x80,
+0x86, 0x86, 0x84, 0x83, 0x01, 0x08, 0x09, 0x08, 0x01, 0x05, 0x05, 0x04,
+0x10, 0x1B, 0x0F, 0x0C, 0x0D, 0x0B, 0x0C, 0x0B, 0x0B, 0x8B, 0x8B, 0x99,
+0x90, 0xA3, 0x97, 0x95, 0x84, 0x84, 0x83, 0x84, 0x83, 0x00, 0x09, 0x8A,
+0x8C, 0x8B, 0x8B, 0x8D, 0x8B, 0x8B, 0x8A, 0x91, 0x07, 0x07, 0x86, 0x84,
+0x82, 0x02, 0x80, 0x08, 0x1B, 0x0B, 0x09, 0x00, 0x83, 0x07, 0x04, 0x05,
+0x13, 0x14, 0x12, 0x31, 0x5B, 0x1D, 0x1E, 0x0D, 0x0C, 0x0B, 0x8C, 0x8A,
+0x8B, 0x8B, 0x8B, 0x9A, 0xB2, 0x96, 0x95, 0x85, 0x94, 0x83, 0x83, 0x01,
+0x81, 0x00, 0x08, 0x88, 0x0A, 0x0D, 0x8C, 0x8B, 0x98, 0x93, 0x07, 0x86,
+0x84, 0x83, 0x83, 0x82, 0x02, 0x11, 0x13, 0x23, 0x34, 0x34, 0x53, 0x48,
+0x39, 0x2D, 0x1D, 0x1E, 0x0D, 0x0C, 0x0C, 0x0C, 0x0B, 0x0C, 0x8A, 0x89,
+0x90, 0x92, 0xA4, 0x94, 0x93, 0xB3, 0xA2, 0xB1, 0xB0, 0xC1, 0xB1, 0xB1,
+0xB8, 0xAC, 0x9E, 0x8C, 0x8C, 0x80, 0x85, 0x07, 0x86, 0x85, 0x83, 0x83,
+0x83, 0x82, 0x01, 0x80, 0x08, 0x18, 0x08, 0x00, 0x20, 0x03, 0x07, 0x87,
+0x05, 0x03, 0x12, 0x11, 0x4B, 0x1F, 0x1C, 0x1D, 0x0C, 0x0B, 0x0B, 0x8B,
+0x8A, 0x99, 0x99, 0xB0, 0xD3, 0xA2, 0xA2, 0x94, 0x84, 0x03, 0x12, 0x38,
+0x3D, 0x2F, 0x1D, 0x2C, 0x1C, 0x2A, 0x2B, 0x28, 0x01, 0x84, 0x95, 0x94,
+0x93, 0x93, 0x82, 0x82, 0x81, 0x92, 0xA4, 0xA7, 0xA5, 0x94, 0xA4, 0xA4,
+0xA4, 0xA2, 0x91, 0xA8, 0x9A, 0x9C, 0x8C, 0x8D, 0x0B, 0x0C, 0x1C, 0x2B,
+0x3C, 0x2B, 0x3A, 0x19, 0x00, 0x91, 0x92, 0xA2, 0xA4, 0x93, 0xA2, 0xA1,
+0xB8, 0x9C, 0x0F, 0x2D, 0x4B, 0x5A, 0x58, 0x50, 0x40, 0x30, 0x40, 0x30,
+0x38, 0x10, 0x80, 0x92, 0x91, 0x90, 0x10, 0x48, 0x58, 0x60, 0x21, 0x13,
+0x05, 0x03, 0x82, 0xA2, 0xB0, 0xC9, 0x9C, 0x9F, 0x9C, 0x8C, 0x9C, 0x9B,
+0xBA, 0xD8, 0xD1, 0xD2, 0xB2, 0xB2, 0xA3, 0x92, 0x92, 0x82, 0x00, 0x0A,
+0x1D, 0x1F, 0x2D, 0x2D, 0x4B, 0x3C, 0x5B, 0x3A, 0x4A, 0x3A, 0x39, 0x29,
+0x18, 0x00, 0x08, 0x09, 0x1B, 0x8B, 0xA8, 0xB7, 0xA7, 0xB6, 0xA6, 0xA3,
+0xA3, 0xB3, 0xB3, 0xC2, 0xC1, 0xB0, 0xC8, 0xB8, 0xB8, 0xA9, 0x8B, 0x1C,
+0x1D, 0x1A, 0x19, 0x08, 0xB3, 0xA7, 0xB6, 0xB5, 0xB3, 0xB4, 0xB2, 0xB2,
+0x91, 0x88, 0x89, 0x98, 0xA0, 0xA2, 0x84, 0x16, 0x24, 0x34, 0x34, 0x43,
+0x31, 0x21, 0x11, 0x80, 0x80, 0x92, 0x97, 0x96, 0x95, 0x95, 0xA4, 0x94,
+0x92, 0x82, 0x01, 0x28, 0x3B, 0x3D, 0x3E, 0x2D, 0x2C, 0x2C, 0x2B, 0x2C,
+0x1C, 0x1B, 0x0A, 0x8A, 0x99, 0xA0, 0xC1, 0xA2, 0xA2, 0x80, 0x29, 0x3F,
+0x2E, 0x2C, 0x2C, 0x2C, 0x2B, 0x3C, 0x3B, 0x3A, 0x39, 0x10, 0x02, 0x04,
+0x03, 0x22, 0x48, 0x4A, 0x4B, 0x3B, 0x2A, 0x81, 0xA7, 0xA7, 0xA5, 0xA5,
+0xB4, 0xA4, 0xB3, 0xB3, 0xB2, 0xB1, 0xA0, 0xA9, 0x9A, 0x0C, 0x1D, 0x1C,
+0x2B, 0x3C, 0x3B, 0x4B, 0x29, 0x00, 0x92, 0xB4, 0xB5, 0xB3, 0xA2, 0x80,
+0x2B, 0x1F, 0x1C, 0x1C, 0x2C, 0x2C, 0x3A, 0x5B, 0x49, 0x28, 0x21, 0x11,
+0x03, 0x94, 0x94, 0xB4, 0xB5, 0xB4, 0xB5, 0xB5, 0xA5, 0xB3, 0xA5, 0xA3,
+0xA4, 0x92, 0x92, 0x91, 0x80, 0x19, 0x3C, 0x2E, 0x2C, 0x3B, 0x2D, 0x1B,
+0x1B, 0x1B, 0x0B, 0x0B, 0x8B, 0x0B, 0x1C, 0x3D, 0x2E, 0x3C, 0x3C, 0x2D,
+0x3C, 0x2D, 0x3B, 0x2C, 0x3B, 0x3B, 0x3B, 0x29, 0x18, 0x11, 0x02, 0x13,
+0x22, 0x41, 0x48, 0x38, 0x28, 0x81, 0xA6, 0xA6, 0xB6, 0xA6, 0xB4, 0xA5,
+0xB3, 0xB5, 0xB4, 0xB3, 0xB3, 0xA2, 0xA1, 0xA0, 0x98, 0x89, 0x8A, 0x8A,
+0x8A, 0x8A, 0x98, 0xA1, 0xB4, 0xA5, 0xA4, 0x94, 0x82, 0x10, 0x5B, 0x3D,
+0x2E, 0x3C, 0x2D, 0x3C, 0x2C, 0x3A, 0x3B, 0x4B, 0x4A, 0x3A, 0x39, 0x49,
+0x39, 0x3A, 0x39, 0x2A, 0x19, 0x90, 0xC3, 0xB7, 0xB6, 0xA5, 0xA4, 0xB3,
+0xA4, 0xA3, 0xA3, 0x91, 0x91, 0x90, 0x98, 0x98, 0xA9, 0xAA, 0xDA, 0xD8,
+0xD0, 0xD1, 0xB1, 0xC2, 0xB1, 0xA1, 0x90, 0x2A, 0x2F, 0x3D, 0x2E, 0x3B,
+0x2E, 0x2B, 0x3C, 0x2C, 0x2B, 0x2A, 0x1A, 0x18, 0x18, 0x20, 0x30, 0x50,
+0x59, 0x49, 0x4A, 0x3A, 0x3A, 0x2A, 0x80, 0xA3, 0xA7, 0xA5, 0xA4, 0xA4,
+0xA4, 0xB4, 0xA4, 0xB3, 0xB3, 0xC3, 0xB2, 0xB2, 0xC1, 0xB1, 0xB0, 0xD1,
+0xC2, 0xC2, 0xC3, 0xC3, 0xB3, 0xB3, 0xA4, 0xB3, 0xA3, 0x92, 0x00, 0x2A,
+0x2E, 0x2D, 0x1C, 0x2B, 0x2B, 0x2C, 0x2A, 0x4A, 0x39, 0x49, 0x48, 0x49,
+0x38, 0x49, 0x4A, 0x39, 0x3A, 0x39, 0x28, 0x93, 0x97, 0xA6, 0x94, 0xA3,
+0xA4, 0xA3, 0xA3, 0x92, 0x80, 0x88, 0x0A, 0x0C, 0x1D, 0x0C, 0x0B, 0x0B,
+0x0C, 0x0B, 0x0B, 0x0B, 0x1D, 0x2D, 0x2F, 0x3D, 0x2D, 0x2D, 0x2C, 0x3C,
+0x2C, 0x2C, 0x2B, 0x2C, 0x2B, 0x3B, 0x3B, 0x3B, 0x3A, 0x39, 0x49, 0x49,
+0x49, 0x49, 0x4A, 0x4A, 0x29, 0x29, 0x00, 0x82, 0xA5, 0xA6, 0xA4, 0xA5,
+0xA4, 0xA3, 0xB4, 0xB4, 0xB3, 0xB3, 0xC3, 0xB2, 0xC2, 0xC2, 0xB1, 0xC1,
+0xC2, 0xA1, 0xB1, 0xB2, 0xB3, 0xB4, 0xA3, 0x93, 0x82, 0x00, 0x4B, 0x3E,
+0x3E, 0x2D, 0x2B, 0x2C, 0x3B, 0x2C, 0x3B, 0x4B, 0x4B, 0x3A, 0x4A, 0x4A,
+0x3A, 0x4A, 0x3A, 0x4A, 0x3A, 0x29, 0x00, 0x93, 0xA6, 0xA5, 0xA5, 0xB4,
+0xA4, 0xB3, 0xA4, 0xB3, 0xB3, 0xB3, 0xC3, 0xC2, 0xB2, 0xC2, 0xC2, 0xB2,
+0xD3, 0xC3, 0xC3, 0xC3, 0xB3, 0xB3, 0xB2, 0xA2, 0x90, 0x1A, 0x1F, 0x2C,
+0x2E, 0x2C, 0x2C, 0x2C, 0x2B, 0x2B, 0x3B, 0x3C, 0x3B, 0x5B, 0x3A, 0x4A,
+0x5B, 0x4A, 0x4B, 0x3A, 0x4B, 0x3A, 0x3A, 0x29, 0x18, 0x01, 0xA3, 0xA7,
+0xA5, 0xB3, 0xB5, 0xB4, 0xB3, 0xB4, 0xC3, 0xB2, 0xC2, 0xC2, 0xA1, 0xC1,
+0xB1, 0xC2, 0xC2, 0xB2, 0xC3, 0xB3, 0xA2, 0xA2, 0x92, 0x00, 0x29, 0x4D,
+0x3D, 0x2D, 0x3B, 0x2D, 0x3B, 0x2C, 0x3A, 0x3B, 0x4B, 0x5B, 0x3A, 0x4A,
+0x4B, 0x3A, 0x3A, 0x4A, 0x3A, 0x29, 0x10, 0x82, 0x95, 0xA5, 0xA5, 0xA4,
+0xA4, 0xA4, 0xA3, 0xB3, 0xA4, 0xA3, 0xA2, 0xA1, 0xB2, 0xB2, 0xC1, 0xC2,
+0xD3, 0xC3, 0xC3, 0xB4, 0xC3, 0xB4, 0xB3, 0xA3, 0xA2, 0x80, 0x19, 0x2E,
+0x1D, 0x2C, 0x2D, 0x2C, 0x2B, 0x2C, 0x2B, 0x3B, 0x3C, 0x4B, 0x4B, 0x4B,
+0x4B, 0x4B, 0x4B, 0x4B, 0x3B, 0x4B, 0x3A, 0x3B, 0x29, 0x19, 0x00, 0x81,
+0xB4, 0xA5, 0xB4, 0xB4, 0xB4, 0xC3, 0xC3, 0xB2, 0xC2, 0xC2, 0xB1, 0xD2,
+0xC2, 0xC2, 0xC2, 0xB2, 0xC3, 0xC3, 0xB3, 0xB3, 0xB3, 0xA2, 0x92, 0x00,
+0x2A, 0x3D, 0x3D, 0x3C, 0x3D, 0x3B, 0x3C, 0x4B, 0x4B, 0x4B, 0x2A, 0x4A,
+0x4B, 0x4B, 0x3B, 0x3A, 0x4B, 0x3A, 0x3A, 0x29, 0x28, 0x01, 0x83, 0x96,
+0x94, 0x94, 0xA4, 0xA4, 0x93, 0xB3, 0xA3, 0xA3, 0xB2, 0xB2, 0xD3, 0xC2,
+0xD3, 0xC3, 0xC3, 0xB4, 0xB4, 0xA3, 0xB3, 0xA4, 0x92, 0x91, 0x19, 0x2D,
+0x2E, 0x2D, 0x2D, 0x1B, 0x2B, 0x2C, 0x2C, 0x3B, 0x2C, 0x3A, 0x3C, 0x4B,
+0x4B, 0x4B, 0x3B, 0x4B, 0x4B, 0x3A, 0x4B, 0x2A, 0x29, 0x18, 0x00, 0x92,
+0xA5, 0xA4, 0xA5, 0xB3, 0xB4, 0xB4, 0xB3, 0xD3, 0xD3, 0xB2, 0xD2, 0xC2,
+0xC2, 0xC2, 0xC2, 0xC3, 0xB2, 0xC3, 0xC3, 0xB3, 0xB2, 0xB3, 0xB3, 0xA2,
+0x91, 0x08, 0x2A, 0x2D, 0x3C, 0x2C, 0x4B, 0x3B, 0x4B, 0x4B, 0x4B, 0x4B,
+0x4B, 0x3A, 0x4B, 0x4B, 0x3A, 0x4B, 0x29, 0x39, 0x18, 0x11, 0x93, 0x96,
+0x94, 0x94, 0xA4, 0xA4, 0xA3, 0x93, 0xA2, 0xA3, 0x91, 0x90, 0x90, 0x99,
+0xC0, 0xD2, 0xC4, 0xC4, 0xA4, 0xB4, 0xA4, 0xA3, 0x92, 0x91, 0x80, 0x2B,
+0x1F, 0x2C, 0x2D, 0x1C, 0x2B, 0x2C, 0x2C, 0x3B, 0x3C, 0x3C, 0x3B, 0x4C,
+0x3B, 0x4B, 0x4B, 0x4B, 0x3B, 0x4B, 0x4B, 0x3A, 0x2A, 0x29, 0x18, 0x10,
+0x10, 0x82, 0x83, 0x94, 0xA4, 0xA4, 0xC3, 0xC3, 0xE3, 0xC2, 0xD2, 0xC2,
+0xC2, 0xD3, 0xC2, 0xC3, 0xB2, 0xC3, 0xC3, 0xC3, 0xA2, 0xA2, 0xB2, 0xA2,
+0xA1, 0x91, 0x90, 0x88, 0x08, 0x1A, 0x2A, 0x4B, 0x4B, 0x4B, 0x5B, 0x5B,
+0x4B, 0x5B, 0x4B, 0x4B, 0x3A, 0x4B, 0x3A, 0x3A, 0x29, 0x10, 0x82, 0x84,
+0x94, 0x95, 0x93, 0x93, 0x94, 0x83, 0x01, 0x28, 0x3A, 0x3D, 0x3C, 0x2D,
+0x2B, 0x2B, 0x1A, 0x08, 0x92, 0x95, 0xA4, 0x94, 0x82, 0x18, 0x3D, 0x2F,
+0x3D, 0x2E, 0x2C, 0x2C, 0x2B, 0x3C, 0x2C, 0x3B, 0x2C, 0x3B, 0x3C, 0x3C,
+0x4B, 0x3B, 0x4C, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3A, 0x3A, 0x3A, 0x29,
+0x10, 0x82, 0x84, 0x94, 0x93, 0x94, 0xA3, 0xB4, 0xC4, 0xD3, 0xD3, 0xD3,
+0xC2, 0xD3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xB3, 0xC3, 0xB3, 0xB2, 0xB3,
+0xB3, 0xB2, 0xC3, 0xA2, 0xA1, 0xB2, 0xA2, 0xA2, 0x92, 0x00, 0x38, 0x6B,
+0x4C, 0x5B, 0x4B, 0x4B, 0x3B, 0x4B, 0x2A, 0x3A, 0x29, 0x18, 0x81, 0x94,
+0xA5, 0x95, 0xA3, 0x94, 0x93, 0x82, 0x01, 0x18, 0x19, 0x2B, 0x2D, 0x1D,
+0x1B, 0x8A, 0x98, 0xC2, 0xC5, 0xB5, 0xB4, 0xA4, 0xB3, 0xB3, 0xA2, 0x88,
+0x1B, 0x1F, 0x1C, 0x1D, 0x2C, 0x1C, 0x2B, 0x2D, 0x3B, 0x2D, 0x4B, 0x3C,
+0x4B, 0x4B, 0x3C, 0x4B, 0x3B, 0x4B, 0x4B, 0x3B, 0x3A, 0x4B, 0x3A, 0x29,
+0x29, 0x10, 0x11, 0x11, 0x22, 0x21, 0x12, 0x21, 0x10, 0x80, 0xD0, 0xF2,
+0xF2, 0xD2, 0xD3, 0xD3, 0xC3, 0xC3, 0xC3, 0xC3, 0xA2, 0xB2, 0xB3, 0xC3,
+0xB2, 0xB3, 0xB2, 0xB2, 0xB2, 0xC3, 0xB2, 0xA2, 0xA2, 0x92, 0x10, 0x4A,
+0x5C, 0x4C, 0x4B, 0x3B, 0x4B, 0x4B, 0x2A, 0x29, 0x19, 0x81, 0x93, 0xA6,
+0xA5, 0xA5, 0xA4, 0xA3, 0xB4, 0xA4, 0xB3, 0xB3, 0xB3, 0xA2, 0xA0, 0xA0,
+0xB0, 0xC1, 0xD2, 0xC3, 0xB4, 0xB4, 0xB4, 0xA4, 0xB3, 0xB3, 0xA2, 0x90,
+0x89, 0x0D, 0x1D, 0x1D, 0x1D, 0x2B, 0x1D, 0x2B, 0x2C, 0x3C, 0x2C, 0x4B,
+0x3C, 0x4C, 0x3B, 0x4B, 0x3C, 0x4B, 0x4B, 0x3B, 0x3A, 0x4B, 0x3A, 0x3A,
+0x3A, 0x49, 0x39, 0x39, 0x38, 0x49, 0x49, 0x39, 0x4A, 0x4B, 0x3B, 0x2B,
+0x8A, 0xC0, 0xF3, 0xD3, 0xD3, 0xC3, 0xB2, 0xC3, 0xC3, 0xC3, 0xB2, 0xB3,
+0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xA1, 0x90, 0x80, 0x18, 0x5B, 0x4C, 0x4C,
+0x4B, 0x4C, 0x4B, 0x3B, 0x4B, 0x4B, 0x3B, 0x3A, 0x3A, 0x29, 0x00, 0x93,
+0x96, 0xA4, 0xA5, 0xA5, 0xA3, 0xB4, 0xA4, 0xA2, 0xC3, 0xB3, 0xB2, 0xC3,
+0xB2, 0xD3, 0xB2, 0xC3, 0xB4, 0xB4, 0xB4, 0xB4, 0xA3, 0xB3, 0xB3, 0xB2,
+0xC2, 0xB1, 0xB0, 0x99, 0xAB, 0x8C, 0x0E, 0x1C, 0x1C, 0x2C, 0x3D, 0x3C,
+0x3D, 0x3C, 0x4B, 0x3C, 0x3B, 0x4C, 0x3B, 0x3B, 0x4B, 0x3B, 0x3A, 0x3B,
+0x39, 0x4A, 0x39, 0x28, 0x21, 0x30, 0x30, 0x58, 0x39, 0x4A, 0x2A, 0x0A,
+0xA8, 0xF2, 0xF3, 0xD3, 0xD3, 0xC3, 0xC3, 0xB2, 0xC3, 0xC3, 0xA2, 0xB2,
+0xB2, 0xB2, 0xC3, 0xB2, 0xB2, 0xA1, 0xA1, 0x91, 0x80, 0x39, 0x4D, 0x5C,
+0x4C, 0x3B, 0x4C, 0x4B, 0x4B, 0x3B, 0x4B, 0x4B, 0x2A, 0x29, 0x29, 0x18,
+0x01, 0x82, 0xA4, 0xA6, 0xA4, 0xA3, 0xB4, 0xB4, 0xB3, 0xB4, 0xC3, 0xB2,
+0xD3, 0xC3, 0xC3, 0xC3, 0xB4, 0xB3, 0xB4, 0xB4, 0xB4, 0xA3, 0xB3, 0xC3,
+0xA2, 0xB2, 0xC2, 0xB1, 0xC2, 0xB1, 0xB1, 0xB0, 0xB0, 0xA0, 0x89, 0x2B,
+0x3F, 0x3D, 0x4C, 0x3C, 0x4C, 0x3C, 0x3B, 0x4B, 0x3C, 0x4B, 0x2A, 0x3A,
+0x3A, 0x3A, 0x39, 0x39, 0x48, 0x38, 0x59, 0x39, 0x5A, 0x4B, 0x4B, 0x3B,
+0x3B, 0x2C, 0x0A, 0x99, 0xB0, 0xE2, 0xD2, 0xC2, 0xC2, 0xB2, 0xB2, 0xB1,
+0xB1, 0xB1, 0xA0, 0xA8, 0x99, 0x0B, 0x1C, 0x2D, 0x3D, 0x4D, 0x3C, 0x4C,
+0x4B, 0x3B, 0x4C, 0x4B, 0x3B, 0x4B, 0x4B, 0x4B, 0x3A, 0x3A, 0x3A, 0x39,
+0x18, 0x11, 0x93, 0x96, 0xA4, 0xA4, 0xA4, 0xB3, 0xB4, 0xC3, 0xC3, 0xB3,
+0xC3, 0xC3, 0xC3, 0xC3, 0xB3, 0xB4, 0xB4, 0xA3, 0xB3, 0xA4, 0xB3, 0xB3,
+0xB3, 0xC2, 0xC2, 0xB1, 0xC1, 0xC1, 0xC1, 0xA0, 0xB0, 0xA0, 0x89, 0x2B,
+0x3E, 0x3D, 0x3D, 0x3C, 0x4C, 0x3C, 0x3B, 0x3C, 0x3B, 0x3C, 0x4B, 0x2A,
+0x29, 0x29, 0x18, 0x10, 0x11, 0x21, 0x30, 0x68, 0x49, 0x4A, 0x3A, 0x3B,
+0x1A, 0x99, 0xE1, 0xE3, 0xD3, 0xC2, 0xC3, 0xC2, 0xC3, 0xB2, 0xC2, 0xB2,
+0xC2, 0xB2, 0xB2, 0xB1, 0xB1, 0xD2, 0xB2, 0xA1, 0xA1, 0x91, 0x08, 0x5B,
+0x4D, 0x4C, 0x4C, 0x3B, 0x4C, 0x4B, 0x4B, 0x4B, 0x2A, 0x3A, 0x3A, 0x39,
+0x29, 0x20, 0x10, 0x02, 0x83, 0xA5, 0xA5, 0xA3, 0xB3, 0xC4, 0xC3, 0xB2,
+0xC3, 0xC2, 0xC3, 0xB3, 0xB4, 0xB4, 0xB4, 0xA4, 0xA3, 0xB3, 0xA3, 0xB3,
+0xC3, 0xC3, 0xC2, 0xC2, 0xB1, 0xC1, 0xB1, 0xB0, 0xB0, 0xA8, 0x99, 0x2B,
+0x3F, 0x3E, 0x3D, 0x4C, 0x3C, 0x3B, 0x3C, 0x3C, 0x3B, 0x3B, 0x4B, 0x2A,
+0x29, 0x29, 0x18, 0x11, 0x02, 0x04, 0x12, 0x22, 0x31, 0x40, 0x28, 0x80,
+0xD3, 0xD5, 0xD4, 0xD3, 0xC3, 0xC3, 0xD3, 0xC3, 0xB2, 0xC3, 0xC3, 0xB2,
+0xC3, 0xB2, 0xC2, 0xC3, 0xB2, 0xB2, 0xC3, 0xA2, 0xB2, 0xB2, 0xA2, 0x91,
+0x18, 0x4B, 0x4D, 0x4C, 0x3C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x3A, 0x3A,
+0x3A, 0x4A, 0x29, 0x28, 0x28, 0x29, 0x28, 0x18, 0x19, 0x19, 0x0A, 0xA9,
+0xB8, 0xE1, 0xE3, 0xC3, 0xC3, 0xA4, 0xB4, 0xA4, 0xA4, 0xA3, 0x92, 0xA2,
+0xB3, 0xD3, 0xC2, 0xC2, 0xC2, 0xB1, 0xC1, 0xA0, 0xB0, 0x98, 0x89, 0x2C,
+0x4D, 0x3D, 0x4D, 0x3B, 0x4D, 0x3B, 0x3C, 0x4B, 0x3B, 0x3B, 0x4B, 0x4B,
+0x2A, 0x29, 0x39, 0x4A, 0x29, 0x38, 0x39, 0x48, 0x39, 0x49, 0x39, 0x39,
+0x18, 0x80, 0xD3, 0xD4, 0xC4, 0xC3, 0xD3, 0xC3, 0xB2, 0xD3, 0xB2, 0xC3,
+0xC2, 0xB2, 0xC2, 0xC2, 0xB2, 0xB2, 0xC2, 0xB2, 0xB2, 0xB2, 0xA1, 0x90,
+0x08, 0x3B, 0x3F, 0x3D, 0x3C, 0x4C, 0x3B, 0x4B, 0x4B, 0x3A, 0x5B, 0x3A,
+0x39, 0x39, 0x28, 0x20, 0x20, 0x01, 0x93, 0xA4, 0xC4, 0xC4, 0xC3, 0xB2,
+0xC2, 0xC3, 0xB2, 0xD3, 0xB3, 0xB3, 0xB4, 0xA4, 0xB3, 0xA4, 0xA3, 0xA2,
+0xA3, 0xC3, 0xC2, 0xD3, 0xC2, 0xB1, 0xB1, 0xB0, 0xA8, 0x0A, 0x2D, 0x3E,
+0x3D, 0x3D, 0x3C, 0x4C, 0x3C, 0x3B, 0x3C, 0x3C, 0x3B, 0x3B, 0x4B, 0x3B,
+0x3A, 0x3A, 0x4A, 0x39, 0x39, 0x48, 0x49, 0x28, 0x38, 0x30, 0x38, 0x10,
+0x83, 0xA5, 0xB5, 0xB5, 0xC5, 0xC4, 0xC3, 0xC3, 0xC3, 0xC3, 0xA2, 0xC2,
+0xB2, 0xC3, 0xB2, 0xD3, 0xB2, 0xC3, 0xC2, 0xC3, 0xA2, 0xB2, 0xA2, 0xA1,
+0xA1, 0x80, 0x19, 0x3B, 0x3D, 0x4D, 0x3B, 0x4C, 0x4B, 0x4B, 0x3A, 0x3A,
+0x5A, 0x29, 0x28, 0x28, 0x20, 0x28, 0x00, 0x81, 0xA2, 0xE3, 0xD3, 0xC2,
+0xC3, 0xC2, 0xB2, 0xD3, 0xC3, 0xB3, 0xB4, 0xB3, 0xA4, 0xB3, 0xB4, 0xA4,
+0xA2, 0xB2, 0xC3, 0xC3, 0xC2, 0xB2, 0xC2, 0xB1, 0xB1, 0x90, 0x0A, 0x2D,
+0x3D, 0x3D, 0x3D, 0x4C, 0x3C, 0x3B, 0x3C, 0x3C, 0x3B, 0x4B, 0x3B, 0x4B,
+0x4B, 0x3A, 0x4B, 0x3A, 0x3A, 0x4A, 0x4A, 0x3A, 0x4A, 0x4A, 0x29, 0x39,
+0x3A, 0x29, 0x18, 0x91, 0xB3, 0xC5, 0xC3, 0xC3, 0xD3, 0xC3, 0xC2, 0xB2,
+0xD3, 0xB2, 0xC2, 0xC2, 0xC2, 0xB2, 0xC2, 0xC3, 0xB2, 0xB2, 0xB2, 0xB2,
+0xA1, 0x98, 0x09, 0x2C, 0x3D, 0x3E, 0x3C, 0x4C, 0x4B, 0x4B, 0x3A, 0x4A,
+0x4A, 0x29, 0x39, 0x28, 0x28, 0x20, 0x00, 0x81, 0xB3, 0xC4, 0xD4, 0xC3,
+0xD3, 0xB2, 0xC3, 0xC3, 0xB3, 0xC3, 0xB3, 0xB4, 0xB4, 0xB4, 0xA3, 0xB3,
+0xC3, 0xB4, 0xC3, 0xA2, 0xC2, 0xB2, 0xB2, 0xC2, 0xB1, 0xA1, 0x98, 0x09,
+0x3B, 0x3F, 0x3E, 0x3C, 0x3C, 0x3C, 0x3B, 0x3C, 0x3C, 0x4B, 0x3B, 0x4C,
+0x3B, 0x4B, 0x4B, 0x2A, 0x3A, 0x4A, 0x3A, 0x3A, 0x4A, 0x4A, 0x4A, 0x29,
+0x29, 0x18, 0x00, 0x81, 0x81, 0xB2, 0xB4, 0xD3, 0xB2, 0xC1, 0xC1, 0xB1,
+0xD1, 0xC1, 0xC1, 0xC2, 0xC3, 0xC2, 0xB4, 0xB3, 0xC3, 0xB2, 0xB1, 0x9A,
+0x8F, 0x0C, 0x0B, 0x1A, 0x3B, 0x4B, 0x49, 0x5A, 0x4A, 0x4B, 0x3B, 0x4A,
+0x3A, 0x38, 0x48, 0x38, 0x28, 0x18, 0x91, 0xD2, 0xE3, 0xD3, 0xC4, 0xB4,
+0xA4, 0xB4, 0xA4, 0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xA5, 0xA3,
+0xB3, 0xB4, 0xB3, 0xB2, 0xD2, 0xC2, 0xB2, 0xB3, 0xB3, 0xA4, 0x93, 0x81,
+0x18, 0x2D, 0x3D, 0x2E, 0x3C, 0x2C, 0x3B, 0x2C, 0x3B, 0x2D, 0x2B, 0x2C,
+0x2C, 0x2C, 0x2B, 0x2A, 0x2A, 0x3A, 0x39, 0x39, 0x4A, 0x4B, 0x3B, 0x3C,
+0x2C, 0x19, 0x10, 0x11, 0x04, 0x95, 0x94, 0x92, 0xA1, 0xB0, 0xC8, 0xC0,
+0xC0, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xB0, 0xC0, 0xB0, 0xC0, 0xA1, 0xA1,
+0x92, 0x83, 0x13, 0x41, 0x79, 0x49, 0x6A, 0x39, 0x6A, 0x39, 0x59, 0x39,
+0x59, 0x4A, 0x39, 0x39, 0x49, 0x3A, 0x39, 0x29, 0x10, 0x80, 0xA2, 0xC2,
+0xD3, 0xD3, 0xC3, 0xC3, 0xB3, 0xC4, 0xB3, 0xB3, 0xC3, 0xC3, 0xC3, 0xA2,
+0xB2, 0xD3, 0xB2, 0xE3, 0xB2, 0xC2, 0xB1, 0xB1, 0xC1, 0xA0, 0x99, 0x9A,
+0x8C, 0x0D, 0x0C, 0x1C, 0x1D, 0x1B, 0x2B, 0x2C, 0x2A, 0x2A, 0x39, 0x5A,
+0x4A, 0x3A, 0x4C, 0x3B, 0x3C, 0x4B, 0x3B, 0x4A, 0x39, 0x38, 0x22, 0x24,
+0x15, 0x04, 0x04, 0x84, 0x83, 0x84, 0x93, 0x94, 0x93, 0x93, 0x92, 0xA2,
+0xB3, 0xC2, 0xB0, 0xD8, 0xC8, 0xC0, 0xC0, 0xB1, 0xA1, 0x91, 0x00, 0x4A,
+0x4D, 0x3D, 0x3C, 0x2D, 0x2C, 0x2C, 0x2D, 0x2C, 0x2C, 0x2C, 0x2B, 0x3C,
+0x2C, 0x3B, 0x4B, 0x4B, 0x3A, 0x2A, 0x3A, 0x2B, 0x2B, 0x0C, 0x8A, 0x99,
+0xB8, 0xD3, 0xC4, 0xB4, 0xA4, 0xC3, 0xB2, 0xC2, 0xB1, 0xD1, 0xB1, 0xD2,
+0xC3, 0xC3, 0xB4, 0xB4, 0xA4, 0xA3, 0xB4, 0xA4, 0xA2, 0xB3, 0xA2, 0xA2,
+0x91, 0xA2, 0x82, 0x83, 0x04, 0x04, 0x04, 0x04, 0x13, 0x13, 0x22, 0x32,
+0x51, 0x48, 0x59, 0x4A, 0x4B, 0x3A, 0x3C, 0x4B, 0x3B, 0x4B, 0x3A, 0x3A,
+0x28, 0x18, 0x80, 0xA2, 0xC2, 0xD2, 0xC1, 0xB0, 0xC0, 0xB8, 0xAA, 0xCB,
+0xDB, 0xCA, 0xCA, 0xCA, 0xD9, 0xC8, 0xC8, 0xD1, 0xB1, 0xC1, 0xB1, 0xB0,
+0xA9, 0x9C, 0x9D, 0x8C, 0x8B, 0x8B, 0x89, 0x01, 0x33, 0x35, 0x73, 0x40,
+0x48, 0x49, 0x3A, 0x4B, 0x4B, 0x3A, 0x3A, 0x39, 0x38, 0x12, 0x05, 0x95,
+0x96, 0x94, 0x93, 0x94, 0xA3, 0xA5, 0x93, 0xA3, 0xA3, 0xA5, 0xA3, 0xA4,
+0xA4, 0xB3, 0xB4, 0xB4, 0xB3, 0xA2, 0x91, 0x00, 0x28, 0x38, 0x49, 0x48,
+0x4A, 0x4B, 0x3D, 0x2F, 0x2D, 0x2C, 0x2D, 0x1C, 0x2B, 0x2C, 0x2C, 0x2C,
+0x2B, 0x2C, 0x3B, 0x2C, 0x2A, 0x3B, 0x2B, 0x19, 0x09, 0x88, 0x91, 0xB3,
+0xB6, 0xA5, 0xA3, 0xA4, 0xB4, 0xA4, 0xC3, 0xB2, 0xC2, 0xB1, 0xC0, 0xC2,
+0xC2, 0xD3, 0xB4, 0xB4, 0xB4, 0xA4, 0xB3, 0xB3, 0xC3, 0xB3, 0xC3, 0xA2,
+0xA1, 0xB2, 0xA2, 0xA1, 0x92, 0x01, 0x31, 0x78, 0x68, 0x59, 0x49, 0x5A,
+0x4A, 0x3A, 0x4A, 0x4B, 0x4A, 0x4B, 0x4B, 0x3A, 0x3B, 0x3A, 0x2A, 0x3A,
+0x2B, 0x2A, 0x2B, 0x2D, 0x2B, 0x3B, 0x4C, 0x3A, 0x5B, 0x4A, 0x4B, 0x3C,
+0x3C, 0x2D, 0x2B, 0x1B, 0x89, 0x88, 0xA1, 0xB2, 0xB2, 0xB1, 0xB9, 0xBC,
+0xCC, 0xCA, 0xD9, 0xD1, 0xC2, 0xB2, 0xB4, 0xB4, 0xB4, 0xA4, 0xB3, 0xB4,
+0xB3, 0xB4, 0xC3, 0xB3, 0xB2, 0xC3, 0xB2, 0xB4, 0xB4, 0xA4, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA3, 0x94, 0x92, 0xA3, 0xA3, 0xA4, 0xA3, 0x93, 0x82, 0x10,
+0x4A, 0x3C, 0x3D, 0x3D, 0x2C, 0x3B, 0x4B, 0x5B, 0x3A, 0x5A, 0x4A, 0x4A,
+0x5B, 0x3A, 0x3B, 0x3C, 0x2B, 0x2C, 0x2B, 0x2D, 0x2C, 0x2D, 0x2B, 0x2D,
+0x2B, 0x3B, 0x2C, 0x2A, 0x2A, 0x08, 0x81, 0xA3, 0xA6, 0xA4, 0xB4, 0xB6,
+0xA4, 0xC3, 0xB4, 0xB4, 0xB3, 0xC3, 0xC3, 0xB2, 0xC3, 0xC2, 0xB2, 0xC2,
+0xC3, 0xB2, 0xD3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xB3, 0xB3, 0xC3,
+0xA2, 0xA2, 0x91, 0x80, 0x18, 0x39, 0x6A, 0x5A, 0x5A, 0x4A, 0x4A, 0x4B,
+0x4B, 0x4B, 0x3B, 0x3C, 0x3C, 0x4B, 0x3B, 0x4B, 0x3A, 0x4B, 0x4B, 0x2A,
+0x3A, 0x4B, 0x4B, 0x4B, 0x4B, 0x3A, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x1A, 0x19, 0x89, 0x90, 0xC1, 0xE3, 0xD3, 0xC2, 0xC2, 0xB2,
+0xD2, 0xC2, 0xC2, 0xC2, 0xB2, 0xC2, 0xC3, 0xB2, 0xC4, 0xB3, 0xB4, 0xA4,
+0xA2, 0xB3, 0xA4, 0xA2, 0xA3, 0xA2, 0x92, 0x91, 0xA2, 0xA2, 0xA3, 0xA3,
+0x94, 0x84, 0x12, 0x22, 0x51, 0x40, 0x58, 0x59, 0x39, 0x6B, 0x4A, 0x4B,
+0x4B, 0x4B, 0x3C, 0x4B, 0x3B, 0x4C, 0x3B, 0x4C, 0x3B, 0x4B, 0x4B, 0x4B,
+0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x4B, 0x3B, 0x4C, 0x3C, 0x2D, 0x3B, 0x2D,
+0x2B, 0x1C, 0x1A, 0x1B, 0x0A, 0x89, 0x90, 0xB1, 0xC5, 0xC4, 0xB4, 0xB4,
+0xB5, 0xB4, 0xB4, 0xB4, 0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xC3, 0xB2, 0xC3,
+0xB2, 0xC2, 0xC2, 0xC2, 0xC3, 0xB2, 0xC3, 0xB2, 0xC3, 0xB3, 0xA2, 0x91,
+0x88, 0x08, 0x2B, 0x3D, 0x3D, 0x3C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x3A,
+0x4B, 0x4B, 0x4B, 0x3A, 0x4B, 0x4B, 0x3A, 0x4B, 0x3A, 0x2A, 0x4A, 0x3A,
+0x3A, 0x4A, 0x3A, 0x4B, 0x3A, 0x5B, 0x3B, 0x4B, 0x2A, 0x2A, 0x3A, 0x19,
+0x08, 0x81, 0xA3, 0xA6, 0xB4, 0xC4, 0xB3, 0xD3, 0xC3, 0xD3, 0xB2, 0xC3,
+0xB2, 0xC2, 0xB2, 0xC1, 0xC2, 0xB1, 0xD2, 0xC2, 0xC2, 0xC3, 0xC3, 0xB3,
+0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB3, 0xA2, 0xA1, 0xB1, 0xA1, 0xB2, 0xB3,
+0xB6, 0xA6, 0xA4, 0xA4, 0x94, 0x82, 0x01, 0x11, 0x30, 0x5A, 0x5A, 0x4A,
+0x4B, 0x5B, 0x3C, 0x4B, 0x3C, 0x3C, 0x4B, 0x3B, 0x4C, 0x3B, 0x4B, 0x3A,
+0x2A, 0x29, 0x39, 0x39, 0x4A, 0x39, 0x4A, 0x4B, 0x5B, 0x3B, 0x3C, 0x3C,
+0x3C, 0x2C, 0x2C, 0x2B, 0x2B, 0x1B, 0x1B, 0x0A, 0xA8, 0xD2, 0xC4, 0xC4,
+0xB4, 0xC3, 0xB4, 0xB4, 0xB4, 0xB4, 0xB3, 0xB4, 0xA3, 0xB2, 0xB3, 0xD3,
+0xB2, 0xD2, 0xD3, 0xB2, 0xC2, 0xD3, 0xB2, 0xC3, 0xB2, 0xC3, 0xB2, 0xB2,
+0xB3, 0xA1, 0xA1, 0x90, 0x80, 0x19, 0x2A, 0x5B, 0x5B, 0x5B, 0x4A, 0x4A,
+0x4B, 0x3A, 0x5B, 0x3B, 0x3A, 0x4B, 0x2A, 0x2A, 0x29, 0x29, 0x39, 0x38,
+0x68, 0x48, 0x49, 0x59, 0x49, 0x4A, 0x4A, 0x4B, 0x4A, 0x4B, 0x4B, 0x3A,
+0x4B, 0x3B, 0x4B, 0x2A, 0x3A, 0x3B, 0x2A, 0x2A, 0x2A, 0x3B, 0x3C, 0x3C,
+0x2D, 0x2C, 0x2C, 0x1C, 0x1B, 0x0C, 0x1B, 0x0C, 0x8A, 0x89, 0x98, 0xB1,
+0xB4, 0xA5, 0xA4, 0xA4, 0xA3, 0xA4, 0xB3, 0xB4, 0xC3, 0xC3, 0xC2, 0xC3,
+0xD3, 0xC3, 0xB3, 0xB4, 0xB4, 0xA4, 0xB3, 0xA4, 0xA4, 0xA3, 0xA3, 0xA4,
+0x93, 0x82, 0x10, 0x4A, 0x5C, 0x4C, 0x3C, 0x4B, 0x3C, 0x4B, 0x3B, 0x4C,
+0x3B, 0x3A, 0x4B, 0x3A, 0x3A, 0x3A, 0x3A, 0x39, 0x5A, 0x4B, 0x5B, 0x3C,
+0x3C, 0x3C, 0x3C, 0x2C, 0x3C, 0x2C, 0x2B, 0x3B, 0x2B, 0x1B, 0x1A, 0x88,
+0xA0, 0xC4, 0xB4, 0xB5, 0xB4, 0xB5, 0xB4, 0xB3, 0xB4, 0xB4, 0xB4, 0xB3,
+0xB3, 0xC4, 0xC3, 0xC3, 0xB2, 0xB4, 0xC2, 0xC3, 0xB3, 0xC3, 0xB2, 0xC3,
+0xB3, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB1, 0xA2, 0xA1, 0x81, 0x00, 0x38,
+0x49, 0x6A, 0x4A, 0x4A, 0x4A, 0x4B, 0x3A, 0x2A, 0x29, 0x18, 0x00, 0x93,
+0x85, 0x83, 0x04, 0x12, 0x41, 0x69, 0x5A, 0x5B, 0x5B, 0x4B, 0x4C, 0x4B,
+0x4B, 0x3B, 0x3A, 0x3B, 0x3A, 0x3B, 0x2A, 0x3A, 0x3B, 0x3C, 0x3B, 0x3C,
+0x3D, 0x3C, 0x2D, 0x2B, 0x2C, 0x2C, 0x1B, 0x1B, 0x1B, 0x8A, 0x98, 0xC1,
+0xC4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB3, 0xC3, 0xB3, 0xC3, 0xC3,
+0xB3, 0xC3, 0xB3, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA3, 0xA4, 0xB3, 0xA4,
+0xA3, 0x92, 0x01, 0x28, 0x5B, 0x4C, 0x4C, 0x4C, 0x4B, 0x3C, 0x4C, 0x3B,
+0x4B, 0x3B, 0x4B, 0x4B, 0x3B, 0x3A, 0x4B, 0x3B, 0x4B, 0x4B, 0x3B, 0x4B,
+0x3C, 0x3C, 0x3B, 0x3C, 0x3C, 0x3C, 0x2C, 0x3B, 0x3B, 0x2C, 0x2A, 0x3B,
+0x2B, 0x1A, 0x08, 0x90, 0xA2, 0xC5, 0xB4, 0xB4, 0xB4, 0xB5, 0xB3, 0xB4,
+0xC4, 0xB3, 0xC4, 0xB3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xB3,
+0xB2, 0xC3, 0xB3, 0xC3, 0xC3, 0xA2, 0xB2, 0xB4, 0xB3, 0xB3, 0xB3, 0xA3,
+0xA2, 0xA3, 0x82, 0x81, 0x00, 0x28, 0x3A, 0x3B, 0x4B, 0x2A, 0x00, 0x92,
+0xA6, 0x96, 0x93, 0x84, 0x22, 0x68, 0x6A, 0x6B, 0x5B, 0x4B, 0x4B, 0x4B,
+0x3C, 0x4B, 0x3B, 0x3C, 0x3B, 0x4B, 0x3B, 0x3B, 0x3C, 0x4B, 0x3B, 0x3B,
+0x3C, 0x2C, 0x3B, 0x2C, 0x3C, 0x2C, 0x2B, 0x2C, 0x2B, 0x2B, 0x1C, 0x1A,
+0x1A, 0x09, 0x08, 0x90, 0xA4, 0xB4, 0xA6, 0xB3, 0xB5, 0xB5, 0xB4, 0xB3,
+0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xA3, 0xB3, 0xB5, 0xA4, 0xB3, 0xB4, 0xA4,
+0xB3, 0xA4, 0xB3, 0xA3, 0xA3, 0x92, 0x01, 0x39, 0x4C, 0x4C, 0x4C, 0x4B,
+0x4C, 0x3B, 0x4B, 0x4B, 0x3A, 0x4B, 0x3B, 0x3A, 0x3A, 0x4B, 0x3A, 0x4C,
+0x3B, 0x4C, 0x3B, 0x3C, 0x2C, 0x3B, 0x3D, 0x2C, 0x3B, 0x3C, 0x2B, 0x3B,
+0x2C, 0x2A, 0x1A, 0x09, 0x88, 0x80, 0xA1, 0xD3, 0xC4, 0xB3, 0xC4, 0xC3,
+0xC4, 0xB3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xB3, 0xC3,
+0xC3, 0xC3, 0xB3, 0xB2, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xA2, 0xB3, 0xB3,
+0xA3, 0x92, 0xA2, 0x82, 0x81, 0x82, 0x01, 0x01, 0x82, 0x94, 0xA5, 0xA5,
+0xA4, 0xA4, 0xA3, 0x94, 0x93, 0x83, 0x21, 0x48, 0x7A, 0x5B, 0x5B, 0x4B,
+0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x4B, 0x3B, 0x4B, 0x3C, 0x3B,
+0x3C, 0x3C, 0x2B, 0x3C, 0x2C, 0x2B, 0x2B, 0x2C, 0x2C, 0x2C, 0x1B, 0x2B,
+0x1B, 0x1B, 0x1B, 0x0A, 0x99, 0xB1, 0xD4, 0xC3, 0xC4, 0xB4, 0xB4, 0xB4,
+0xB4, 0xB3, 0xB4, 0xB4, 0xB4, 0xA4, 0xB3, 0xB4, 0xA4, 0xA3, 0xB3, 0xA5,
+0xA3, 0xA3, 0xA3, 0xA3, 0x94, 0x01, 0x20, 0x7B, 0x5B, 0x5B, 0x4C, 0x4B,
+0x4B, 0x4B, 0x4B, 0x4B, 0x3B, 0x3A, 0x4B, 0x3A, 0x4B, 0x3B, 0x3A, 0x4B,
+0x4B, 0x3B, 0x4C, 0x3B, 0x3C, 0x3C, 0x3B, 0x2C, 0x3B, 0x3C, 0x2C, 0x3B,
+0x2B, 0x3B, 0x2C, 0x2B, 0x2A, 0x2B, 0x1B, 0x09, 0x88, 0xA0, 0xD3, 0xC4,
+0xC4, 0xC3, 0xC4, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xB2, 0xC3,
+0xC3, 0xC3, 0xA2, 0xB2, 0xC3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xB3,
+0xB3, 0xA4, 0xA2, 0xA3, 0xB3, 0xA3, 0x93, 0xA2, 0xA3, 0xA3, 0xA4, 0xA4,
+0xA5, 0xA4, 0xA5, 0xA4, 0xA4, 0x93, 0x93, 0x02, 0x21, 0x48, 0x6A, 0x4A,
+0x5B, 0x4B, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x4B, 0x3B, 0x3B, 0x3B,
+0x3B, 0x3C, 0x2C, 0x2B, 0x1B, 0x1C, 0x1C, 0x1C, 0x1B, 0x1D, 0x1C, 0x1B,
+0x2C, 0x1C, 0x1A, 0x0A, 0x89, 0xA0, 0xD3, 0xC4, 0xB4, 0xC3, 0xB4, 0xB4,
+0xB4, 0xB3, 0xB4, 0xB4, 0xB3, 0xB4, 0xB4, 0xA4, 0xA2, 0xB3, 0xA5, 0xB3,
+0xA4, 0xB3, 0xA5, 0xA3, 0xA2, 0x93, 0x81, 0x10, 0x5B, 0x5C, 0x4C, 0x4B,
+0x4C, 0x3B, 0x4B, 0x4B, 0x4B, 0x3B, 0x3A, 0x4B, 0x3A, 0x5B, 0x3A, 0x3B,
+0x3A, 0x4B, 0x4B, 0x3B, 0x4C, 0x3B, 0x3C, 0x2C, 0x3B, 0x3C, 0x2C, 0x2A,
+0x2B, 0x2B, 0x3B, 0x2C, 0x2A, 0x2B, 0x2A, 0x1A, 0x88, 0xA0, 0xC3, 0xD4,
+0xC4, 0xC3, 0xC3, 0xC4, 0xC3, 0xB3, 0xD3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+0xB2, 0xC3, 0xC3, 0xC3, 0xA2, 0xB2, 0xC3, 0xC3, 0xA2, 0xB2, 0xB3, 0xB3,
+0xC3, 0xB3, 0xA3, 0xB3, 0xB3, 0xA4, 0x92, 0x92, 0x92, 0xA3, 0xA4, 0xA4,
+0xA4, 0xA4, 0xA4, 0xA4, 0x94, 0x92, 0x83, 0x12, 0x30, 0x68, 0x5A, 0x5A,
+0x4A, 0x4B, 0x3A, 0x5B, 0x4B, 0x4B, 0x4B, 0x4B, 0x3B, 0x4B, 0x2A, 0x3A,
+0x3C, 0x3B, 0x3B, 0x2B, 0x2B, 0x1B, 0x1B, 0x0B, 0x0B, 0x8C, 0x8B, 0x0C,
+0x0C, 0x0D, 0x0B, 0x8C, 0x9A, 0xAA, 0xE0, 0xD2, 0xC2, 0xC4, 0xC3, 0xB4,
+0xC4, 0xB3, 0xB4, 0xB3, 0xB4, 0xC3, 0xB4, 0xB3, 0xA4, 0xB3, 0xB4, 0xB3,
+0xB4, 0xA4, 0xB3, 0xB3, 0xA4, 0xA2, 0xA3, 0x92, 0x20, 0x6B, 0x5C, 0x4C,
+0x4B, 0x4B, 0x4C, 0x3B, 0x4B, 0x4B, 0x4B, 0x3A, 0x3B, 0x4B, 0x4B, 0x3A,
+0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x4C, 0x3B, 0x3B, 0x3C, 0x3B, 0x3C, 0x2C,
+0x2A, 0x3B, 0x2B, 0x3B, 0x3C, 0x2B, 0x3B, 0x3B, 0x2C, 0x2A, 0x1A, 0x88,
+0xB1, 0xC6, 0xC4, 0xC4, 0xB3, 0xC4, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+0xA2, 0xB2, 0xD3, 0xC3, 0xA2, 0xB2, 0xC3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3,
+0xB3, 0xB3, 0xB4, 0xB3, 0xC3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB4, 0xA4,
+0xA2, 0xA3, 0xA4, 0x94, 0x82, 0x82, 0x12, 0x21, 0x40, 0x48, 0x69, 0x4A,
+0x5A, 0x5B, 0x4B, 0x5B, 0x4B, 0x4B, 0x4B, 0x3B, 0x4B, 0x4B, 0x3A, 0x4B,
+0x3B, 0x4B, 0x3B, 0x3B, 0x3B, 0x2B, 0x2B, 0x2B, 0x1C, 0x1B, 0x1C, 0x1B,
+0x1D, 0x1B, 0x1C, 0x1B, 0x0B, 0x8A, 0xB8, 0xF3, 0xE3, 0xC3, 0xD3, 0xC3,
+0xC4, 0xB3, 0xC3, 0xB3, 0xC4, 0xB3, 0xC3, 0xB3, 0xB4, 0xB3, 0xB4, 0xB4,
+0xB3, 0xB4, 0xB4, 0xB4, 0xB3, 0xB4, 0xB3, 0xA3, 0xA2, 0x92, 0x00, 0x29,
+0x5C, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x3A, 0x5B, 0x3A, 0x4B,
+0x4B, 0x2A, 0x3A, 0x4B, 0x4B, 0x3B, 0x3B, 0x3C, 0x4B, 0x3C, 0x3B, 0x2C,
+0x2A, 0x3B, 0x3B, 0x3C, 0x3C, 0x3B, 0x3C, 0x2B, 0x3B, 0x3B, 0x3C, 0x2B,
+0x1A, 0x98, 0xB1, 0xD4, 0xC4, 0xD3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xB2,
+0xC3, 0xD3, 0xB2, 0xC3, 0xB2, 0xD3, 0xC3, 0xA2, 0xB2, 0xC3, 0xC3, 0xA2,
+0xC3, 0xB3, 0xC3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB4, 0xB3, 0xB4, 0xA4, 0xA2,
+0xB3, 0xA4, 0xB3, 0xA4, 0xA3, 0x93, 0x82, 0x12, 0x21, 0x50, 0x59, 0x6A,
+0x4A, 0x4A, 0x4A, 0x5B, 0x4B, 0x5B, 0x4B, 0x4B, 0x4B, 0x3B, 0x4B, 0x4B,
+0x3B, 0x3A, 0x3C, 0x4B, 0x3B, 0x3B, 0x2B, 0x2A, 0x2B, 0x2B, 0x2B, 0x2C,
+0x2C, 0x2C, 0x2B, 0x1C, 0x2B, 0x1C, 0x0A, 0x99, 0xB0, 0xE3, 0xD3, 0xC4,
+0xC3, 0xB4, 0xC3, 0xB4, 0xC3, 0xB4, 0xB3, 0xB4, 0xB3, 0xC4, 0xB3, 0xB4,
+0xB3, 0xB4, 0xB4, 0xC3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB3, 0xA3, 0x91, 0x81,
+0x28, 0x4B, 0x5C, 0x4C, 0x3B, 0x5B, 0x4B, 0x4B, 0x4B, 0x4B, 0x2A, 0x4A,
+0x4B, 0x3B, 0x3A, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3C, 0x3B, 0x3C, 0x3B,
+0x3C, 0x3C, 0x2B, 0x3B, 0x3C, 0x2C, 0x3B, 0x3B, 0x3C, 0x3C, 0x3B, 0x2B,
+0x2A, 0x2A, 0x09, 0x88, 0xC2, 0xC4, 0xD3, 0xC4, 0xC3, 0xD3, 0xC3, 0xC3,
+0xB2, 0xC3, 0xD3, 0xC3, 0xB2, 0xB3, 0xD3, 0xB3, 0xC3, 0xC3, 0xB3, 0xC3,
+0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xB4, 0xC3, 0xB3, 0xB4, 0xB3, 0xB3, 0xB4,
+0xB3, 0xB4, 0xB4, 0xA3, 0xB3, 0xA4, 0x92, 0x92, 0x82, 0x01, 0x10, 0x38,
+0x6B, 0x4A, 0x6B, 0x4B, 0x5B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
+0x3B, 0x4B, 0x4B, 0x3B, 0x3B, 0x3B, 0x4B, 0x2B, 0x2A, 0x3B, 0x2C, 0x3B,
+0x2C, 0x3B, 0x2D, 0x3B, 0x2C, 0x2B, 0x1A, 0x1A, 0x89, 0xA0, 0xE3, 0xC3,
+0xC4, 0xC3, 0xC4, 0xB3, 0xC3, 0xB4, 0xC3, 0xB3, 0xB4, 0xC3, 0xB4, 0xB3,
+0xB4, 0xC4, 0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB3, 0xB4, 0xC3, 0xB3, 0x92,
+0x91, 0x80, 0x00, 0x29, 0x5B, 0x4C, 0x5B, 0x4B, 0x4B, 0x3A, 0x4B, 0x5B,
+0x4B, 0x4B, 0x3B, 0x3A, 0x4C, 0x3B, 0x3B, 0x4B, 0x3C, 0x3B, 0x3C, 0x3B,
+0x3C, 0x3B, 0x3C, 0x3B, 0x3B, 0x3C, 0x3C, 0x4B, 0x3B, 0x3C, 0x3B, 0x4B,
+0x3B, 0x3B, 0x2B, 0x2A, 0x1A, 0x88, 0x90, 0xD2, 0xD3, 0xC4, 0xD3, 0xC3,
+0xD3, 0xC3, 0xB2, 0xD3, 0xC3, 0xC3, 0xC3, 0xA2, 0xB2, 0xC3, 0xB3, 0xC3,
+0xC3, 0xB3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC4, 0xB3, 0xB3, 0xB4, 0xC3,
+0xB4, 0xB3, 0xA3, 0xB3, 0xB3, 0xA4, 0xB3, 0xA3, 0xA3, 0x92, 0x82, 0x20,
+0x59, 0x5A, 0x6B, 0x4A, 0x5B, 0x4B, 0x5B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
+0x3B, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3B, 0x3B, 0x3C, 0x4B, 0x3B, 0x2C,
+0x2A, 0x3B, 0x2C, 0x3B, 0x2C, 0x2B, 0x2C, 0x2B, 0x2B, 0x0A, 0x09, 0xA8,
+0xD3, 0xC4, 0xB4, 0xC3, 0xB4, 0xB4, 0xB4, 0xC3, 0xB4, 0xB4, 0xC3, 0xB4,
+0xC3, 0xB4, 0xB3, 0xC4, 0xB3, 0xB4, 0xB3, 0xC3, 0xB4, 0xB3, 0xB3, 0xB3,
+0xA3, 0xA2, 0x81, 0x80, 0x28, 0x4A, 0x5B, 0x5B, 0x5B, 0x4B, 0x4B, 0x4A,
+0x4B, 0x4B, 0x4B, 0x3B, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3B, 0x3C, 0x3B,
+0x3C, 0x3B, 0x3C, 0x2C, 0x2A, 0x3B, 0x3C, 0x3C, 0x3B, 0x3C, 0x2C, 0x3A,
+0x2B, 0x2A, 0x2A, 0x19, 0x19, 0x90, 0xB1, 0xD5, 0xD3, 0xD3, 0xC3, 0xD3,
+0xC3, 0xC3, 0xC2, 0xC3, 0xC3, 0xC3, 0xC3, 0xB3, 0xC3, 0xC3, 0xB3, 0xB3,
+0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB4, 0xB3, 0xC3,
+0xB4, 0xB3, 0xB4, 0xA4, 0xA2, 0xB3, 0xA3, 0xA3, 0xB3, 0xA4, 0x92, 0x92,
+0x81, 0x10, 0x39, 0x7B, 0x5B, 0x5B, 0x5B, 0x4B, 0x4B, 0x5B, 0x4B, 0x4B,
+0x3B, 0x4C, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3B, 0x4B, 0x3B, 0x3C, 0x2B,
+0x3B, 0x3C, 0x3C, 0x2C, 0x3B, 0x3C, 0x2B, 0x3B, 0x2C, 0x2A, 0x1A, 0x09,
+0x88, 0x90, 0xB2, 0xD3, 0xC4, 0xB3, 0xC4, 0xC3, 0xB4, 0xC3, 0xB4, 0xC3,
+0xB4, 0xB4, 0xC3, 0xB4, 0xB4, 0xB3, 0xB4, 0xC3, 0xB3, 0xB4, 0xB3, 0xB3,
+0xB3, 0xB3, 0xA3, 0xA2, 0x92, 0x00, 0x38, 0x6B, 0x5B, 0x4A, 0x5B, 0x4A,
+0x5B, 0x4B, 0x4B, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3B, 0x3C, 0x3B, 0x3C,
+0x3B, 0x3B, 0x3C, 0x3B, 0x3C, 0x3C, 0x3B, 0x3C, 0x3C, 0x4B, 0x3C, 0x3B,
+0x3C, 0x3B, 0x3B, 0x3C, 0x3B, 0x2B, 0x2A, 0x1A, 0x09, 0x98, 0xD1, 0xE3,
+0xD3, 0xD3, 0xC3, 0xD3, 0xC3, 0xC3, 0xC3, 0xB2, 0xB4, 0xC3, 0xA2, 0xB2,
+0xB3, 0xC3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC4, 0xB3, 0xC3, 0xB4,
+0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB4, 0xB4, 0xB3, 0xA4, 0xA2, 0xA2, 0xB3,
+0xB4, 0xA4, 0xA2, 0x93, 0x92, 0x11, 0x59, 0x6B, 0x5B, 0x4B, 0x5B, 0x4B,
+0x4B, 0x3B, 0x4C, 0x3B, 0x4B, 0x3B, 0x4B, 0x2A, 0x2A, 0x3B, 0x4B, 0x3B,
+0x3C, 0x3B, 0x3C, 0x2C, 0x3B, 0x2C, 0x3B, 0x2D, 0x3B, 0x2B, 0x2B, 0x3B,
+0x2C, 0x1A, 0x09, 0x88, 0xB2, 0xC4, 0xB4, 0xB4, 0xB4, 0xB4, 0xC4, 0xB3,
+0xC5, 0xB3, 0xC4, 0xB3, 0xB4, 0xC3, 0xB4, 0xC3, 0xB3, 0xB4, 0xB3, 0xB4,
+0xB3, 0xB3, 0xB4, 0xA3, 0xA2, 0xA2, 0x92, 0x01, 0x39, 0x5B, 0x6B, 0x5B,
+0x4B, 0x5B, 0x4B, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3B, 0x4B,
+0x3B, 0x3B, 0x3C, 0x3C, 0x3B, 0x2C, 0x3B, 0x3C, 0x3C, 0x3C, 0x3B, 0x3C,
+0x3B, 0x3B, 0x4B, 0x3B, 0x2A, 0x3A, 0x2B, 0x2A, 0x0A, 0xA8, 0xF2, 0xD2,
+0xE3, 0xD3, 0xD3, 0xC3, 0xC3, 0xD3, 0xB3, 0xC3, 0xC3, 0xB3, 0xC3, 0xB3,
+0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xB2, 0xB4, 0xC3, 0xC3, 0xB3, 0xC3,
+0xB3, 0xB4, 0xC3, 0xB4, 0xB3, 0xB4, 0xA3, 0xB3, 0xB4, 0xB4, 0xA3, 0xB3,
+0xB3, 0xA4, 0x92, 0xA2, 0x82, 0x10, 0x5A, 0x6B, 0x4C, 0x5B, 0x4B, 0x4B,
+0x4C, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3B,
+0x3C, 0x3B, 0x3C, 0x3C, 0x3C, 0x2B, 0x3B, 0x3C, 0x2B, 0x3B, 0x3C, 0x2B,
+0x3B, 0x2B, 0x1A, 0x19, 0x89, 0xA1, 0xC3, 0xC4, 0xB4, 0xB4, 0xB4, 0xC4,
+0xB4, 0xB4, 0xC3, 0xB4, 0xC3, 0xB4, 0xC3, 0xB3, 0xB4, 0xC3, 0xB3, 0xB4,
+0xC3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xA3, 0x01, 0x38, 0x6B, 0x6B, 0x4A,
+0x4B, 0x5B, 0x4B, 0x3A, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3B, 0x4B, 0x3B,
+0x3C, 0x3B, 0x3C, 0x3C, 0x3C, 0x4B, 0x3C, 0x3B, 0x3C, 0x3B, 0x4B, 0x3B,
+0x3C, 0x4B, 0x3B, 0x3B, 0x3B, 0x4B, 0x3B, 0x3B, 0x2B, 0x1A, 0x09, 0x98,
+0xE1, 0xE3, 0xD3, 0xD3, 0xD3, 0xC3, 0xD3, 0xC3, 0xC3, 0xB3, 0xC3, 0xC3,
+0xB3, 0xC3, 0xA2, 0xB2, 0xB3, 0xC3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC4, 0xB3,
+0xB4, 0xC3, 0xB3, 0xB4, 0xB3, 0xC3, 0xB3, 0xB4, 0xB3, 0xA3, 0xB3, 0xB4,
+0xB3, 0xB4, 0xA4, 0xA2, 0x92, 0x01, 0x38, 0x6B, 0x5B, 0x5B, 0x4B, 0x5B,
+0x4B, 0x4B, 0x3C, 0x4B, 0x3B, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B,
+0x4B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3C, 0x2C, 0x3B, 0x2C, 0x1A, 0x1A, 0x1A,
+0x1A, 0x2A, 0x0A, 0x08, 0x09, 0x90, 0xB3, 0xA5, 0xB5, 0xB5, 0xA5, 0xB3,
+0xB5, 0xC4, 0xB4, 0xC3, 0xB3, 0xC4, 0xC3, 0xB3, 0xB4, 0xC3, 0xB3, 0xC4,
+0xB3, 0xB3, 0xB3, 0xB4, 0xC3, 0xB3, 0xB3, 0xA3, 0xA2, 0x93, 0x81, 0x38,
+0x6B, 0x5B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x3A, 0x3B, 0x4B, 0x4B,
+0x3B, 0x4B, 0x3B, 0x3C, 0x4B, 0x3C, 0x3C, 0x3C, 0x3B, 0x3C, 0x3C, 0x3B,
+0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3A, 0x3B, 0x3B, 0x3B, 0x2B, 0x1B,
+0x99, 0xE0, 0xF3, 0xC2, 0xE3, 0xC3, 0xB2, 0xC4, 0xC3, 0xB3, 0xC3, 0xC3,
+0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xC3, 0xC3, 0xB3, 0xC3, 0xC3, 0xB3,
+0xB3, 0xC3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB3, 0xB4, 0xB3, 0xB4, 0xA3, 0xA2,
+0xB3, 0xB3, 0xB4, 0xB3, 0xA3, 0x81, 0x10, 0x5A, 0x7B, 0x5B, 0x5B, 0x5B,
+0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B,
+0x4B, 0x3C, 0x3B, 0x3C, 0x3B, 0x3C, 0x2C, 0x2A, 0x3B, 0x3B, 0x2C, 0x2A,
+0x2B, 0x2A, 0x2B, 0x0A, 0x88, 0xB1, 0xC3, 0xC4, 0xB4, 0xB4, 0xB4, 0xB4,
+0xB4, 0xC4, 0xB4, 0xB3, 0xB4, 0xC3, 0xB4, 0xB3, 0xC3, 0xB4, 0xC3, 0xB3,
+0xC3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xB4, 0xA3, 0x92, 0x92, 0x11,
+0x39, 0x6B, 0x5B, 0x4B, 0x4B, 0x4B, 0x3B, 0x3A, 0x4B, 0x2A, 0x3A, 0x2A,
+0x3A, 0x3B, 0x4B, 0x4B, 0x4C, 0x4C, 0x3B, 0x4C, 0x3C, 0x4B, 0x3B, 0x3C,
+0x4B, 0x3B, 0x3C, 0x3B, 0x3A, 0x3B, 0x3B, 0x4C, 0x3B, 0x4B, 0x3B, 0x3B,
+0x2C, 0x2A, 0x0A, 0xA8, 0xE3, 0xE3, 0xC2, 0xC3, 0xD3, 0xB2, 0xC3, 0xB2,
+0xD3, 0xA2, 0xB2, 0xB2, 0xC2, 0xB2, 0xC3, 0xC3, 0xC3, 0xC3, 0xB4, 0xC3,
+0xB4, 0xC3, 0xB3, 0xB4, 0xC3, 0xB3, 0xB4, 0xC3, 0xB3, 0xB3, 0xB3, 0xB4,
+0xC3, 0xB4, 0xB3, 0xB4, 0xB3, 0xA4, 0xB3, 0xA3, 0x92, 0x82, 0x10, 0x48,
+0x6B, 0x5B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x3B, 0x3A, 0x4B, 0x4B, 0x4B,
+0x4B, 0x3B, 0x4B, 0x3B, 0x3C, 0x3B, 0x2C, 0x3B, 0x2C, 0x3B, 0x2C, 0x2B,
+0x2A, 0x2B, 0x2C, 0x2A, 0x3B, 0x3C, 0x3A, 0x4B, 0x3A, 0x4A, 0x19, 0x00,
+0x92, 0xC4, 0xB5, 0xC4, 0xB4, 0xC3, 0xB3, 0xC3, 0xB3, 0xB2, 0xB3, 0xC3,
+0xB3, 0xC3, 0xB4, 0xB3, 0xC4, 0xB3, 0xB4, 0xB3, 0xA3, 0x92, 0x10, 0x6B,
+0x5C, 0x4C, 0x4B, 0x3C, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3A, 0x3B, 0x3A,
+0x3A, 0x4B, 0x2A, 0x19, 0x19, 0x2A, 0x2C, 0x2C, 0x3C, 0x2D, 0x4B, 0x3C,
+0x3B, 0x3B, 0x4B, 0x3A, 0x4A, 0x4A, 0x3A, 0x4A, 0x3A, 0x3A, 0x3A, 0x2B,
+0x1A, 0xAA, 0xF1, 0xF2, 0xF3, 0xD3, 0xD3, 0xC3, 0xC3, 0xB3, 0xC3, 0xC3,
+0xA2, 0xA2, 0xB2, 0xB3, 0xB2, 0xC3, 0xB2, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+0xB3, 0xC4, 0xB3, 0xB4, 0xB3, 0xB4, 0xA3, 0xB3, 0xA3, 0x92, 0xA2, 0xA2,
+0xA2, 0xC3, 0xC3, 0xC3, 0xB4, 0xC3, 0xA3, 0x92, 0x92, 0x02, 0x59, 0x6A,
+0x5B, 0x6B, 0x4B, 0x5B, 0x4B, 0x4B, 0x3B, 0x4B, 0x4B, 0x3B, 0x4B, 0x3B,
+0x4B, 0x3C, 0x3B, 0x3B, 0x2C, 0x3B, 0x3C, 0x2B, 0x2B, 0x3B, 0x2B, 0x2B,
+0x2C, 0x3B, 0x2C, 0x2B, 0x2C, 0x3B, 0x2C, 0x1A, 0x89, 0xA1, 0xB4, 0xB6,
+0xB5, 0xB4, 0xB4, 0xA4, 0xB3, 0xB4, 0xB3, 0xB3, 0xB3, 0xA3, 0xA2, 0xA2,
+0xC3, 0xD3, 0xC4, 0xC4, 0xC3, 0xC4, 0xB3, 0xB3, 0xB4, 0xA3, 0x92, 0x82,
+0x20, 0x5A, 0x5B, 0x5B, 0x4B, 0x4B, 0x3B, 0x2A, 0x2A, 0x19, 0x88, 0xA2,
+0xC5, 0xB4, 0xB5, 0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xA2, 0xA2, 0x91, 0x80,
+0x90, 0x90, 0xA1, 0xB2, 0xB5, 0xD3, 0xA4, 0xA2, 0x10, 0x5A, 0x4D, 0x4C,
+0x3C, 0x4B, 0x3B, 0x3B, 0x2B, 0x0A, 0x98, 0xB0, 0xD2, 0xD2, 0xC2, 0xC2,
+0xB1, 0xC2, 0xB1, 0xA0, 0x98, 0x0A, 0x1B, 0x0C, 0x0A, 0x89, 0xA0, 0xC4,
+0xB5, 0xB5, 0xB4, 0xA4, 0xB3, 0xB5, 0xB4, 0xB4, 0xB4, 0xB3, 0xC4, 0xB3,
+0xB4, 0xC3, 0xB4, 0xC4, 0xB3, 0xB4, 0xB4, 0xB3, 0xB3, 0xB3, 0xA3, 0x92,
+0x01, 0x18, 0x49, 0x5B, 0x4B, 0x4A, 0x3A, 0x4A, 0x4A, 0x5B, 0x4B, 0x3A,
+0x4C, 0x4B, 0x3B, 0x3B, 0x3C, 0x2C, 0x3B, 0x2C, 0x2B, 0x2B, 0x2B, 0x2B,
+0x1B, 0x1A, 0x1A, 0x3D, 0x3D, 0x3D, 0x4B, 0x4C, 0x4B, 0x3B, 0x4B, 0x3A,
+0x4B, 0x2A, 0x29, 0x19, 0x08, 0x08, 0x80, 0x08, 0x3A, 0x4D, 0x3D, 0x4C,
+0x3B, 0x4B, 0x3B, 0x3B, 0x19, 0x08, 0x91, 0x92, 0xB4, 0xA5, 0x82, 0x20,
+0x5A, 0x6C, 0x4B, 0x4B, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x09, 0x80, 0xC3,
+0xB6, 0xB5, 0xB5, 0xB4, 0xB4, 0xC3, 0xB4, 0xB3, 0xC3, 0xC3, 0xB3, 0xC3,
+0xC3, 0xB3, 0xC3, 0xB3, 0xB3, 0xA3, 0xB3, 0x82, 0x00, 0x39, 0x6C, 0x4C,
+0x3B, 0x3C, 0x4B, 0x2C, 0x2A, 0x1A, 0x88, 0xA0, 0xE3, 0xC3, 0xD3, 0xB3,
+0xB2, 0xB2, 0xB2, 0xA1, 0x90, 0x89, 0x1B, 0x0C, 0x0B, 0x8A, 0xC8, 0xE3,
+0xC4, 0xC4, 0xB3, 0xB4, 0xA4, 0xB3, 0xA4, 0x82, 0x81, 0x01, 0x18, 0x28,
+0x2A, 0x09, 0xB8, 0xF2, 0xF3, 0xD3, 0xC3, 0xB3, 0xC3, 0xB3, 0xB3, 0xA3,
+0x92, 0x10, 0x48, 0x6A, 0x5A, 0x3A, 0x5A, 0x4A, 0x4A, 0x3A, 0x5B, 0x3A,
+0x4B, 0x3B, 0x4C, 0x3B, 0x2C, 0x3B, 0x2C, 0x1A, 0x0A, 0x89, 0x88, 0x88,
+0xA0, 0xA1, 0xA1, 0xC2, 0xA0, 0xB8, 0xC8, 0xD1, 0xB1, 0xD3, 0xC4, 0xB4,
+0xB5, 0xB5, 0xB4, 0xB4, 0xA4, 0xB3, 0xA3, 0x92, 0x00, 0x3A, 0x3D, 0x4D,
+0x3B, 0x3C, 0x2B, 0x2B, 0x0A, 0x90, 0xA1, 0xB4, 0xB3, 0xA5, 0xA3, 0x12,
+0x59, 0x7B, 0x5B, 0x5B, 0x4C, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x1A,
+0x08, 0x80, 0x80, 0x91, 0x92, 0xA2, 0xB3, 0xC3, 0xB3, 0xD3, 0xC3, 0xB2,
+0xD3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xB3, 0xB4, 0xA3, 0xA3, 0x82, 0x18,
+0x39, 0x4C, 0x2A, 0x2A, 0x98, 0xE3, 0xC6, 0xB4, 0xC3, 0xB3, 0xC3, 0xC3,
+0xB2, 0xB2, 0xD2, 0xB2, 0xB1, 0xB1, 0xB1, 0xB0, 0xD2, 0xC1, 0xC3, 0xD3,
+0xB3, 0xC3, 0xB4, 0xB3, 0xB4, 0xA4, 0xA2, 0xA3, 0x92, 0x81, 0x08, 0x80,
+0x91, 0xC4, 0xB5, 0xC3, 0xC4, 0xB3, 0xA2, 0x80, 0x2A, 0x4D, 0x3C, 0x3C,
+0x4B, 0x4B, 0x4B, 0x2A, 0x4A, 0x2A, 0x39, 0x29, 0x38, 0x48, 0x69, 0x5A,
+0x5B, 0x4B, 0x4B, 0x3C, 0x3B, 0x3C, 0x2B, 0x2B, 0x09, 0x88, 0xB0, 0xC4,
+0xD3, 0xC3, 0xC3, 0xB3, 0xC3, 0xC3, 0xB3, 0xB3, 0xC3, 0xB3, 0xB3, 0xB4,
+0xB3, 0xB4, 0xB4, 0xB4, 0xB4, 0xA3, 0xB3, 0xB3, 0x82, 0x08, 0x5B, 0x4E,
+0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x2A, 0x3A, 0x4B, 0x4B, 0x5C, 0x4C,
+0x4C, 0x3B, 0x4C, 0x4C, 0x3B, 0x4C, 0x3B, 0x3B, 0x4B, 0x3B, 0x3B, 0x4B,
+0x3B, 0x2A, 0x4B, 0x2A, 0x2A, 0x1A, 0x19, 0x19, 0x09, 0x88, 0xA1, 0xE3,
+0xC4, 0xC4, 0xB4, 0xC3, 0xB4, 0xC3, 0xB3, 0xB4, 0xA3, 0xA2, 0xA2, 0xB3,
+0xB3, 0xB4, 0xB4, 0xC3, 0xC4, 0xB4, 0xC3, 0xC4, 0xB3, 0xC4, 0xB3, 0xB3,
+0xC3, 0xB3, 0xC3, 0xB2, 0xB3, 0xB2, 0xB2, 0xB2, 0xC2, 0xB2, 0xD3, 0xB3,
+0xD3, 0xB4, 0xC3, 0xB3, 0xB4, 0xA3, 0xB3, 0xA3, 0x93, 0x01, 0x10, 0x20,
+0x39, 0x59, 0x4B, 0x4B, 0x2D, 0x3B, 0x2D, 0x2C, 0x3C, 0x3D, 0x3C, 0x3C,
+0x4C, 0x3C, 0x3B, 0x4B, 0x3B, 0x3A, 0x3A, 0x3A, 0x3A, 0x59, 0x5B, 0x4A,
+0x4B, 0x4B, 0x4C, 0x3B, 0x3B, 0x3C, 0x3B, 0x3B, 0x2C, 0x1A, 0x1A, 0x0A,
+0x09, 0x09, 0x99, 0xA0, 0xA8, 0xC1, 0xB1, 0xE3, 0xD3, 0xC4, 0xB4, 0xC4,
+0xB4, 0xB4, 0xC3, 0xB4, 0xB3, 0xA4, 0xA2, 0xA2, 0xA2, 0x92, 0x91, 0x80,
+0x08, 0x09, 0x1A, 0x8A, 0xA8, 0xF2, 0xD3, 0xC4, 0xB4, 0xA3, 0xB3, 0xA3,
+0x82, 0x28, 0x5B, 0x4D, 0x4B, 0x4C, 0x4B, 0x4B, 0x4B, 0x2A, 0x3A, 0x3A,
+0x4B, 0x2A, 0x4A, 0x2A, 0x3A, 0x4B, 0x2A, 0x2A, 0x19, 0x09, 0xB2, 0xE3,
+0xD4, 0xC4, 0xC3, 0xC3, 0xB3, 0xC3, 0xB3, 0xA2, 0x92, 0x91, 0x01, 0x18,
+0x18, 0x18, 0x08, 0xA1, 0xC4, 0xC4, 0xB5, 0xB3, 0xB4, 0xB3, 0xB4, 0xB2,
+0xB3, 0xA1, 0x98, 0x99, 0x0F, 0x0B, 0x1D, 0x8A, 0x0A, 0xC0, 0xA1, 0xF3,
+0xA2, 0xC2, 0xC3, 0xB2, 0xB2, 0xA1, 0xA1, 0x00, 0x00, 0x59, 0x39, 0x20,
+0x91, 0xA7, 0xB4, 0xB6, 0xC3, 0xC3, 0xA2, 0x80, 0x5B, 0x2E, 0x4C, 0x3C,
+0x3C, 0x2C, 0x2A, 0x2A, 0x2A, 0x2A, 0x08, 0x01, 0x93, 0x95, 0x84, 0x01,
+0x30, 0x4A, 0x6B, 0x4B, 0x3B, 0x3B, 0x3B, 0x3B, 0x1B, 0xA8, 0xB2, 0xF3,
+0xC3, 0xC3, 0xC2, 0xA2, 0xA1, 0xB3, 0xD3, 0xB3, 0xB6, 0xC5, 0xC3, 0xB4,
+0xB4, 0xB3, 0xC4, 0xB3, 0xB4, 0xA3, 0xA2, 0x81, 0x80, 0x39, 0x3D, 0x4C,
+0x3C, 0x3C, 0x2C, 0x2A, 0x2A, 0x2A, 0x1A, 0x19, 0x08, 0x39, 0x1A, 0x4A,
+0x3C, 0x4E, 0x4C, 0x3C, 0x3C, 0x4B, 0x4B, 0x3B, 0x3C, 0x3A, 0x3B, 0x4B,
+0x2A, 0x3A, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3B, 0x2A, 0xA0, 0xC4,
+0xC5, 0xC4, 0xC3, 0xB3, 0xC4, 0xB3, 0xB3, 0xB3, 0xB3, 0xA4, 0xA2, 0x92,
+0x81, 0x80, 0x80, 0x90, 0xB2, 0xC5, 0xB4, 0xB5, 0xB4, 0xB3, 0xB3, 0xC4,
+0xB2, 0xC3, 0xC2, 0xD3, 0xB2, 0xD3, 0xB2, 0xD3, 0xC3, 0xB3, 0xC3, 0xC3,
+0xB3, 0xB3, 0xA2, 0xA2, 0x81, 0x18, 0x2A, 0x4A, 0x4B, 0x4B, 0x3A, 0x3A,
+0x39, 0x08, 0x81, 0x94, 0xB1, 0x03, 0x2B, 0x4F, 0x3F, 0x3E, 0x3C, 0x3D,
+0x3C, 0x3C, 0x3B, 0x4B, 0x3B, 0x3B, 0x2A, 0x29, 0x18, 0x28, 0x80, 0x11,
+0x48, 0x4A, 0x5B, 0x5B, 0x4B, 0x2A, 0x2A, 0x19, 0x88, 0xB2, 0xF3, 0xC3,
+0xC2, 0xC3, 0xB2, 0xB2, 0x90, 0xB1, 0x90, 0xA8, 0xC1, 0xD3, 0xD5, 0xC3,
+0xC5, 0xC3, 0xB4, 0xB3, 0xB3, 0xB4, 0xA3, 0x92, 0x91, 0x00, 0x29, 0x4B,
+0x3C, 0x3D, 0x3B, 0x3D, 0x3B, 0x3C, 0x3B, 0x1A, 0x19, 0x29, 0x09, 0x18,
+0x18, 0x2A, 0x3A, 0x3C, 0x4C, 0x3C, 0x3B, 0x4B, 0x6B, 0x3A, 0x7B, 0x19,
+0x28, 0x39, 0x4A, 0x5A, 0x5B, 0x4B, 0x4A, 0x3B, 0x4B, 0x2A, 0x3A, 0x1A,
+0xA0, 0xE3, 0xC4, 0xC3, 0xC3, 0xC3, 0xA2, 0xA2, 0x91, 0x00, 0x19, 0x19,
+0x3A, 0x1B, 0x39, 0x2C, 0x08, 0x10, 0x02, 0x41, 0x21, 0x68, 0x49, 0x4D,
+0x4C, 0x2D, 0x3B, 0x2C, 0x2B, 0x1B, 0x8A, 0xC1, 0xC3, 0xE4, 0xA2, 0xD3,
+0xA2, 0xA2, 0xA2, 0x91, 0x80, 0x80, 0x00, 0x09, 0x90, 0x00, 0xC1, 0xA7,
+0xC4, 0xB5, 0xB4, 0xB4, 0xB4, 0xB4, 0xB3, 0xA3, 0x00, 0x29, 0x3D, 0x3D,
+0x3D, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3A, 0x3A, 0x3A, 0x49, 0x39,
+0x29, 0x39, 0x6A, 0x3A, 0x4A, 0x2B, 0x39, 0x9A, 0xB3, 0xF6, 0xB3, 0xC5,
+0xC3, 0xB3, 0xB3, 0xC3, 0xA2, 0x91, 0x90, 0xA0, 0xC2, 0xC4, 0xD3, 0xB4,
+0xC4, 0xC3, 0xB4, 0xB3, 0xB4, 0xA2, 0xB3, 0x92, 0x81, 0x00, 0x29, 0x5B,
+0x4C, 0x3C, 0x3C, 0x4C, 0x3B, 0x3C, 0x3B, 0x4B, 0x3C, 0x4B, 0x3B, 0x3C,
+0x4B, 0x3B, 0x3B, 0x3B, 0x2C, 0x19, 0x19, 0x19, 0x19, 0x29, 0x3A, 0x4B,
+0x5B, 0x4B, 0x5B, 0x3B, 0x5B, 0x4B, 0x3B, 0x3B, 0x3B, 0x1A, 0xA0, 0xD5,
+0xB4, 0xC5, 0xC4, 0xB3, 0xB4, 0xC3, 0xB3, 0xC3, 0xB3, 0xA2, 0x92, 0x80,
+0x80, 0x08, 0x29, 0x19, 0x08, 0x90, 0xA3, 0xA7, 0x93, 0x94, 0x11, 0x28,
+0x5C, 0x2B, 0x3B, 0x1D, 0x8A, 0xB0, 0xF3, 0xC3, 0xE3, 0xC3, 0xC3, 0xB3,
+0xC3, 0xB3, 0xB3, 0xB4, 0xA3, 0xA2, 0x93, 0xA1, 0x94, 0xC2, 0xB5, 0xC3,
+0xB4, 0xB4, 0xB3, 0xB4, 0xC3, 0xA3, 0xA2, 0x81, 0x39, 0x3E, 0x4C, 0x3D,
+0x3C, 0x3C, 0x3C, 0x3B, 0x3C, 0x4B, 0x3B, 0x3C, 0x3B, 0x4B, 0x4B, 0x3B,
+0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3B, 0x3A, 0x2B, 0x1A, 0x19, 0xC0,
+0xA3, 0xB1, 0x91, 0xB0, 0xB2, 0xAB, 0xC3, 0xBB, 0xD5, 0xD1, 0xC4, 0xE3,
+0xC4, 0xB4, 0xC4, 0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xA3, 0xA2, 0x82, 0x00,
+0x29, 0x2A, 0x3A, 0x3C, 0x2B, 0x5C, 0x1A, 0x39, 0x1A, 0x39, 0x49, 0x3B,
+0x3B, 0x3B, 0x9A, 0x99, 0xD3, 0xF1, 0xD3, 0xC2, 0xC3, 0xB3, 0xB3, 0xA3,
+0x93, 0x93, 0x30, 0x49, 0x7A, 0x5B, 0x3A, 0x5B, 0x3A, 0x29, 0x89, 0xB2,
+0xF3, 0xC4, 0xD3, 0xC3, 0xB3, 0xB3, 0xB3, 0xC3, 0x91, 0x91, 0x08, 0x29,
+0x4C, 0x4C, 0x3B, 0x4C, 0x4B, 0x4B, 0x3A, 0x4C, 0x3B, 0x5B, 0x3B, 0x4B,
+0x3B, 0x4C, 0x3B, 0x3B, 0x3B, 0x3C, 0x2B, 0x1A, 0x09, 0x0A, 0x98, 0x09,
+0x00, 0x9A, 0x11, 0x1D, 0x88, 0x0A, 0xA1, 0xF2, 0xD2, 0xD3, 0xC5, 0xB3,
+0xC5, 0xB4, 0xB4, 0xB3, 0xB4, 0xB3, 0xB3, 0xA3, 0xA2, 0x81, 0x88, 0x29,
+0x3C, 0x3F, 0x2C, 0x3B, 0x3B, 0x3D, 0x3B, 0x2A, 0x3A, 0x19, 0x28, 0x28,
+0x39, 0x3A, 0x5B, 0x2B, 0x5B, 0x2C, 0x4A, 0x2D, 0x28, 0x1B, 0x10, 0x1A,
+0x81, 0x90, 0xA7, 0x83, 0xB2, 0x95, 0x80, 0x82, 0xC9, 0xC4, 0xF3, 0xD3,
+0xB2, 0xD5, 0xC3, 0xB3, 0xC3, 0xB4, 0xC3, 0xA3, 0xB3, 0xA3, 0xB3, 0x92,
+0x81, 0x80, 0x28, 0x3B, 0x3C, 0x5B, 0x3D, 0x5B, 0x4C, 0x3C, 0x4B, 0x2B,
+0x3A, 0x3C, 0x2A, 0x1A, 0x29, 0x0A, 0x18, 0x99, 0x81, 0x98, 0xB3, 0xA1,
+0x03, 0x2D, 0x59, 0x2D, 0x5C, 0x3B, 0x3C, 0x5B, 0x1A, 0x29, 0x09, 0x80,
+0xB2, 0xB5, 0xD4, 0xB4, 0xC3, 0xB4, 0xB3, 0xC3, 0xA2, 0x91, 0x18, 0x0A,
+0x4D, 0x3B, 0x3D, 0x3A, 0x3C, 0x3A, 0x4A, 0x3B, 0x49, 0x3A, 0x5A, 0x2A,
+0x4A, 0x2A, 0x4B, 0x3C, 0x3C, 0x2B, 0x2C, 0x0A, 0x09, 0x98, 0xA1, 0xE4,
+0xC3, 0xB3, 0xB4, 0xB3, 0xA5, 0xA2, 0xB3, 0xC4, 0xB4, 0xC4, 0xB3, 0xC4,
+0xC3, 0xB3, 0xB3, 0xC4, 0xB3, 0xB3, 0xA4, 0xB2, 0xA3, 0x91, 0x18, 0x3B,
+0x4C, 0x3D, 0x3B, 0x3D, 0x3C, 0x3C, 0x4B, 0x3C, 0x3B, 0x3C, 0x3A, 0x3D,
+0x4A, 0x3C, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x2A, 0x2B, 0x29, 0x1B,
+0x3A, 0x19, 0x1B, 0x01, 0x0C, 0x11, 0x9A, 0x11, 0xA9, 0x91, 0xF1, 0xE3,
+0xD4, 0xC3, 0xC4, 0xB3, 0xC4, 0xB3, 0xB4, 0xB3, 0xB3, 0xB3, 0xB4, 0xB2,
+0xB3, 0xB4, 0xA2, 0xA3, 0x91, 0xA1, 0x03, 0x90, 0x11, 0x82, 0x1A, 0x13,
+0x5B, 0x3A, 0x4C, 0x2B, 0x1B, 0x08, 0x1D, 0x90, 0xBA, 0xC5, 0xA4, 0xB1,
+0x04, 0x90, 0x31, 0x2D, 0x7B, 0x5B, 0x3B, 0x5B, 0x3B, 0x5B, 0x2B, 0x2A,
+0x2B, 0x08, 0x89, 0xB4, 0xD2, 0xA4, 0x80, 0x91, 0x28, 0x3B, 0x3C, 0x4D,
+0x3C, 0x2C, 0x4B, 0x3B, 0x2C, 0x4A, 0x1A, 0x39, 0x29, 0x4B, 0x5A, 0x3D,
+0x49, 0x3C, 0x3A, 0x3C, 0x4B, 0x2B, 0x29, 0x1B, 0x00, 0x8A, 0xB3, 0xD0,
+0xC3, 0xC1, 0xB3, 0xB1, 0xC3, 0xC3, 0xB2, 0xA3, 0xE3, 0xB4, 0xC3, 0xD4,
+0xB4, 0xC3, 0xB4, 0xC4, 0xB3, 0xB4, 0xB3, 0xB3, 0xA3, 0xB2, 0x92, 0xA1,
+0x00, 0x0A, 0x3B, 0x3E, 0x4B, 0x3D, 0x3A, 0x3C, 0x4B, 0x3A, 0x3C, 0x4A,
+0x3B, 0x4B, 0x4C, 0x3B, 0x3C, 0x3A, 0x3D, 0x2A, 0x3B, 0x3B, 0x3B, 0x3B,
+0x3A, 0x3A, 0x10, 0x2C, 0x31, 0x9A, 0xB4, 0xB3, 0xC3, 0xA2, 0xB5, 0xE1,
+0xB4, 0xA1, 0xE4, 0xB3, 0xD4, 0xA2, 0xB3, 0xC3, 0xB4, 0xB3, 0xA3, 0xB3,
+0xB3, 0xA3, 0xB3, 0xB3, 0xC3, 0xB3, 0xC5, 0x92, 0x91, 0x18, 0x00, 0x5A,
+0x3B, 0x5B, 0x3C, 0x4B, 0x3B, 0x3C, 0x3B, 0x1C, 0x90, 0xB2, 0xB3, 0xC3,
+0x92, 0xB1, 0x10, 0x92, 0x2B, 0x2B, 0x4B, 0x2C, 0x5A, 0x1B, 0x29, 0x2A,
+0x90, 0x10, 0xB3, 0xB6, 0xC5, 0xB3, 0xB3, 0xB2, 0xB3, 0x91, 0x3A, 0x3A,
+0x1F, 0x4C, 0x2D, 0x4B, 0x2B, 0x5B, 0x3B, 0x5B, 0x3B, 0x2A, 0x3A, 0x29,
+0x4A, 0x2A, 0x5A, 0x2B, 0x4B, 0x3B, 0x3C, 0x3B, 0x3C, 0x1A, 0x2B, 0xA0,
+0x18, 0x01, 0x1A, 0x92, 0x2A, 0x02, 0x11, 0x09, 0xD3, 0xC3, 0xB6, 0xC3,
+0xB5, 0xD3, 0xB4, 0xC4, 0xB3, 0xB3, 0xB4, 0xB3, 0xB3, 0xC3, 0xA3, 0xB2,
+0x81, 0x19, 0x88, 0x1B, 0x92, 0x2D, 0xB1, 0x08, 0xB9, 0x53, 0x2C, 0x7B,
+0x3B, 0x3D, 0x3A, 0x3D, 0x4A, 0x3C, 0x3A, 0x4C, 0x3B, 0x4B, 0x3B, 0x3B,
+0x3B, 0x3B, 0x2A, 0x3B, 0x3B, 0x5B, 0x2B, 0x3B, 0x1B, 0x2B, 0x1B, 0xA1,
+0x19, 0xB2, 0xD1, 0xB3, 0xD5, 0xA2, 0xB1, 0xA4, 0xB2, 0xC4, 0xC3, 0xA3,
+0xE3, 0xA3, 0xC2, 0xA3, 0xA3, 0xB2, 0xB3, 0xA7, 0x91, 0x93, 0x91, 0xB3,
+0xD3, 0xA4, 0xB2, 0x01, 0xC1, 0xB3, 0xB1, 0xD5, 0xC3, 0xD3, 0xA3, 0xD3,
+0xA4, 0xC3, 0xA2, 0xA4, 0x91, 0x92, 0xB2, 0xA3, 0xA3, 0xC4, 0xA2, 0xC4,
+0xB2, 0xB4, 0xB3, 0xB6, 0xB2, 0xB5, 0xA2, 0xB3, 0x82, 0x89, 0x38, 0x4E,
+0x3B, 0x3B, 0x3F, 0x3B, 0x3C, 0x3C, 0x5B, 0x2B, 0x4B, 0x3B, 0x4C, 0x3B,
+0x4B, 0x3B, 0x4C, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x3B, 0x4C, 0x3B, 0x2B,
+0x3A, 0x2B, 0x4B, 0x1C, 0x3A, 0x1A, 0x09, 0x1A, 0x80, 0x90, 0x09, 0xF1,
+0xB2, 0xD3, 0xC5, 0xB3, 0xC5, 0xB3, 0xB4, 0xB3, 0xC4, 0xB3, 0xB3, 0xB3,
+0xB3, 0xB2, 0xA3, 0xD2, 0xA3, 0xB1, 0xB4, 0xC3, 0xA3, 0xB3, 0xB4, 0xB4,
+0x83, 0xB1, 0x02, 0xF1, 0x81, 0x90, 0x00, 0x2A, 0x4D, 0x3B, 0x3F, 0x3A,
+0x2B, 0x3A, 0x3B, 0x59, 0x1B, 0x7A, 0x09, 0x3A, 0x4B, 0x3C, 0x3A, 0x3B,
+0x1A, 0x2B, 0x2A, 0x1D, 0x90, 0x10, 0x99, 0x11, 0x99, 0x11, 0x0A, 0x13,
+0x2B, 0x49, 0x1B, 0x3C, 0x39, 0x1B, 0x99, 0x10, 0xC3, 0x93, 0xC2, 0x10,
+0x99, 0x00, 0x19, 0xA2, 0x3B, 0xA3, 0x1B, 0xA3, 0x20, 0xF3, 0xB2, 0xB3,
+0xC4, 0xB3, 0xB3, 0xC4, 0xA2, 0xC4, 0x92, 0xB2, 0x91, 0xB3, 0xA1, 0x95,
+0xB0, 0xA7, 0xB1, 0xB5, 0xB4, 0xB2, 0xB5, 0xA1, 0xB5, 0x81, 0xA1, 0x01,
+0x89, 0x18, 0x3C, 0x4D, 0x3B, 0x3D, 0x3C, 0x4B, 0x3B, 0x4C, 0x3A, 0x2B,
+0x4A, 0x3B, 0x4B, 0x2B, 0x19, 0x19, 0x29, 0x2B, 0x3B, 0x1B, 0x39, 0x3B,
+0x2B, 0x39, 0x1D, 0x59, 0x2B, 0x5B, 0x2C, 0x39, 0x1C, 0x49, 0x1B, 0x2A,
+0x8A, 0x92, 0xC2, 0xD5, 0xB3, 0xB2, 0xC5, 0xA3, 0xB4, 0xA2, 0xA4, 0xC2,
+0xA3, 0xB2, 0xB3, 0xB4, 0x91, 0xA1, 0x92, 0x1A, 0x93, 0x2A, 0xC0, 0xA3,
+0xD3, 0x11, 0xA9, 0x43, 0x3B, 0x1B, 0x5B, 0x1A, 0x3B, 0x39, 0x1D, 0x93,
+0x1A, 0x02, 0x99, 0x11, 0x99, 0x31, 0x3B, 0x3A, 0x4C, 0x1A, 0x3B, 0x3B,
+0x1B, 0x09, 0x09, 0x00, 0x09, 0x02, 0x9B, 0x04, 0x1F, 0x01, 0x0B, 0x91,
+0x81, 0x0B, 0x13, 0x1B, 0xA1, 0x31, 0xB9, 0x33, 0x01, 0x1B, 0xA4, 0x3A,
+0xB6, 0x91, 0xC3, 0x92, 0xC2, 0x93, 0xC1, 0xA3, 0xE3, 0xB3, 0xC5, 0xB3,
+0xD3, 0xB3, 0xB3, 0xB5, 0xA3, 0xA2, 0xA3, 0x91, 0xC3, 0x92, 0xB1, 0xB5,
+0x81, 0xD2, 0xB4, 0xB3, 0xE3, 0xA3, 0xD3, 0x82, 0xB1, 0x81, 0xA0, 0x30,
+0x3A, 0x2A, 0x5C, 0x1C, 0x39, 0x3C, 0x3C, 0x3D, 0x2A, 0x4C, 0x2A, 0x3B,
+0x4B, 0x3C, 0x3B, 0x5A, 0x1B, 0x49, 0x1B, 0x4A, 0x19, 0x1A, 0x18, 0x3A,
+0x3A, 0x1B, 0x30, 0x2D, 0x29, 0x3B, 0x3B, 0x20, 0x3E, 0x98, 0x1A, 0xA2,
+0x2B, 0xB3, 0x3B, 0xE1, 0x93, 0x90, 0xB5, 0xB2, 0xB3, 0xE4, 0x93, 0xB2,
+0xA2, 0xA3, 0x29, 0xA1, 0x99, 0xB4, 0xB1, 0xA4, 0x90, 0x13, 0x0A, 0x01,
+0x10, 0x99, 0x10, 0x91, 0x1A, 0x03, 0x1C, 0xC3, 0x99, 0xA7, 0x81, 0xB1,
+0xA3, 0xC3, 0x11, 0xB2, 0x3B, 0x92, 0x1B, 0xA3, 0x5B, 0x88, 0x59, 0x1B,
+0x39, 0x4B, 0x0C, 0x82, 0x9A, 0x13, 0x0A, 0x11, 0x90, 0x90, 0x30, 0xB9,
+0x21, 0x99, 0x09, 0x01, 0x19, 0xA1, 0x31, 0xB9, 0x11, 0x19, 0x91, 0x7A,
+0x09, 0x39, 0x1B, 0x3A, 0xBB, 0x11, 0x91, 0x11, 0xB1, 0x95, 0xB8, 0x95,
+0xB1, 0xE3, 0xA4, 0xB1, 0x92, 0x82, 0x00, 0xA9, 0x20, 0x91, 0x1A, 0x02,
+0x0B, 0x93, 0xBA, 0xA7, 0xB3, 0xC3, 0xB3, 0xB4, 0xB3, 0x02, 0xD9, 0x31,
+0xA9, 0x30, 0x90, 0x3D, 0x19, 0x4B, 0x2A, 0x3C, 0x19, 0x5B, 0x1A, 0x5B,
+0x1A, 0x3A, 0x3A, 0x40, 0x4B, 0x0B, 0x18, 0xB0, 0x31, 0xA9, 0x31, 0xC9,
+0x22, 0xBB, 0x31, 0x99, 0x09, 0x11, 0x99, 0x11, 0x99, 0x11, 0xA0, 0x30,
+0xB0, 0x30, 0xB0, 0x20, 0xA1, 0x29, 0xA1, 0x20, 0x9A, 0x22, 0xBB, 0x23,
+0x9B, 0x12, 0x9A, 0x11, 0x91, 0x19, 0xA2, 0x3B, 0xB3, 0x3A, 0xA1, 0x10,
+0x09, 0x02, 0x9A, 0x31, 0x9A, 0x11, 0x19, 0xA9, 0x13, 0x0B, 0x93, 0x3B,
+0xC1, 0x32, 0x9E, 0x84, 0x1B, 0xA3, 0x3B, 0x91, 0x99, 0x10, 0x91, 0x19,
+0x29, 0xB9, 0x31, 0xB9, 0x13, 0x1B, 0xA2, 0x39, 0xB1, 0x39, 0xC1, 0x30,
+0xB9, 0x00, 0x11, 0xA9, 0x32, 0xBA, 0x31, 0xB0, 0x10, 0x02, 0x9A, 0x11,
+0x90, 0x11, 0x99, 0x11, 0x99, 0x01, 0x10, 0xA9, 0x13, 0x9B, 0x13, 0x1B,
+0xA2, 0x39, 0xB0, 0x30, 0xA0, 0x00, 0x20, 0xB0, 0x30, 0xA0, 0x10, 0x19,
+0x91, 0x00, 0x19, 0x91, 0x2A, 0xA2, 0x19, 0x91, 0x00, 0x19, 0x91, 0x10,
+0x99, 0x11, 0x1A, 0x01, 0x00, 0x91, 0x09, 0x11, 0x99, 0x11, 0xA9, 0x22,
+0xB9, 0x11, 0x19, 0xA1, 0x30, 0xA0, 0x10, 0x91, 0x19, 0x91, 0x3B, 0xA3,
+0x1B, 0x93, 0x09, 0x1A, 0x93, 0x2B, 0x91, 0x29, 0xB0, 0x20, 0x91, 0x2B,
+0x91, 0x29, 0xB1, 0x39, 0xB1, 0x3A, 0xB3, 0x2B, 0x93, 0x9B, 0x13, 0xB9,
+0x31, 0xB0, 0x30, 0x99, 0x91, 0x19, 0x91, 0x19, 0x91, 0x09, 0x11, 0x99,
+0x11, 0x1A, 0xB3, 0x4A, 0xB0, 0x30, 0xB0, 0x22, 0xAA, 0x23, 0xBB, 0x33,
+0xBB, 0x42, 0xC9, 0x31, 0xD0, 0x38, 0xA8, 0x30, 0xA9, 0x21, 0xB9, 0x31,
+0xA9, 0x21, 0xA9, 0x11, 0x09, 0x02, 0x9A, 0x11, 0x91, 0x2B, 0x93, 0x1B,
+0x93, 0x1B, 0x91, 0x10, 0x91, 0x19, 0x00, 0x91, 0x3A, 0xB1, 0x30, 0xB9,
+0x23, 0x8C, 0x03, 0x9B, 0x93, 0x1B, 0x93, 0x1A, 0x11, 0x09, 0x91, 0x10,
+0x99, 0x10, 0x01, 0x1B, 0x03, 0x0B, 0x11, 0xA3, 0x1B, 0x93, 0x1A, 0x11,
+0x99, 0x01, 0x19, 0x01, 0x99, 0x01, 0x19, 0xA1, 0x31, 0xB9, 0x31, 0xB9,
+0x20, 0x91, 0x1A, 0x02, 0x9B, 0x13, 0x1B, 0xA3, 0x2A, 0x91, 0x09, 0x21,
+0xB9, 0x30, 0xB0, 0x30, 0xB0, 0x21, 0x99, 0x90, 0x21, 0x9B, 0x03, 0x1B,
+0x11, 0xA0, 0x39, 0xA1, 0x19, 0x92, 0x1A, 0x11, 0x99, 0x01, 0x91, 0x19,
+0x91, 0x19, 0x99, 0x03, 0x1B, 0x11, 0x90, 0x3A, 0xB2, 0x3A, 0xB1, 0x31,
+0x9A, 0x01, 0x29, 0xB1, 0x39, 0xB1, 0x29, 0x09, 0x91, 0x19, 0x91, 0x19,
+0x00, 0x01, 0x99, 0x10, 0xA2, 0x3B, 0xB3, 0x3A, 0xA0, 0x11, 0x00, 0x90,
+0x11, 0x1B, 0x94, 0x3B, 0xA3, 0x19, 0x19, 0x91, 0x19, 0x19, 0xA2, 0x3B,
+0xC3, 0x59, 0xB8, 0x30, 0x99, 0x09, 0x11, 0x19, 0x99, 0x21, 0xAA, 0x21,
+0x90, 0x19, 0xA3, 0x1B, 0x93, 0x2B, 0x91, 0x19, 0x91, 0x29, 0xB9, 0x31,
+0xA9, 0x92, 0x19, 0x90, 0x92, 0x1B, 0x93, 0x1A, 0x11, 0x09, 0x91, 0x3B,
+0xB3, 0x3B, 0xA2, 0x19, 0x91, 0x19, 0x01, 0x99, 0x11, 0x99, 0x11, 0x99,
+0x91, 0x11, 0x1A, 0x93, 0x1B, 0xA2, 0x29, 0xB1, 0x31, 0xAA, 0x13, 0xAA,
+0x23, 0x99, 0x1A, 0x93, 0x1B, 0x92, 0x3A, 0xB0, 0x21, 0xA9, 0x21, 0xA9,
+0x21, 0xA9, 0x21, 0xB0, 0x39, 0xB1, 0x11, 0x91, 0x19, 0x91, 0x00, 0x19,
+0x91, 0x19, 0x01, 0x09, 0x19, 0x91, 0x09, 0x11, 0x99, 0x30, 0xB9, 0x31,
+0x9B};
@@ -1,2635 +1,882 @@
 #include "stm32f7xx_hal.h"
 
-const uint16_t audio_msg[]={
-65532,     6,     8, 65525, 65527,     5,    11, 65535,
-65523,     3,     4,     2,     7, 65530, 65522,     1,
-   20,     2, 65516,     0,    10, 65535,     0,     1,
-65527, 65531,    13,     9, 65528, 65528,     4,     6,
-65535, 65531, 65534,     1,     1,     2,     6, 65535,
-65529,     0,     0,     0,     7, 65532, 65528,     8,
-   11, 65529, 65522,     5,    10, 65533, 65531, 65534,
-    0,     6,     1, 65532, 65533,     1,     8,     0,
-65524,     0,    12,     1, 65523,     3,    14, 65529,
-65526,    10,     1, 65521,     9,    17, 65521, 65522,
-   14,    11, 65525, 65528,     9,     9, 65527, 65523,
-   14,    17, 65517, 65514,    21,    21, 65514, 65521,
-   22,     6, 65517,     3,    17, 65533, 65523, 65528,
-    3,    14,     8, 65521, 65526,    15,     7, 65527,
-65533,     2, 65533,     1,     4, 65532,     0,    10,
-65532, 65521,     9,    13, 65527, 65531,     9, 65534,
-65521,     7,    20, 65525, 65516,    15,    22, 65522,
-65517,    14,    10, 65521, 65535,    11, 65531, 65530,
-    8,     5, 65526, 65532,    10,     3, 65527, 65529,
-    8,     7, 65528, 65532,     9,     1, 65525,     3,
-   12, 65529, 65525,    11,     9, 65525, 65534,     7,
-65532, 65534,     9,     2, 65527,     3,     4, 65528,
-    1,     8, 65531, 65523,     5,    18, 65535, 65523,
-    2,     4, 65532,     5,     0, 65521,     6,    15,
-65523, 65525,    19,     7, 65516, 65533,    16,     3,
-65531, 65529, 65529,    12,    13, 65518, 65517,    24,
-   20, 65515, 65522,    13,     8, 65533,     3, 65534,
-65521,     2,    15, 65533, 65528,     5,     1, 65534,
-    5,     3, 65526, 65527,     9,     4, 65528,     3,
-    8,     0, 65531,     1,     3, 65528, 65527,    10,
-   14, 65526, 65523,    10,    17, 65526, 65521,     9,
-    8, 65528, 65530,    12,     4, 65520, 65533,    16,
-    4, 65519, 65535,    14, 65534, 65531,     1, 65535,
-65535,     7, 65532, 65523,     9,    14, 65526, 65523,
-   11,    12, 65531, 65529, 65533,     1,     6,     0,
-65529,     0,    11,     0, 65526,     1,     9,     2,
-65529, 65526,     6,    12, 65534, 65526, 65533,     6,
-    9,     2, 65522, 65525,    14,    14, 65531, 65514,
-65531, 65524,    11,   309, 65524,  1030,     8,  1755,
-65534,  2278,     1,  2223, 65535,  1482, 65531,   323,
-   11, 64567, 65521, 63269,    15, 62528, 65524, 62549,
-    8, 63294, 65533, 64588, 65533,   650,     5,  1986,
-65530,  2634,    10,  2506, 65526,  1697,     4,   276,
-    2, 64397, 65535, 63234,    48, 62577,   148, 62521,
-  215, 63188,   293, 64153,   242, 65418,   166,  1184,
-    1,  2220, 65402,  2795, 65238,  2943, 65169,  2414,
-65182,  1333, 65281, 65505, 65452, 64117,    97, 62934,
-  259, 62438,   315, 62770,   304, 63806,   177, 65293,
-   24,  1398, 65379,  2572, 65242,  2970, 65181,  2633,
-65162,  1476, 65259, 65489, 65390, 64047, 65515, 62934,
-  169, 62427,   263, 62614,   346, 63443,   360, 64603,
-  291,   417,   153,  1755, 65527,  2677, 65360,  3111,
-65219,  3009, 65153,  2239, 65197,   948, 65324, 65045,
-65508, 63627,   154, 62633,   329, 62366,   356, 62973,
-  332, 64239,   184,   345,     4,  1986, 65359,  2944,
-65227,  3174, 65144,  2497, 65176,  1144, 65265, 65030,
-65414, 63587,    36, 62564,   205, 62248,   316, 62663,
-  396, 63700,   360, 65008,   309,   934,   120,  2230,
-65505,  3034, 65324,  3300, 65187,  2926, 65143,  1913,
-65206,   446, 65339, 64459,    15, 63081,   215, 62284,
-  351, 62333,   403, 63210,   326, 64728,   175,   960,
-65514,  2488, 65324,  3283, 65193,  3193, 65124,  2265,
-65142,   662, 65294, 64494, 65414, 63078,    98, 62216,
-  220, 62122,   372, 62762,   408, 63988,   387, 65433,
-  282,  1433,   102,  2640, 65458,  3338, 65274,  3382,
-65143,  2765, 65129,  1493, 65192, 65437, 65386, 63859,
-   45, 62583,   263, 62073,   398, 62422,   404, 63618,
-  353, 65293,   141,  1576, 65485,  2909, 65277,  3444,
-65142,  3041, 65104,  1860, 65135,   156, 65295, 64004,
-65432, 62727,   123, 62053,   276, 62205,   392, 63060,
-  457, 64381,   379,   400,   273,  1880,    72,  2970,
-65396,  3484, 65237,  3302, 65091,  2428, 65116,   980,
-65209, 64866, 65412, 63330,   101, 62261,   296, 62040,
-  426, 62718,   427, 64127,   319,   394,   126,  2110,
-65444,  3228, 65250,  3476, 65125,  2799, 65085,  1404,
-65143, 65176, 65308, 63560, 65472, 62419,   155, 61989,
-  305, 62351,   432, 63394,   448, 64839,   380,   882,
-  238,  2330,    24,  3218, 65366,  3554, 65184,  3096,
-65088,  1996, 65103,   420, 65247, 64284, 65432, 62876,
-  153, 62071,   321, 62148,   453, 63113,   420, 64676,
-  299,   987,   112,  2546, 65393,  3433, 65248,  3372,
-65093,  2465, 65087,   898, 65164, 64681, 65307, 63142,
-65518, 62200,   170, 61985,   343, 62582,   447, 63801,
-  447, 65317,   381,  1392,   193,  2676,     5,  3432,
-65314,  3478, 65157,  2812, 65076,  1495, 65119, 65386,
-65267, 63753, 65482, 62499,   175, 61997,   361, 62349,
-  413, 63578,   565, 65272,  1128,  1534,  1811,  2937,
- 2388,  3514,  2444,  3216,  1869,  2048,   590,   384,
-64756, 64195, 63316, 62775, 62226, 62046, 62002, 62062,
-62679, 62888, 63981, 64235,   259,   297,  2015,  1857,
- 3047,  3001,  3186,  3561,  2403,  3349,   900,  2443,
-64571,   966, 63052, 64810, 62076, 63255, 61802, 62212,
-62393, 61996, 63553, 62659, 64954, 64086,   954,   339,
- 2267,  2064,  3085,  3234,  3344,  3564,  3031,  2943,
- 2009,  1617,   523, 65377, 64506, 63723, 63058, 62463,
-62092, 61958, 62060, 62216, 62971, 63240, 64489, 64693,
-  869,   808,  2605,  2270,  3522,  3277,  3484,  3597,
- 2535,  3143,   756,  2019, 64449,   399, 62838, 64252,
-61929, 62809, 61760, 62026, 62501, 62102, 63788, 63052,
-65326, 64652,  1383,   917,  2704,  2534,  3452,  3438,
- 3561,  3465,  3085,  2633,  1889,  1075,   279, 64898,
-64188, 63257, 62755, 62254, 61937, 61933, 62069, 62459,
-63140, 63636, 64837, 65197,  1291,  1290,  2983,  2652,
- 3794,  3452,  3624,  3522,  2443,  2835,   586,  1510,
-64121, 65358, 62571, 63722, 61661, 62448, 61640, 61957,
-62523, 62317, 63960, 63535,    68, 65220,  1745,  1488,
- 3038,  2893,  3715,  3553,  3718,  3288,  3026,  2211,
- 1665,   569, 65474, 64366, 63766, 62896, 62356, 62062,
-61686, 62019, 62010, 62748, 63285, 64104, 65146,   173,
- 1706,  1778,  3333,  2994,  4053,  3559,  3644,  3386,
- 2338,  2444,   263,   969, 63777, 64780, 62198, 63246,
-61379, 62186, 61500, 61999, 62520, 62631, 64096, 64054,
-  335,   287,  2052,  1992,  3345,  3211,  3948,  3575,
- 3834,  3044,  2939,  1761,  1410,    40, 65103, 63888,
-63324, 62565, 61984, 61978, 61493, 62159, 62062, 63112,
-63532, 64591, 65533,   691,  2114,  2218,  3627,  3268,
- 4151,  3580,  3574,  3166,  2038,  1988, 65509,   409,
-63472, 64232, 61992, 62810, 61309, 62035, 61579, 62098,
-62697, 63043, 64368, 64596,   621,   874,  2347,  2447,
- 3531,  3418,  4061,  3497,  3764,  2725,  2746,  1262,
- 1053, 65050, 64736, 63433, 62959, 62297, 61774, 61941,
-61460, 62376, 62255, 63519, 63854, 65083,   432,  1214,
- 2458,  2597,  3871,  3442,  4179,  3522,  3442,  2850,
- 1764,  1649, 65204,   130, 63200, 64134, 61803, 62970,
-61255, 62340, 61657, 62510, 62894, 63415, 64615, 64824,
-  949,   842,  2620,  2183,  3743,  3001,  4109,  3001,
- 3685,  2330,  2477,  1040,   711, 65051, 64306, 63585,
-62653, 62553, 61558, 62176, 61522, 62536, 62433, 63576,
-64243, 65041,   786,  1080,  2795,  2417,  4012,  3255,
- 4158,  3297,  3249,  2672,  1471,  1373, 64892, 65331,
-62941, 63802, 61661, 62684, 61215, 62277, 61793, 62645,
-63123, 63778, 64905, 65295,  1268,  1346,  2860,  2598,
- 3891,  3194,  4107,  3008,  3519,  2081,  2159,   667,
-  339, 64581, 63936, 63188, 62373, 62304, 61468, 62143,
-61594, 62743, 62731, 63971, 64578,    77,  1208,  1657,
- 3036,  2925,  4129,  3376,  4089,  3042,  3033,  1955,
- 1161,   425, 64575, 64367, 62701, 63107, 61509, 62412,
-61248, 62477, 61922, 63186, 63378, 64507, 65223,   475,
- 1569,  1961,  3130,  2963,  4012,  3274,  4099,  2801,
- 3340,  1659,  1852,   131, 65499, 64098, 63573, 62849,
-62103, 62216, 61370, 62314, 61731, 63175, 63001, 64596,
-64975,   691,  1535,  2238,  3338,  3203,  4338,  3388,
- 4284,  2739,  3174,  1463,  1286, 65385, 64585, 63880,
-62598, 62791, 61286, 62368, 60908, 62674, 61545, 63627,
-63075, 65046, 65057,  1060,  1642,  2394,  3393,  3193,
- 4457,  3183,  4536,  2470,  3612,  1143,  1914, 65071,
-65212, 63609, 63098, 62520, 61463, 62185, 60844, 62537,
-61328, 63648, 62915, 65168, 65097,  1307,  1872,  2661,
- 3693,  3370,  4613,  3232,  4284,  2323,  3009,   878,
-  929, 64817, 64225, 63407, 62317, 62563, 61130, 62383,
-60967, 62950, 61792, 64087, 63444,    75, 65523,  1571,
- 2033,  2786,  3712,  3274,  4544,  3015,  4437,  2029,
- 3319,   560,  1461, 64494, 64756, 63122, 62703, 62292,
-61265, 62218, 60834, 62871, 61591, 64186, 63279,   268,
-   38,  1875,  2254,  3016,  3983,  3433,  4664,  2956,
- 4191,  1840,  2747,   270,   592, 64237, 63920, 63012,
-62049, 62397, 61053, 62486, 61004, 63326, 62021, 64606,
-63754,   648,   363,  2091,  2385,  3061,  3957,  3298,
- 4635,  2726,  4326,  1543,  3047, 65469,  1067, 63939,
-64342, 62728, 62377, 62164, 61083, 62397, 60904, 63303,
-61812, 64789, 63679,   921,   435,  2382,  2623,  3287,
- 4193,  3341,  4686,  2605,  4044,  1275,  2430, 65189,
-  268, 63721, 63582, 62683, 61847, 62333, 60958, 62709,
-61102, 63744, 62237, 65188, 64101,  1229,   707,  2543,
- 2728,  3254,  4156,  3188,  4679,  2355,  4163,   956,
- 2738, 64882,   636, 63405, 63947, 62435, 62032, 62162,
-60957, 62649, 60953, 63838, 62083, 65395, 64060,  1546,
-  830,  2788,  2964,  3439,  4341,  3139,  4675,  2182,
- 3856,   658,  2122, 64599, 65452, 63252, 63247, 62456,
-61617, 62379, 60869, 63015, 61194, 64247, 62484,   241,
-64439,  1795,  1078,  2896,  3029,  3339,  4336,  3012,
- 4647,  2120,  3979,   784,  2359, 64873,   239, 63601,
-63531, 62698, 61777, 62435, 60858, 62854, 61111, 63864,
-62378, 65265, 64488,  1241,  1219,  2465,  3285,  3033,
- 4472,  2951,  4599,  2075,  3621,   762,  1763, 64736,
-65082, 63421, 62940, 62505, 61429, 62327, 60866, 62857,
-61333, 64036, 62790,    32, 64805,  1565,  1451,  2716,
- 3318,  3156,  4458,  2863,  4605,  1878,  3733,   466,
- 2002, 64535, 65342, 63335, 63180, 62624, 61527, 62562,
-60842, 63239, 61255, 64370, 62730,   325, 64874,  1749,
- 1622,  2752,  3551,  3109,  4585,  2708,  4502,  1689,
- 3373,   240,  1410, 64301, 64695, 63105, 62645, 62434,
-61247, 62493, 60874, 63255, 61531, 64578, 63097,   600,
-65225,  2041,  1914,  2958,  3744,  3119,  4654,  2538,
- 4465,  1359,  3121, 65397,  1078, 64033, 64291, 63006,
-62281, 62564, 61046, 62833, 60859, 63697, 61710, 65013,
-63440,   965,    87,  2221,  2262,  2968,  3980,  2997,
- 4711,  2334,  4401,  1106,  2991, 65188,   952, 63791,
-64202, 62816, 62289, 62412, 61105, 62767, 60989, 63756,
-61875, 65203, 63619,  1205,   273,  2479,  2501,  3098,
- 4287,  2953,  5148,  2162,  4767,   792,  3313, 64905,
-  979, 63593, 63974, 62813, 61799, 62610, 60466, 63111,
-60286, 64162, 61323,     8, 63307,  1448,   267,  2506,
- 2771,  3022,  4635,  2758,  5381,  1919,  4796,   576,
- 3107, 64666,   601, 63426, 63585, 62627, 61443, 62491,
-60301, 63080, 60345, 64222, 61549,   220, 63652,  1661,
-  646,  2731,  3055,  3095,  4802,  2701,  5395,  1661,
- 4693,   288,  2961, 64388,   471, 63286, 63476, 62709,
-61441, 62750, 60330, 63488, 60444, 64654, 61675,   564,
-63871,  1860,   846,  2749,  3317,  2950,  4950,  2480,
- 5441,  1417,  4591,    52,  2656, 64171,    92, 63101,
-63063, 62543, 61105, 62663, 60187, 63491, 60500, 64782,
-61927,   774, 64211,  2101,  1196,  2920,  3566,  2976,
- 5060,  2337,  5377,  1149,  4422, 65247,  2465, 63959,
-65465, 62996, 62990, 62710, 61121, 62975, 60283, 63937,
-60643, 65186, 62104,  1110, 64394,  2218,  1405,  2894,
- 3744,  2792,  5165,  2100,  5373,   886,  4266, 65043,
- 2159, 63731, 65061, 62872, 62590, 62551, 60793, 62963,
-60151, 63952, 60688, 65367, 62377,  1290, 64752,  2443,
- 1783,  2978,  3975,  2767,  5266,  1915,  5262,   607,
- 4079, 64765,  1914, 63570, 64915, 62864, 62519, 62771,
-60839, 63294, 60266, 64374, 60847,   192, 62547,  1516,
-64907,  2505,  1960,  2860,  4123,  2571,  5340,  1661,
- 5248,   397,  3916, 64574,  1616, 63426, 64530, 62754,
-62071, 62717, 60560, 63301, 60109, 64477, 60950,   352,
-62804,  1735, 65287,  2639,  2307,  2918,  4359,  2451,
- 5378,  1437,  5122,    85,  3695, 64311,  1393, 63297,
-64387, 62820, 62061, 62968, 60656, 63696, 60262, 64896,
-61166,   693, 62987,  1902, 65475,  2640,  2455,  2758,
- 4464,  2235,  5417,  1191,  5040, 65418,  3480, 64098,
- 1062, 63111, 63980, 62644, 61704, 62843, 60384, 63691,
-60224, 64978, 61294,   907, 63303,  2109,   314,  2825,
- 2783,  2770,  4648,  2108,  5404,   935,  4881, 65124,
- 3224, 63928,   839, 63080, 63835, 62889, 61710, 63200,
-60478, 64173, 60424, 65392, 61476,  1183, 63552,  2210,
-  477,  2712,  2973,  2578,  4748,  1866,  5421,   670,
- 4789, 64933,  2985, 63697,   517, 62937, 63430, 62720,
-61373, 63152, 60240, 64193, 60384,     7, 61657,  1385,
-63819,  2407,   866,  2822,  3250,  2541,  4914,  1665,
- 5362,   409,  4605, 64651,  2716, 63582,   287, 62988,
-63315, 62989, 61364, 63558, 60392, 64636, 60594,   387,
-61881,  1600, 64063,  2439,  1040,  2678,  3402,  2319,
- 4957,  1394,  5349,   176,  4431, 64428,  2433, 63402,
-65414, 62823, 62879, 62897, 61002, 63541, 60182, 64712,
-60610,   567, 62122,  1788, 64463,  2610,  1469,  2731,
- 3777,  2203,  5116,  1187,  5313, 65407,  4189, 64224,
- 2171, 63301, 65161, 62965, 62779, 63192, 61033, 63970,
-60338, 65149, 60839,   889, 62380,  1950, 64676,  2573,
- 1686,  2537,  3888,  1983,  5185,   894,  5259, 65216,
- 4018, 64004,  1848, 63157, 64737, 62837, 62329, 63118,
-60672, 64006, 60169, 65248, 60874,  1077, 62631,  2139,
-65044,  2686,  2066,  2559,  4152,  1823,  5271,   655,
- 5143, 64928,  3804, 63806,  1596, 63114, 64596, 63001,
-62302, 63447, 60798, 64428, 60374,   121, 61124,  1370,
-62874,  2245, 65256,  2648,  2230,  2356,  4262,  1584,
- 5292,   406,  5049, 64682,  3577, 63625,  1247, 62954,
-64184, 62920, 61896, 63419, 60503, 64511, 60254,   261,
-61226,  1567, 63160,  2420,    97,  2723,  2599,  2305,
- 4469,  1394,  5330,   129,  4884, 64436,  3338, 63457,
- 1007, 62994, 64047, 63106, 61899, 63808, 60653, 64915,
-60474,   644, 61503,  1803, 63392,  2470,   299,  2604,
- 2750,  2096,  4540,  1102,  5321, 65419,  4750, 64208,
- 3084, 63288,   643, 62889, 63645, 63065, 61517, 63843,
-60392, 65048, 60424,   835, 61634,  1976, 63706,  2604,
-  691,  2621,  3069,  1971,  4743,   881,  5284, 65129,
- 4577, 63966,  2795, 63196,   411, 62960, 63483, 63336,
-61549, 64223, 60528, 65451, 60687,  1162, 61889,  2159,
-63985,  2594,   871,  2475,  3210,  1709,  4785,   612,
- 5236, 64874,  4414, 63773,  2540, 63058,    59, 62898,
-63141, 63340, 61235, 64308, 60374,    66, 60676,  1340,
-62077,  2329, 64267,  2666,  1217,  2449,  3457,  1546,
- 4888,   367,  5142, 64600,  4193, 63586,  2250, 63009,
-65386, 63044, 63035, 63644, 61321, 64681, 60562,   361,
-60966,  1735, 62372,  4374, 64545,  5978,  1413,  5495,
- 3573,  4555,  4885,  3516,  5027,  1886,  3986, 64389,
- 1955, 61963, 65049, 61374, 62707, 61023, 61052, 60407,
-60460, 60820, 61009, 62373, 62595, 64751, 64829,   565,
- 1743,   886,  3774,  1874,  4952,  3056,  4903,  2778,
- 3732,  1598,  1677,   675, 64820,   391, 62629,   276,
-61135, 64750, 60651, 63865, 61348, 64358, 63274, 64574,
-  176, 63753,  2521, 62740,  4465, 62328,  5549, 62713,
- 5316, 62906,  3667, 62677,  1187, 63789, 64201,   656,
-61816,  2623, 60119,  4020, 59615,  5255, 60491,  6381,
-62497,  6632, 65029,  4831,  1995,  1788,  4189, 64969,
- 5538, 62635,  5363, 59954,  3971, 58051,  1684, 57876,
-64826, 59639, 62615, 62219, 61013, 64588, 60376,  2005,
-61135,  5418, 62770,  7214, 64881,  7068,  1517,  5641,
- 3339,  3767,  4403,  1643,  4234, 64203,  2888, 61120,
-  910, 59884, 64494, 59934, 62728, 60317, 61655, 61168,
-61572, 62737, 62595, 65054, 64427,  1394,   890,  1905,
- 2728,  2039,  4049,  2769,  4481,  2923,  3612,  2433,
- 1811,  1846, 65098,  1801, 63060,  2338, 61526,  2219,
-60773,  1304, 61100,   825, 62614,   435, 64774, 64693,
- 1531, 62900,  3583, 61399,  4936, 61029,  5290, 61480,
- 4308, 61924,  2210, 63080, 65232, 65526, 62874,  2619,
-60992,  4408, 60006,  5442, 60230,  5810, 61633,  5605,
-63921,  3987,   853,   943,  3083, 63604,  4795, 61479,
- 5395, 59608,  4764, 58231,  3011, 58060,   747, 59448,
-64080, 62066, 62268, 64593, 61172,  1484, 61100,  4356,
-62218,  6566, 63943,  7257,   435,  6652,  2264,  5252,
- 3580,  3751,  4050,  1642,  3388, 64390,  1820, 62186,
-65466, 61261, 63737, 60828, 62371, 60803, 61790, 61408,
-62118, 62838, 63381, 64887, 65212,   674,  1530,  1388,
- 3032,  2332,  3947,  3139,  3816,  3131,  2665,  2535,
-  694,  1740, 64105,  1362, 62283,  1015, 61129,    12,
-60859, 64627, 61709, 64286, 63562, 63719,   351, 62810,
- 2688, 61767,  4515, 61294,  5470, 61712,  5285, 62347,
- 3820, 63088,  1433, 64857, 64406,  1748, 62089,  4020,
-60516,  5727, 59932,  6681, 60609,  7097, 62384,  6421,
-64840,  4066,  1811,   920,  3895, 63497,  5194, 60926,
- 5272, 58685,  4107, 57533,  2027, 57851, 65132, 59967,
-62992, 62858, 61407,   238, 60754,  3328, 61213,  6052,
-62708,  7442, 64737,  7188,  1306,  5597,  2979,  3407,
- 3926,  1019,  3861, 63757,  2753, 61236,   924, 60005,
-64559, 59809, 63005, 60360, 62031, 61383, 62037, 62812,
-62882, 64704, 64579,   727,   996,  1435,  2775,  1936,
- 3936,  2496,  4240,  2864,  3455,  2871,  1719,  2719,
-65032,  2723, 62905,  2944, 61354,  2599, 60718,  1618,
-61055,   640, 62520, 64950, 64710, 63388,  1601, 61659,
- 3731, 60367,  5063, 60198,  5336, 60956,  4439, 62173,
- 2428, 64075, 65426,  1167, 62955,  3736, 61039,  5680,
-60081,  6542, 60179,  6424, 61494,  5471, 63561,  3268,
-  597,   168,  2709, 62721,  5486, 60324,  8571, 58688,
- 8826, 57900,  7115, 58243,  5006, 59940,  2956, 62627,
-65418, 65409, 61574,  2503, 59775,  4977, 59903,  6607,
-59833,  7072, 59871,  6370, 61087,  4837, 63405,  3099,
-  286,   960,   927, 64125,   839, 62314,  1962, 61252,
- 2742, 60910,  2020, 61062,  1047, 61734,   700, 62973,
- 1284, 64566,  1452,   267,   263,  1226, 65151,  2116,
-65410,  2859, 64557,  3159, 62499,  2976, 60461,  2525,
-59557,  2098, 59790,  1558, 60045,   572, 60605, 65040,
-63486, 64042,  1992, 62976,  5291, 61902,  7671, 60966,
- 9478, 60643, 10481, 61193,  9749, 62235,  6042, 63710,
- 1300,   315, 62964,  2683, 59280,  4987, 55800,  6501,
-53981,  7167, 54754,  6877, 58051,  5523, 62224,  2925,
-  412, 65325,  4762, 62388,  8876, 59920, 10520, 58291,
- 9602, 57742,  7013, 58588,  3950, 60835,   743, 63790,
-62303,  1229, 58792,  4040, 57756,  6144, 58386,  7058,
-59391,  6636, 60844,  5004, 62973,  2841,    24,   484,
- 1973, 63602,  2023, 61594,  1820, 60494,  2361, 60301,
- 2563, 60859,  2266, 61822,  2179, 63052,  2843, 64527,
- 4173,   184,  4564,   988,  3556,  1613,  2648,  2176,
- 1501,  2707, 64566,  3044, 61395,  3207, 58681,  3313,
-57594,  3301, 58097,  2769, 59101,  1738, 61263,   335,
-65319, 64225,  4076, 62447,  7338, 60810,  9132, 59810,
- 9635, 59850,  8937, 60861,  6273, 62618,  1601, 64955,
-62446,  2095, 58934,  4630, 56167,  6426, 54428,  7114,
-54451,  6589, 56656,  5060, 60642,  2498, 64678, 64939,
- 2713, 61963,  6434, 59614,  9265, 58243, 10082, 57914,
- 9006, 58690,  6836, 60669,  4483, 63364,  1860,   701,
-64063,  3292, 61342,  5343, 60268,  6521, 60033,  6643,
-60165,  5713, 60776,  4158, 62119,  2294, 64201,   265,
-  172, 63842,   774, 62318,  1540, 61494,  2661, 61274,
- 3180, 61558,  3113, 62227,  2779, 63245,  2755, 64449,
- 2925, 65508,  2112,   872,   697,  1776, 65102,  2493,
-63821,  3043, 61913,  3184, 59833,  3055, 58310,  2747,
-58284,  2140, 59275,  1134, 60698, 65369, 63248, 63908,
- 1602, 62703,  5465, 61755,  8557, 60854, 10340, 60655,
-10883, 61433, 10114, 62846,  7170, 64589,  2503,  1018,
-63387,  3439, 59380,  5425, 56110,  6459, 54199,  6421,
-54200,  5544, 56596,  3815, 60725,  1238, 64977, 63782,
- 3648, 61259,  7461, 59646,  9892, 58825, 10107, 58897,
- 8377, 60167,  5365, 62537,  2187, 65363, 64316,  2322,
-60926,  4230, 58810,  5559, 58288,  5969, 58885,  5109,
-60053,  3329, 61556,  1290, 63411, 64997, 65342, 63265,
-  851, 61820,  1217, 61172,  1740, 61526,  2501, 62285,
- 3084, 63124,  3611, 64005,  4054, 65056,  4887,   392,
- 5297,   837,  4583,  1081,  2988,  1547,  1066,  2205,
-64030,  2585, 61086,  2768, 58305,  2999, 56704,  3105,
-56949,  2727, 58506,  1592, 61002,    39, 64734, 64039,
- 3496, 62313,  7329, 60745,  9793, 59824, 10473, 60036,
- 9577, 61336,  7182, 63198,  3086, 65451, 63790,  2493,
-59582,  4978, 56447,  6465, 54688,  6728, 54411,  5822,
-55922,  4029, 59170,  1482, 63328, 63983,  1673, 61241,
- 5194, 59473,  7973, 58745,  9382, 58928,  9198, 60141,
- 7593, 62321,  5286, 65108,  2862,  2151,   127,  4061,
-63008,  5327, 61224,  5868, 60370,  5331, 60213,  4017,
-60490,  2285, 61442,   694, 63087, 64785, 64671, 63477,
-  235, 62579,  1311, 62384,  2469, 62658,  3380, 63016,
- 3737, 63417,  3917, 63980,  3770, 64635,  3409, 65232,
- 2492,    88,  1045,   711, 64952,  1545, 63242,  2282,
-61221,  2702, 59431,  2898, 58291,  2916, 58128,  2608,
-59095,  1598, 60869,   132, 63536, 64044,  1429, 62496,
- 4959, 61069,  7823, 60191,  9729, 60181, 10278, 61236,
- 9331, 62959,  6713, 65092,  2692,  1956, 63872,  4387,
-60011,  6215, 56838,  6938, 54987,  6563, 55006,  5182,
-56867,  3019, 60290,   202, 64371, 62899,  2906, 60633,
- 6552, 59301,  8960, 58897,  9514, 59516,  8431, 61112,
- 6103, 63581,  3027,   638, 65304,  2869, 62215,  4437,
-59960,  5242, 58997,  5142, 59013,  4086, 59793,  2495,
-61180,   750, 62773, 64789, 64310, 63462, 65444, 62538,
-  619, 62247,  1310, 62544,  2119, 63091,  2796, 63647,
- 3539, 64173,  4326, 64732,  4973, 65204,  5216,     3,
- 4631,   418,  3223,  1114,  1224,  1964, 64149,  2716,
-61175,  3292, 58648,  3666, 57119,  3705, 57043,  3058,
-58410,  1667, 61004, 65381, 64643, 63349,  3240, 61454,
- 6927, 59973,  9492, 59383, 10540, 59933,  9771, 61519,
- 7299, 63727,  3471,   828, 64471,  3461, 60307,  5690,
-57048,  6842, 55095,  6736, 54820,  5454, 56204,  3271,
-59030,   502, 62728, 63124,  1010, 60780,  4410, 59311,
- 7056, 58942,  8389, 59553,  8332, 61109,  7145, 63383,
- 5226,   375,  2887,  2572,   512,  4237, 63696,  5200,
-62074,  5268, 61087,  4377, 60727,  2900, 60840,  1186,
-61425, 65224, 62329, 63957, 63430, 63044, 64545, 62675,
-  102, 62774,  1419, 63172,  2679, 63600,  3696, 63874,
- 4474, 64168,  4831, 64435,  4714, 64684,  4045, 65253,
- 2626,   609,   745,  2152, 64048,  3525, 61635,  4268,
-59395,  4581, 57869,  4617, 57336,  3900, 58061,  2071,
-59868, 65271, 62641, 63058,   574, 61007,  4269, 59181,
- 7478, 58273,  9666, 58739, 10407, 60514,  9528, 63012,
- 7071,   168,  3359,  3440, 64638,  6396, 60669,  8074,
-57529,  8066, 55608,  6771, 55409,  4520, 56822,  1614,
-59741, 63751, 63530, 60651,  1862, 58779,  5307, 58082,
- 7733, 58307,  8722, 59434,  8239, 61603,  6499, 64342,
- 3930,  1437,  1063,  3327, 63869,  4801, 61627,  5670,
-60298,  5516, 59843,  4396, 60149,  2898, 60986,  1421,
-62065,   162, 63147, 64360, 64184, 63202, 64977, 62716,
-  296, 62680,  1280, 62654,  2405, 62563,  3572, 62799,
- 4660, 63118,  5426, 63910,  5773, 64746,  5290,   276,
- 3889,  2243,  1710,  3485, 64465,  4580, 61451,  4883,
-58786,  4695, 57022,  4251, 56665,  2445, 57806,   305,
-60303, 63356, 63845, 61194,  2293, 59625,  6173, 58305,
- 9073, 58556, 10539, 59788, 10174, 62067,  8018, 64946,
- 4546,  2159,   240,  5380, 61576,  7419, 58116,  8164,
-55849,  7583, 55226,  5555, 56164,  3281, 58502,    80,
-61818, 62549, 65465, 60223,  3234, 58807,  5921, 58855,
- 7364, 59305,  7777, 61039,  6956, 63419,  5570,   354,
- 4064,  2734,  2039,  4079,    24,  5261, 63860,  5400,
-62784,  4525, 61962,  3335, 61216,  1515, 61131,   344,
-61393, 64542, 61815, 63381, 62304, 62847, 63195, 62444,
-64708, 62740,  1034, 62559,  2778, 62555,  4315, 62931,
- 5679, 63221,  6505, 64218,  6203, 65079,  4912,  1113,
- 2799,  2886,   148,  4022, 62680,  5081, 59450,  5144,
-57076,  4936, 56049,  3883, 56335,  1675, 57921, 64928,
-60566, 62249, 64312, 60337,  2923, 58897,  6627, 58300,
- 9274, 59376, 10555, 61137, 10438, 64044,  8466,  1486,
- 5095,  4388,  1054,  7019, 62661,  7883, 59399,  7717,
-56967,  5920, 55871,  3331, 56647,   548, 58742, 62795,
-61752, 60493, 65065, 58850,  2739, 58571,  5529, 59324,
- 7068, 60547,  7371, 62900,  6535, 65115,  5137,  1823,
- 3168,  3513,   813,  4313, 64270,  4962, 62590,  4357,
-61667,  3531, 61090,  2318, 60771,   988, 61004,   248,
-61438, 64603, 62015, 63990, 62639, 63469, 63545, 63146,
-65043, 63112,  1292, 62574,  3127, 62683,  4809, 62851,
- 6300, 63475,  7274, 64715,  7121,   408,  5910,  2354,
- 3633,  3748,   688,  4750, 62868,  5286, 59406,  4732,
-56949,  3978, 55904,  1985, 56416, 65129, 58411, 62701,
-61537, 60359,   119, 59102,  4393, 58313,  7954, 58910,
-10131, 60621, 10612, 62965,  9480,   633,  6580,  3387,
- 2593,  6052, 63850,  7608, 60070,  7628, 57361,  6724,
-55815,  4280, 55815,  1761, 57406, 64387, 60100, 61699,
-63352, 60059,   878, 59046,  3664, 59529,  5861, 60496,
- 6933, 62254,  6793, 64588,  5658,   980,  4181,  3040,
- 2354,  4049,   445,  4576, 64343,  4524, 63127,  3506,
-62482,  2612, 62043,  1145, 61687,    93, 61687, 64780,
-61762, 63777, 62098, 63482, 62592, 62976, 63647, 62892,
-65484, 62705,  2146, 62364,  4188, 62677,  5798, 62902,
- 6907, 64015,  7206, 65375,  6267,  1403,  4280,  3339,
- 1376,  4444, 63647,  5455, 60438,  5504, 57557,  4711,
-55996,  3440, 55882,   887, 57287, 64018, 59972, 61394,
-63443, 59505,  2090, 58610,  6233, 58490,  9177, 59980,
-10552, 62112, 10063, 65075,  8191,  2806,  4858,  5317,
-  914,  7436, 62531,  7739, 59369,  6980, 57420,  4979,
-56647,  2040, 57267, 64847, 59205, 61939, 61927, 59996,
-64958, 59024,  2108, 58944,  4407, 60227,  6102, 61681,
- 6681, 64006,  6245,   516,  4979,  2283,  3472,  3766,
- 1713,  4104, 65491,  4272, 63940,  3587, 62779,  2650,
-62083,  1824, 61628,   603, 61245,    82, 61221, 64807,
-61394, 64257, 61661, 63947, 62615, 63305, 63980, 63139,
-  471, 62519,  2970, 62372,  4731, 62654,  6384, 63248,
- 7092, 64852,  6976,   789,  5908,  2683,  3411,  4289,
-  624,  5144, 62815,  5737, 59790,  4898, 57579,  3679,
-56229,  1469, 56870, 64255, 58536, 61858, 61427, 59498,
-65263, 58483,  3531, 58272,  7469, 59257,  9588, 61499,
-10275, 64064,  9298,  1903,  6601,  4683,  3321,  6747,
-64696,  7799, 61138,  7087, 58471,  5720, 56840,  3025,
-56923,   281, 57817, 63241, 60172, 60893, 63070, 59886,
-  231, 59431,  2917, 60200,  4590, 61703,  5929, 63383,
- 6076,    84,  5177,  1616,  4107,  3140,  2437,  3906,
- 1114,  3873, 65273,  3689, 64012,  2662, 63438,  1928,
-62691,   929, 62457, 65516, 61956, 65068, 61656, 64229,
-61860, 63965, 62039, 63421, 63099, 62894, 64618, 62636,
- 1190, 62060,  3643, 62354,  5236, 62741,  6682, 63994,
- 6998,   260,  6418,  1851,  4849,  3881,  1961,  4994,
-64484,  5772, 61141,  5681, 58449,  4383, 56820,  2754,
-56187,    11, 57598, 63005, 59765, 60648, 63160, 58834,
- 1492, 58513,  5083, 58811,  8290, 60660,  9534, 63152,
- 9377,   573,  7667,  3866,  4611,  6007,  1340,  7471,
-63129,  7339, 60316,  5942, 58443,  3833, 57660,   759,
-58386, 63783, 59705, 61417, 62136, 59933, 64752, 59648,
- 1405, 59825,  3545, 61373,  4682, 62942,  5502, 64890,
- 5255,  1158,  4287,  2302,  3252,  3442,  1745,  3488,
-  632,  3338, 64912,  2841, 63833,  1968, 63246,  1541,
-62442,   618, 62164,   224, 61581, 65284, 61387, 64667,
-61712, 64366, 62152, 63413, 63607, 62896, 65368, 62243,
- 2077, 61846,  4347, 62357,  5652, 63075,  6784, 64945,
- 6549,  1227,  5622,  3082,  3646,  4835,   664,  5540,
-63334,  5890, 60313,  4845, 58233,  3073, 57237,   790,
-57301, 63405, 59171, 61191, 61623, 59170, 65055, 58414,
- 3181, 58864,  6276, 60079,  8716, 62665,  9123, 65316,
- 8293,  2887,  6076,  5397,  2792,  6712, 65158,  7230,
-61711,  6061, 59443,  4307, 58109,  1786, 57890, 64675,
-59097, 62672, 60659, 60909, 63282, 60374,    80, 60409,
- 2152, 61238,  3950, 62784,  4675, 64231,  5103,   403,
- 4513,  1609,  3480,  2577,  2498,  3191,  1068,  2989,
-  228,  2826, 64687,  2191, 63910,  1627, 63462,  1132,
-62776,   331, 62528,    47, 61964, 64881, 61770, 64349,
-62126, 63713, 62610, 62754, 64275, 62364,   548, 61805,
- 2815, 62057,  4839, 62842,  5997, 64211,  6797,   707,
- 6180,  2427,  4817,  4201,  2435,  5344, 64757,  5685,
-61887,  5385, 59016,  3746, 57505,  1789, 57020, 64726,
-57855, 62152, 60189, 60236, 63043, 58831,  1140, 58884,
- 4644, 59799,  7290, 61713,  8950, 64461,  8551,  1692,
- 7141,  4513,  4397,  6217,  1127,  6855, 63639,  6403,
-60741,  4609, 59165,  2518, 58501, 65313, 58977, 63116,
-60560, 61427, 62381, 60365, 64814, 60472,  1219, 60953,
- 2831, 62345,  4100, 63941,  4376, 65365,  4449,  1301,
- 3649,  2121,  2718,  2832,  1843,  2902,   647,  2555,
-65534,  2323, 64560,  1677, 63857,  1411, 63304,   885,
-62495,   470, 62148,   173, 61544, 64954, 61539, 64373,
-62085, 63343, 63020, 62463, 65111, 61944,  1552, 61593,
- 3822, 62281,  5578, 63459,  6388, 65339,  6707,  1949,
- 5560,  3632,  3755,  5260,  1074,  5787, 63385,  5615,
-60809,  4372, 58422,  2177, 57577, 65341, 57759, 62552,
-59111, 60418, 61881, 58998, 64728, 58542,  2834, 59542,
- 5851, 61123,  7855, 63756,  8740,  1076,  7626,  3747,
- 5769,  5924,  2770,  6603, 65049,  6484, 62357,  5079,
-59837,  2968, 58867,   699, 58654, 63782, 59562, 62227,
-61449, 61042, 63306, 60752,   190, 61273,  1850, 62068,
- 3261, 63654,  4307, 64856,  4213,   623,  4122,  1661,
- 3116,  2201,  2207,  2686,  1367,  2456,   209,  2294,
-65289,  2020, 64345,  1499, 63857,  1323, 63342,   643,
-62565,   310, 62310, 65204, 61716, 64313, 61905, 63555,
-62571, 62407, 63723, 61867,   474, 61529,  2355, 61802,
- 4551, 63082,  5961, 64663,  6428,  1343,  6381,  3253,
- 4678,  4810,  2580,  5993, 65174,  5738, 61982,  5018,
-59697,  2956, 57712,   529, 57522, 63493, 58258, 60907,
-60179, 59444, 63267, 58608,   704, 59170,  4312, 60739,
- 6816, 62857,  8174,   334,  8268,  2954,  6499,  5255,
- 4279,  6509,  1076,  6400, 63660,  5632, 61344,  3521,
-59486,  1322, 59251, 64520, 59549, 62508, 60926, 61437,
-62890, 60699, 64631, 61106,  1182, 61884,  2332, 63122,
- 3416, 64662,  3974,   119,  3636,  1336,  3424,  1938,
- 2406,  2274,  1766,  2444,  1002,  2108,    74,  2193,
-65180,  1773, 64246,  1539, 63693,  1243, 63045,   626,
-62202,   237, 61953, 64730, 61499, 63799, 62010, 62767,
-62989, 61716, 64580, 61513,  1493, 61403,  3315, 62499,
- 5282, 64176,  6204,   619,  6226,  2927,  5609,  4465,
- 3438,  5880,  1168,  6095, 63708,  5276, 60954,  3767,
-59188,  1118, 57930, 64198, 58424, 61567, 59679, 59621,
-61949, 58886, 65035, 58829,  2326, 60360,  5425, 62320,
- 7103, 64960,  7724,  2365,  7084,  4424,  4947,  6172,
- 2613,  6234, 65101,  5640, 62602,  4077, 60758,  1727,
-59503, 65315, 59717, 63122, 60313, 61932, 61848, 61250,
-63738, 61134, 65319, 62036,  1585, 62841,  2455, 64292,
- 3404, 65373,  3665,   643,  3242,  1649,  2946,  1763,
- 1970,  2191,  1458,  2050,   756,  1976, 65523,  2082,
-65127,  1612, 64174,  1615, 63665,  1051, 62873,   477,
-62101, 65355, 61911, 64037, 61655, 63191, 62449, 61975,
-63671, 61406, 65515, 61485,  2398, 61901,  4012, 63747,
- 5651, 65423,  6105,  2135,  5752,  4069,  4704,  5269,
- 2275,  6149, 65486,  5433, 62514,  4190, 60159,  2003,
-58778, 64817, 58057, 62550, 59079, 60199, 60679, 59251,
-63262, 59056,   813, 59901,  3550, 62007,  6250, 64064,
- 7272,  1527,  7307,  3802,  6056,  5396,  3612,  6216,
- 1193,  5444, 63842,  4477, 61787,  2316, 60398,   250,
-59707, 63998, 60418, 62273, 61275, 61758, 63056, 61359,
-64805, 61909,   645, 62878,  2126, 63785,  2676, 65148,
- 3363,   220,  3271,  1116,  2721,  1631,  2382,  1694,
- 1442,  2056,  1085,  1772,   433,  2019, 65375,  1895,
-65002,  1588, 64094,  1560, 63605,   706, 62751,   195,
-62037, 64570, 61922, 63329, 61774, 62445, 62882, 61370,
-64254, 61416,   841, 61727,  3123, 63003,  4634, 65082,
- 5946,  1326,  6015,  3603,  5308,  4918,  3743,  5821,
- 1139,  5800, 64168,  4390, 61347,  2752, 59392, 65533,
-58455, 63133, 58382, 61020, 59926, 59364, 61936, 59306,
-64786, 59658,  2311, 61456,  4896, 63664,  7023,   540,
- 7340,  3295,  6769,  4798,  4872,  5846,  2235,  5600,
-65235,  4412, 62588,  2992, 60953,   631, 60006, 64585,
-59961, 62887, 61002, 61921, 62227, 61780, 64120, 61747,
-  151, 62788,  1425, 63570,  2547, 64658,  2924,   122,
- 3251,   591,  2850,  1477,  2320,  1583,  1844,  1804,
- 1091,  2006,   760,  1824,   175,  2173, 65225,  1756,
-64786,  1638, 63887,  1156, 63404,   185, 62453, 65008,
-61983, 63448, 61893, 62509, 62140, 61575, 63496, 61101,
-65140, 61693,  1897, 62494,  3940, 64630,  5259,  1046,
- 6190,  3045,  5757,  4911,  4651,  5599,  2597,  5965,
-65352,  4847, 62814,  3002, 60185,   824, 58777, 63490,
-58295, 61551, 58902, 59705, 60931, 59145, 63240, 59710,
-  783, 60846,  3682, 63270,  5978, 65507,  7427,  2621,
- 7086,  4654,  5938,  5489,  3624,  5845,   837,  4674,
-63957,  3331, 61549,  1343, 60443, 64806, 59908, 63462,
-60361, 62051, 61743, 61830, 63087, 61817, 65080, 62338,
-  857, 63487,  1986, 64190,  2845, 65349,  2954,   384,
- 3115,  1003,  2496,  1666,  1973,  1592,  1513,  2054,
-  783,  1967,   570,  2120, 65480,  2192, 65050,  1694,
-64520,  1543, 63613,   535, 63079, 65138, 62153, 63969,
-61869, 62423, 61991, 61754, 62557, 60928, 64249, 61300,
-  580, 62243,  2903, 63859,  4700,   749,  5699,  2606,
- 6209,  4614,  5259,  5746,  3792,  5896,  1355,  5431,
-64060,  3420, 61642,  1359, 59387, 64197, 58553, 61747,
-58585, 60201, 59799, 59020, 62176, 59532, 64667, 60553,
- 2230, 62537,  4825, 65113,  6631,  1830,  7362,  4278,
- 6355,  5283,  4763,  5650,  2138,  5066, 65031,  3430,
-62780,  1913, 60898, 65282, 60297, 63777, 60256, 62650,
-61131, 61848, 62622, 62134, 64060, 62281,   339, 63253,
- 1372, 64138,  2268, 64824,  2863,   242,  2841,   587,
- 2814,  1289,  2131,  1568,  1706,  1706,  1242,  2199,
-  653,  2089,   441,  2450, 65292,  2149, 64882,  1704,
-64208,  1134, 63318, 65310, 62749, 64280, 61980, 62699,
-61955, 61572, 62368, 61033, 63315, 60806, 65311, 61881,
- 1667, 63323,  3789,    16,  5175,  2361,  5748,  4046,
- 5691,  5730,  4264,  5950,  2447,  5634, 65396,  4155,
-62755,  1768, 60699, 65021, 59032, 62279, 58826, 60538,
-59424, 59424, 61127, 59228, 63665, 60452,   594, 61947,
- 3479, 64455,  5572,  1300,  6733,  3453,  6745,  5114,
- 5260,  5330,  3407,  5159,   758,  3831, 63924,  2191,
-62067,   543, 60728, 64192, 60605, 63196, 60937, 62280,
-62064, 62133, 63563, 62508, 64904, 62881,   882, 63913,
- 1612, 64473,  2287, 65211,  2711,   349,  2497,   712,
- 2442,  1420,  1746,  1533,  1446,  2018,  1053,  2319,
-  489,  2375,   315,  2584, 65105,  1980, 64675,  1478,
-63919,   346, 63017, 64481, 62512, 63246, 61893, 61695,
-62120, 61101, 62783, 60805, 64038, 61402,   689, 62979,
- 2498, 64843,  4442,  1779,  5434,  3688,  5651,  5205,
- 5150,  6060,  3375,  5605,  1333,  4627, 64223,  2406,
-61767,    21, 60070, 63135, 58880, 60910, 59215, 59863,
-60284, 59344, 62332, 60145, 64996, 61728,  1891, 63671,
- 4555,   741,  6129,  2724,  6655,  4508,  6047,  5166,
- 4144,  4880,  2062,  4128, 64969,  2448, 62849,   959,
-61405, 64861, 60536, 63497, 60889, 62869, 61559, 62302,
-62901, 62653, 64445, 62972,   135, 63616,  1420, 64401,
- 1897, 64805,  2406,    32,  2580,   450,  2226,   950,
- 2054,  1485,  1396,  1688,  1170,  2309,   826,  2428,
-  351,  2591,   196,  2443, 65008,  1654, 64528,   892,
-63715, 64906, 62782, 63554, 62350, 62172, 61868, 61026,
-62356, 60871, 63239, 61054, 64842, 62464,  1569, 64372,
- 3323,   988,  4987,  3300,  5633,  4756,  5425,  5865,
- 4495,  5817,  2335,  4775,   102,  3099, 62997,   515,
-60777, 63762, 59476, 61504, 58823, 60019, 59664, 59609,
-61196, 59875, 63544, 61424,   741, 63263,  3171,    34,
- 5525,  2390,  6507,  3977,  6479,  5088,  5324,  4906,
- 3080,  4204,   865,  2920, 63814,  1169, 61997, 65328,
-60895, 63807, 60489, 63018, 61222, 62608, 62169, 62525,
-63651, 63079, 65206, 63452,   778, 64225,  1856, 64718,
- 2121, 65153,  2511,   281,  2465,   629,  1999,  1238,
- 1783,  1633,  1140,  2040,   961,  2591,   626,  2589,
-  153,  2658, 65493,  2018, 64693,  1077, 64173, 65413,
-63308, 63744, 62439, 62442, 62146, 61193, 61942, 60692,
-62747, 61003, 63972, 61952,   331, 63956,  2621,   546,
- 4238,  2824,  5579,  4660,  5793,  5670,  5117,  6061,
- 3698,  5125,  1198,  3538, 64372,  1210, 61755, 64129,
-59895, 62027, 59023, 60196, 58925, 59575, 60292, 59781,
-62237, 60910, 64794, 62918,  2082, 64987,  4327,  1850,
- 6313,  3698,  6683,  4759,  6108,  5049,  4427,  4250,
- 1935,  3220, 65152,  1592, 62746,    54, 61257, 64299,
-60561, 63174, 60605, 62828, 61670, 62635, 62848, 62938,
-64416, 63463,   353, 63899,  1260, 64579,  2162, 64903,
- 2318, 65475,  2535,   523,  2338,   930,  1841,  1618,
- 1610,  1974,  1043,  2545,   850,  2868,   481,  2742,
-65529,  2461, 65218,  1396, 64372,   212, 63751, 64207,
-62868, 62541, 62134, 61413, 62014, 60537, 62127, 60732,
-63235, 61580, 64813, 63285,  1338,   103,  3569,  2280,
- 4927,  4387,  5866,  5607,  5640,  6051,  4473,  5562,
- 2640,  3886, 65490,  1815, 63079, 64686, 60755, 62357,
-59285, 60597, 58965, 59525, 59400, 59715, 61242, 60587,
-63463, 62402,   561, 64590,  3255,  1251,  5193,  3362,
- 6595,  4506,  6437,  4962,  5300,  4500,  3396,  3349,
-  793,  2075, 64193,   414, 62102, 64691, 61020, 63611,
-60756, 62946, 61102, 62908, 62347, 62880, 63537, 63377,
-65031, 63791,   734, 64203,  1467, 64720,  2153, 64992,
- 2278,   180,  2384,   681,  2182,  1291,  1714,  1980,
- 1517,  2436,  1005,  3055,   766,  3051,   340,  2755,
-65302,  1955, 64869,   576, 63914, 64658, 63249, 62869,
-62438, 61458, 61919, 60596, 62088, 60349, 62551, 61216,
-63975, 62675,   316, 64968,  2363,  1855,  4376,  3903,
- 5360,  5545,  5851,  6072,  5137,  5860,  3545,  4521,
- 1444,  2357, 64252, 65510, 62031, 62891, 60066, 61070,
-59103, 59796, 59300, 59549, 60236, 60402, 62399, 61790,
-64743, 63959,  1765,   578,  4236,  2613,  5735,  4180,
- 6517,  4652,  5804,  4574,  4270,  3611,  2152,  2377,
-65167,  1000, 63224, 65074, 61591, 64089, 60942, 63297,
-61113, 63036, 61731, 63105, 63111, 63277, 64274, 63766,
-   83, 64042,  1063, 64435,  1564, 64809,  2127, 65225,
- 2122,   430,  2180,   921,  1943,  1706,  1555,  2349,
- 1437,  2916,   956,  3300,   699,  2999,   250,  2391,
-65118,  1142, 64601, 65106, 63580, 63452, 62905, 61738,
-62199, 60747, 61891, 60280, 62326, 60764, 63104, 62170,
-64871, 64131,  1328,  1142,  3289,  3290,  4979,  5043,
- 5561,  5970,  5583,  5903,  4366,  4974,  2408,  2994,
-   94,   629, 62986, 63726, 61009, 61552, 59513, 60314,
-59106, 59689, 59832, 60279, 61246, 61596, 63648, 63414,
-  528,    91,  2966,  1983,  5114,  3657,  6095,  4378,
- 6282,  4314,  5064,  3695,  3180,  2492,   946,  1334,
-64045,    48, 62417, 64497, 61170, 63876, 60971, 63366,
-61474, 63433, 62348, 63436, 63827, 63682, 64967, 63983,
-  607, 64097,  1403, 64481,  1722, 64810,  2208, 65401,
- 2071,   604,  2059,  1254,  1786,  2147,  1403,  2794,
- 1281,  3313,   775,  3341,   470,  2723, 65487,  1737,
-64770,   125, 64160, 63998, 63191, 62291, 62536, 60935,
-62084, 60440, 61976, 60552, 62768, 61731, 63824, 63590,
-  301,   333,  2298,  2754,  4073,  4463,  5428,  5689,
- 5589,  5885,  5176,  5113,  3549,  3594,  1357,  1191,
-64496, 64471, 61986, 62210, 60297, 60721, 59264, 60066,
-59297, 60202, 60480, 61390, 62259, 62990, 64815, 64979,
- 1704,  1453,  4019,  2961,  5799,  4036,  6267,  4063,
- 5900,  3613,  4232,  2676,  2114,  1446, 65324,   421,
-63025, 64794, 61661, 64167, 60802, 63713, 60991, 63569,
-61841, 63702, 62925, 63770, 64510, 64039,    53, 64136,
- 1137, 64291,  1716, 64646,  1956, 65041,  2270,   228,
- 2010,   958,  1904,  1742,  1590,  2672,  1244,  3156,
- 1130,  3502,   599,  3046,   323,  2136, 65276,   747,
-64532, 64469, 63860, 62806, 62862, 61240, 62327, 60428,
-61964, 60419, 62166, 61188, 63193, 62990, 64576, 65152,
- 1251,  2062,  3192,  4091,  4795,  5401,  5740,  5975,
- 5494,  5403,  4570,  4040,  2533,  1881,   104, 64938,
-63173, 62750, 60863, 60924, 59565, 60122, 59013, 60134,
-59659, 61031, 61318, 62739, 63450, 64555,   624,  1142,
- 2971,  2761,  5097,  3856,  6304,  4211,  6200,  3639,
- 5319,  2859,  3226,  1624,  1013,   504, 64206, 65049,
-62232, 64188, 61208, 63887, 60796, 63652, 61361, 63785,
-62412, 63910, 63644, 64013, 65150, 64237,   578, 64201,
- 1449, 64474,  1826, 64840,  1985, 65370,  2179,   690,
- 1862,  1386,  1731,  2375,  1432,  3111,  1148,  3469,
-  974,  3405,   425,  2482,    42,  1263, 64906, 65036,
-64060, 63178, 63342, 61638, 62383, 60399, 62045, 60332,
-61940, 60844, 62522, 62449, 63880, 64670,    54,  1446,
- 2360,  3770,  4134,  5195,  5421,  5965,  5879,  5711,
- 5166,  4411,  3759,  2487,  1412, 65461, 64413, 63183,
-62063, 61256, 60097, 60114, 59255, 60034, 59209, 60653,
-60367, 62268, 62352, 64141, 64672,   593,  1763,  2510,
- 3972,  3617,  5677,  4224,  6340,  3817,  5717,  2995,
- 4377,  1942,  2143,   687, 65408, 65288, 63299, 64416,
-61664, 63953, 61095, 63844, 61037, 63754, 61907, 63995,
-63017, 63995, 64323, 64130,    90, 64193,   886, 64180,
- 1525, 64648,  1785, 65035,  1956,   353,  2031,  1193,
- 1770,  2076,  1685,  3078,  1436,  3529,  1216,  3644,
-  947,  2981,   349,  1696, 65467,   140, 64632, 63622,
-63793, 61955, 62968, 60568, 62165, 60067, 61976, 60535,
-62106, 61751, 62974, 63983, 64557,   821,   962,  3182,
- 3132,  5021,  4673,  5848,  5571,  6021,  5578,  4898,
- 4452,  3084,  2686,   730,   164, 63715, 63281, 61845,
-61164, 60339, 59692, 60039, 59349, 60501, 59852, 61762,
-61446, 63696, 63606, 65510,   397,  1979,  2829,  3324,
- 4671,  3984,  5849,  3967,  5869,  3116,  4823,  2254,
- 3161,  1021,   902, 65533, 64408, 64742, 62592, 64064,
-61549, 63979, 61383, 63834, 61734, 63948, 62775, 64086,
-63889, 64013, 65066, 64173,   578, 64072,  1059, 64399,
- 1491, 64922,  1606,    10,  1691,  1029,  1680,  1819,
- 1455,  2866,  1465,  3531,  1282,  3599,  1125,  3294,
-  810,  2033,   236,   564, 65231, 64194, 64342, 62298,
-63459, 60980, 62652, 60070, 61995, 60394, 62062, 61380,
-62448, 63307, 63665,   285, 65434,  2509,  1927,  4651,
- 3926,  5698,  5092,  5995,  5586,  5286,  5091,  3469,
- 3611,  1344,  1577, 64292, 64562, 62186, 62355, 60701,
-60567, 59940, 59619, 60404, 59762, 61357, 60673, 63173,
-62603, 65118, 64794,  1448,  1506,  3129,  3665,  3818,
- 5049,  4067,  5727,  3437,  5171,  2455,  3797,  1447,
- 1939,   179, 65276, 64975, 63498, 64220, 62037, 63896,
-61462, 63905, 61643, 63803, 62302, 64105, 63485, 64042,
-64595, 64131,   142, 64217,   975, 64300,  1260, 64923,
- 1582, 65426,  1548,   781,  1598,  1684,  1503,  2525,
- 1318,  3375,  1333,  3520,  1154,  3317,  1017,  2379,
-  638,   828,    61, 64741, 64994, 62692, 64055, 61327,
-63218, 60287, 62451, 60211, 61991, 61150, 62262, 62721,
-62887, 65184, 64362,  1985,   705,  4069,  2687,  5580,
- 4442,  5926,  5229,  5609,  5378,  4045,  4449,  1919,
- 2681, 65087,   489, 62640, 63454, 61093, 61466, 60030,
-60025, 60148, 59525, 61101, 60103, 62559, 61408, 64679,
-63598,   957,   331,  2778,  2540,  3829,  4481,  4060,
- 5495,  3766,  5717,  2728,  4691,  1700,  3005,   487,
- 1009, 64973, 64377, 64352, 62830, 63771, 61676, 63801,
-61475, 63774, 61976, 63918, 62808, 64193, 64100, 64087,
-65113, 64348,   573, 64370,  1168, 64768,  1316, 65391,
- 1562,   425,  1456,  1452,  1522,  2176,  1392,  3037,
- 1237,  3482,  1320,  3256,  1053,  2717,   923,  1260,
-  383, 65258, 65269, 63392, 64550, 61689, 63525, 60704,
-62746, 60210, 62075, 60903, 61909, 62290, 62490, 64408,
-63447,  1416, 65300,  3440,  1747,  5219,  3671,  5876,
- 5070,  5673,  5469,  4580,  5168,  2445,  3757,   212,
- 1702, 63262, 64880, 61363, 62383, 60313, 60734, 59936,
-59622, 60832, 59650, 62128, 60672, 64061, 62275,   581,
-64717,  2247,  1324,  3726,  3480,  4029,  5083,  3880,
- 5644,  3010,  5415,  1806,  3953,   767,  2116, 65091,
-   58, 64400, 63559, 63911, 62290, 63701, 61417, 63943,
-61580, 63923, 62236, 64263, 63228, 64328, 64517, 64347,
-65445, 64571,   842, 64658,  1258, 65301,  1408,   305,
- 1672,  1087,  1567,  2031,  1669,  2649,  1513,  3363,
- 1401,  3275,  1415,  2740,  1054,  1693,   774, 65508,
-  118, 63923, 64846, 62048, 64079, 60870, 62973, 60368,
-62349, 60599, 61851, 62020, 62015, 63823, 62908,   820,
-64130,  3078,   712,  4766,  2658,  5864,  4372,  5681,
- 5453,  4907,  5380,  3000,  4718,   660,  2904, 63906,
-  623, 61684, 63769, 60555, 61410, 59977, 60108, 60478,
-59364, 61879, 59860, 63525, 61229,   176, 63157,  1922,
-  160,  3414,  2250,  4189,  4303,  3938,  5569,  3374,
- 5747,  2107,  5108,   999,  3326, 65422,  1399, 64431,
-64873, 63997, 63001, 63654, 61989, 63784, 61367, 63986,
-61799, 64061, 62566, 64388, 63592, 64306, 64861, 64500,
-   96, 64668,   972, 65030,  1209,   220,  1420,   803,
- 1681,  1738,  1613,  2518,  1778,  3063,  1602,  3447,
- 1533,  2850,  1482,  2138,   970,   523,   593, 64396,
-65217, 62695, 64333, 61090, 63446, 60512, 62370, 60416,
-61940, 61463, 61669, 63281, 62300, 65470, 63499,  2436,
-65108,  4259,  1864,  5544,  3696,  5899,  5211,  5096,
- 5755,  3725,  5249,  1350,  4081, 64643,  1881, 62452,
-65014, 60837, 62636, 60280, 60582, 60282, 59736, 61485,
-59450, 63049, 60443, 64930, 62131,  1409, 64248,  2849,
- 1220,  3874,  3105,  3976,  4887,  3386,  5602,  2537,
- 5298,  1214,  4303,   276,  2258, 64789,   433, 64200,
-64027, 63965, 62493, 63835, 61845, 64100, 61478, 64160,
-62194, 64327, 63006, 64427, 63992, 64329, 65153, 64589,
-  246, 64799,  1009, 65397,  1217,   560,  1501,  1273,
- 1884,  2274,  1852,  2804,  2054,  3308,  1851,  3097,
- 1705,  2330,  1513,  1174,   750, 64956,   193, 63339,
-64615, 61760, 63685, 60711, 62818, 60622, 61872, 61107,
-61730, 62752, 61821, 64769, 62824,  1504, 64338,  3637,
-  628,  4929,  2928,  5669,  4533,  5240,  5587,  4006,
- 5664,  2173,  4619, 65281,  3118, 63288,   611, 61448,
-63773, 60558, 61536, 60506, 59943, 61112, 59555, 62700,
-59758, 64308, 61186,   725, 63147,  2364, 65403,  3412,
- 2267,  3903,  3970,  3472,  5415,  2726,  5676,  1621,
- 4983,   460,  3619, 65149,  1469, 64309, 65195, 63988,
-63385, 63830, 62120, 63881, 61706, 64166, 61646, 64172,
-62524, 64441, 63397, 64406, 64403, 64550, 65500, 64919,
-  481, 65246,  1194,   530,  1314,  1108,  1669,  1984,
- 1921,  2653,  1880,  2999,  2052,  3094,  1759,  2440,
- 1597,  1389,  1218, 65490,   392, 63774, 65257, 62374,
-64077, 61116, 63158, 60796, 62356, 61161, 61586, 62330,
-61732, 64356, 62125,   818, 63458,  3041, 65207,  4536,
- 1640,  5333,  3879,  5331,  5143,  4226,  5840,  2609,
- 5434,   388,  3979, 63726,  2162, 61974, 64988, 60738,
-62718, 60518, 60693, 60971, 59536, 62194, 59604, 63965,
-60264,   172, 62063,  2034, 64189,  3182,   912,  3801,
- 3137,  3713,  4589,  2917,  5592,  1974,  5390,   750,
- 4323, 65306,  2679, 64571,   505, 63916, 64346, 63901,
-62725, 63811, 61847, 64113, 61692, 64282, 61941, 64375,
-63000, 64566, 63895, 64543, 64931, 64874,   314, 65258,
-  747,   232,  1293,  1056,  1416,  1623,  1720,  2450,
- 1965,  2791,  1934,  2899,  2089,  2584,  1820,  1500,
- 1560,   297,  1087, 64171,   132, 62665, 64898, 61530,
-63612, 60795, 62732, 61147, 61960, 62031, 61434, 63801,
-61852,   409, 62523,  2376, 64169,  4245,   511,  5139,
- 2561,  5319,  4538,  4575,  5479,  2939,  5769,  1044,
- 4925, 64249,  3188, 62413,  1084, 61092, 63931, 60518,
-61780, 60942, 60056, 61838, 59343, 63508, 59813, 65300,
-60859,  1506, 62973,  3039, 65180,  3649,  1928,  3864,
- 3975,  3238,  5165,  2238,  5764,  1166,  5135, 65471,
- 3732, 64729,  1898, 64021, 65260, 63728, 63634, 63769,
-62255, 63859, 61609, 64202, 61724, 64324, 62168, 64474,
-63342, 64654, 64266, 64753, 65293, 65300,   570,   131,
-  941,   869,  1428,  1577,  1536,  2157,  1819,  2766,
- 2016,  2825,  1931,  2647,  2046,  1875,  1693,   591,
- 1386, 64752,   766, 63104, 65321, 61913, 64410, 61086,
-63162, 60987, 62317, 61824, 61631, 63179, 61392, 65308,
-62041,  1812, 63075,  3635, 64964,  5005,  1523,  5281,
- 3528,  4927,  5259,  3511,  5811,  1587,  5697, 65015,
- 4357, 62828,  2346, 61403, 65500, 60499, 62887, 60589,
-60920, 61469, 59588, 62831, 59360, 64745, 60235,   950,
-61642,  2646, 63935,  3661,   621,  3864,  2756,  3630,
- 4510,  2610,  5327,  1552,  5493,   376,  4474, 64821,
- 2868, 64241,   999, 63675, 64531, 63690, 63197, 63781,
-62067, 63988, 61799, 64366, 62022, 64394, 62678, 64644,
-63732, 64791, 64602, 65118, 65456,   174,   586,   611,
-  892,  1461,  1354,  2038,  1567,  2576,  1941,  2911,
- 2165,  2607,  2159,  2115,  2206,   907,  1761, 65026,
- 1317, 63552,   454, 62049, 64882, 61307, 63839, 60935,
-62628, 61541, 61902, 62835, 61473, 64655, 61574,  1356,
-62576,  3110, 63872,  4633,   387,  5238,  2421,  4923,
- 4214,  3955,  5502,  2033,  5598,    39,  5033, 63467,
- 3371, 61792,  1195, 60893, 64365, 60626, 61946, 61310,
-60396, 62547, 59514, 64147, 59802,   483, 60984,  2008,
-62705,  3295, 65021,  3735,  1595,  3579,  3508,  2964,
- 4915,  1831,  5358,   870,  5085, 65288,  3774, 64524,
- 2042, 64013,   183, 63699, 63938, 63797, 62786, 63882,
-62012, 64098, 61934, 64336, 62412, 64383, 63152, 64711,
-64229, 64929, 64968, 65527,   222,   578,   673,  1222,
-  935,  2008,  1319,  2424,  1492,  2828,  1867,  2742,
- 2006,  2135,  2009,  1312,  1968, 65339,  1484, 64015,
-  965, 62548,    55, 61539, 64454, 61249, 63443, 61442,
-62336, 62584, 61781, 64182, 61556,   623, 61975,  2613,
-63189,  3990, 64734,  4973,  1318,  4884,  3281,  4108,
- 4835,  2677,  5693,   580,  5445, 64300,  4394, 62388,
- 2440, 61305,    61, 60849, 63291, 61100, 61085, 62261,
-59902, 63570, 59506, 65359, 60251,  1440, 61794,  2716,
-63731,  3547,   578,  3470,  2563,  3097,  4300,  2168,
- 5254,  1079,  5194,   206,  4527, 64717,  2814, 64268,
- 1077, 63846, 64700, 63767, 63192, 63969, 62348, 64010,
-61875, 64366, 62117, 64429, 62762, 64604, 63633, 64961,
-64687, 65269, 65361,   438,   472,   942,   868,  1632,
- 1127,  2269,  1563,  2514,  1740,  2750,  2112,  2238,
- 2172,  1533,  2123,   342,  1867, 64396,  1255, 63124,
-  573, 61880, 65053, 61409, 63896, 61497, 62829, 62204,
-61924, 63822, 61597, 65490, 61643,  2019, 62457,  3551,
-63890,  4572,   152,  4948,  2328,  4247,  4056,  3095,
- 5307,  1193,  5643, 64741,  4975, 63033,  3505, 61535,
- 1286, 61065, 64446, 61038, 62217, 61945, 60367, 63340,
-59608, 64837, 59652,  1105, 60861,  2404, 62643,  3358,
-64745,  3603,  1547,  3116,  3392,  2489,  4922,  1301,
- 5449,   379,  5072, 64991,  3969, 64227,  2129, 63990,
-  293, 63682, 64012, 63891, 62733, 64043, 62083, 64237,
-61873, 64577, 62325, 64580, 63070, 64965, 64054, 65304,
-65041,   240,   131,   938,   722,  1351,  1009,  2094,
- 1352,  2367,  1701,  2530,  1855,  2370,  2127,  1543,
- 2061,   685,  1946, 64746,  1537, 63460,   852, 62302,
-  106, 61521, 64491, 61599, 63384, 62055, 62361, 63364,
-61666, 65119, 61551,  1354, 61897,  3175, 63020,  4177,
-64676,  4767,  1163,  4405,  3282,  3290,  4828,  1775,
- 5759, 65236,  5664, 63553,  4598, 62051,  2783, 61182,
-  335, 61164, 63509, 61638, 61318, 63006, 59826, 64443,
-59406,   561, 59878,  2147, 61429,  3048, 63373,  3608,
-  128,  3270,  2358,  2580,  4120,  1698,  5335,   486,
- 5506, 65245,  4769, 64334,  3369, 63929,  1391, 63801,
-65085, 63711, 63359, 64087, 62290, 64190, 61795, 64566,
-61785, 64739, 62411, 64891, 63221, 65387, 64330,   159,
-65244,   827,   372,  1294,   966,  1754,  1324,  2280,
- 1759,  2286,  2070,  2291,  2200,  1676,  2366,   760,
- 2185, 65221,  1897, 63745,  1310, 62727,   453, 61806,
-65111, 61637, 63836, 62115, 62794, 63016, 61835, 64726,
-61384,   868, 61551,  2590, 62241,  3930, 63682,  4435,
-65522,  4491,  2120,  3501,  4113,  2144,  5354,   330,
- 5865, 63937,  5325, 62589,  3883, 61429,  1790, 61251,
-64775, 61595, 62477, 62588, 60544, 64149, 59481,    65,
-59488,  1720, 60375,  2799, 62201,  3374, 64322,  3420,
- 1104,  2675,  3162,  1921,  4703,   801,  5558, 65406,
- 5340, 64690,  4276, 63959,  2634, 63874,   680, 63716,
-64463, 63936, 62981, 64178, 62129, 64333, 61858, 64724,
-62035, 64821, 62747, 65246, 63615,   165, 64595,   639,
-65448,  1323,   467,  1645,  1004,  2112,  1362,  2293,
- 1830,  2137,  2147,  1875,  2291,   853,  2384, 65463,
- 2117, 64166,  1745, 62955,   982, 62221,    78, 61677,
-64537, 62139, 63316, 62888, 62280, 64287, 61561,   535,
-61350,  2041, 61876,  3592, 62855,  4244, 64598,  4333,
- 1017,  3759,  3101,  2359,  4831,   876,  5622, 64470,
- 5712, 62963,  4680, 61887,  2928, 61298,   635, 61599,
-63680, 62266, 61648, 63620, 60048, 65170, 59507,  1071,
-59898,  2479, 61193,  3083, 63175,  3397, 65293,  2940,
- 1926,  2106,  3733,  1250,  4953,   145,  5372, 64966,
- 4756, 64239,  3490, 63828,  1757, 63821, 65429, 63786,
-63844, 64094, 62646, 64258, 62056, 64533, 61996, 64861,
-62339, 65093, 63144,   126, 64021,   525, 64993,  1137,
-  157,  1614,   693,  1901,  1203,  2232,  1606,  2120,
- 2055,  1887,  2316,  1218,  2394,   156,  2392, 64687,
- 2016, 63383,  1473, 62541,   619, 61987, 65137, 62024,
-64012, 62775, 62770, 63825, 61924, 65511, 61346,  1555,
-61488,  2984, 62220,  3980, 63512,  4142, 65409,  3821,
- 1918,  2737,  3847,  1246,  5254, 65165,  5699, 63472,
- 5368, 62385,  3981, 61658,  1963, 61617, 65113, 62255,
-62719, 63228, 60877, 64740, 59677,   574, 59540,  1909,
-60365,  2813, 61939,  3100, 64134,  2992,   724,  2255,
- 2826,  1460,  4433,   530,  5301, 65211,  5345, 64618,
- 4343, 64036,  2855, 63934,  1013, 63889, 64719, 63976,
-63314, 64253, 62287, 64368, 61969, 64742, 62059, 65031,
-62576, 65478, 63469,   541, 64351,  1005, 65264,  1575,
-  367,  1856,   830,  2035,  1363,  2083,  1736,  1696,
- 2176,  1238,  2355,   228,  2383, 64789,  2278, 63724,
- 1764, 62722,  1137, 62297,   169, 62150, 64615, 62734,
-63487, 63734, 62289, 65107, 61661,  1234, 61348,  2536,
-61782,  3616, 62839,  3950, 64331,  3691,   865,  2895,
- 2851,  1497,  4589,    31,  5622, 64016,  5649, 62769,
- 4915, 62090,  3150, 61767,   959, 62265, 64096, 63097,
-61850, 64368, 60343,   258, 59509,  1487, 59840,  2611,
-60976,  3008, 62783,  2999, 65007,  2496,  1538,  1596,
- 3482,   787,  4803, 65367,  5287, 64699,  4975, 64183,
- 3716, 63840,  2109, 63885,   272, 63890, 64070, 64133,
-62900, 64363, 62070, 64581, 61926, 64983, 62204, 65328,
-62840,   400, 63809,   914, 64665,  1401,    29,  1823,
-  636,  1951,  1124,  2053,  1700,  1795,  2068,  1305,
- 2489,   572,  2545, 65029,  2456, 64100,  2172, 63060,
- 1492, 62461,   733, 62298, 65205, 62579, 63999, 63532,
-62929, 64772, 61840,   763, 61409,  2221, 61352,  3235,
-62060,  3892, 63394,  3679, 65074,  3011,  1676,  1796,
- 3605,   286,  5062, 64426,  5789, 63024,  5358, 62275,
- 4319, 61915,  2258, 62150, 65522, 62972, 63148, 64002,
-61099, 65420, 59931,  1122, 59509,  2217, 60171,  2858,
-61640,  2856, 63599,  2547,   387,  1771,  2368,   918,
- 4151,    87,  5227, 64871,  5355, 64391,  4733, 64014,
- 3199, 63935,  1507, 64024, 65217, 64128, 63615, 64433,
-62587, 64546, 61904, 64890, 61975, 65272, 62329,   202,
-63057,   817, 63990,  1237, 64837,  1725,   139,  1946,
-  707,  1981,  1232,  1890,  1880,  1393,  2293,   795,
- 2656, 65354,  2667, 64305,  2444, 63384,  2071, 62595,
- 1188, 62375,   318, 62504, 64597, 63254, 63387, 64464,
-62340,   325, 61395,  1837, 61210,  2959, 61494,  3652,
-62552,  3747, 64156,  3084,   479,  2083,  2692,   612,
- 4438, 64743,  5617, 63424,  5858, 62431,  5063, 62064,
- 3620, 62130,  1344, 62810, 64506, 63842, 62240, 65049,
-60452,   892, 59668,  1942, 59615,  2765, 60679,  2918,
-62361,  2660, 64486,  2072,  1202,  1156,  3047,   326,
- 4583, 65070,  5287, 64456,  5105, 64118,  4155, 63859,
- 2507, 63972,   802, 64055, 64607, 64261, 63222, 64498,
-62340, 64689, 61891, 65134, 62072,    28, 62545,   605,
-63291,  1185, 64279,  1556, 65069,  1977,   405,  2001,
-  978,  1953,  1635,  1594,  2279,   903,  2657,    87,
- 2921, 64522,  2776, 63582,  2429, 62796,  1834, 62353,
-  823, 62541, 65323, 63032, 63999, 64191, 62820,    26,
-61842,  1464, 61156,  2782, 61235,  3513, 61857,  3767,
-63175,  3322, 64948,  2305,  1340,  1037,  3465, 65015,
- 4950, 63732,  5699, 62640,  5553, 62087,  4380, 62139,
- 2709, 62544,   305, 63620, 63567, 64740, 61515,   575,
-60110,  1735, 59705,  2551, 60053,  2937, 61386,  2741,
-63279,  2204, 65388,  1390,  1955,   476,  3631, 65227,
- 4867, 64548,  5240, 64117,  4683, 63927,  3534, 63904,
- 1807, 64139,   156, 64260, 64132, 64621, 62905, 64796,
-62306, 65131, 61990,    57, 62324,   483, 62823,  1039,
-63579,  1388, 64513,  1689, 65205,  1857,   461,  1782,
- 1047,  1543,  1749,  1043,  2394,   243,  2737, 64936,
- 2954, 63895,  2776, 63184,  2293, 62625,  1593, 62611,
-  460, 63045, 64874, 63880, 63494, 65196, 62353,  1001,
-61505,  2298, 61063,  3186, 61449,  3504, 62334,  3280,
-63895,  2442,   285,  1279,  2249, 65410,  4196, 64081,
- 5311, 63039,  5708, 62356,  5132, 62250,  3652, 62609,
- 1731, 63443, 64901, 64603, 62740,   244, 60995,  1471,
-59940,  2338, 59930,  2750, 60604,  2711, 62153,  2151,
-64105,  1454,   604,   551,  2592, 65291,  3975, 64675,
- 4938, 64187,  4932, 64050,  4156, 64017,  2877, 64183,
- 1123, 64413, 65151, 64598, 63744, 64890, 62741, 65071,
-62272, 65475, 62118,   385, 62551,   826, 63117,  1256,
-63876,  1488, 64765,  1656, 65468,  1661,   715,  1384,
- 1359,  1020,  2028,   299,  2658, 65087,  2871, 64206,
- 2962, 63421,  2578, 62973,  1982, 62801,  1128, 63188,
-65453, 63854, 64293, 64984, 62969,   767, 61963,  1938,
-61343,  2907, 61158,  3265, 61827,  3155, 62983,  2492,
-64668,  1357,  1144,   146,  3005, 64351,  4694, 63313,
- 5447, 62647,  5456, 62386,  4533, 62725,  2817, 63389,
-  793, 64452, 63987,    80, 62013,  1184, 60551,  2160,
-59897,  2632, 60204,  2670, 61184,  2270, 62917,  1508,
-64970,   720,  1405, 65363,  3237, 64743,  4429, 64216,
- 5058, 63982,  4765, 64006,  3682, 64113,  2271, 64415,
-  510, 64650, 64600, 64920, 63330, 65237, 62484, 65495,
-62178,   448, 62180,   788, 62718,  1189, 63285,  1419,
-64126,  1510, 64949,  1533,   142,  1302,   874,   972,
- 1598,   406,  2256, 65196,  2848, 64460,  2922, 63659,
- 2952, 63173,  2404, 62978,  1710, 63158,   719, 63833,
-64960, 64745, 63742,   490, 62445,  1698, 61564,  2633,
-61109,  3172, 61238,  3085, 62190,  2563, 63590,  1534,
-65483,   280,  2036, 64566,  3846, 63418,  5238, 62741,
- 5671, 62405,  5255, 62658,  4025, 63379,  2041, 64357,
-65448,    50, 63114,  1137, 61368,  2122, 60188,  2692,
-59872,  2642, 60531,  2296, 61734,  1470, 63681,   642,
-  131, 65262,  2068, 64546,  3711, 64123,  4718, 63892,
- 5019, 63992,  4457, 64208,  3221, 64537,  1765, 64921,
-   30, 65143, 64221, 65417, 63039,    64, 62347,   368,
-62144,   670, 62217,   904, 62817,  1141, 63438,  1246,
-64307,  1262, 65186,  1218,   350,   873,  1239,   543,
- 1972, 65368,  2657, 64707,  3077, 63969,  3098, 63387,
- 2901, 63190,  2261, 63265,  1362, 63796,   256, 64687,
-64418,   245, 63187,  1531, 61985,  2412, 61247,  3046,
-61076,  3067, 61465,  2566, 62692,  1661, 64254,   391,
-  713, 64749,  2794, 63600,  4425, 62824,  5535, 62521,
- 5607, 62618,  4875, 63310,  3381, 64214,  1195, 65384,
-64542,   973, 62327,  1954, 60757,  2608, 59872,  2702,
-59892,  2359, 60812,  1682, 62340,   745, 64363, 65460,
-  887, 64640,  2744, 64168,  4269, 63928,  4977, 63898,
- 4946, 64203,  4108, 64447,  2720, 64862,  1145, 65178,
-65004, 65379, 63699,   155, 62673,   342, 62131,   740,
-62071,   963, 62320,  1138, 63003,  1274, 63747,  1210,
-64665,  1147,    14,   862,   781,   444,  1669, 65499,
- 2408, 64745,  2958, 64163,  3225, 63541,  3076, 63261,
- 2680, 63336,  1857, 63687,   843, 64536, 65143,    10,
-63761,  1186, 62590,  2231, 61553,  2829, 61113,  3091,
-61221,  2663, 61986,  1874, 63486,   737, 65217, 64968,
- 1755, 63884,  3634, 62909,  5004, 62531,  5667, 62489,
- 5297, 63023,  4239, 63942,  2408, 65067,   204,   733,
-63576,  1812, 61576,  2540, 60345,  2862, 59899,  2491,
-60270,  1922, 61517,   915, 63183,    13, 65296, 64705,
- 1706, 64079,  3362, 63874,  4626, 63827,  4936, 64119,
- 4689, 64513,  3547, 64864,  2086, 65300,   549, 65479,
-64505,   172, 63353,   387, 62448,   577, 62013,   844,
-62118,   946, 62393,  1045, 63154,  1105, 63924,   981,
-64898,   928,   274,   520,  1089,   156,  2089, 65029,
- 2751, 64343,  3261, 63793,  3335, 63289,  2992, 63327,
- 2467, 63541,  1422, 64273,   271, 65307, 64485,   925,
-63075,  2082, 62046,  2814, 61159,  3112, 61005,  2875,
-61409,  2037, 62517,   971, 64176, 65159,   456, 64009,
- 2568, 63098,  4247, 62535,  5321, 62593,  5631, 62982,
- 4908, 63912,  3610, 65010,  1589,   599, 64885,  1729,
-62813,  2414, 61026,  2769, 60128,  2534, 59942,  1898,
-60643,  1079, 62107,    71, 63939, 64826,   538, 64183,
- 2374, 63866,  3961, 63923,  4899, 64057,  4966, 64511,
- 4372, 64818,  3066, 65202,  1552, 65511, 65535,    48,
-64033,   359, 63024,   493, 62175,   791, 62010,   949,
-62131,  1019, 62570,  1140, 63395,  1018, 64173,   917,
-65171,   598,   528,   111,  1425, 65166,  2389, 64434,
- 2972, 63901,  3388, 63478,  3365, 63326,  2907, 63671,
- 2246, 64172,  1038, 65168, 65388,   706, 63917,  1790,
-62571,  2636, 61602,  2917, 60904,  2827, 61070,  2154,
-61734,  1117, 63136, 65503, 64978, 64222,  1376, 63352,
- 3479, 62716,  4870, 62576,  5662, 62936,  5537, 63586,
- 4457, 64740,  2878,   249,   626,  1360, 63998,  2224,
-62003,  2610, 60543,  2656, 59979,  2033, 60132,  1285,
-61172,   328, 62795, 64930, 64703, 64314,  1216, 63794,
- 2901, 63824,  4272, 63992,  4911, 64372,  4682, 64885,
- 3930, 65182,  2475,   102,  1046,   213, 65008,   395,
-63699,   604, 62754,   681, 62106,   916, 62030,   873,
-62246,   923, 62800,   944, 63639,   750, 64489,   663,
-65529,   191,   890, 65346,  1899, 64756,  2792, 64113,
- 3253, 63734,  3580, 63422,  3310, 63621,  2758, 64091,
- 1855, 64808,   522,   445, 64796,  1422, 63294,  2407,
-62109,  2862, 61234,  2826, 60844,  2413, 61261,  1345,
-62195,   230, 63787, 64481,   156, 63425,  2131, 62821,
- 4055, 62450,  5159, 62841,  5640, 63455,  5151, 64546,
- 3853,   250,  2060,  1257, 65277,  2314, 63204,  2698,
-61333,  2732, 60189,  2233, 59929,  1293, 60349,   437,
-61670, 64896, 63436, 64238, 65450, 63771,  1926, 63668,
- 3527, 63978,  4759, 64326,  5086, 64895,  4636, 65334,
- 3604,    93,  2040,   409,   558,   385, 64474,   635,
-63256,   666, 62395,   771, 61915,   884, 62026,   787,
-62342,   903, 63024,   748, 63940,   571, 64796,   344,
-  357, 65312,  1247, 64957,  2300, 64210,  3081, 63792,
- 3445, 63519,  3601, 63498,  3143, 64024,  2499, 64666,
- 1430,   190,    36,  1345, 64223,  2217, 62733,  2903,
-61665,  2890, 60933,  2519, 60767,  1628, 61484,   361,
-62658, 64720, 64483, 63474,   943, 62812,  2978, 62438,
- 4712, 62601,  5571, 63330,  5681, 64238,  4814,    16,
- 3267,  1112,  1231,  2101, 64415,  2804, 62431,  2753,
-60797,  2446, 60017,  1521, 60057,   566, 60767, 65138,
-62335, 64214, 64183, 63839,   671, 63567,  2528, 63843,
- 3924, 64263,  4872, 64705,  4842, 65339,  4167,    69,
- 2973,   398,  1401,   524, 65527,   537, 64029,   770,
-62977,   689, 62286,   832, 61960,   807, 62192,   748,
-62519,   822, 63282,   536, 64173,   408, 65088, 65482,
-  620, 64996,  1598, 64482,  2622, 63834,  3285, 63548,
- 3521, 63442,  3462, 63742,  2855, 64483,  2057, 65341,
-  790,  1083, 64962,  2054, 63570,  2826, 62238,  3082,
-61355,  2724, 60900,  2019, 61089,   767, 62086, 64987,
-63470, 63809, 65420, 62786,  1859, 62467,  3718, 62431,
- 5092, 63079,  5511, 64054,  5247, 65231,  4045,  1049,
- 2308,  2013,   230,  2828, 63575,  2972, 61877,  2588,
-60619,  1860, 60229,   681, 60585, 65272, 61546, 64284,
-63247, 63709, 65050, 63563,  1398, 63627,  3059, 64174,
- 4172, 64684,  4765, 65240,  4415,   180,  3584,   348,
- 2283,   579,   813,   541, 65002,   638, 63666,   678,
-62818,   638, 62256,   759, 62115,   673, 62395,   729,
-62795,   636, 63614,   382, 64497,   159, 65426, 65124,
-  990, 64618,  1949, 64055,  2933, 63594,  3447, 63554,
- 3565, 63675,  3346, 64353,  2584, 65248,  1639,   810,
-  264,  1913, 64374,  2626, 63039,  3040, 61821,  2809,
-61203,  2072, 60969,  1053, 61507, 65159, 62715, 64074,
-64288, 62980,   738, 62490,  2617, 62484,  4260, 62908,
- 5261, 63879,  5310, 64963,  4709,   702,  3241,  1816,
- 1397,  2573, 64849,  2970, 62823,  2644, 61367,  2031,
-60448,  1020, 60382, 65448, 61003, 64561, 62176, 63769,
-64004, 63541,   197, 63562,  2052, 63898,  3473, 64540,
- 4362, 65014,  4654,    93,  4078,   371,  3104,   586,
- 1780,   740,   331,   716, 64587,   809, 63370,   743,
-62603,   722, 62210,   742, 62141,   594, 62541,   608,
-63038,   371, 63931,   123, 64891, 65295,   339, 64727,
- 1512, 64301,  2428, 63781,  3287, 63594,  3600, 63718,
- 3498, 64096,  3059, 65005,  2073,   422,   984,  1545,
-65060,  2419, 63638,  2874, 62422,  2919, 61405,  2296,
-61070,  1366, 61138,    80, 61993, 64311, 63422, 63288,
-65137, 62509,  1600, 62398,  3364, 62706,  4721, 63503,
- 5372, 64702,  5038,   351,  4143,  1615,  2422,  2487,
-  514,  2945, 63992,  2900, 62155,  2163, 60978,  1318,
-60400,   121, 60636, 64693, 61538, 63900, 62942, 63471,
-64815, 63563,  1037, 63832,  2725, 64451,  3952, 65050,
- 4524,     2,  4499,   449,  3637,   526,  2514,   662,
- 1077,   615, 65180,   625, 64003,   649, 62880,   609,
-62356,   688, 62118,   714, 62267,   674, 62755,   628,
-63391,   286, 64339, 65512, 65345, 64945,   819, 64340,
- 1981, 63870,  2762, 63453,  3493, 63556,  3562, 63884,
- 3325, 64651,  2712,   201,  1624,  1276,   458,  2344,
-64481,  2883, 63134,  3013, 62004,  2596, 61185,  1608,
-61070,   463, 61417, 64534, 62546, 63449, 64166, 62637,
-  437, 62313,  2464, 62618,  4020, 63252,  5122, 64412,
- 5342,   110,  4684,  1296,  3435,  2371,  1576,  2840,
-65079,  2978, 63171,  2405, 61482,  1526, 60691,   497,
-60380, 64928, 60974, 64154, 62077, 63549, 63674, 63446,
-   37, 63681,  1730, 64127,  3272, 64782,  4241, 65305,
- 4533,   248,  4212,   572,  3168,   644,  1916,   774,
-  504,   695, 64678,   749, 63567,   677, 62642,   620,
-62245,   635, 62207,   571, 62442,   531, 63035,   337,
-63755, 65511, 64773, 65178,   266, 64578,  1319, 64121,
- 2432, 63701,  3126, 63579,  3665, 63884,  3515, 64398,
- 3038, 65358,  2263,   883,  1017,  1887, 65294,  2674,
-63753,  2858, 62509,  2725, 61581,  1934, 61037,   831,
-61203, 65082, 61896, 63797, 63288, 62973, 65063, 62445,
- 1348, 62502,  3288, 63065,  4577, 64030,  5316, 65327,
- 5114,   993,  4113,  2110,  2626,  2849,   635,  3001,
-64181,  2669, 62408,  1742, 61058,   711, 60604, 65142,
-60624, 64193, 61526, 63595, 62830, 63332, 64553, 63609,
-  862, 64094,  2422, 64709,  3762, 65387,  4423,   258,
- 4394,   672,  3780,   696,  2571,   673,  1282,   681,
-65408,   563, 64104,   583, 63134,   489, 62366,   500,
-62203,   601, 62266,   537, 62705,   476, 63403,   159,
-64208, 65335, 65281, 64841,   772, 64233,  1846, 63826,
- 2814, 63589,  3338, 63765,  3629, 64295,  3309, 65073,
- 2660,   683,  1702,  1696,   401,  2534, 64622,  2870,
-63196,  2701, 62075,  2110, 61402,  1010, 61121, 65272,
-61633, 64023, 62532, 63017, 64122, 62558,   386, 62442,
- 2193, 62968,  3863, 63866,  4798, 65065,  5169,   789,
- 4589,  1836,  3352,  2697,  1687,  2955, 65232,  2708,
-63401,  1990, 61840,   888, 60832, 65428, 60675, 64415,
-61032, 63723, 62147, 63437, 63590, 63506, 65313, 63993,
- 1543, 64535,  2942, 65187,  4040,   196,  4410,   522,
- 4158,   731,  3369,   676,  2078,   708,   793,   634,
-64926,   535, 63763,   553, 62855,   470, 62246,   547,
-62206,   516, 62372,   382, 62889,   215, 63653, 65395,
-64525, 64993,   149, 64484,  1182, 64024,  2283, 63840,
- 3102, 63834,  3521, 64276,  3583, 64914,  3050,   353,
- 2247,  1377,  1159,  2139, 65289,  2639, 63989,  2611,
-62612,  2122, 61740,  1271, 61264,     4, 61291, 64406,
-62018, 63335, 63180, 62727, 64868, 62579,  1124, 62882,
- 2861, 63709,  4285, 64763,  4962,   465,  4975,  1537,
- 4143,  2394,  2691,  2863,   986,  2696, 64525,  2145,
-62844,  1172, 61478,   100, 60777, 64711, 60858, 63880,
-61431, 63550, 62691, 63498, 64232, 63891,   417, 64479,
- 2082, 65081,  3347,   153,  4200,   536,  4335,   731,
- 3829,   796,  2872,   656,  1518,   668,   196,   506,
-64406,   485, 63286,   456, 62535,   451, 62125,   499,
-62241,   406, 62548,   242, 63203, 65493, 64076, 65035,
-65024, 64630,   669, 64101,  1684, 63864,  2715, 63849,
- 3386, 64130,  3586, 64834,  3474,    89,  2754,  1154,
- 1884,  1958,   613,  2516, 64760,  2634, 63427,  2186,
-62187,  1433, 61498,   262, 61219, 64599, 61522, 63557,
-62470, 62814, 63815, 62653,    61, 62866,  1847, 63571,
- 3468, 64634,  4659,   213,  5037,  1369,  4736,  2206,
- 3606,  2702,  2022,  2721,   168,  2183, 63744,  1384,
-62145,   318, 61005, 64911, 60614, 64144, 60938, 63634,
-61778, 63607, 63264, 63809, 64916, 64374,  1171, 64971,
- 2724, 65510,  3833,   442,  4458,   617,  4306,   727,
- 3610,   651,  2478,   575,  1058,   553, 65298,   431,
-63931,   444, 62929,   441, 62266,   401, 62013,   446,
-62239,   167, 62650,    11, 63434, 65108, 64393, 64705,
-65474, 64304,  1108, 63963,  2191, 63960,  3109, 64167,
- 3618, 64720,  3654,     1,  3291,   870,  2462,  1840,
- 1364,  2381,    17,  2640, 64083,  2376, 62784,  1663,
-61740,   707, 61202, 64968, 61208, 63912, 61762, 63059,
-62979, 62680, 64497, 62821,   827, 63292,  2582, 64311,
- 4100, 65382,  4985,   992,  5056,  1946,  4421,  2496,
- 3079,  2711,  1305,  2305, 64950,  1534, 63025,   582,
-61651, 65059, 60750, 64323, 60672, 63701, 61215, 63522,
-62348, 63747, 63942, 64160,   106, 64868,  1804, 65369,
- 3226,   369,  4116,   658,  4427,   743,  4021,   745,
- 3164,   588,  1905,   549,   517,   471, 64731,   409,
-63507,   467, 62612,   438, 62138,   495, 62007,   367,
-62364,    91, 62865, 65326, 63765, 64828, 64741, 64442,
-  359, 64052,  1545, 63861,  2612, 64098,  3394, 64473,
- 3751, 65263,  3616,   568,  3088,  1488,  2107,  2223,
-  893,  2455, 64992,  2403, 63554,  1751, 62295,   848,
-61426, 65282, 61107, 64067, 61355, 63284, 62192, 62755,
-63591, 62801, 65241, 63281,  1626, 64049,  3266, 65283,
- 4535,   770,  5057,  1845,  4792,  2434,  3858,  2664,
- 2277,  2471,   466,  1701, 64090,   799, 62434, 65325,
-61258, 64490, 60744, 63915, 60957, 63577, 61754, 63747,
-63065, 64131, 64687, 64721,   844, 65328,  2410,   193,
- 3633,   616,  4251,   700,  4312,   676,  3659,   624,
- 2648,   481,  1292,   534, 65464,   389, 64166,   424,
-63073,   428, 62332,   401, 62053,   385, 62117,    72,
-62623, 65332, 63281, 64883, 64281, 64438, 65327, 64082,
-  927, 63820,  2078, 64004,  2920, 64392,  3508, 65049,
- 3576,   428,  3254,  1295,  2522,  2156,  1470,  2544,
-  197,  2506, 64343,  2078, 63049,  1174, 62023,   107,
-61441, 64438, 61376, 63448, 61864, 62899, 62920, 62722,
-64383, 63143,   538, 63821,  2301, 64925,  3738,   550,
- 4685,  1512,  4846,  2313,  4305,  2559,  3133,  2461,
- 1510,  1838, 65216,   910, 63465, 65492, 61972, 64593,
-61118, 63976, 60827, 63651, 61297, 63648, 62248, 64094,
-63697, 64597, 65322, 65265,  1402,   177,  2856,   534,
- 3831,   735,  4249,   657,  4030,   584,  3237,   450,
- 2118,   403,   782,   418, 64955,   382, 63781,   514,
-62788,   511, 62258,   537, 62076,   343, 62317, 65504,
-62878, 65133, 63685, 64581, 64716, 64216,   267, 63864,
- 1444, 63877,  2487, 64271,  3228, 64820,  3591,   170,
- 3489,  1050,  2958,  1855,  2095,  2419,   898,  2402,
-65135,  2092, 63765,  1253, 62593,   264, 61795, 64649,
-61424, 63629, 61650, 63006, 62348, 62796, 63588, 63093,
-65120, 63785,  1276, 64722,  2890,   360,  4077,  1339,
- 4659,  2127,  4540,  2510,  3706,  2433,  2388,  1983,
-  688,  1136, 64458,   194, 62840, 64883, 61618, 64183,
-61026, 63875, 61042, 63753, 61708, 64090, 62857, 64540,
-64397, 65140,   478,    96,  2039,   408,  3319,   671,
- 4094,   645,  4206,   572,  3743,   480,  2743,   386,
- 1512,   414,   130,   375, 64349,   411, 63276,   440,
-62488,   388, 62163,   282, 62216, 65508, 62624, 65118,
-63347, 64715, 64229, 64265, 65294, 64046,   812, 63923,
- 1858, 64249,  2751, 64814,  3208,    17,  3401,   956,
- 3061,  1723,  2434,  2346,  1495,  2498,   304,  2188,
-64596,  1524, 63337,   509, 62344, 64925, 61745, 63906,
-61559, 63080, 61984, 62849, 62871, 62950, 64194, 63611,
-  285, 64468,  1906,    47,  3441,  1146,  4366,  1931,
- 4683,  2493,  4273,  2460,  3210,  2082,  1722,  1321,
-65451,   322, 63742, 64988, 62258, 64184, 61279, 63791,
-60991, 63653, 61257, 63864, 62222, 64373, 63545, 64915,
-65149, 65515,  1216,   370,  2635,   616,  3718,   744,
- 4178,   615,  4012,   590,  3316,   469,  2194,   430,
-  887,   509, 65076,   462, 63866,   576, 62941,   515,
-62345,   420, 62208,   177, 62403, 65263, 62930, 64837,
-63734, 64349, 64633, 63986,   204, 63855,  1237, 63970,
- 2291, 64553,  3050, 65230,  3392,   632,  3384,  1500,
- 2882,  2172,  2092,  2541,   976,  2301, 65215,  1721,
-63966,   772, 62765, 65151, 61975, 64118, 61597, 63172,
-61705, 62808, 62433, 62845, 63504, 63359, 64996, 64210,
- 1067, 65254,  2638,   870,  3889,  1762,  4494,  2341,
- 4497,  2540,  3779,  2214,  2526,  1624,   919,   677,
-64681, 65296, 63076, 64559, 61804, 64010, 61083, 63866,
-61063, 63922, 61601, 64345, 62734, 64913, 64194, 65378,
-  251,   311,  1846,   465,  3122,   613,  3989,   540,
- 4163,   421,  3771,   384,  2904,   333,  1641,   432,
-  351,   465, 64514,   510, 63422,   587, 62645,   471,
-62203,   298, 62281, 65402, 62577, 64919, 63287, 64463,
-64162, 63994, 65124, 63816,   644, 63852,  1661, 64300,
- 2599, 65035,  3183,   347,  3329,  1320,  3169,  2083,
- 2526,  2539,  1647,  2554,   474,  1970, 64707,  1171,
-63526,    21, 62446, 64464, 61833, 63488, 61609, 62856,
-61940, 62842, 62834, 63157, 64045, 63975,    62, 64932,
- 1672,   532,  3147,  1538,  4217,  2190,  4532,  2496,
- 4272,  2333,  3332,  1759,  1911,   946,   258, 65470,
-63997, 64660, 62603, 64017, 61525, 63740, 61118, 63747,
-61343, 64059, 62091, 64632, 63404, 65193, 64858,   153,
-  871,   488,  2288,   594,  3364,   642,  3973,   519,
- 3875,   445,  3331,   406,  2335,   393,  1116,   509,
-65373,   533, 64142,   600, 63161,   551, 62543,   376,
-62275,    80, 62402, 65102, 62854, 64623, 63582, 64173,
-64525, 63859, 65487, 63876,  1034, 64139,  2047, 64797,
- 2918,   112,  3317,  1024,  3332,  1910,  2974,  2402,
- 2183,  2589,  1187,  2192, 65425,  1399, 64183,   310,
-63043, 64681, 62192, 63643, 61763, 62925, 61799, 62682,
-62378, 62966, 63418, 63655, 64734, 64709,   720,   247,
- 2262,  1352,  3483,  2137,  4294,  2558,  4263,  2536,
- 3798,  1986,  2639,  1226,  1176,   257, 65049, 64873,
-63443, 64202, 62235, 63797, 61451, 63801, 61290, 64078,
-61706, 64582, 62609, 65193, 63996,   146, 65412,   520,
- 1358,   623,  2666,   583,  3550,   472,  3952,   312,
- 3680,   293,  2976,   260,  1957,   330,   669,   445,
-64986,   527, 63813,   541, 62964,   438, 62480,   129,
-62292, 65300, 62608, 64738, 63084, 64330, 63947, 63937,
-64876, 63890,   333, 64108,  1450, 64605,  2354, 65390,
- 3080,   722,  3322,  1613,  3162,  2221,  2685,  2440,
- 1746,  2266,   667,  1592, 64899,   656, 63682, 65073,
-62675, 64026, 61946, 63265, 61735, 62864, 62010, 62986,
-62778, 63515, 64009, 64412, 65379, 65501,  1472,   974,
- 2902,  1859,  3948,  2326,  4423,  2493,  4127,  2081,
- 3390,  1414,  1999,   504,   394, 65157, 64277, 64403,
-62771, 63906, 61799, 63722, 61270, 63907, 61430, 64293,
-62168, 64875, 63282, 65382, 64791,   309,   663,   595,
- 2099,   653,  3214,   626,  3804,   526,  3853,   456,
- 3293,   430,  2412,   377,  1225,   452, 65466,   467,
-64307,   475, 63257,   388, 62657,   123, 62329, 65355,
-62423, 64852, 62885, 64458, 63543, 64112, 64491, 63964,
-65446, 64148,   927, 64507,  2008, 65250,  2736,   506,
- 3250,  1381,  3242,  2064,  2896,  2381,  2241,  2340,
- 1150,  1785,     7,   891, 64236, 65392, 63136, 64268,
-62278, 63400, 61765, 62858, 61850, 62786, 62343, 63260,
-63394, 64007, 64703, 65122,   653,   658,  2257,  1639,
- 3472,  2330,  4251,  2561,  4323,  2413,  3744,  1779,
- 2697,   949,  1117,    10, 65001, 64640, 63437, 64077,
-62126, 63711, 61474, 63753, 61216, 64056, 61770, 64536,
-62692, 65180, 64064,   111,    73,   513,  1456,   692,
- 2830,   707,  3646,   727,  3939,   580,  3654,   573,
- 2800,   504,  1798,   470,   450,   524, 64737,   380,
-63651,   351, 62819,   109, 62465, 65281, 62352, 64909,
-62697, 64377, 63295, 64140, 64131, 63929, 65109, 64038,
-  528, 64429,  1572, 65021,  2495,   373,  3044,  1186,
- 3288,  1939,  3023,  2374,  2502,  2398,  1604,  2049,
-  427,  1195, 64750,   184, 63521, 64635, 62593, 63627,
-61940, 63013, 61724, 62721, 62116, 63043, 62906, 63741,
-64207, 64699,    81,   340,  1641,  1292,  3121,  2186,
- 4059,  2553,  4455,  2491,  4085,  2086,  3161,  1214,
- 1800,   343,    60, 64935, 63982, 64161, 62510, 63776,
-61602, 63563, 61250, 63858, 61467, 64244, 62329, 64863,
-63552, 65482, 65059,   350,   987,   733,  2270,   778,
- 3338,   798,  3789,   756,  3717,   625,  3092,   570,
- 2097,   448,   976,   436, 65240,   389, 64105,   254,
-63204,   143, 62641, 65344, 62491, 65021, 62589, 64611,
-63076, 64223, 63764, 64127, 64666, 64083,    94, 64451,
- 1050, 64931,  2060,   118,  2833,   968,  3213,  1693,
- 3232,  2204,  2776,  2338,  2094,  2057,   999,  1431,
-65319,   443, 64067, 64957, 62938, 63926, 62197, 63197,
-61773, 62860, 61891, 62922, 62546, 63550, 63607, 64416,
-65037,     5,   964,  1076,  2502,  1896,  3658,  2503,
- 4259,  2551,  4240,  2221,  3481,  1511,  2344,   576,
-  757, 65234, 64632, 64392, 63136, 63875, 61987, 63650,
-61456, 63722, 61455, 64143, 62041, 64594, 63119, 65223,
-64464,   147,   426,   504,  1737,   757,  2886,   744,
- 3609,   797,  3734,   734,  3365,   669,  2487,   617,
- 1423,   471,   224,   463, 64594,   340, 63631,   167,
-62897, 65449, 62614, 65042, 62600, 64699, 62919, 64279,
-63505, 64062, 64284, 64044, 65170, 64274,   591, 64807,
- 1496, 65440,  2404,   724,  2920,  1530,  3149,  2107,
- 2910,  2369,  2355,  2159,  1483,  1640,   327,   779,
-64660, 65273, 63495, 64278, 62528, 63423, 62024, 62992,
-61836, 62930, 62277, 63299, 63157, 64103, 64378, 65086,
-  362,   637,  1816,  1550,  3204,  2166,  4017,  2501,
- 4267,  2293,  3826,  1790,  2807,   948,  1424,    58,
-65299, 64808, 63759, 64128, 62474, 63810, 61681, 63710,
-61494, 63984, 61841, 64426, 62696, 64924, 63948, 65482,
-65319,   346,  1179,   674,  2348,   818,  3224,   835,
- 3620,   862,  3403,   777,  2808,   692,  1796,   604,
-  708,   454, 65086,   384, 64066,   146, 63274, 65465,
-62785, 65108, 62673, 64714, 62834, 64397, 63243, 64079,
-63954, 64085, 64724, 64230,   156, 64664,  1094, 65321,
- 2045,   470,  2813,  1275,  3167,  1862,  3174,  2162,
- 2707,  2160,  1922,  1651,   854,   989, 65131, 65516,
-63924, 64596, 62810, 63744, 62125, 63160, 61803, 63054,
-62030, 63252, 62737, 63917, 63876, 64838, 65278,   297,
- 1254,  1273,  2650,  1950,  3737,  2352,  4188,  2318,
- 4034,  1889,  3228,  1189,  1944,   329,   426, 65073,
-64330, 64390, 62964, 63945, 61968, 63848, 61547, 63936,
-61708, 64350, 62353, 64768, 63461, 65286, 64811,   203,
-  620,   513,  1926,   731,  2897,   806,  3524,   840,
- 3563,   827,  3123,   727,  2268,   646,  1199,   514,
-   41,   399, 64483,   239, 63536, 65488, 62947, 65201,
-62630, 64780, 62719, 64429, 63019, 64126, 63616, 63988,
-64399, 64152, 65274, 64492,   685, 65129,  1626,   297,
- 2465,  1100,  2998,  1830,  3131,  2211,  2882,  2300,
- 2245,  1909,  1304,  1259,   167,   338, 64444, 64859,
-63327, 63988, 62414, 63309, 61931, 63028, 61910, 63177,
-62365, 63611, 63380, 64512, 64654, 65447,   631,   920,
- 2113,  1708,  3362,  2200,  4152,  2359,  4215,  2074,
- 3700,  1505,  2556,   706,  1078, 65392, 64992, 64711,
-63440, 64126, 62261, 63897, 61588, 63872, 61506, 64124,
-61998, 64529, 62949, 64931, 64260, 65365,   128,   209,
- 1469,   471,  2610,   706,  3335,   765,  3601,   914,
- 3286,   908,  2548,   879,  1540,   781,   375,   621,
-64826,   462, 63847,   160, 63142, 65318, 62781, 64893,
-62730, 64422, 62989, 64127, 63493, 63859, 64158, 63939,
-64999, 64252,   317, 64809,  1275,    78,  2143,   829,
- 2818,  1680,  3134,  2203,  3013,  2413,  2546,  2189,
- 1706,  1573,   626,   733, 64946, 65269, 63724, 64284,
-62724, 63514, 62031, 63032, 61833, 63027, 62117, 63365,
-62890, 64031, 64129, 65021, 65497,   453,  1537,  1399,
- 2881,  2052,  3888,  2326,  4248,  2305,  3941,  1770,
- 3051,  1137,  1660,   218,    49, 65029, 64021, 64390,
-62659, 63985, 61796, 63885, 61475, 63972, 61761, 64332,
-62581, 64741, 63755, 65139, 65133,    42,  1016,   341,
- 2218,   644,  3167,   822,  3558,   939,  3516,  1043,
- 2912,  1009,  1994,   949,   859,   790, 65232,   529,
-64208,   291, 63359, 65363, 62847, 64957, 62677, 64418,
-62800, 64043, 63238, 63829, 63808, 63743, 64612, 64087,
-65445, 64579,   815, 65367,  1760,   677,  2495,  1472,
- 3023,  2156,  3069,  2449,  2806,  2356,  2094,  1847,
- 1133,   995, 65502,    20, 64279, 64506, 63117, 63643,
-62325, 63068, 61823, 62897, 61976, 63168, 62493, 63774,
-63567, 64685, 64925,   190,   879,  1147,  2419,  1957,
- 3574,  2329,  4280,  2399,  4239,  2051,  3577,  1364,
- 2340,   593,   767, 65229, 64673, 64590, 63173, 64077,
-62058, 63843, 61535, 63888, 61562, 64110, 62216, 64547,
-63252, 64939, 64568, 65368,   467,   192,  1699,   497,
- 2774,   777,  3332,   946,  3480,  1068,  3067,  1149,
- 2297,  1067,  1262,   978,   162,   691, 64634,   380,
-63782, 65516, 63125, 64982, 62850, 64493, 62828, 63978,
-63145, 63720, 63615, 63652, 64299, 63849, 65107, 64405,
-  430, 65114,  1381,   514,  2210,  1393,  2787,  2118,
- 3110,  2559,  2902,  2576,  2414,  2171,  1531,  1387,
-  413,   355, 64763, 64851, 63547, 63832, 62581, 63161,
-62011, 62800, 61876, 62926, 62318, 63476, 63149, 64264,
-64439, 65332,   327,   788,  1801,  1687,  3092,  2287,
- 3896,  2437,  4149,  2291,  3692,  1721,  2668,   973,
- 1286,   137, 65219, 64873, 63769, 64297, 62525, 63906,
-61842, 63815, 61689, 63925, 62078, 64237, 62964, 64671,
-64120, 65048, 65477, 65530,  1225,   312,  2300,   684,
- 3100,   933,  3356,  1145,  3215,  1234,  2563,  1250,
- 1653,  1119,   587,   906, 65050,   549, 64121,   131,
-63395, 65146, 62934, 64605, 62863, 64117, 62989, 63753,
-63462, 63644, 64025, 63756, 64823, 64177,   114, 64884,
- 1017,   163,  1886,  1102,  2565,  1874,  2936,  2387,
- 2940,  2566,  2518,  2264,  1827,  1631,   802,   686,
-65232, 65166, 64058, 64187, 63023, 63383, 62330, 62939,
-62008, 62880, 62219, 63274, 62879, 63970, 63934, 64916,
-65314,   389,  1142,  1298,  2557,  2031,  3554,  2378,
- 4038,  2332,  3907,  1956,  3080,  1272,  1885,   472,
-  350, 65195, 64338, 64494, 63035, 64054, 62059, 63803,
-61708, 63864, 61862, 64074, 62549, 64458, 63651, 64885,
-64940, 65287,   717,   182,  1875,   540,  2766,   902,
- 3265,  1165,  3226,  1308,  2781,  1389,  1970,  1270,
-  979,  1090, 65487,   701, 64496,   253, 63759, 65266,
-63205, 64691, 63004, 64164, 63044, 63782, 63316, 63605,
-63827, 63728, 64463, 64062, 65227, 64741,   543, 65516,
- 1414,   906,  2243,  1707,  2748,  2258,  2967,  2513,
- 2760,  2311,  2187,  1795,  1345,   910,   177, 65459,
-64583, 64480, 63418, 63652, 62551, 63131, 62055, 62992,
-62008, 63217, 62533, 63835, 63435, 64647, 64698,    52,
-  580,   953,  1979,  1707,  3192,  2156,  3842,  2267,
- 3957,  2021,  3379,  1512,  2325,   818,   907,    77,
-64924, 64924, 63552, 64377, 62508, 64037, 61900, 63907,
-61903, 63999, 62363, 64221, 63304, 64599, 64505, 64990,
-  226, 65438,  1445,   312,  2391,   727,  3057,  1103,
- 3209,  1308,  2927,  1439,  2275,  1385,  1345,  1195,
-  339,   862, 64881,   361, 64052, 65375, 63467, 64769,
-63107, 64207, 63097, 63805, 63236, 63559, 63678, 63661,
-64214, 63946, 64906, 64560,   139, 65324,   989,   649,
- 1812,  1500,  2466,  2086,  2785,  2412,  2812,  2326,
- 2404,  1882,  1703,  1157,   723,   197, 65101, 64814,
-64009, 63959, 62980, 63393, 62319, 63144, 62076, 63249,
-62316, 63744, 63088, 64445, 64188, 65304,    37,   645,
- 1472,  1371,  2793,  1926,  3700,  2123,  4015,  1984,
- 3697,  1619,  2789,   991,  1442,   344, 65443, 65191,
-63938, 64628, 62751, 64248, 61969, 64037, 61791, 64050,
-62110, 64173, 62950, 64448, 64102, 64787, 65375, 65155,
- 1058,    28,  2082,   421,  2799,   856,  3088,  1178,
- 2919,  1359,  2371,  1493,  1565,  1328,   596,  1159,
-65229,   683, 64363,   194, 63759, 65130, 63387, 64493,
-63198, 64018, 63333, 63651, 63581, 63596, 64065, 63810,
-64645, 64276, 65331, 65029,   596,   327,  1425,  1197,
- 2155,  1935,  2681,  2300,  2787,  2409,  2657,  2019,
- 2022,  1402,  1181,   509,    56, 65104, 64414, 64268,
-63344, 63567, 62480, 63271, 62079, 63262, 62154, 63609,
-62752, 64252, 63765, 64981, 65055,   303,   946,  1055,
- 2320,  1611,  3351,  1956,  3904,  1896,  3754,  1666,
- 3095,  1142,  1884,   563,   453, 65486, 64495, 64944,
-63238, 64525, 62336, 64267, 61962, 64140, 62086, 64214,
-62733, 64345, 63715, 64626, 64937, 64900,   594, 65315,
- 1625,   179,  2474,   644,  2910,  1063,  2957,  1352,
- 2578,  1534,  1911,  1499,  1046,  1292,   132,   904,
-64771,   361, 64057, 65286, 63546, 64640, 63274, 64082,
-63253, 63698, 63419, 63549, 63839, 63699, 64385, 64094,
-65083, 64758,   257,    26,  1117,   879,  1860,  1637,
- 2447,  2129,  2680,  2288,  2594,  2083,  2177,  1542,
- 1424,   784,   431, 65440, 64852, 64585, 63785, 63916,
-62911, 63433, 62333, 63366, 62252, 63542, 62612, 64035,
-63463, 64743, 64627, 65470,   384,   730,  1749,  1347,
- 2875,  1781,  3600,  1912,  3719,  1759,  3237,  1395,
- 2304,   846,   969,   264, 65095, 65206, 63746, 64716,
-62709, 64360, 62155, 64162, 62076, 64114, 62489, 64234,
-63349, 64422, 64456, 64783,   151, 65126,  1213,    71,
- 2115,   539,  2692,  1018,  2904,  1371,  2684,  1539,
- 2078,  1569,  1339,  1378,   456,  1024, 65165,   509,
-64404, 65415, 63827, 64810, 63506, 64209, 63378, 63798,
-63425, 63595, 63711, 63648, 64135, 64039, 64775, 64565,
-65455, 65348,   683,   642,  1529,  1412,  2194,  2033,
- 2650,  2223,  2687,  2152,  2425,  1725,  1787,   992,
-  849,   205, 65268, 64834, 64117, 64155, 63127, 63615,
-62433, 63417, 62137, 63523, 62381, 63898, 63050, 64532,
-64164, 65243, 65463,   422,  1279,  1110,  2567,  1575,
- 3436,  1832,  3792,  1764,  3527,  1484,  2665,  1083,
- 1510,   511,    20, 65535, 64243, 65008, 63060, 64613,
-62348, 64362, 62139, 64168, 62399, 64214, 63127, 64270,
-64135, 64542, 65319, 64851,   857, 65243,  1807,   242,
- 2457,   729,  2769,  1235,  2683,  1496,  2263,  1649,
- 1542,  1560,   767,  1276, 65420,   774, 64667,   148,
-64024, 64977, 63575, 64386, 63396, 63816, 63351, 63568,
-63564, 63522, 63943, 63822, 64471, 64397, 65196, 65072,
-  371,   397,  1233,  1221,  1956,  1841,  2510,  2214,
- 2707,  2112,  2562,  1833,  2066,  1172,  1252,   418,
-  193, 65121, 64624, 64397, 63516, 63879, 62729, 63608,
-62256, 63593, 62288, 63911, 62824, 64379, 63745, 65063,
-65019,   124,   790,   767,  2116,  1267,  3129,  1586,
- 3659,  1664,  3590,  1470,  2968,  1143,  1828,   716,
-  541,   192, 64609, 65273, 63472, 64828, 62557, 64529,
-62197, 64313, 62314, 64197, 62857, 64235, 63815, 64368,
-64897, 64683,   496, 65025,  1463, 65501,  2179,   543,
- 2611,  1051,  2645,  1477,  2319,  1657,  1763,  1642,
-  962,  1468,   233,   992, 64950,   421, 64383, 65259,
-63861, 64597, 63602, 64072, 63532, 63649, 63571, 63585,
-63887, 63719, 64271, 64189, 64876, 64849,    49,    65,
-  783,   951,  1609,  1637,  2244,  2120,  2631,  2206,
- 2656,  1950,  2294,  1448,  1640,   683,   651, 65402,
-65069, 64655, 63929, 64021, 62945, 63702, 62371, 63577,
-62162, 63794, 62526, 64201, 63335, 64799, 64494, 65429,
-  335,   471,  1626,  1065,  2793,  1411,  3514,  1603,
- 3651,  1519,  3219,  1248,  2227,   895,   993,   416,
-65123, 65480, 63867, 65050, 62907, 64674, 62358, 64436,
-62363, 64249, 62769, 64237, 63551, 64293, 64616, 64510,
-  110, 64844,  1140, 65237,  1866,   265,  2369,   803,
- 2556,  1304,  2350,  1604,  1906,  1700,  1219,  1592,
-  489,  1236, 65315,   685, 64623,     8, 64123, 64819,
-63731, 64224, 63571, 63747, 63557, 63534, 63681, 63603,
-64070, 63962, 64522, 64573, 65244, 65312,   407,   612,
- 1235,  1383,  2000,  1949,  2495,  2182,  2713,  2038,
- 2503,  1629,  1973,   970,  1114,   203,     1, 64963,
-64410, 64299, 63370, 63860, 62604, 63692, 62298, 63749,
-62390, 64073, 63058, 64527, 64052, 65164, 65324,   179,
- 1107,   755,  2278,  1208,  3198,  1505,  3532,  1578,
- 3348,  1417,  2575,  1102,  1416,   712,   100,   226,
-64333, 65305, 63253, 64853, 62583, 64529, 62363, 64323,
-62642, 64209, 63287, 64208, 64220, 64368, 65272, 64688,
-  751, 65086,  1575,    81,  2135,   600,  2446,  1168,
- 2383,  1517,  2058,  1702,  1481,  1623,   767,  1362,
-   86,   898, 64937,   260, 64373, 65113, 63963, 64438,
-63687, 63971, 63660, 63651, 63698, 63597, 63960, 63836,
-64386, 64303, 64957, 65045,   158,   224,   881,  1069,
- 1653,  1682,  2256,  2085,  2553,  2092,  2534,  1772,
- 2121,  1230,  1390,   502,   405, 65288, 64820, 64547,
-63752, 64037, 62886, 63749, 62413, 63733, 62389, 63945,
-62819, 64359, 63729, 64904, 64883, 65529,   655,   504,
- 1871,  1042,  2833,  1373,  3400,  1544,  3377,  1486,
- 2808,  1193,  1825,   848,   548,   403, 64853, 65513,
-63700, 65069, 62929, 64693, 62537, 64456, 62640, 64294,
-63157, 64241, 63938, 64302, 64928, 64528,   352, 64882,
- 1210, 65338,  1849,   300,  2204,   875,  2296,  1320,
- 2107,  1618,  1621,  1616,  1059,  1462,   321,  1108,
-65242,   511, 64630, 65411, 64154, 64701, 63810, 64196,
-63636, 63823, 63650, 63682, 63803, 63790, 64174, 64193,
-64686, 64805, 65384, 65506,   623,   723,  1392,  1397,
- 2068,  1849,  2504,  2009,  2577,  1776,  2305,  1346,
- 1665,   745,   741,    25, 65231, 64913, 64137, 64315,
-63254, 64001, 62626, 63903, 62501, 63991, 62765, 64285,
-63483, 64704, 64522, 65234,   170,   201,  1391,   652,
- 2375,  1058,  3063,  1309,  3233,  1366,  2904,  1248,
- 2105,   944,   992,   622, 65298,   220, 64201, 65326,
-63289, 64941, 62816, 64613, 62667, 64426, 63038, 64310,
-63663, 64293, 64528, 64458, 65463, 64755,   797, 65199,
- 1495,   105,  1982,   691,  2156,  1133,  2131,  1508,
- 1799,  1595,  1289,  1456,   657,  1183,    10,   650,
-64970,    73, 64450, 64923, 64067, 64368, 63816, 64000,
-63744, 63808, 63839, 63870, 64069, 64139, 64499, 64669,
-65069, 65322,   249,   457,   976,  1123,  1672,  1624,
- 2185,  1841,  2471,  1793,  2325,  1379,  1887,   899,
- 1087,   237,   135, 65141, 64633, 64575, 63639, 64138,
-62925, 64014, 62548, 64015, 62680, 64257, 63169, 64611,
-64070, 65082, 65202,    49,   857,   492,  1947,   900,
- 2772,  1183,  3145,  1295,  3053,  1261,  2427,  1004,
- 1451,   699,   281,   365, 64676, 65452, 63726, 65128,
-63081, 64723, 62817, 64534, 62985, 64371, 63505, 64321,
-64261, 64420, 65121, 64634,   430, 65030,  1182, 65472,
- 1684,   443,  1992,   967,  2019,  1361,  1836,  1569,
- 1431,  1527,   881,  1286,   297,   861, 65224,   257,
-64734, 65188, 64246, 64516, 63923, 64133, 63745, 63833,
-63712, 63871, 63889, 64054, 64183, 64535, 64752, 65126,
-65409,   282,   657,   933,  1405,  1444,  2070,  1743,
- 2466,  1747,  2534,  1478,  2184,   988,  1530,   425,
-  599, 65340, 65100, 64793, 64049, 64327, 63188, 64084,
-62693, 64083, 62614, 64222, 62988, 64539, 63710, 64896,
-64761, 65381,   384,   271,  1525,   679,  2414,  1002,
- 2952,  1196,  3035,  1254,  2632,  1149,  1785,   841,
-  719,   561, 65128,   139, 64138, 65301, 63384, 64909,
-62969, 64579, 62952, 64401, 63329, 64312, 63943, 64361,
-64720, 64548,     9, 64883,   777, 65384,  1388,   324,
- 1773,   864,  1959,  1260,  1903,  1541,  1666,  1591,
- 1170,  1340,   614,   978,    52,   381, 65021, 65341,
-64580, 64695, 64143, 64184, 63898, 63924, 63794, 63841,
-63863, 64028, 64078, 64388, 64495, 64938, 65099,    69,
-  263,   703,  1039,  1245,  1714,  1603,  2239,  1675,
- 2467,  1554,  2299,  1109,  1794,   599,   973,    15,
-65528, 64999, 64531, 64559, 63554, 64212, 62922, 64159,
-62630, 64263, 62815, 64497, 63391, 64871, 64272, 65234,
-65397,   167,  1011,   562,  1995,   863,  2700,  1105,
- 2957,  1149,  2784,  1134,  2138,   895,  1195,   585,
-   78,   276, 64610, 65414, 63760, 65083, 63242, 64697,
-63058, 64470, 63261, 64338, 63763, 64303, 64446, 64434,
-65204, 64685,   409, 65156,  1051,   123,  1510,   632,
- 1783,  1141,  1834,  1432,  1694,  1614,  1381,  1449,
-  896,  1106,   368,   603, 65340, 65530, 64836, 64912,
-64375, 64384, 63989, 63988, 63780, 63928, 63732, 63985,
-63873, 64350, 64227, 64808, 64764, 65441, 65469,   554,
-  710,  1096,  1482,  1479,  2077,  1615,  2428,  1510,
- 2411,  1189,  2001,   669,  1303,   132,   332, 65167,
-64870, 64700, 63924, 64413, 63180, 64223, 62805, 64312,
-62857, 64481, 63310, 64768, 64114, 65108, 65112, 65480,
-  653,   335,  1639,   673,  2373,   902,  2750,  1064,
- 2658,  1087,  2217,   966,  1381,   728,   402,   393,
-64940,    97, 64100, 65231, 63539, 64921, 63254, 64568,
-63310, 64427, 63675, 64366, 64242, 64423, 64934, 64686,
-   85, 65024,   710,    13,  1219,   500,  1577,   950,
- 1725,  1323,  1695,  1482,  1485,  1442,  1124,  1143,
-  650,   676,   109,   143, 65113, 65095, 64654, 64566,
-64208, 64174, 63917, 63998, 63769, 64060, 63823, 64297,
-64099, 64712, 64551, 65254, 65191,   312,   403,   860,
- 1157,  1237,  1859,  1471,  2245,  1420,  2361,  1223,
- 2077,   782,  1483,   314,   624, 65360, 65179, 64923,
-64257, 64593, 63463, 64393, 62991, 64362, 62903, 64521,
-63210, 64711, 63904, 65053, 64822, 65348,   283,   204,
- 1288,   527,  2038,   796,  2542,   979,  2585,  1058,
- 2258,   972,  1577,   823,   667,   499, 65276,   218,
-64389, 65385, 63821, 65035, 63447, 64721, 63449, 64467,
-63705, 64373, 64211, 64373, 64862, 64542, 65511, 64867,
-  564, 65302,  1060,   306,  1374,   749,  1549,  1193,
- 1514,  1385,  1334,  1445,  1039,  1221,   615,   821,
-  149,   324, 65248, 65278, 64812, 64791, 64463, 64347,
-64138, 64155, 64016, 64130, 63982, 64335, 64187, 64668,
-64496, 65146, 65019,   142,   125,   641,   813,  1046,
- 1471,  1245,  1975,  1306,  2183,  1117,  2097,   826,
- 1645,   390,   907, 65510,    36, 65130, 64647, 64795,
-63836, 64602, 63274, 64512, 63034, 64578, 63228, 64746,
-63753, 64949, 64566, 65243, 65532, 65518,   948,   300,
- 1773,   569,  2305,   777,  2518,   928,  2270,   948,
- 1726,   861,   849,   646, 65477,   392, 64599,    60,
-63930, 65274, 63536, 64926, 63447, 64658, 63661, 64499,
-64110, 64444, 64721, 64555, 65338, 64808,   403, 65168,
-  868,   129,  1225,   574,  1394,   975,  1439,  1267,
- 1346,  1317,  1085,  1248,   786,   883,   384,   445,
-65494, 65466, 65110, 64927, 64679, 64536, 64378, 64244,
-64106, 64196, 64011, 64320, 64076, 64602, 64324, 65045,
-64795, 65505, 65363,   495,   561,   884,  1235,  1139,
- 1856,  1227,  2169,  1094,  2185,   849,  1856,   439,
- 1184,    59,   343, 65199, 64905, 64905, 64060, 64709,
-63366, 64630, 63042, 64677, 63092, 64825, 63510, 65001,
-64272, 65253, 65203, 65461,   614,   194,  1497,   419,
- 2103,   605,  2443,   764,  2355,   816,  1884,   815,
- 1174,   694,   273,   483, 64989,   225, 64252, 65436,
-63780, 65099, 63615, 64792, 63692, 64519, 64048, 64426,
-64521, 64422, 65125, 64623,   152, 64967,   633, 65425,
- 1014,   402,  1230,   853,  1374,  1214,  1330,  1380,
- 1168,  1338,   900,  1095,   540,   604,   155,   109,
-65260, 65057, 64856, 64603, 64483, 64283, 64210, 64153,
-64004, 64271, 64029, 64537, 64151, 64964, 64573, 65468,
-65062,   413,   201,   885,   892,  1110,  1545,  1224,
- 2004,  1114,  2156,   856,  1974,   496,  1486,    82,
-  735, 65261, 65389, 64951, 64488, 64737, 63759, 64651,
-63273, 64658, 63161, 64792, 63398, 64955, 63999, 65164,
-64808, 65392,   220,    75,  1063,   339,  1800,   526,
- 2259,   700,  2345,   825,  2082,   846,  1455,   789,
-  652,   596, 65349,   353, 64563,    57, 63988, 65250,
-63689, 64910, 63661, 64618, 63903, 64445, 64311, 64440,
-64861, 64549, 65405, 64874,   382, 65296,   760,   265,
- 1036,   749,  1228,  1099,  1274,  1361,  1222,  1348,
-  996,  1159,   747,   755,   392,   208, 65535, 65237,
-65122, 64696, 64726, 64356, 64378, 64169, 64137, 64213,
-64021, 64438, 64129, 64809, 64386, 65303, 64886,   242,
-65458,   724,   604,  1034,  1295,  1161,  1803,  1166,
- 2113,   918,  2042,   645,  1671,   236,  1024, 65410,
-  181, 65088, 64854, 64845, 64016, 64716, 63470, 64694,
-63190, 64775, 63315, 64937, 63756, 65110, 64482, 65332,
-65365,     7,   688,   238,  1470,   458,  2001,   607,
- 2234,   762,  2136,   787,  1661,   765,   985,   602,
-  202,   363, 64955,    92, 64352, 65289, 63930, 64973,
-63786, 64698, 63907, 64494, 64215, 64482, 64666, 64560,
-65216, 64812,   112, 65242,   596,   116,   845,   631,
- 1117,   954,  1205,  1227,  1211,  1288,  1087,  1127,
-  856,   815,   557,   317,   174, 65356, 65324, 64894,
-64905, 64494, 64546, 64322, 64251, 64305, 64120, 64489,
-64070, 64834, 64281, 65235, 64586,   185, 65149,   582,
-  190,   926,   846,  1074,  1456,  1047,  1866,   918,
- 2001,   615,  1803,   294,  1323, 65478,   640, 65143,
-65332, 64957, 64534, 64776, 63828, 64757, 63448, 64805,
-63355, 64916, 63631, 65132, 64176, 65270, 64963, 65501,
-  257,   158,  1040,   373,  1650,   548,  2060,   655,
- 2060,   746,  1847,   737,  1231,   625,   533,   454,
-65331,   167, 64615, 65450, 64193, 65141, 63874, 64834,
-63919, 64658, 64128, 64528, 64512, 64630, 65000, 64787,
-65445, 65135,   355,     8,   649,   470,   888,   823,
- 1016,  1112,  1076,  1165,  1007,  1122,   878,   807,
-  641,   399,   377, 65429,    40, 64959, 65227, 64597,
-64875, 64343, 64552, 64336, 64370, 64452, 64227, 64802,
-64322, 65181, 64534,    90, 64941,   541, 65471,   837,
-  517,  1049,  1127,  1011,  1624,   873,  1852,   635,
- 1833,   279,  1454, 65516,   915, 65193,   130, 64992,
-64870, 64879, 64153, 64829, 63610, 64903, 63456, 64992,
-63538, 65170, 64007, 65318, 64677, 65477, 65465,   121,
-  728,   277,  1352,   424,  1812,   516,  1994,   580,
- 1816,   611,  1391,   555,   719,   413,    51,   263,
-64921, 65527, 64390, 65291, 64073, 64999, 63990, 64763,
-64142, 64630, 64469, 64610, 64863, 64738, 65360, 64986,
-  207, 65394,   577,   296,   776,   696,   959,  1027,
- 1045,  1155,  1009,  1175,   900,   944,   697,   561,
-  426,    90,   146, 65143, 65301, 64739, 64961, 64449,
-64636, 64347, 64388, 64461, 64275, 64681, 64248, 65096,
-64454, 65472, 64785,   408, 65257,   786,   297,   945,
-  834,  1033,  1420,   867,  1676,   676,  1805,   347,
- 1524,     6,  1101, 65266,   429, 65037, 65211, 64923,
-64486, 64886, 63914, 64914, 63587, 65060, 63599, 65157,
-63862, 65322, 64440, 65438, 65149,    47,   368,   219,
- 1030,   309,  1552,   451,  1858,   512,  1850,   594,
- 1565,   581,  1042,   493,   397,   350, 65305,   113,
-64720, 65429, 64288, 65129, 64106, 64883, 64079, 64718,
-64320, 64659, 64619, 64730, 65053, 64928, 65459, 65280,
-  287,   155,   588,   552,   787,   874,   946,  1051,
- 1021,  1082,   942,   946,   831,   575,   587,   172,
-  334, 65229,     0, 64823, 65181, 64537, 64834, 64385,
-64532, 64472, 64345, 64680, 64263, 65033, 64342, 65441,
-64625,   300, 65016,   705,    36,   923,   581,   977,
- 1177,   904,  1587,   652,  1785,   410,  1703,    53,
- 1331, 65312,   748, 65090,    49, 64941, 64828, 64928,
-64190, 64927, 63737, 65052, 63613, 65198, 63754, 65318,
-64196, 65467, 64803,    27,    21,   183,   693,   288,
- 1283,   367,  1651,   450,  1803,   478,  1626,   517,
- 1235,   439,   632,   335,    28,   147, 65005, 65456,
-64536, 65208, 64257, 64965, 64180, 64744, 64286, 64695,
-64576, 64678, 64891, 64914, 65277, 65179,   102,    84,
-  397,   485,   660,   847,   833,  1085,   980,  1146,
-  986,  1037,   936,   752,   725,   307,   472, 65362,
-  148, 64901, 65321, 64583, 64963, 64387, 64620, 64406,
-64390, 64580, 64288, 64931, 64338, 65333, 64514,   241,
-64891,   606, 65382,   884,   389,   964,   952,   891,
- 1382,   680,  1673,   387,  1651,   111,  1418, 65332,
-  891, 65124,   275, 64963, 65133, 64912, 64458, 64992,
-64003, 65033, 63708, 65196, 63827, 65315, 64106, 65443,
-64643,    29, 65288,   116,   390,   266,  1026,   351,
- 1416,   450,  1666,   491,  1608,   516,  1336,   506,
-  854,   386,   266,   251, 65234, 65508, 64768, 65307,
-64416, 65026, 64248, 64833, 64266, 64693, 64463, 64711,
-64770, 64840, 65111, 65122, 65469, 65475,   257,   344,
-  538,   709,   759,   937,   892,  1056,   975,   947,
-  939,   752,   813,   356,   576, 65469,   295, 65041,
-65499, 64685, 65152, 64523, 64795, 64475, 64536, 64618,
-64348, 64900, 64380, 65223, 64441,   117, 64756,   437,
-65162,   761,   118,   867,   700,   883,  1121,   718,
- 1516,   486,  1587,   223,  1461, 65471,  1076, 65233,
-  494, 65068, 65425, 64956, 64756, 65011, 64236, 65040,
-63877, 65182, 63833, 65299, 64026, 65415, 64440,     2,
-65015,   103,    91,   209,   706,   307,  1186,   343,
- 1499,   414,  1568,   405,  1400,   399,  1014,   347,
-  505,   179, 65482,    41, 65006, 65329, 64619, 65130,
-64403, 64935, 64326, 64799, 64469, 64802, 64659, 64891,
-65019, 65116, 65290, 65442,   105,   263,   362,   613,
-  613,   859,   779,   994,   907,   956,   906,   784,
-  842,   471,   666,    57,   406, 65190,   124, 64822,
-65322, 64585, 64980, 64531, 64675, 64599, 64487, 64864,
-64383, 65190, 64475,    47, 64624,   427, 65007,   711,
-65434,   904,   412,   843,   915,   740,  1277,   444,
- 1511,   171,  1439, 65428,  1199, 65176,   705, 65028,
-  147, 64950, 65077, 64963, 64526, 65080, 64144, 65164,
-63960, 65353, 64067, 65447, 64359,    31, 64832,   118,
-65403,   206,   411,   289,   922,   333,  1286,   398,
- 1466,   418,  1387,   421,  1131,   399,   677,   276,
-  176,   124, 65197, 65454, 64819, 65219, 64485, 64996,
-64413, 64827, 64401, 64766, 64622, 64824, 64872, 65003,
-65198, 65302, 65496,   124,   250,   513,   506,   775,
-  692,   948,   862,   956,   890,   800,   877,   536,
-  711,   129,   514, 65249,   235, 64900, 65448, 64606,
-65141, 64551, 64819, 64560, 64593, 64821, 64475, 65117,
-64442, 65510, 64611,   319, 64822,   652, 65261,   840,
-  141,   880,   667,   750,  1080,   521,  1375,   254,
- 1464, 65496,  1291, 65281,   922, 65062,   407, 64995,
-65332, 65001, 64797, 65061, 64287, 65197, 64053, 65319,
-64006, 65485, 64235,    14, 64626,   129, 65126,   187,
-  179,   276,   671,   299,  1116,   338,  1343,   332,
- 1391,   324,  1203,   298,   869,   214,   375,    87,
-65483, 65474, 65007, 65267, 64730, 65092, 64502, 64942,
-64480, 64851, 64599, 64890, 64782, 65020, 65064, 65258,
-65335,    60,    50,   378,   326,   688,   497,   882,
-  732,   924,   806,   839,   866,   579,   806,   254,
-  645, 65373,   445, 65015,   141, 64711, 65360, 64541,
-65046, 64576, 64720, 64704, 64543, 65034, 64419, 65395,
-64495,   223, 64685,   615, 65018,   815, 65475,   915,
-  426,   805,   933,   599,  1272,   315,  1452, 65528,
- 1371, 65276,  1095, 65050,   618, 64942,    58, 64950,
-64994, 64998, 64518, 65164, 64164, 65301, 64070, 65477,
-64160,    51, 64523,   135, 64942,   229, 65478,   283,
-  427,   330,   865,   340,  1159,   339,  1301,   347,
- 1164,   302,   967,   268,   526,   130,   154,     4,
-65252, 65341, 64929, 65160, 64714, 64969, 64601, 64883,
-64643, 64850, 64758, 64972, 64948, 65162, 65179, 65463,
-65386,   281,    97,   579,   305,   820,   545,   902,
-  730,   854,   816,   665,   872,   339,   771, 65493,
-  611, 65086,   337, 64781, 65535, 64591, 65209, 64529,
-64855, 64670, 64603, 64913, 64443, 65294, 64439,   113,
-64583,   484, 64853,   757, 65263,   916,   179,   875,
-  694,   721,  1081,   439,  1336,   165,  1356, 65391,
- 1183, 65152,   796, 64990,   303, 64919, 65276, 64958,
-64773, 65049, 64402, 65184, 64193, 65363, 64220, 65508,
-64456,    84, 64816,   198, 65294,   291,   194,   356,
-  652,   391,   958,   353,  1162,   346,  1146,   277,
-  978,   206,   680,    93,   281, 65478, 65441, 65332,
-65105, 65165, 64861, 65011, 64715, 64943, 64686, 64898,
-64743, 65036, 64928, 65177, 65093, 65484, 65330,   211,
-65513,   540,   194,   749,   396,   838,   583,   843,
-  725,   645,   749,   399,   779,    64,   604, 65238,
-  443, 64915,   142, 64739, 65379, 64621, 65072, 64740,
-64770, 64892, 64592, 65229, 64537,    14, 64588,   344,
-64811,   628, 65105,   793,    10,   791,   443,   684,
-  889,   434,  1172,   157,  1284, 65439,  1207, 65193,
-  912, 65027,   481, 64963, 65504, 64962, 65003, 65055,
-64591, 65204, 64302, 65341, 64235, 65516, 64386,   107,
-64665,   198, 65101,   301, 65511,   349,   428,   379,
-  787,   377,  1028,   326,  1116,   287,  1003,   226,
-  779,   105,   432,    26,    70, 65369, 65256, 65247,
-65011, 65098, 64831, 64965, 64788, 64985, 64789, 64993,
-64939, 65182, 65078, 65397, 65268,   136, 65431,   442,
-   66,   645,   270,   799,   436,   777,   609,   668,
-  678,   401,   739,   110,   663, 65285,   524, 64982,
-  295, 64733,    10, 64646, 65250, 64651, 64955, 64854,
-64681, 65114, 64586, 65465, 64552,   281, 64654,   572,
-64919,   797, 65239,   825,   172,   768,   590,   563,
-  969,   301,  1176,    23,  1197, 65297,  1048, 65115,
-  680, 64989,   248, 64964, 65293, 65008, 64875, 65129,
-64521, 65274, 64382, 65439, 64393,    37, 64621,   177,
-64930,   262, 65329,   370,   195,   387,   553,   391,
-  868,   347,   984,   282,  1016,   191,   817,    90,
-  589, 65520,   219, 65367, 65464, 65237, 65170, 65099,
-64971, 64990, 64873, 64974, 64825, 65011, 64907, 65159,
-64996, 65349, 65143,   100, 65293,   356, 65438,   608,
-   90,   750,   258,   779,   460,   692,   602,   475,
-  700,   187,   698, 65406,   642, 65091,   443, 64866,
-  222, 64716, 65444, 64722, 65159, 64839, 64880, 65087,
-64683, 65382, 64604,   190, 64625,   482, 64820,   732,
-65088,   816, 65507,   792,   364,   615,   827,   371,
- 1065,    97,  1225, 65364,  1127, 65133,   883, 64997,
-  485, 64907,     4, 64953, 65078, 65015, 64676, 65180,
-64431, 65337, 64342, 65519, 64470,   128, 64724,   284,
-65067,   376, 65509,   470,   299,   445,   687,   431,
-  885,   340,   976,   216,   890,   113,   685, 65482,
-  401, 65383,    82, 65202, 65331, 65113, 65104, 65013,
-64943, 65000, 64900, 65066, 64892, 65180, 64998, 65398,
-65108,    86, 65236,   354, 65392,   569,     1,   710,
-  170,   736,   371,   650,   516,   467,   655,   184,
-  702, 65437,   680, 65144,   569, 64892,   360, 64749,
-   98, 64721, 65335, 64784, 65028, 65011, 64786, 65261,
-64604,    69, 64597,   367, 64647,   629, 64926,   758,
-65224,   788,   118,   657,   549,   468,   905,   193,
- 1115, 65486,  1145, 65238,   951, 65071,   690, 64958,
-  210, 64946, 65356, 64992, 64911, 65114, 64632, 65248,
-64479, 65460, 64522,    72, 64689,   263, 64984,   379,
-65343,   491,   144,   524,   470,   486,   735,   428,
-  874,   260,   882,   153,   751, 65508,   523, 65358,
-  285, 65211, 65523, 65047, 65329, 65001, 65117, 64922,
-65021, 65017, 64955, 65106, 64977, 65340, 64999,    38,
-65096,   306, 65196,   528, 65335,   720, 65508,   741,
-  152,   699,   384,   512,   535,   260,   657, 65514,
-  684, 65203,   622, 64988,   469, 64793,   231, 64776,
-65495, 64794, 65223, 64978, 64945, 65224, 64781, 65527,
-64665,   273, 64707,   555, 64842,   714, 65116,   774,
-65463,   704,   312,   537,   697,   284,   951,    54,
- 1049, 65323,   995, 65135,   762, 65001,   437, 64930,
-   30, 64966, 65204, 65018, 64849, 65178, 64668, 65325,
-64589, 65526, 64670,   156, 64879,   349, 65127,   461,
-65457,   558,   187,   527,   496,   475,   680,   344,
-  788,   158,   732,    10,   600, 65334,   369, 65197,
-  148, 65052, 65435, 64966, 65279, 64958, 65117, 64998,
-65057, 65157, 65046, 65339, 65060,    47, 65146,   309,
-65193,   518, 65325,   704, 65430,   693,    67,   656,
-  265,   484,   408,   234,   578, 65503,   629, 65220,
-  624, 64999,   536, 64881,   348, 64809,   111, 64871,
-65398, 65012, 65118, 65243, 64891, 65505, 64751,   221,
-64682,   478, 64775,   636, 64931,   706, 65247,   646,
-   49,   500,   453,   327,   759,    75,   963, 65414,
-  982, 65193,   858, 65070,   584, 65040,   225, 65017,
-65369, 65103, 65053, 65185, 64758, 65339, 64682, 65508,
-64672,   111, 64845,   280, 65065,   401, 65345,   488,
-   92,   502,   337,   465,   588,   369,   680,   224,
-  712,    62,   602, 65407,   439, 65245,   237, 65090,
-   32, 64988, 65377, 64915, 65267, 64969, 65115, 65046,
-65118, 65293, 65077, 65498, 65087,   239, 65145,   487,
-65189,   654, 65294,   751, 65441,   686,    59,   554,
-  306,   300,   444,    43,   600, 65281,   645, 65049,
-  609, 64904,   486, 64840,   285, 64898,    16, 65013,
-65315, 65224, 65043, 65475, 64861,   199, 64762,   424,
-64767,   596, 64895,   653, 65123,   638, 65447,   488,
-  265,   301,   612,    81,   834, 65408,   936, 65228,
-  879, 65088,   685, 65028,   378, 65037,    30, 65078,
-65214, 65163, 64914, 65279, 64747, 65423, 64663,    40,
-64758,   181, 64907,   337, 65164,   441, 65436,   512,
-  165,   488,   424,   419,   600,   295,   672,   124,
-  636, 65503,   498, 65296,   341, 65163,   107, 65035,
-65501, 64973, 65321, 64977, 65226, 65049, 65154, 65228,
-65105, 65461, 65157,   157, 65128,   444, 65221,   615,
-65270,   731, 65393,   709,    19,   564,   198,   350,
-  385,    62,   519, 65321,   636, 65053,   617, 64898,
-  570, 64824,   403, 64875,   169, 64972, 65450, 65153,
-65167, 65396, 64922,   102, 64755,   343, 64654,   515,
-64730,   628, 64891,   611, 65190,   563,    26,   354,
-  400,   195,   759, 65515,   939, 65353,   991, 65183,
-  875, 65097,   628, 65074,   278, 65091, 65442, 65174,
-65081, 65242, 64818, 65385, 64668, 65528, 64682,   137,
-64781,   305, 65028,   431, 65291,   503,    60,   548,
-  327,   468,   583,   347,   720,   182,   739, 65503,
-  625, 65343,   485, 65113,   248, 65017,    72, 64919,
-65403, 64933, 65257, 65005, 65136, 65153, 65078, 65397,
-65060,   106, 65046,   373, 65116,   564, 65173,   711,
-65266,   714, 65447,   631,    61,   414,   325,   159,
-  477, 65402,   627, 65157,   689, 64934,   643, 64861,
-  557, 64860,   302, 64968,    75, 65136, 65307, 65339,
-65039,    78, 64830,   284, 64673,   516, 64691,   617,
-64791,   633, 65072,   569, 65385,   417,   257,   224,
-  615,    30,   882, 65371,   996, 65214,   974, 65102,
-  768, 65069,   483, 65089,   104, 65116, 65274, 65235,
-64946, 65281, 64729, 65451, 64644,     9, 64681,   162,
-64839,   307, 65070,   393, 65347,   474,   112,   474,
-  354,   416,   611,   301,   676,   131,   694, 65477,
-  598, 65279,   418, 65095,   241, 64970,    51, 64908,
-65400, 64941, 65260, 65055, 65123, 65271, 65062,     5,
-65020,   275, 65029,   549, 65076,   718, 65163,   751,
-65323,   732, 65511,   518,   203,   274,   427, 65503,
-  605, 65210,   698, 64986,   726, 64828,   613, 64831,
-  468, 64901,   190, 65065, 65459, 65308, 65165, 65510,
-64910,   257, 64721,   431, 64653,   575, 64695,   598,
-64880,   534, 65182,   420,     0,   254,   396,    54,
-  709, 65443,   912, 65285,   966, 65213,   870, 65129,
-  631, 65171,   336, 65158, 65488, 65276, 65191, 65300,
-64891, 65416, 64758, 65500, 64717,   102, 64795,   251,
-64960,   359, 65207,   433, 65468,   497,   211,   451,
-  450,   381,   613,   204,   665,    36,   636, 65366,
-  494, 65178,   357, 65010,   156, 64917, 65524, 64921,
-65366, 64989, 65198, 65157, 65118, 65380, 65039,   127,
-65015,   393, 65029,   590, 65088,   711, 65186,   707,
-65377,   625,    49,   386,   260,   128,   503, 65360,
-  617, 65143,   733, 64934,   683, 64865,   601, 64875,
-  374, 65010,   124, 65208, 65375, 65402, 65068,   121,
-64866,   333, 64680,   509, 64691,   590, 64751,   532,
-65013,   489, 65326,   287,   178,   147,   525, 65467,
-  795, 65331,   944, 65215,   918, 65164,   770, 65136,
-  490, 65199,   156, 65232, 65341, 65323, 65034, 65395,
-64830, 65451, 64705,    51, 64766,   147, 64829,   260,
-65082,   341, 65289,   392,    56,   426,   290,   394,
-  503,   257,   628,   140,   628, 65476,   575, 65301,
-  455, 65111,   267, 64975,   131, 64924, 65495, 64970,
-65336, 65088, 65236, 65304, 65109,    36, 65058,   327,
-65042,   549, 65019,   715, 65130,   726, 65216,   660,
-65444,   477,   121,   177,   341, 65447,   560, 65146,
-  671, 64939,   744, 64838,   679, 64829,   522, 64957,
-  291, 65143, 65533, 65379, 65240,    86, 64959,   310,
-64724,   484, 64648,   575, 64644,   531, 64829,   454,
-65095,   313, 65474,   117,   325, 65523,   655, 65364,
-  869, 65281,   968, 65228,   874, 65212,   697, 65245,
-  351, 65273,    30, 65342, 65227, 65383, 64963, 65451,
-64787, 65534, 64732,   112, 64800,   221, 64958,   327,
-65181,   375, 65439,   436,   162,   376,   419,   342,
-  569,   153,   626,    17,   615, 65354,   486, 65151,
-  379, 65041,   178, 64912,    45, 64957, 65431, 65025,
-65315, 65227, 65193, 65468, 65112,   202, 65060,   456,
-65056,   628, 65053,   702, 65135,   653, 65276,   514,
-65494,   270,   197, 65529,   389, 65267,   612, 65054,
-  701, 64920,   757, 64899,   642, 64970,   466, 65111,
-  210, 65336, 65437, 65525, 65150,   226, 64841,   396,
-64679,   508, 64627,   536, 64699,   455, 64936,   335,
-65261,   182,   117,    14,   494, 65427,   777, 65295,
-  939, 65245,   962, 65211,   791, 65223,   551, 65275,
-  169, 65306, 65399, 65357, 65065, 65429, 64856, 65469,
-64725,    63, 64740,   134, 64852,   262, 65048,   338,
-65277,   379,    21,   406,   255,   341,   487,   242,
-  573,    79,   602, 65448,   559, 65255,   426, 65094,
-  321, 64964,   119, 64940,     6, 64982, 65400, 65147,
-65281, 65347, 65179,    92, 65082,   364, 65054,   590,
-65031,   703, 65069,   722, 65182,   598, 65356,   403,
-   72,   110,   296, 65367,   506, 65113,   679, 64940,
-  731, 64886,   720, 64914,   562, 65055,   343, 65258,
-   54, 65480, 65285,   153, 64992,   344, 64735,   475,
-64645,   508, 64636,   455, 64804,   334, 65075,   189,
-65436,    63,   304, 65449,   608, 65364,   891, 65284,
-  923, 65266,   927, 65278,   670, 65283,   402, 65319,
-   28, 65361, 65278, 65401, 64975, 65431, 64834, 65526,
-64733,    57, 64806,   202, 64930,   278, 65148,   343,
-65391,   403,   118,   378,   341,   315,   525,   169,
-  572, 65515,   584, 65354,   499, 65150,   376, 65009,
-  257, 64942,    79, 64967, 65497, 65100, 65370, 65292,
-65229, 65531, 65159,   298, 65052,   511, 65042,   665,
-65024,   702, 65092,   589, 65244,   472, 65435,   171,
-  167, 65464,   373, 65197,   605, 65015,   701, 64945,
-  744, 64917,   679, 65033,   483, 65217,   259, 65410,
-65454,    92, 65168,   268, 64870,   416, 64709,   483,
-64630,   461, 64722,   335, 64932,   236, 65239,    83,
-   90, 65515,   423, 65398,   730, 65321,   856, 65289,
-  894, 65310,   758, 65289,   520, 65343,   217, 65331,
-65434, 65405, 65186, 65400, 64955, 65489, 64867,    11,
-64822,   135, 64938,   225, 65066,   302, 65281,   358,
-65479,   376,   187,   345,   330,   215,   482,   101,
-  482, 65420,   494, 65299,   411, 65093,   321, 65012,
-  208, 64978,    86, 65046, 65506, 65194, 65387, 65412,
-65261,   130, 65160,   381, 65061,   563, 65063,   649,
-65005,   618, 65133,   479, 65279,   294, 65501,     0,
-  217, 65310,   410, 65088,   605, 64985,   687, 64974,
-  702, 65029,   575, 65198,   382, 65363,   117,    57,
-65362,   189, 65062,   346, 64830,   425, 64689,   404,
-64699,   350, 64813,   230, 65067,   104, 65383,    31,
-  226, 65443,   519, 65403,   773, 65358,   845, 65355,
-  834, 65381,   642, 65362,   399, 65375,    83, 65372,
-65349, 65378, 65102, 65398, 64917, 65462, 64857,    28,
-64863,   130, 65005,   247, 65158,   328, 65379,   389,
-   56,   387,   270,   322,   410,   166,   493,     2,
-  489, 65337,   454, 65155,   374, 65033,   264, 64953,
-  127, 65028,    26, 65125, 65439, 65337, 65322,    27,
-65224,   286, 65116,   494, 65084,   611, 65050,   628,
-65095,   526, 65187,   369, 65396,   116,    74, 65427,
-  283, 65191,   499, 65054,   622, 64998,   702, 65012,
-  643, 65145,   521, 65295,   263, 65491,    38,   117,
-65238,   269, 64984,   369, 64768,   409, 64710,   355,
-64763,   265, 64917,   167, 65202,    39, 65529, 65524,
-  343, 65406,   601, 65386,   772, 65353,   797, 65363,
-  729, 65381,   512, 65356,   249, 65398, 65493, 65373,
-65223, 65427, 65031, 65433, 64874,     0, 64873,    76,
-64929,   190, 65109,   273, 65274,   342, 65506,   358,
-  175,   345,   359,   215,   460,    63,   477, 65435,
-  458, 65244,   385, 65109,   303, 64998,   181, 64996,
-   51, 65101, 65513, 65243, 65366, 65469, 65294,   179,
-65167,   395, 65132,   576, 65086,   607, 65099,   551,
-65169,   402, 65324,   186, 65519, 65469,   204, 65263,
-  375, 65068,   548, 65014,   629, 65010,   645, 65104,
-  547, 65278,   363, 65450,   129,   101, 65383,   230,
-65106,   339, 64874,   383, 64743,   358, 64744,   266,
-64856,   170, 65066,    49, 65413, 65525,   171, 65446,
-  545, 65413,   697, 65376,   843, 65399,   770, 65390,
-  648, 65385,   356, 65391,   113, 65366, 65331, 65385,
-65115, 65404, 64939, 65480, 64849,    33, 64907,   150,
-65006,   245, 65199,   351, 65410,   375,    79,   381,
-  293,   286,   410,   142,   485, 65496,   468, 65323,
-  402, 65135,   326, 65039,   210, 64993,    91, 65065,
-    1, 65198, 65400, 65409, 65321,    94, 65203,   332,
-65145,   506, 65095,   576, 65082,   567, 65132,   428,
-65247,   266, 65436,    31,    84, 65342,   307, 65165,
-  473, 65041,   591, 65030,   661, 65085,   586, 65211,
-  488, 65382,   250,    30, 65532,   167, 65262,   301,
-64981,   356, 64841,   352, 64719,   307, 64826,   184,
-64941,   106, 65259, 65520,    13, 65492,   371, 65397,
-  614, 65407,   779, 65383,   806, 65415,   705, 65409,
-  513, 65410,   232, 65421, 65487, 65393, 65225, 65431,
-64994, 65449, 64885,     1, 64844,    62, 64931,   185,
-65074,   252, 65289,   326, 65483,   331,   187,   311,
-  343,   186,   451,    58,   498, 65409,   440, 65254,
-  402, 65119,   273, 65043,   196, 65067,    38, 65176,
-65486, 65332, 65358,    32, 65249,   236, 65184,   434,
-65092,   557, 65096,   549, 65089,   480, 65183,   296,
-65335,    76, 65508, 65414,   194, 65184,   372, 65088,
-  522, 65023,   626, 65084,   617, 65196,   557, 65352,
-  360,     0,   127,   148, 65384,   297, 65129,   334,
-64885,   377, 64810,   278, 64748,   215, 64908,    68,
-65092, 65533, 65401, 65444,   179, 65427,   461, 65378,
-  672, 65406,   748, 65413,   730, 65442,   596, 65429,
-  375, 65429,   126, 65408, 65392, 65415, 65178, 65441,
-65009, 65502, 64914,    38, 64951,   141, 65026,   226,
-65188,   305, 65382,   314,    26,   307,   221,   211,
-  359,    99,   427, 65462,   438, 65313,   404, 65160,
-  340, 65086,   260, 65074,   154, 65163,    37, 65305,
-65459, 65508, 65352,   192, 65226,   362, 65143,   529,
-65062,   520, 65077,   489, 65089,   325, 65242,   112,
-65392, 65465,    74, 65255,   273, 65130,   439, 65072,
-  569, 65087,   631, 65208,   603, 65324,   483, 65518,
-  274,    99,    16,   259, 65297,   302, 65028,   335,
-64857,   283, 64766,   200, 64801,   100, 64956,    15,
-65201, 65474, 65522, 65446,   302, 65432,   559, 65417,
-  723, 65459,   771, 65453,   707, 65472,   532, 65446,
-  292, 65427, 65530, 65396, 65300, 65417, 65076, 65447,
-64938, 65521, 64894,    69, 64943,   174, 65068,   244,
-65262,   300, 65441,   299,   142,   245,   284,   163,
-  429, 65503,   458, 65396,   442, 65185,   418, 65132,
-  310, 65060,   221, 65117,    96, 65234, 65512, 65393,
-65410,    99, 65296,   268, 65176,   459, 65131,   538,
-65060,   501, 65091,   418, 65170,   204, 65288,    29,
-65512, 65359,   143, 65187,   353, 65110,   511, 65071,
-  598, 65163,   648, 65269,   544, 65437,   397,    50,
-  159,   167, 65402,   299, 65166,   300, 64892,   312,
-64802,   205, 64741,   148, 64873,    27, 65049, 65498,
-65383, 65446,   129, 65423,   454, 65434,   634, 65457,
-  756, 65471,   731, 65486,   598, 65480,   402, 65440,
-  131, 65426, 65428, 65398, 65180, 65429, 65044, 65484,
-64924,    19, 64959,   135, 65038,   200, 65176,   307,
-65374,   296,    16,   296,   202,   218,   326,    78,
-  404, 65467,   435, 65304,   393, 65170,   353, 65108,
-  256, 65086,   159, 65184,    43, 65312, 65472, 65517,
-65358,   182, 65244,   352, 65153,   483, 65087,   507,
-65074,   436, 65118,   292, 65231,    99, 65409, 65438,
-   71, 65285,   269, 65119,   453, 65119,   572, 65104,
-  634, 65236,   592, 65339,   479, 65511,   250,   104,
-   14,   214, 65273,   300, 65029,   282, 64854,   270,
-64777,   171, 64833,    90, 64979,    12, 65252, 65476,
-   10, 65451,   310, 65432,   571, 65443,   712, 65451,
-  748, 65488,   664, 65463,   490, 65481,   242, 65434,
-65514, 65442, 65250, 65436, 65081, 65494, 64914,     2,
-64929,    81, 64926,   175, 65107,   214, 65243,   285,
-65488,   259,   111,   216,   310,   131,   398, 65503,
-  450, 65401,   425, 65236,   379, 65170,   296, 65118,
-  205, 65175,    75, 65262, 65513, 65458, 65401,    72,
-65307,   297, 65208,   402, 65134,   498, 65100,   455,
-65105,   356, 65191,   188, 65313, 65528, 65499, 65368,
-  162, 65206,   347, 65142,   508, 65128,   599, 65187,
-  620, 65320,   548, 65450,   373,    81,   134,   165,
-65407,   275, 65152,   279, 64923,   262, 64801,   211,
-64772,    83, 64878,    27, 65090, 65471, 65382, 65413,
-  146, 65409,   447, 65392,   647, 65430,   758, 65453,
-  729, 65473,   612, 65474,   393, 65485,   127, 65447,
-65407, 65474, 65156, 65494, 65030,     0, 64918,    73,
-64962,   137, 65029,   210, 65191,   256, 65381,   262,
-   41,   221,   200,   133,   336,    30,   416, 65406,
-  420, 65302,   388, 65162,   342, 65163,   245, 65166,
-  163, 65281,    30, 65402, 65461,    68, 65363,   214,
-65254,   390, 65162,   437, 65112,   458, 65084,   366,
-65154,   202, 65250,    50, 65409, 65369,    64, 65273,
-  252, 65119,   443, 65143,   543, 65142,   615, 65277,
-  568, 65418,   450,     8,   241,   165, 65515,   237,
-65274,   307, 65037,   279, 64876,   231, 64799,   150,
-64858,    46, 65006, 65522, 65281, 65451,     1, 65418,
-  310, 65430,   529, 65431,   694, 65460,   705, 65482,
-  649, 65484,   462, 65488,   247, 65473, 65507, 65460,
-65298, 65483, 65070, 65507, 65021,    29, 64931,    64,
-65044,   145, 65114,   186, 65312,   201, 65492,   215,
-  106,   136,   282,    69,   325, 65488,   412, 65353,
-  355, 65259,   343, 65201,   261, 65195,   192, 65252,
-   97, 65375, 65529, 65500, 65438,   160, 65338,   269,
-65249,   403, 65159,   387, 65138,   379, 65097,   234,
-65194,   100, 65300, 65460, 65468, 65340,   117, 65220,
-  295, 65200,   471, 65199,   559, 65299,   587, 65403,
-  534,     9,   360,   114,   153,   213, 65404,   262,
-65168,   248, 64943,   197, 64841,   119, 64800,    24,
-64927, 65500, 65125, 65427, 65420, 65410,   166, 65400,
-  416, 65430,   636, 65471,   706, 65496,   705, 65533,
-  549, 65510,   375, 65533,    99, 65486, 65412, 65509,
-65178, 65517, 65036, 65533, 64977,    53, 65005,    95,
-65089,   143, 65232,   175, 65404,   183,    54,   142,
-  188,    89,   289, 65532,   362, 65422,   352, 65353,
-  344, 65248,   287, 65275,   224, 65274,   155, 65384,
-   56, 65482, 65498,    80, 65393,   219, 65310,   292,
-65198,   350, 65156,   303, 65103,   225, 65150,    97,
-65253, 65502, 65368, 65353,    44, 65286,   181, 65187,
-  407, 65247,   513, 65246,   598, 65385,   564, 65468,
-  470,    71,   258,   150,    28,   233, 65299,   232,
-65069,   221, 64902,   152, 64830,    82, 64882,     1,
-65014, 65479, 65277, 65442,    15, 65432,   277, 65436,
-  517, 65484,   639, 65504,   675, 65531,   593,     3,
-  423, 65528,   193, 65529, 65503, 65510, 65256, 65523,
-65116, 65514, 64981,    25, 65013,    37, 65050,   100,
-65194,   127, 65346,   148, 65524,   175,   146,    99,
-  258,    52,   329, 65495,   357, 65394,   326, 65319,
-  305, 65259,   233, 65259,   172, 65316,    89, 65401,
-    0,     7, 65456,   114, 65350,   247, 65292,   306,
-65188,   319, 65156,   276, 65150,   178, 65211,    60,
-65328, 65483, 65489, 65364,   106, 65301,   304, 65282,
-  447, 65281,   555, 65366,   554, 65444,   500,    15,
-  332,   106,   108,   169, 65404,   200, 65155,   183,
-64966,   142, 64862,    52, 64859, 65530, 64978, 65475,
-65171, 65448, 65465, 65428,   178, 65453,   424, 65495,
-  591, 65509,   658,    18,   620, 65527,   490, 65535,
-  291, 65516,    59, 65472, 65376, 65486, 65184, 65465,
-65068, 65525, 65020,     4, 65071,    52, 65134,   101,
-65310,   147, 65447,   160,    85,   148,   187,    93,
-  287,    28,   315, 65469,   326, 65404,   303, 65308,
-  246, 65318,   200, 65319,   110, 65404,    66, 65487,
-65486,    67, 65422,   164, 65303,   255, 65245,   260,
-65158,   236, 65144,   166, 65164,    60, 65270, 65504,
-65412, 65391,    19, 65336,   223, 65292,   353, 65323,
-  519, 65343,   540, 65438,   525, 65509,   425,    70,
-  212,   116,    10,   171, 65280,   150, 65082,   139,
-64933,    54, 64886,    24, 64921, 65493, 65098, 65478,
-65308, 65462,    67, 65468,   276, 65506,   504,     5,
-  601,     5,   634,    40,   535, 65518,   389,    23,
-  140, 65485, 65502, 65511, 65259, 65475, 65138, 65486,
-65045,    11, 65054, 65532, 65106,    80, 65228,    83,
-65364,   131,     1,   136,   113,    91,   243,    47,
-  264, 65509,   331, 65443,   299, 65380,   285, 65317,
-  217, 65341,   176, 65361,    81, 65472,    29, 65530,
-65460,   108, 65367,   192, 65293,   217, 65201,   253,
-65152,   159, 65149,   123, 65210, 65534, 65335, 65469,
-65483, 65384,   108, 65342,   293, 65349,   429, 65373,
-  548, 65435,   527, 65508,   485,    43,   325,   115,
-   96,   157, 65438,   150, 65165,   136, 65026,    77,
-64903,    27, 64927, 65496, 65004, 65474, 65220, 65441,
-65435, 65463,   179, 65474,   357, 65528,   539,     2,
-  590,    37,   583,     5,   437,    10,   295, 65497,
-   44, 65495, 65422, 65460, 65225, 65474, 65117, 65492,
-65063,     1, 65096,    28, 65175,   101, 65275,   115,
-65439,   171,    18,   122,   159,   110,   209,    26,
-  279, 65495,   271, 65430,   303, 65354,   243, 65343,
-  211, 65352,   149, 65423,    71, 65491,     0,    70,
-65430,   120, 65336,   205, 65250,   214, 65174,   176,
-65142,   137, 65173,    25, 65249, 65496, 65408, 65410,
-   15, 65365,   192, 65337,   375, 65372,   484, 65399,
-  565, 65486,   496,     8,   410,    81,   225,   125,
-65530,   139, 65328,   120, 65069,    86, 64989,    19,
-64891, 65522, 64974, 65483, 65108, 65460, 65331, 65473,
-   43, 65488,   273, 65528,   439,    20,   572,    30,
-  567,    60,   505,     6,   343,    19,   149, 65501,
-65502, 65523, 65307, 65477, 65182, 65529, 65100, 65494,
-65106,    34, 65160,    27, 65268,    83, 65368,    94,
-65531,    88,    88,    59,   187,    20,   236, 65496,
-  266, 65461,   269, 65392,   260, 65389,   217, 65399,
-  161, 65428,   122, 65510,    35,    18, 65493,   105,
-65416,   159, 65287,   167, 65235,   158, 65161,   119,
-65151,    45, 65214, 65525, 65307, 65441, 65472, 65412,
-   98, 65361,   279, 65396,   421, 65400,   521, 65478,
-  508, 65525,   454,    66,   284,   111,    89,   143,
-65397,   129, 65198,   122, 65021,    38, 64966,    21,
-64957, 65476, 65081, 65466, 65269, 65441, 65500, 65447,
-  195, 65472,   366, 65505,   518,    10,   555,    16,
-  506,    27,   400,    10,   189,    14,    35, 65531,
-65372, 65523, 65245, 65521, 65143, 65505, 65124,    13,
-65164, 65528, 65234,    52, 65344,    39, 65464,    94,
-   49,    55,   123,    50,   209, 65535,   220, 65508,
-  258, 65458,   251, 65423,   213, 65434,   195, 65428,
-  119, 65505,    73,     1, 65520,    70, 65439,   133,
-65336,   135, 65274,   162, 65184,    91, 65197,    56,
-65195, 65529, 65309, 65448, 65421, 65403,    49, 65359,
-  182, 65372,   377, 65402,   437, 65457,   515, 65517,
-  446,    45,   346,   122,   169,   136, 65506,   165,
-65280,   113, 65120,    79, 64986,     7, 64989, 65496,
-65011, 65445, 65201, 65437, 65373, 65420,    80, 65469,
-  266, 65475,   419,     7,   514,    31,   509,    38,
-  420,    61,   285,    31,    92,    31, 65473,    30,
-65307, 65517, 65199,    18, 65157, 65528, 65147,    18,
-65237,    28, 65298,    36, 65449,    49, 65529,    43,
-  110,    18,   161, 65527,   222, 65489,   231, 65452,
-  243, 65420,   225, 65422,   193, 65425,   164, 65484,
-   96,     1,    28,    60, 65483,   126, 65393,   156,
-65306,   156, 65235,   142, 65182,    64, 65199,    21,
-65251, 65476, 65376, 65419, 65510, 65375,   122, 65364,
-  290, 65381,   398, 65438,   497, 65486,   452,    19,
-  403,    93,   217,   132,    50,   172, 65365,   155,
-65182,   118, 65057,    68, 64990, 65531, 65041, 65493,
-65143, 65434, 65341, 65429,     9, 65413,   200, 65452,
-  385, 65474,   462, 65529,   495, 65529,   428,    40,
-  305,     8,   144,    55, 65517,    12, 65363,    30,
-65259,    17, 65181,     4, 65193,    18, 65210,    13,
-65291,    20, 65389,    39, 65477,     8,    49,    19,
-   97, 65525,   175, 65507,   183, 65471,   229, 65454,
-  216, 65452,   220, 65435,   169, 65500,   130, 65525,
-   58,    47, 65507,   112, 65449,   131, 65317,   167,
-65276,   131, 65204,   102, 65202,    33, 65248, 65511,
-65344, 65461, 65490, 65381,    69, 65385,   242, 65343,
-  352, 65423,   437, 65437,   459, 65535,   372,    34,
-  290,   109,    78,   142, 65472,   149, 65251,   130,
-65140,    84, 65044,    36, 65056, 65513, 65116, 65484,
-65276, 65436, 65455, 65449,   121, 65445,   271, 65473,
-  404, 65490,   452, 65530,   437, 65533,   359,    26,
-  202,    26,    74,    47, 65434,    31, 65332,    48,
-65218,    15, 65200,    22, 65227,    17, 65259,     9,
-65373,    18, 65435,     2,    11,     1,    92,     0,
-  135, 65508,   195, 65496,   181, 65482,   232, 65454,
-  190, 65481,   192, 65474,   139, 65527,    98,    24,
-   33,    57, 65480,    97, 65414,   102, 65299,   106,
-65270,    69, 65186,    48, 65224, 65521, 65275, 65507,
-65380, 65443,     8, 65439,   118, 65418,   296, 65443,
-  399, 65458,   457, 65520,   423, 65530,   344,    68,
-  172,    80,    16,   123, 65342,   107, 65178,    78,
-65076,    52, 65030, 65532, 65094, 65512, 65203, 65482,
-65379, 65451,    57, 65468,   213, 65457,   365, 65499,
-  434, 65506,   452, 65528,   385,     4,   256,     9,
-   88,    24, 65511,    35, 65342,    21, 65284,    45,
-65185,    10, 65226,    22, 65252,     8, 65339,    12,
-65416,     7, 65513,     3,    50, 65533,   123, 65528,
-  147, 65526,   180, 65499,   197, 65491,   202, 65480,
-  187, 65483,   154, 65496,   136,     9,    47,    14,
-   20,    76, 65406,    66, 65379,    94, 65249,    70,
-65252,    69, 65193,    22, 65271, 65533, 65356, 65495,
-65487, 65468,   101, 65427,   220, 65459,   358, 65420,
-  423, 65498,   424, 65494,   337,    17,   233,    60,
-   30,    76, 65430,   112, 65221,    91, 65118,    61,
-65063,    40, 65096, 65527, 65167, 65508, 65335, 65479,
-65504, 65468,   149, 65480,   298, 65487,   376, 65523,
-  423, 65530,   379,    14,   298,    38,   155,    22,
-   24,    58, 65439,    10, 65321,    37, 65264, 65531,
-65227,    12, 65264, 65519, 65324, 65529, 65376, 65518,
-65498, 65535,     2,     1,   101, 65530,   136,     3,
-  141, 65527,   204, 65511,   159, 65505,   206, 65508,
-  142, 65502,   131, 65533,    81,     2,    13,    23,
-65482,    55, 65387,    34, 65317,    42, 65262,    30,
-65222,    10, 65261,     5, 65308, 65501, 65454, 65498,
-   20, 65474,   162, 65479,   288, 65487,   390, 65495,
-  406,     2,   386,     8,   259,    53,   133,    62,
-65484,    88, 65325,    73, 65169,    44, 65104,    21,
-65081, 65505, 65163, 65516, 65287, 65454, 65459, 65484,
-  102, 65456,   251, 65503,   371, 65503,   401,    10,
-  416,     3,   288,    37,   211,    37,    27,    56,
-65467,    45, 65338,    26, 65258,    22, 65241, 65527,
-65241, 65521, 65309, 65496, 65363, 65489, 65450, 65505,
-65507, 65502,    53, 65529,    89, 65531,   138,     0,
-  152,    14,   190, 65533,   178,    14,   185, 65529,
-  148,    26,   107,    17,    71,    37, 65508,    34,
-65465,    23, 65338,    19, 65308,     5, 65237, 65532,
-65270, 65512, 65277, 65512, 65420, 65493, 65508, 65496,
-  120, 65495,   235, 65502,   348, 65512,   398,     1,
-  402,     2,   291,    38,   184,    47,    12,    73,
-65394,    62, 65244,    66, 65139,    17, 65099,    10,
-65144, 65497, 65219, 65470, 65386, 65468, 65533, 65442,
-  160, 65477,   286, 65482,   358, 65529,   381,     7,
-  331,    47,   247,    58,   114,    84, 65531,    99,
-65417,    67, 65329,    64, 65273,    13, 65264,     0,
-65281, 65500, 65365, 65479, 65411, 65468, 65507, 65472,
-   24, 65483,    97, 65505,   137, 65523,   159,     3,
-  178,    21,   170,    21,   175,    29,   128,    38,
-  100,    23,    43,    35, 65529,    13, 65466,    11,
-65380, 65531, 65334,     3, 65282, 65509, 65278, 65526,
-65278, 65507, 65368, 65512, 65450, 65502,    52, 65493,
-  144, 65508,   259, 65511,   339, 65527,   355,     0,
-  328,    19,   230,    43,    81,    67, 65506,    57,
-65343,    58, 65219,    34, 65175,     2, 65137, 65516,
-65235, 65480, 65316, 65470, 65479, 65465,    80, 65463,
-  232, 65489,   314, 65513,   364,    13,   336,    18,
-  281,    70,   150,    64,    38,    94, 65452,    71,
-65358,    37, 65302,    20, 65277, 65516, 65293, 65503,
-65348, 65450, 65398, 65479, 65483, 65450, 65532, 65505,
-   50, 65505,   105,    12,   105,     2,   149,    62,
-  134,    28,   146,    53,   146,    33,    99,    24,
-   92,    34,    28, 65521, 65517,    16, 65440, 65514,
-65387,     5, 65303, 65505, 65300, 65533, 65280, 65523,
-65337, 65532, 65413,     1,     9, 65521,    86, 65526,
-  242,     6,   283, 65529,   367,     7,   309, 65531,
-  259,    32,   116,    21, 65530,    51, 65382,    34,
-65270,    16, 65170,    20, 65185, 65517, 65183, 65507,
-65319, 65478, 65399, 65485,    46, 65470,   150, 65499,
-  271, 65501,   323, 65535,   318,    31,   286,    40,
-  182,    85,    86,    65, 65502,    85, 65418,    61,
-65347,     0, 65309,     4, 65313, 65480, 65352, 65467,
-65399, 65448, 65472, 65437, 65509, 65472,    50, 65509,
-   62, 65521,   128,    38,   111,    37,   153,    78,
-  119,    63,   155,    46,    90,    40,    91,    11,
-   29,     8, 65524, 65510, 65477, 65504, 65406, 65491,
-65340, 65503, 65321, 65505, 65279, 65522, 65348, 65532,
-65362, 65535, 65504,     4,    22, 65533,   170,     8,
-  235, 65534,   307,     1,   316,     3,   271,     2,
-  181,    26,    52,    33, 65474,    25, 65339,    31,
-65256,    13, 65203, 65531, 65214, 65528, 65277, 65487,
-65369, 65489, 65521, 65488,    83, 65488,   238, 65498,
-  249, 65516,   341,     5,   246,    29,   239,    48,
-   90,    69,    16,    68, 65439,    71, 65370,    33,
-65329,    19, 65310, 65510, 65347, 65499, 65377, 65459,
-65444, 65455, 65501, 65464,    14, 65482,    62, 65514,
-   89,    12,   109,    23,   133,    68,   111,    61,
-  135,    72,    97,    56,   104,    46,    49,     6,
-   19,     8, 65491, 65501, 65461, 65494, 65376, 65481,
-65357, 65491, 65314, 65503, 65342, 65524, 65380, 65533,
-65475,    21,    10, 65530,   139,    29,   201, 65523,
-  287,    12,   293,     6,   268, 65526,   199,    35,
-   71,     3, 65497,    44, 65369,    19, 65279,     9,
-65227,    11, 65218, 65511, 65271, 65498, 65355, 65469,
-65478, 65488,    58, 65474,   175, 65498,   247, 65516,
-  289,     1,   262,    37,   216,    64,   125,    84,
-   26,    98, 65486,    89, 65392,    58, 65362,    20,
-65333, 65520, 65347, 65466, 65388, 65454, 65436, 65419,
-65493, 65439,     8, 65456,    55, 65500,    85,    14,
-  120,    17,   115,    84,   128,    65,   120,    78,
-  101,    70,    81,    15,    30,    39,    16, 65512,
-65482, 65512, 65470, 65481, 65381, 65492, 65382, 65470,
-65330, 65512, 65364, 65475, 65383,    11, 65459, 65521,
-    9,    10,    88,     6,   170, 65533,   243,    34,
-  249,     4,   247,    38,   200,    30,    86,    50,
-   12,    52, 65403,    43, 65351,    30, 65253,     7,
-65269, 65516, 65272, 65473, 65351, 65464, 65456, 65442,
-   23, 65463,   140, 65461,   218, 65509,   257, 65520,
-  268,    39,   212,    70,   151,    99,    35,   112,
-65522,   118, 65399,    78, 65378,    53, 65334, 65530,
-65341, 65480, 65383, 65443, 65415, 65409, 65482, 65409,
-65534, 65416,    42, 65473,    78, 65498,   104,    24,
-  107,    52,   112,    88,    99,   104,    87,    95,
-   58,    97,    51,    57,     2,    34, 65521,     6,
-65474, 65508, 65430, 65484, 65416, 65478, 65365, 65464,
-65391, 65485, 65391, 65485, 65460, 65501, 65523, 65528,
-   53,     2,   128,     0,   198,    10,   228,    32,
-  218,    25,   198,    65,   103,    53,    35,    65,
-65462,    80, 65377,    19, 65307,    43, 65286, 65495,
-65284, 65514, 65356, 65434, 65424, 65442, 65534, 65419,
-   97, 65452,   156, 65463,   237, 65513,   218,     4,
-  208,    62,   143,   106,    65,   124, 65529,   115,
-65462,   115, 65400,    62, 65375,    18, 65365, 65491,
-65403, 65456, 65413, 65406, 65489, 65428, 65510, 65397,
-   39, 65472,    63, 65484,   103,    23,    95,    50,
-  106,    77,   109,   107,    68,    88,    85,    79,
-   25,    50,    20,    26, 65514, 65535, 65481, 65508,
-65448, 65487, 65414, 65465, 65400, 65478, 65384, 65475,
-65415, 65495, 65451, 65496, 65521, 65528,    34, 65532,
-  114,     3,   159,     9,   196,    31,   195,    39,
-  167,    55,    99,    64,    49,    63, 65469,    72,
-65420,    33, 65339,    30, 65324, 65511, 65312, 65503,
-65363, 65448, 65422, 65443, 65507, 65422,    76, 65450,
-  139, 65465,   215, 65510,   220,    13,   207,    51,
-  147,   109,    82,   106,     0,   147, 65468,    88,
-65405,    90, 65370,     9, 65361, 65513, 65385, 65453,
-65414, 65423, 65478, 65397, 65517, 65410,    34, 65432,
-   60, 65488,   111, 65527,    98,    47,   106,    73,
-   96,   117,    58,    95,    64,   125,    15,    63,
-   18,    64, 65508,     3, 65504, 65528, 65461, 65491,
-65439, 65468, 65427, 65474, 65401, 65448, 65424, 65496,
-65446, 65469, 65511, 65527,    15, 65519,   114,    11,
-  121,     9,   205,    32,   182,    46,   178,    50,
-  118,    70,    49,    51, 65497,    71, 65427,    40,
-65349,    23, 65309, 65530, 65324, 65486, 65332, 65461,
-65429, 65428, 65481, 65431,    48, 65422,   130, 65479,
-  187, 65479,   224,    32,   191,    21,   164,   137,
-   80,   102,    31,   167, 65476,   101, 65446,   103,
-65378,    19, 65391,     5, 65386, 65440, 65408, 65444,
-65471, 65383, 65503, 65408,     2, 65420,    52, 65470,
-   53, 65511,   123,    29,    85,    59,   118,    96,
-   94,   116,    73,    96,    66,    90,    12,    45,
-    6,    20, 65496, 65521, 65475, 65499, 65426, 65468,
-65400, 65465, 65405, 65453, 65395, 65480, 65442, 65474,
-65496, 65510,     0, 65510,   101, 65533,   124,     7,
-  187,    19,   177,    37,   177,    68,   115,    62,
-   52,   105, 65503,    67, 65435,    81, 65360,    29,
-65344,    10, 65311, 65493, 65368, 65467, 65398, 65429,
-65497, 65431,    16, 65412,   122, 65464,   159, 65472,
-  210,    13,   202,    35,   157,    83,   116,   124,
-   27,   134, 65526,   129, 65457,    96, 65409,    43,
-65400, 65527, 65375, 65482, 65424, 65413, 65429, 65415,
-65484, 65370, 65517, 65435,    18, 65435,    54, 65511,
-   86,    12,   105,    64,   106,    85,   118,   116,
-   78,   100,    85,    95,    30,    78,     9,    21,
-65502,    13, 65470, 65510, 65420, 65489, 65404, 65463,
-65381, 65456, 65393, 65469, 65435, 65463, 65468, 65493,
-   23, 65502,    67, 65528,   153,     5,   188,    28,
-  198,    22,   186,    75,   148,    69,    68,   103,
-    4,    81, 65442,    66, 65389,    58, 65320, 65526,
-65331, 65521, 65324, 65447, 65399, 65425, 65447, 65411,
-    4, 65402,    72, 65431,   163, 65468,   180, 65524,
-  215,    25,   163,    91,   138,   113,    63,   175,
-65534,   132, 65501,   150, 65413,    52, 65406,    37,
-65378, 65491, 65387, 65437, 65412, 65410, 65444, 65380,
-65489, 65410,     1, 65423,    35, 65486,    96, 65528,
-   99,    37,   151,    92,   126,    82,   141,   126,
-   95,   100,    67,    87,    12,    56, 65512,    17,
-65460, 65532, 65410, 65491, 65396, 65477, 65360, 65453,
-65400, 65451, 65409, 65462, 65466, 65470,    10, 65480,
-   57, 65515,   133, 65514,   169,    13,   194,    19,
-  175,    50,   157,    84,    61,    87,    31,   110,
-65452,    87, 65414,    70, 65349,    22, 65337, 65527,
-65354, 65460, 65374, 65450, 65443, 65389, 65506, 65433,
-   57, 65397,   106, 65484,   178, 65494,   184,    39,
-  176,    59,   144,   118,    89,   143,    19,   146,
-65526,   126, 65451,    81, 65429,    23, 65397, 65513,
-65394, 65454, 65425, 65407, 65426, 65403, 65484, 65391,
-65506, 65427,    10, 65468,    63, 65518,    90,    31,
-  111,    63,   133,    88,   121,   101,   105,   108,
-   67,    87,    23,    73, 65518,    27, 65470,     7,
-65434, 65515, 65375, 65484, 65385, 65473, 65366, 65466,
-65416, 65457, 65454, 65477, 65522, 65488,    56, 65500,
-  133, 65527,   168,     6,   205,    13,   178,    48,
-  163,    54,    85,    98,    29,    85, 65479,    96,
-65410,    72, 65364,    28, 65346, 65533, 65347, 65480,
-65400, 65434, 65441, 65409, 65512, 65393,    43, 65409,
-  116, 65431,   151, 65502,   198, 65524,   161,    68,
-  140,    91,    91,   153,    19,   141, 65527,   163,
-65449,    92, 65431,    78, 65402, 65521, 65392, 65494,
-65413, 65410, 65434, 65399, 65466, 65372, 65511, 65407,
-    5, 65431,    56, 65493,    88,    18,   123,    45,
-  132,   109,   130,    92,   110,   128,    90,   101,
-   31,    86, 65534,    48, 65488,    15, 65428, 65517,
-65405, 65501, 65369, 65456, 65384, 65462, 65402, 65439,
-65446, 65450, 65519, 65465,    29, 65478,   120, 65515,
-  160,     0,   182,     7,   188,    45,   141,    64,
-   94,    92,    26,   113, 65495,   109, 65415,    93,
-65370,    79, 65352,     6, 65348, 65514, 65393, 65455,
-65425, 65410, 65510, 65390,    25, 65390,    95, 65409,
-  150, 65462,   156, 65515,   179,    29,   137,    93,
-   93,   130,    45,   164, 65520,   159, 65501,   138,
-65440,    88, 65427,    21, 65410, 65508, 65409, 65437,
-65447, 65392, 65443, 65377, 65515, 65381, 65513, 65417,
-   44, 65459,    75, 65512,   101,    37,   140,    52,
-  118,   109,   135,    93,    87,   117,    55,    89,
-    3,    79, 65487,    21, 65444,    22, 65390, 65506,
-65376, 65504, 65369, 65457, 65404, 65457, 65427, 65447,
-65507, 65463,    25, 65466,   107, 65491,   163, 65518,
-  190,     5,   193,    32,   162,    53,   106,    87,
-   38,    99, 65498,   119, 65448,    95, 65361,    71,
-65372,    34, 65341,     0, 65396, 65461, 65427, 65447,
-65502, 65381,     3, 65390,    89, 65406,   127, 65425,
-  154, 65489,   169,    13,   126,    50,   118,   125,
-   37,   132,    20,   169, 65482,   142, 65465,   120,
-65420,    60, 65413, 65528, 65412, 65492, 65415, 65417,
-65446, 65394, 65486, 65394, 65506, 65385,    29, 65457,
-   67, 65467,   101,    21,   137,    37,   157,    87,
-  119,   109,   139,   116,    53,   115,    19,    95,
-65503,    49, 65430,    17, 65397, 65530, 65360, 65495,
-65344, 65470, 65392, 65445, 65401, 65435, 65514, 65450,
-    9, 65461,   115, 65475,   162, 65520,   211, 65530,
-  190,    33,   200,    40,   101,    79,    50,    91,
-65507,   112, 65426,    99, 65378,    73, 65340,    56,
-65334, 65531, 65370, 65518, 65420, 65440, 65476, 65430,
-   11, 65403,    74, 65399,   119, 65441,   178, 65463,
-  156, 65526,   161,    31,   114,    87,    64,   125,
-   18,   151, 65517,   157, 65460,   109, 65458,    94,
-65404,    11, 65423, 65513, 65410, 65448, 65442, 65411,
-65453, 65385, 65504, 65396, 65534, 65415,    41, 65457,
-   98, 65509,   126,    14,   152,    58,   149,    99,
-  131,    98,    78,   125,    36,    96, 65511,    86,
-65445,    38, 65413,    15, 65343, 65507, 65365, 65498,
-65357, 65454, 65415, 65455, 65470, 65445,     3, 65445,
-   99, 65473,   149, 65491,   211, 65518,   210,    17,
-  181,    32,   156,    62,    53,    97,     1,    99,
-65452,   102, 65390,    94, 65357,    41, 65348,    26,
-65364, 65504, 65415, 65471, 65463, 65426,     2, 65412,
-   45, 65405,   121, 65419,   147, 65465,   156, 65508,
-  162,    13,   107,    77,    90,    86,    14,   144,
-65524,   116, 65479,   125, 65441,    72, 65431,    40,
-65390, 65523, 65429, 65483, 65398, 65454, 65464, 65408,
-65471, 65435, 65518, 65426,    31, 65469,    86, 65502,
-  122,     6,   166,    23,   161,    77,   158,    70,
-  125,   103,    51,    89, 65534,    84, 65471,    53,
-65399,    33, 65362, 65532, 65322, 65517, 65345, 65477,
-65378, 65461, 65453, 65445, 65519, 65448,    83, 65453,
-  149, 65478,   204, 65504,   241,     5,   190,    22,
-  182,    65,    74,    83,     5,   109, 65454,   116,
-65403,    85, 65340,    74, 65334,    12, 65341, 65519,
-65379, 65482, 65456, 65427, 65507, 65420,    33, 65413,
-   96, 65429,   147, 65467,   162, 65499,   162,    22,
-  126,    46,    99,   102,    39,   104,     0,   126,
-65498,   112, 65454,    81, 65446,    48, 65411, 65526,
-65416, 65509, 65426, 65452, 65441, 65432, 65459, 65418,
-65523, 65418,     1, 65443,    82, 65472,   105, 65508,
-  152,    10,   161,    33,   168,    81,   124,    82,
-   78,   105,     8,   101, 65492,    66, 65415,    64,
-65368,     3, 65333, 65533, 65317, 65482, 65380, 65474,
-65410, 65436, 65504, 65458,    53, 65447,   116, 65477,
-  212, 65505,   207, 65523,   225,    31,   177,    46,
-  100,    87,    34,    92, 65483,   114, 65408,    91,
-65366,    77, 65339,    27, 65350,     6, 65381, 65494,
-65448, 65472, 65495, 65431,    31, 65422,    80, 65428,
-  124, 65450,   165, 65477,   149, 65518,   144,    14,
-   96,    51,    61,    87,     7,   101, 65513,   115,
-65473,    93, 65446,    77, 65426,    20, 65425,    10,
-65403, 65481, 65448, 65469, 65444, 65430, 65503, 65430,
-65530, 65442,    44, 65453,   109, 65505,   133, 65514,
-  157,    40,   169,    36,   118,   105,   107,    85,
-   18,   103, 65508,    97, 65430,    60, 65388,    48,
-65337, 65520, 65341, 65515, 65367, 65466, 65409, 65446,
-65485, 65433,    34, 65427,    98, 65459,   189, 65474,
-  209, 65520,   222, 65530,   186,    48,   123,    68,
-   50,    89, 65500,   106, 65443,    96, 65367,    81,
-65344,    44, 65356,    15, 65356, 65508, 65434, 65484,
-65471, 65446,     6, 65432,    67, 65442,   105, 65441,
-  154, 65489,   153, 65502,   131,    18,   120,    30,
-   48,    81,    38,    92, 65498,   104, 65491,   101,
-65434,    86, 65441,    39, 65402,    24, 65424, 65502,
-65419, 65493, 65457, 65444, 65486, 65443, 65528, 65420,
-   41, 65453,    88, 65471,   148, 65504,   153,     5,
-  177,    24,   139,    71,   110,    76,    45,   107,
-65513,    88, 65454,    80, 65398,    45, 65339,    12,
-65356, 65521, 65321, 65482, 65421, 65460, 65446, 65436,
-   13, 65444,    88, 65457,   150, 65476,   220, 65509,
-  214, 65530,   203,    29,   147,    53,    59,    86,
-65535,    86, 65435,   101, 65407,    81, 65336,    62,
-65362,    30, 65346, 65520, 65415, 65504, 65460, 65467,
-    1, 65443,    41, 65437,   113, 65444,   126, 65461,
-  181, 65500,   134, 65534,   134,     6,    69,    61,
-   35,    69, 65525,    90, 65494,    86, 65448,    81,
-65444,    45, 65411,    20, 65433, 65531, 65413, 65484,
-65454, 65482, 65470, 65443, 65522, 65456,    22, 65457,
-   63, 65476,   135, 65511,   143, 65527,   152,    29,
-  158,    51,    88,    60,    74,    93, 65535,    70,
-65461,    78, 65427,    60, 65349,    13, 65374,    15,
-65334, 65497, 65404, 65499, 65433, 65460, 65528, 65453,
-   52, 65454,   135, 65460,   185, 65504,   212, 65503,
-  195,    21,   159,    21,    86,    74,    15,    76,
-65476,    91, 65410,    81, 65375,    58, 65351,    32,
-65370, 65534, 65397, 65510, 65447, 65475, 65505, 65462,
-   28, 65453,    72, 65456,   123, 65483,   144, 65493,
-  149, 65535,   127,    11,    88,    43,    54,    56,
-65528,    70, 65529,    68, 65444,    66, 65459,    40,
-65414,    32, 65428, 65527, 65422, 65530, 65435, 65486,
-65461, 65490, 65499, 65462,    14, 65490,    39, 65463,
-  118, 65521,   143, 65501,   169,    19,   171,     8,
-  117,    58,    94,    50,     8,    69, 65506,    71,
-65414,    42, 65375,    51, 65338, 65533, 65343, 65529,
-65349, 65500, 65432, 65462, 65478, 65481,    46, 65442,
-  100, 65482,   190, 65491,   208, 65518,   228,    18,
-  173,    24,   125,    67,    37,    68, 65495,    75,
-65446,    79, 65353,    40, 65375,    50, 65339, 65516,
-65388,     1, 65425, 65462, 65483, 65492,     7, 65445,
-   60, 65469,   106, 65480,   152, 65481,   155, 65532,
-  162,     6,   115,    23,    90,    48,    25,    58,
-65534,    69, 65478,    62, 65455,    52, 65410,    25,
-65405,    15, 65393, 65523, 65417, 65507, 65420, 65468,
-65489, 65485, 65512, 65454,    47, 65484,    93, 65482,
-  146, 65509,   179, 65534,   170,    11,   166,    46,
-   77,    65,    76,    79, 65481,    74, 65470,    74,
-65358,    31, 65360,    35, 65328, 65521, 65353, 65513,
-65392, 65472, 65469, 65464,     6, 65451,    89, 65470,
-  157, 65472,   214, 65514,   217, 65526,   219,    33,
-  135,    35,    85,    82, 65528,    64, 65467,    84,
-65390,    54, 65361,    39, 65331,    12, 65374, 65515,
-65387, 65505, 65446, 65480, 65511, 65463,    18, 65486,
-   94, 65462,   126, 65503,   166, 65512,   150,     0,
-  161,    15,    92,    43,    76,    47, 65528,    63,
-65528,    71, 65430,    48, 65440,    48, 65389,    23,
-65382, 65533, 65412, 65525, 65391, 65487, 65481, 65482,
-65476, 65473,    41, 65466,    73, 65492,   143, 65482,
-  178, 65529,   195,     2,   174,    22,   140,    45,
-   82,    66, 65525,    56, 65494,    71, 65378,    47,
-65373,    20, 65311,    20, 65345, 65505, 65363, 65497,
-65427, 65468, 65506, 65462,    44, 65455,   129, 65484,
-  192, 65488,   210, 65530,   220,    12,   173,    34,
-  105,    62,    39,    78, 65487,    79, 65431,    64,
-65368,    61, 65351,     5, 65342,     9, 65387, 65504,
-65420, 65481, 65479, 65476,    10, 65454,    51, 65472,
-  123, 65480,   144, 65503,   159, 65524,   165,     5,
-  128,    23,    96,    51,    43,    62};
+// 21054 samples IMA-ADPCM (tools/pcm2adpcm.py)
+const uint8_t audio_msg[]={
+0x6B, 0xE0, 0x30, 0xB1, 0x5B, 0x80, 0xC1, 0x4A, 0xB3, 0x3D, 0xA2, 0x80,
+0x1A, 0x85, 0x0C, 0x02, 0x9A, 0x11, 0x00, 0xC1, 0x4B, 0x08, 0xF3, 0x59,
+0xB0, 0x4A, 0xB1, 0x18, 0x20, 0x9A, 0x10, 0xB4, 0x3E, 0xB4, 0x4B, 0xE3,
+0x38, 0xB9, 0x15, 0x0E, 0x02, 0x0B, 0x02, 0x9B, 0x06, 0x0D, 0x84, 0x1C,
+0x92, 0x2A, 0xB2, 0x19, 0x31, 0xDA, 0x41, 0xA9, 0x01, 0x19, 0xB1, 0x41,
+0xBC, 0x07, 0x0A, 0xA2, 0x5B, 0xD2, 0x49, 0xC1, 0x38, 0xB8, 0x12, 0x0B,
+0x93, 0x1B, 0x95, 0x0B, 0x84, 0x1B, 0xA4, 0x4B, 0xD2, 0x59, 0xB8, 0x21,
+0x0A, 0xA2, 0x4B, 0xC0, 0x22, 0xAC, 0x35, 0xAC, 0x03, 0x2A, 0xD9, 0x14,
+0x0C, 0x94, 0x2C, 0x92, 0x99, 0x40, 0xF0, 0x40, 0xC8, 0x20, 0x90, 0x80,
+0x3A, 0xB1, 0x38, 0x99, 0x82, 0x0D, 0x95, 0x3A, 0xA0, 0x29, 0xC0, 0x78,
+0xC0, 0x48, 0xB0, 0x49, 0xA8, 0x30, 0xD9, 0x42, 0xBA, 0x32, 0x8B, 0x81,
+0x30, 0xAD, 0x07, 0x9B, 0x85, 0x0A, 0x00, 0x91, 0x19, 0xB4, 0x3A, 0xB3,
+0xAB, 0x27, 0x9C, 0x21, 0xA1, 0x0D, 0x86, 0xBA, 0x93, 0x75, 0x7D, 0x7A,
+0x7B, 0x7B, 0x5B, 0x0B, 0xB8, 0xF3, 0xD3, 0xC3, 0xA3, 0x93, 0x11, 0x49,
+0x4C, 0x3B, 0x2B, 0x1B, 0xA9, 0xF3, 0xC3, 0xC3, 0xA4, 0xA2, 0x82, 0x10,
+0x49, 0x4C, 0x3B, 0x3C, 0x2B, 0x0A, 0xA8, 0xF3, 0xC3, 0xB3, 0xA4, 0x82,
+0x10, 0x5A, 0x4B, 0x3C, 0x2B, 0x0A, 0xA8, 0xD2, 0xC4, 0xB3, 0xA4, 0x92,
+0x01, 0x28, 0x5B, 0x4B, 0x3C, 0x3B, 0x1C, 0x09, 0xB0, 0xE3, 0xB4, 0xB3,
+0x93, 0x01, 0x48, 0x5B, 0x3C, 0x3B, 0x2C, 0x8A, 0xB1, 0xE3, 0xC3, 0xB4,
+0xA3, 0x82, 0x10, 0x49, 0x5B, 0x3C, 0x3B, 0x2C, 0x1A, 0x99, 0xD2, 0xC3,
+0xB4, 0xB3, 0x93, 0x11, 0x59, 0x4C, 0x3B, 0x3C, 0x1B, 0x99, 0xC2, 0xD3,
+0xB3, 0xB4, 0xA3, 0x83, 0x10, 0x5A, 0x4C, 0x4B, 0x2B, 0x2B, 0x0A, 0xA8,
+0xE3, 0xC4, 0xB3, 0xA3, 0x93, 0x20, 0x6A, 0x4B, 0x3C, 0x2B, 0x0A, 0xA8,
+0xD2, 0xC4, 0xB3, 0xA4, 0x92, 0x81, 0x20, 0x5B, 0x4B, 0x3C, 0x3B, 0x1C,
+0x89, 0xB1, 0xE3, 0xB4, 0xB3, 0x93, 0x82, 0x48, 0x5B, 0x3C, 0x3B, 0x2C,
+0x0A, 0xA8, 0xE3, 0xC3, 0xB4, 0xA3, 0x82, 0x10, 0x39, 0x5C, 0x4B, 0x3C,
+0x2B, 0x0A, 0x98, 0xC1, 0xC4, 0xB3, 0xB4, 0x93, 0x11, 0x39, 0x5C, 0x3C,
+0x3B, 0x1B, 0x8A, 0xC1, 0xD3, 0xB4, 0xB3, 0xA4, 0x82, 0x10, 0x49, 0x4C,
+0x4B, 0x2C, 0x1A, 0x09, 0xA8, 0xD3, 0xC3, 0xB4, 0xA3, 0x82, 0x11, 0x10,
+0x28, 0x2B, 0x0C, 0x8B, 0x9C, 0xAA, 0x99, 0x00, 0x12, 0x07, 0x05, 0x84,
+0x02, 0x00, 0x3B, 0x1F, 0x2F, 0x1C, 0x1A, 0x09, 0x88, 0xA3, 0x95, 0x83,
+0x83, 0x02, 0x00, 0x89, 0x9C, 0xBB, 0xBB, 0xAC, 0x89, 0x00, 0x15, 0x06,
+0x86, 0x84, 0x81, 0x81, 0x1A, 0x1F, 0x2D, 0x1C, 0x0A, 0x09, 0x91, 0x93,
+0x96, 0x83, 0x83, 0x82, 0x00, 0xA9, 0xBA, 0xBC, 0xCB, 0x9A, 0x0A, 0x20,
+0x25, 0x16, 0x85, 0x84, 0x82, 0x80, 0x1B, 0x0F, 0x1D, 0x1C, 0x0A, 0x19,
+0x80, 0x84, 0x84, 0x83, 0x84, 0x82, 0x90, 0xA9, 0xDA, 0xC9, 0xA9, 0x99,
+0x19, 0x48, 0x42, 0x33, 0x07, 0x83, 0x92, 0x90, 0x0C, 0x0F, 0x1D, 0x1C,
+0x1A, 0x09, 0x01, 0x83, 0x86, 0x03, 0x82, 0x92, 0xB1, 0xD8, 0xD8, 0xB8,
+0xA9, 0x89, 0x3A, 0x58, 0x41, 0x23, 0x86, 0x94, 0x92, 0x90, 0x0C, 0x0E,
+0x1C, 0x1C, 0x1A, 0x19, 0x01, 0x13, 0x05, 0x03, 0x83, 0xA2, 0xD1, 0xD8,
+0xC8, 0xB8, 0x99, 0x09, 0x4A, 0x58, 0x40, 0x21, 0x84, 0x94, 0xA2, 0x98,
+0x8C, 0x1E, 0x1D, 0x1C, 0x2A, 0x19, 0x10, 0x03, 0x85, 0x94, 0x93, 0xA2,
+0xC1, 0xC0, 0xB8, 0xAA, 0x8B, 0x2C, 0x4A, 0x48, 0x22, 0x15, 0x84, 0x94,
+0xA1, 0xA0, 0x8C, 0x0E, 0x1C, 0x1C, 0x2A, 0x29, 0x11, 0x13, 0x05, 0x83,
+0x94, 0xB2, 0xE1, 0xB0, 0xB9, 0xAA, 0x8B, 0x2C, 0x6A, 0x48, 0x21, 0x13,
+0x85, 0xA3, 0xB2, 0xC8, 0xAB, 0x8E, 0x0C, 0x2B, 0x3B, 0x49, 0x31, 0x33,
+0x15, 0x84, 0xB3, 0xD3, 0xD1, 0xC0, 0xB8, 0x99, 0x0A, 0x4B, 0x5A, 0x48,
+0x21, 0x22, 0x83, 0xA5, 0xD2, 0xB0, 0xC8, 0x9A, 0x0C, 0x2C, 0x5B, 0x4A,
+0x49, 0x38, 0x10, 0x82, 0xB3, 0xD4, 0xC1, 0xC1, 0xA8, 0x98, 0x1A, 0x5B,
+0x5A, 0x39, 0x30, 0x11, 0x93, 0xB4, 0xF3, 0xC1, 0xA0, 0x99, 0x0A, 0x3B,
+0x6B, 0x5A, 0x39, 0x20, 0x11, 0x92, 0xC3, 0xF3, 0xC2, 0xB0, 0xA0, 0x89,
+0x2A, 0x6B, 0x5A, 0x39, 0x38, 0x20, 0x91, 0xC3, 0xE2, 0xC1, 0xA0, 0xA8,
+0x09, 0x4B, 0x5B, 0x5A, 0x39, 0x38, 0x10, 0xA2, 0xC4, 0xD2, 0xD2, 0xB1,
+0xA0, 0x08, 0x2A, 0x6B, 0x5A, 0x39, 0x28, 0x00, 0xA2, 0xD3, 0xD2, 0xB1,
+0xB0, 0x98, 0x09, 0x5B, 0x6B, 0x4A, 0x39, 0x38, 0x18, 0x91, 0xE3, 0xD2,
+0xC2, 0xB1, 0xA0, 0x08, 0x3A, 0x7B, 0x4A, 0x39, 0x28, 0x00, 0xA2, 0xE3,
+0xD2, 0xB1, 0xB1, 0x88, 0x2A, 0x4C, 0x4A, 0x5A, 0x39, 0x28, 0x18, 0xA1,
+0xE3, 0xC2, 0xC1, 0xB1, 0x90, 0x19, 0x4B, 0x5B, 0x49, 0x39, 0x10, 0x81,
+0xB3, 0xD4, 0xD2, 0xB1, 0xA0, 0x89, 0x2A, 0x5B, 0x6B, 0x39, 0x49, 0x18,
+0x81, 0xB2, 0xD4, 0xC2, 0xB1, 0xA0, 0x98, 0x2A, 0x5C, 0x4A, 0x4A, 0x28,
+0x10, 0x81, 0xC2, 0xD3, 0xD2, 0xB1, 0xA0, 0x88, 0x29, 0x5C, 0x4A, 0x39,
+0x49, 0x18, 0x91, 0xD3, 0xD3, 0xC2, 0xB1, 0x90, 0x88, 0x3A, 0x6B, 0x4A,
+0x39, 0x39, 0x10, 0x91, 0xD4, 0xD3, 0xB1, 0xB1, 0xA0, 0x09, 0x3A, 0x6C,
+0x4A, 0x39, 0x38, 0x18, 0xB2, 0xD5, 0xD3, 0xC2, 0xA1, 0x90, 0x19, 0x4B,
+0x5B, 0x4A, 0x4A, 0x29, 0x08, 0xA2, 0xD3, 0xD3, 0xC2, 0xA1, 0x90, 0x08,
+0x4A, 0x4B, 0x5A, 0x3A, 0x18, 0x00, 0xB2, 0xD4, 0xD3, 0xB2, 0xA1, 0x88,
+0x19, 0x5B, 0x5B, 0x3A, 0x39, 0x39, 0x80, 0xC3, 0xD4, 0xD3, 0xB2, 0xB1,
+0x80, 0x2A, 0x5B, 0x5B, 0x4A, 0x29, 0x18, 0x80, 0xC3, 0xD3, 0xD3, 0xB2,
+0xA1, 0x88, 0x29, 0x4C, 0x5B, 0x4A, 0x3A, 0x08, 0x91, 0xC3, 0xD3, 0xD3,
+0xB2, 0xA1, 0x08, 0x3A, 0x4C, 0x5B, 0x3A, 0x39, 0x19, 0x91, 0xC4, 0xD3,
+0xC2, 0xB2, 0xA1, 0x08, 0x3A, 0x5C, 0x5B, 0x3A, 0x29, 0x08, 0xA2, 0xD3,
+0xC4, 0xC2, 0xB2, 0x91, 0x19, 0x4B, 0x4B, 0x5B, 0x4A, 0x19, 0x00, 0xA1,
+0xD3, 0xC3, 0xC2, 0xB2, 0xA1, 0x18, 0x4B, 0x4C, 0x4A, 0x3A, 0x29, 0x08,
+0xB2, 0xC5, 0xD3, 0xB2, 0xA1, 0x90, 0x18, 0x4B, 0x5C, 0x3A, 0x4A, 0x29,
+0x08, 0xB1, 0xC5, 0xD3, 0xB2, 0xB2, 0x91, 0x29, 0x4C, 0x4B, 0x4A, 0x3A,
+0x29, 0x88, 0xC3, 0xC4, 0xD3, 0xB2, 0xA1, 0x80, 0x29, 0x4C, 0x5B, 0x3A,
+0x3A, 0x29, 0x80, 0xD3, 0xD3, 0xD3, 0xB2, 0xA2, 0x08, 0x3A, 0x4C, 0x5B,
+0x3A, 0x3A, 0x19, 0x91, 0xD3, 0xC4, 0xC2, 0xB2, 0x91, 0x08, 0x3A, 0x4D,
+0x5B, 0x3A, 0x3A, 0x19, 0xA1, 0xC4, 0xD3, 0xC3, 0xB2, 0x91, 0x08, 0x3A,
+0x5C, 0x4B, 0x3A, 0x3A, 0x08, 0xA1, 0xC4, 0xD3, 0xC3, 0xA1, 0xA1, 0x18,
+0x4B, 0x5B, 0x5B, 0x3A, 0x2A, 0x08, 0xB2, 0xC4, 0xD3, 0xC3, 0xB2, 0x91,
+0x18, 0x4B, 0x4C, 0x3A, 0x4A, 0x2A, 0x08, 0xA1, 0xD4, 0xC3, 0xB2, 0xB2,
+0x91, 0x29, 0x4C, 0x4C, 0x4A, 0x2A, 0x29, 0x88, 0xB2, 0xC5, 0xD3, 0xB2,
+0xA2, 0x80, 0x29, 0x5B, 0x4C, 0x3A, 0x3A, 0x2A, 0x80, 0xC2, 0xD4, 0xC3,
+0xB2, 0xA2, 0x80, 0x29, 0x4C, 0x5B, 0x4B, 0x3A, 0x19, 0x90, 0xC3, 0xD4,
+0xC3, 0xA2, 0xA1, 0x80, 0x39, 0x4C, 0x4B, 0x3A, 0x3A, 0x19, 0x90, 0xD4,
+0xC4, 0xB2, 0xC3, 0x91, 0x80, 0x39, 0x4C, 0x4B, 0x3A, 0x3A, 0x19, 0xA1,
+0xD4, 0xD3, 0xC3, 0xA2, 0xA1, 0x00, 0x4A, 0x4C, 0x4B, 0x4A, 0x3A, 0x2A,
+0x09, 0x90, 0xC2, 0xD2, 0xC2, 0xA1, 0x91, 0x88, 0x08, 0x20, 0x30, 0x30,
+0xA2, 0x97, 0xA4, 0xB2, 0xB1, 0xA0, 0x2B, 0x3F, 0x2F, 0x3B, 0x2A, 0x18,
+0xB1, 0xC7, 0xB5, 0xB4, 0xC3, 0xB3, 0x91, 0x10, 0x5B, 0x4C, 0x4B, 0x4B,
+0x3B, 0x2A, 0x89, 0xB1, 0xC4, 0xD3, 0xC3, 0xA2, 0xA2, 0x81, 0x28, 0x4A,
+0x6B, 0x4B, 0x2A, 0x19, 0x09, 0xA0, 0xC2, 0xD2, 0xB2, 0xB3, 0xA2, 0x81,
+0x10, 0x38, 0x49, 0x18, 0x91, 0xA4, 0xB3, 0xB2, 0x89, 0x3F, 0x4F, 0x3C,
+0x3C, 0x3B, 0x3B, 0x89, 0xC2, 0xC5, 0xB4, 0xB4, 0xC3, 0x92, 0x00, 0x29,
+0x5C, 0x3C, 0x4B, 0x3B, 0x2A, 0x89, 0xB1, 0xC5, 0xC3, 0xC3, 0xB3, 0xA2,
+0x92, 0x00, 0x49, 0x4C, 0x4A, 0x3B, 0x2A, 0x2A, 0x09, 0x98, 0xC1, 0xD2,
+0xB2, 0xA2, 0xA1, 0x81, 0x01, 0x21, 0x20, 0x82, 0x95, 0xA3, 0xA2, 0x89,
+0x1F, 0x3E, 0x3E, 0x2C, 0x2A, 0x2A, 0x88, 0xC3, 0xC6, 0xB4, 0xB4, 0xC3,
+0xB3, 0x92, 0x28, 0x5B, 0x4C, 0x4C, 0x3B, 0x3B, 0x2A, 0x89, 0xB1, 0xD4,
+0xC4, 0xB3, 0xB2, 0xA3, 0x81, 0x28, 0x6B, 0x5B, 0x3B, 0x3A, 0x2B, 0x09,
+0xA0, 0xD2, 0xD3, 0xB2, 0xA2, 0xA2, 0x81, 0x10, 0x28, 0x38, 0x00, 0x92,
+0xA4, 0xB3, 0x91, 0x3B, 0x3F, 0x3F, 0x3F, 0x3C, 0x2B, 0x19, 0x88, 0xC2,
+0xC5, 0xB4, 0xB4, 0xB3, 0xA2, 0x01, 0x4A, 0x4D, 0x4B, 0x3B, 0x3B, 0x2B,
+0x09, 0xC1, 0xC5, 0xC4, 0xB3, 0xC3, 0xB3, 0xA3, 0x81, 0x39, 0x4D, 0x4B,
+0x3B, 0x3C, 0x3B, 0x2A, 0x09, 0x98, 0xA1, 0xC4, 0xC3, 0xB3, 0xB3, 0xA3,
+0xA3, 0x82, 0x18, 0x4A, 0x4B, 0x4C, 0x3D, 0x3D, 0x3C, 0x3B, 0x3B, 0x3B,
+0x09, 0xD3, 0xC5, 0xB4, 0xC4, 0xB4, 0xB3, 0xA2, 0x81, 0x29, 0x4C, 0x4C,
+0x3C, 0x4B, 0x3B, 0x1A, 0x88, 0xB2, 0xC5, 0xC3, 0xB3, 0xB3, 0xB3, 0x92,
+0x28, 0x4C, 0x4C, 0x4B, 0x3B, 0x3B, 0x1A, 0x09, 0x90, 0xC2, 0xC3, 0xB3,
+0xB4, 0xB3, 0xB3, 0xA4, 0xA4, 0xA2, 0xA2, 0x81, 0x29, 0x3D, 0x3F, 0x3D,
+0x4C, 0x3B, 0x3B, 0x1A, 0x90, 0xC3, 0xC5, 0xB4, 0xC3, 0xB3, 0xB3, 0x92,
+0x28, 0x4D, 0x4C, 0x3C, 0x3B, 0x3B, 0x2A, 0x09, 0xB1, 0xC5, 0xB4, 0xC4,
+0xB3, 0xB3, 0x92, 0x81, 0x29, 0x4B, 0x4C, 0x3B, 0x3C, 0x3B, 0x2B, 0x19,
+0x98, 0xB2, 0xC3, 0xB4, 0xB4, 0xB3, 0xB4, 0xA3, 0xA2, 0x92, 0x18, 0x4A,
+0x4D, 0x3D, 0x3C, 0x3C, 0x3C, 0x3B, 0x2A, 0x09, 0xB2, 0xC7, 0xB4, 0xB4,
+0xB4, 0xB3, 0xA2, 0x91, 0x39, 0x4D, 0x3C, 0x4C, 0x3B, 0x3B, 0x1A, 0x88,
+0xC2, 0xB4, 0xC5, 0xB3, 0xB3, 0xA2, 0x92, 0x18, 0x5B, 0x4C, 0x3B, 0x3B,
+0x3B, 0x2B, 0x09, 0x90, 0xC2, 0xC3, 0xB4, 0xB4, 0xA4, 0xA2, 0xB3, 0xB4,
+0xB3, 0xB3, 0x92, 0x08, 0x4C, 0x3E, 0x4D, 0x3C, 0x3B, 0x3B, 0x2A, 0x88,
+0xC2, 0xC6, 0xB4, 0xC3, 0xB3, 0xA3, 0x91, 0x28, 0x4C, 0x4C, 0x3C, 0x3B,
+0x3B, 0x2B, 0x88, 0xA1, 0xC5, 0xB4, 0xC4, 0xB3, 0xA3, 0x91, 0x81, 0x18,
+0x4B, 0x4C, 0x3B, 0x3C, 0x2B, 0x2A, 0x09, 0x88, 0xA1, 0xB4, 0xB4, 0xB4,
+0xB4, 0xB3, 0xB3, 0xB3, 0xB3, 0x81, 0x39, 0x4F, 0x3D, 0x4C, 0x3C, 0x3B,
+0x3B, 0x3B, 0x09, 0xB1, 0xC7, 0xB4, 0xB4, 0xB4, 0xB3, 0xA2, 0x81, 0x39,
+0x3E, 0x4C, 0x3C, 0x3B, 0x3B, 0x1A, 0x88, 0xC2, 0xB5, 0xC4, 0xB3, 0xB3,
+0xA3, 0x81, 0x18, 0x4B, 0x4D, 0x3B, 0x3C, 0x3B, 0x2B, 0x19, 0x88, 0xA1,
+0xB2, 0xB4, 0xB4, 0xA4, 0xB3, 0xB4, 0xB4, 0xB4, 0xB3, 0xA2, 0x00, 0x4B,
+0x3F, 0x4D, 0x3C, 0x3B, 0x3B, 0x2A, 0x98, 0xC3, 0xC5, 0xB4, 0xB4, 0xB3,
+0xB3, 0x81, 0x18, 0x4C, 0x4D, 0x3B, 0x3C, 0x3B, 0x1A, 0x88, 0xA1, 0xC4,
+0xB4, 0xB4, 0xB3, 0xB3, 0xA3, 0x81, 0x28, 0x4C, 0x3C, 0x3C, 0x3C, 0x2B,
+0x2A, 0x1A, 0x88, 0x91, 0xA2, 0xB4, 0xB5, 0xB4, 0xB4, 0xB4, 0xB3, 0xB3,
+0xA2, 0x10, 0x5C, 0x4D, 0x3C, 0x3C, 0x3C, 0x3B, 0x1A, 0x88, 0xA1, 0xC5,
+0xC5, 0xB3, 0xB4, 0xA3, 0xA2, 0x81, 0x39, 0x4D, 0x3C, 0x3C, 0x3C, 0x2B,
+0x19, 0x88, 0xC2, 0xB4, 0xB4, 0xB4, 0xB3, 0xA3, 0x91, 0x00, 0x4A, 0x3C,
+0x4C, 0x3B, 0x2C, 0x2A, 0x19, 0x09, 0x88, 0x91, 0xB2, 0xB4, 0xB5, 0xB4,
+0xB4, 0xB4, 0xB4, 0xB3, 0x82, 0x08, 0x5B, 0x3D, 0x4D, 0x3C, 0x3B, 0x2B,
+0x1A, 0x90, 0xC3, 0xC6, 0xB4, 0xB3, 0xB4, 0xA3, 0x81, 0x29, 0x4C, 0x3C,
+0x3C, 0x3B, 0x3C, 0x1A, 0x09, 0xA1, 0xC4, 0xB4, 0xB4, 0xB3, 0xA3, 0xA2,
+0x92, 0x18, 0x3A, 0x4D, 0x3C, 0x2B, 0x3B, 0x2B, 0x3B, 0x1A, 0x09, 0x90,
+0xA3, 0xC6, 0xB5, 0xB4, 0xB5, 0xB3, 0xB4, 0x92, 0x00, 0x3A, 0x4E, 0x3C,
+0x3D, 0x3B, 0x3C, 0x2B, 0x19, 0xA0, 0xC4, 0xB5, 0xB4, 0xB4, 0xB3, 0xA3,
+0x81, 0x39, 0x3D, 0x3D, 0x3C, 0x3B, 0x2C, 0x09, 0x80, 0xA1, 0xC4, 0xB4,
+0xB4, 0xA3, 0xA2, 0x92, 0x00, 0x29, 0x4C, 0x3C, 0x3C, 0x2B, 0x3B, 0x3B,
+0x2B, 0x2A, 0x09, 0x80, 0xB2, 0xB7, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3, 0xA3,
+0x81, 0x3A, 0x3F, 0x3D, 0x3C, 0x3C, 0x2B, 0x2A, 0x88, 0xC2, 0xB5, 0xB5,
+0xB4, 0xB3, 0xA4, 0x91, 0x10, 0x4B, 0x3D, 0x3C, 0x3C, 0x2B, 0x2A, 0x09,
+0x90, 0xC3, 0xB4, 0xB4, 0xB4, 0xA3, 0x92, 0x81, 0x08, 0x3A, 0x3D, 0x3C,
+0x3C, 0x2B, 0x3B, 0x2B, 0x1A, 0x19, 0x09, 0x91, 0xB5, 0xC7, 0xB4, 0xB5,
+0xB4, 0xB3, 0xA3, 0x81, 0x29, 0x4D, 0x3D, 0x3C, 0x3C, 0x3B, 0x2B, 0x09,
+0x90, 0xC4, 0xB5, 0xB4, 0xB4, 0xA3, 0x92, 0x00, 0x3A, 0x3E, 0x3C, 0x3C,
+0x2C, 0x2A, 0x09, 0x88, 0xA2, 0xC4, 0xB4, 0xA4, 0xA2, 0xA3, 0x91, 0x00,
+0x29, 0x3B, 0x3D, 0x3D, 0x2B, 0x3B, 0x3C, 0x2B, 0x2A, 0x2A, 0x09, 0x91,
+0xC5, 0xB6, 0xB4, 0xB5, 0xB4, 0xA3, 0xA2, 0x00, 0x3A, 0x4E, 0x3D, 0x3C,
+0x2C, 0x2A, 0x09, 0x90, 0xB3, 0xC5, 0xB4, 0xA4, 0xB3, 0xA3, 0x81, 0x29,
+0x3C, 0x3D, 0x3D, 0x3B, 0x2C, 0x2A, 0x09, 0x90, 0xC3, 0xB4, 0xA4, 0xB3,
+0xA4, 0xA2, 0x81, 0x18, 0x2A, 0x3C, 0x2C, 0x3B, 0x2C, 0x3B, 0x3B, 0x2C,
+0x2A, 0x1A, 0x08, 0xC3, 0xC7, 0xB5, 0xB4, 0xB4, 0xA4, 0xA2, 0x81, 0x18,
+0x4C, 0x3D, 0x3C, 0x3C, 0x2C, 0x2A, 0x09, 0x90, 0xB4, 0xB5, 0xB4, 0xB4,
+0xA3, 0x92, 0x00, 0x3A, 0x3E, 0x3C, 0x3C, 0x2C, 0x1A, 0x08, 0x88, 0xA2,
+0xC3, 0xB5, 0xA4, 0xA2, 0x92, 0x91, 0x81, 0x29, 0x3B, 0x3D, 0x2C, 0x3B,
+0x3C, 0x3C, 0x2B, 0x3B, 0x3B, 0x2B, 0x90, 0xC5, 0xC6, 0xB4, 0xB4, 0xA4,
+0xA2, 0x92, 0x00, 0x3A, 0x4E, 0x3D, 0x3C, 0x2B, 0x2B, 0x09, 0x90, 0xB4,
+0xB5, 0xB5, 0xB4, 0xA3, 0x92, 0x81, 0x29, 0x3C, 0x3E, 0x3C, 0x2C, 0x2A,
+0x1A, 0x88, 0x91, 0xB3, 0xB5, 0xB4, 0xA4, 0xA2, 0x92, 0x91, 0x00, 0x2A,
+0x3B, 0x3D, 0x3C, 0x2C, 0x3B, 0x3B, 0x2C, 0x3B, 0x2A, 0x0A, 0xD3, 0xB6,
+0xB5, 0xB5, 0xB4, 0xA4, 0xA2, 0x81, 0x18, 0x4C, 0x3D, 0x3C, 0x2C, 0x3B,
+0x2B, 0x09, 0xA1, 0xB5, 0xB5, 0xB5, 0xA4, 0xA2, 0x92, 0x00, 0x2A, 0x3C,
+0x3D, 0x2C, 0x3B, 0x2B, 0x09, 0x90, 0xB3, 0xB5, 0xB5, 0xA4, 0xA2, 0xA3,
+0x81, 0x80, 0x08, 0x2A, 0x3C, 0x2C, 0x3B, 0x3D, 0x3C, 0x3C, 0x2C, 0x2A,
+0x1A, 0x88, 0xC4, 0xB5, 0xB5, 0xB5, 0xA4, 0xA2, 0x92, 0x00, 0x4B, 0x3D,
+0x3D, 0x2C, 0x3B, 0x2B, 0x09, 0x90, 0xC4, 0xB5, 0xA4, 0xB3, 0xA4, 0x92,
+0x00, 0x2A, 0x4C, 0x2C, 0x3C, 0x2B, 0x2B, 0x2A, 0x88, 0xA1, 0xB5, 0xA4,
+0xB4, 0xA4, 0xA2, 0x92, 0x80, 0x00, 0x1A, 0x2A, 0x3C, 0x3C, 0x3C, 0x2C,
+0x3C, 0x3B, 0x2C, 0x1A, 0x09, 0xB1, 0xB7, 0xB6, 0xB5, 0xA4, 0xB3, 0xA3,
+0x81, 0x39, 0x3E, 0x3D, 0x2D, 0x3B, 0x2B, 0x1A, 0x88, 0xB2, 0xB6, 0xB6,
+0xA4, 0xB3, 0xA3, 0x81, 0x18, 0x4B, 0x3D, 0x2C, 0x2B, 0x3B, 0x2B, 0x09,
+0xA1, 0xB4, 0xB5, 0xA4, 0xA3, 0xB3, 0xA3, 0xA2, 0x81, 0x08, 0x2A, 0x3D,
+0x3C, 0x3D, 0x3C, 0x2C, 0x3B, 0x2C, 0x3B, 0x1B, 0xA0, 0xB6, 0xB6, 0xB5,
+0xB5, 0xA4, 0x92, 0x91, 0x28, 0x3C, 0x3D, 0x3D, 0x2C, 0x2B, 0x09, 0x08,
+0x90, 0xB4, 0xB5, 0xA5, 0xB3, 0xA4, 0x92, 0x00, 0x2A, 0x3D, 0x2C, 0x3C,
+0x2C, 0x1A, 0x19, 0x08, 0xA1, 0xA3, 0xB5, 0xA4, 0xB3, 0xA3, 0x92, 0x91,
+0x00, 0x09, 0x3A, 0x3E, 0x3C, 0x3D, 0x3C, 0x2C, 0x3B, 0x2C, 0x1A, 0x98,
+0xC3, 0xB6, 0xB5, 0xA5, 0xB3, 0xA3, 0x93, 0x00, 0x4B, 0x3E, 0x3D, 0x2C,
+0x2B, 0x2B, 0x09, 0x90, 0xC3, 0xB6, 0xA5, 0xB3, 0xA4, 0x92, 0x81, 0x19,
+0x3B, 0x3E, 0x2C, 0x2B, 0x2B, 0x1A, 0x08, 0xA1, 0xA4, 0xB4, 0xA5, 0xB3,
+0xA4, 0xA2, 0x92, 0x80, 0x08, 0x19, 0x4B, 0x3C, 0x3C, 0x3D, 0x2C, 0x3B,
+0x2D, 0x1A, 0x1A, 0xA0, 0xB5, 0xB6, 0xB6, 0xA4, 0xA3, 0x92, 0x81, 0x29,
+0x3D, 0x3D, 0x2D, 0x2B, 0x2B, 0x1A, 0x88, 0xB2, 0xB6, 0xA6, 0xB3, 0xA5,
+0x92, 0x81, 0x08, 0x2A, 0x3C, 0x2E, 0x2B, 0x3B, 0x2B, 0x09, 0x80, 0xB2,
+0xA6, 0xB4, 0xA4, 0xA3, 0xA2, 0x92, 0x80, 0x08, 0x29, 0x2B, 0x4C, 0x3D,
+0x3C, 0x3C, 0x2C, 0x2C, 0x1A, 0x1A, 0x89, 0xC3, 0xB6, 0xB6, 0xA5, 0xA3,
+0xA3, 0x81, 0x18, 0x4B, 0x2E, 0x3C, 0x2D, 0x2B, 0x1A, 0x09, 0x91, 0xB3,
+0xA7, 0xA4, 0xB3, 0xA5, 0x92, 0x80, 0x18, 0x2C, 0x3C, 0x2D, 0x2B, 0x2A,
+0x1A, 0x88, 0x91, 0xA4, 0xA4, 0xB3, 0xA5, 0xA2, 0xA3, 0x91, 0x91, 0x00,
+0x2A, 0x4B, 0x4D, 0x2C, 0x3B, 0x2D, 0x2B, 0x2C, 0x0A, 0x88, 0xC1, 0xB6,
+0xA6, 0xA4, 0xA3, 0xA3, 0x93, 0x10, 0x3B, 0x3F, 0x2E, 0x2C, 0x2B, 0x2B,
+0x1A, 0x88, 0xA2, 0xB6, 0xA6, 0xA4, 0xA3, 0x92, 0x91, 0x00, 0x3B, 0x2F,
+0x2B, 0x2C, 0x2B, 0x2A, 0x1A, 0x80, 0xA2, 0xA6, 0xA3, 0xB4, 0xA4, 0xA2,
+0x92, 0x91, 0x80, 0x28, 0x3C, 0x4C, 0x3D, 0x2C, 0x3B, 0x2C, 0x1B, 0x1B,
+0x89, 0xB1, 0xB6, 0xA7, 0xA4, 0xA4, 0xA3, 0x93, 0x01, 0x2A, 0x3D, 0x2E,
+0x2C, 0x2C, 0x1B, 0x1A, 0x88, 0xA2, 0xA5, 0xA5, 0xA4, 0xA4, 0xA3, 0x92,
+0x00, 0x2A, 0x2E, 0x2C, 0x2C, 0x2B, 0x2A, 0x1A, 0x08, 0x91, 0xB4, 0xA5,
+0xB3, 0xA5, 0xB3, 0xB3, 0xA3, 0x81, 0x18, 0x3A, 0x3E, 0x4C, 0x2C, 0x3B,
+0x2C, 0x1C, 0x1A, 0x8A, 0xA1, 0xC3, 0xA6, 0xA5, 0xA4, 0x94, 0x92, 0x82,
+0x18, 0x2C, 0x3D, 0x2E, 0x2C, 0x2B, 0x1B, 0x09, 0x80, 0xA3, 0xA6, 0xA4,
+0xA5, 0xA3, 0x93, 0x80, 0x19, 0x2B, 0x2F, 0x2C, 0x2B, 0x2B, 0x1A, 0x19,
+0x80, 0xA3, 0xA6, 0xB4, 0xA4, 0xB3, 0xB3, 0xA3, 0x92, 0x00, 0x39, 0x4D,
+0x3C, 0x3C, 0x2D, 0x3B, 0x1C, 0x1B, 0x89, 0xA8, 0xC3, 0xB5, 0xA6, 0xA5,
+0x94, 0x92, 0x92, 0x01, 0x2A, 0x2D, 0x2D, 0x2D, 0x2C, 0x1B, 0x09, 0x08,
+0x91, 0x94, 0xA5, 0xA4, 0x94, 0x92, 0x92, 0x88, 0x2A, 0x2D, 0x2E, 0x2B,
+0x2C, 0x2A, 0x1A, 0x08, 0x81, 0xB3, 0xA6, 0xB4, 0xA3, 0xB3, 0xB4, 0x92,
+0x81, 0x18, 0x4A, 0x3C, 0x4D, 0x2B, 0x2C, 0x2B, 0x0C, 0x89, 0x98, 0xB1,
+0xA6, 0xA4, 0x95, 0x94, 0x93, 0x93, 0x82, 0x29, 0x2D, 0x1F, 0x2B, 0x1D,
+0x1B, 0x1A, 0x09, 0x91, 0x94, 0x95, 0xA5, 0x94, 0xA3, 0xA3, 0x91, 0x88,
+0x2C, 0x1E, 0x2B, 0x2C, 0x2B, 0x3B, 0x19, 0x80, 0x93, 0xB6, 0xA5, 0xB3,
+0xB4, 0xA4, 0xA2, 0x81, 0x00, 0x4A, 0x4B, 0x3C, 0x3C, 0x2C, 0x1C, 0x0A,
+0x89, 0x99, 0xB1, 0xB4, 0xA6, 0x95, 0x94, 0x93, 0x83, 0x82, 0x18, 0x2B,
+0x1F, 0x1D, 0x1C, 0x1C, 0x1A, 0x1A, 0x08, 0x92, 0x95, 0x95, 0x94, 0x93,
+0xA3, 0xA2, 0x90, 0x89, 0x1E, 0x2D, 0x2D, 0x2B, 0x2A, 0x2A, 0x19, 0x81,
+0xA3, 0xB6, 0xA5, 0xC3, 0xA3, 0xB3, 0xA3, 0x01, 0x29, 0x5C, 0x3B, 0x3D,
+0x2C, 0x2B, 0x1C, 0x8A, 0x99, 0xB0, 0xB4, 0xA5, 0x95, 0x94, 0x84, 0x82,
+0x82, 0x81, 0x19, 0x1D, 0x0D, 0x1C, 0x0C, 0x1B, 0x0A, 0x08, 0x01, 0x94,
+0x87, 0x93, 0x95, 0xA3, 0xA3, 0xA1, 0x98, 0x0A, 0x1F, 0x1C, 0x3C, 0x2C,
+0x2A, 0x19, 0x80, 0x92, 0xA4, 0xB5, 0xB4, 0xA4, 0xA2, 0xA3, 0x81, 0x10,
+0x4A, 0x4C, 0x3C, 0x2C, 0x2B, 0x1C, 0x8A, 0xA9, 0xB1, 0xC2, 0xA5, 0x94,
+0x94, 0x84, 0x03, 0x02, 0x10, 0x19, 0x1D, 0x0D, 0x0C, 0x0D, 0x0A, 0x0A,
+0x09, 0x10, 0x02, 0x86, 0x85, 0x93, 0x95, 0xA3, 0xB2, 0xA1, 0x99, 0x0C,
+0x2E, 0x2D, 0x2C, 0x2A, 0x2A, 0x29, 0x80, 0xA3, 0xB5, 0xB5, 0xB4, 0xA4,
+0xA2, 0x92, 0x01, 0x39, 0x5C, 0x3C, 0x2C, 0x3B, 0x1C, 0x8A, 0x99, 0xB0,
+0xC2, 0xB3, 0x96, 0x83, 0x04, 0x03, 0x13, 0x02, 0x18, 0x8A, 0x8F, 0x8D,
+0x0C, 0x0C, 0x0B, 0x1A, 0x29, 0x30, 0x22, 0x07, 0x84, 0x95, 0xA4, 0xB3,
+0xB2, 0xA0, 0xA9, 0x1C, 0x2F, 0x2C, 0x3B, 0x3B, 0x3A, 0x19, 0x81, 0xB4,
+0xB6, 0xB5, 0xB3, 0xA4, 0x92, 0x81, 0x20, 0x4C, 0x4B, 0x3C, 0x2C, 0x1B,
+0x8A, 0x99, 0xB8, 0xD2, 0xC3, 0x93, 0x84, 0x13, 0x23, 0x33, 0x22, 0x11,
+0x9A, 0xAD, 0x9F, 0x9C, 0x8C, 0x8B, 0x1B, 0x4B, 0x49, 0x30, 0x42, 0x04,
+0x85, 0xA4, 0xA4, 0xC2, 0xB2, 0xB0, 0x98, 0x1C, 0x2E, 0x3C, 0x3C, 0x2A,
+0x29, 0x08, 0xA2, 0xB4, 0xB6, 0xB4, 0xA3, 0xA3, 0x92, 0x20, 0x5B, 0x4C,
+0x3B, 0x2D, 0x1A, 0x0B, 0xA9, 0xC0, 0xC1, 0xB3, 0xA3, 0x84, 0x23, 0x52,
+0x32, 0x30, 0x20, 0x88, 0xBB, 0xEC, 0xDA, 0xB9, 0xAA, 0x8B, 0x2A, 0x7B,
+0x48, 0x30, 0x41, 0x22, 0x83, 0xA6, 0xC4, 0xC2, 0xB2, 0xA8, 0x09, 0x2D,
+0x2D, 0x4B, 0x3B, 0x2A, 0x29, 0x80, 0xB3, 0xB6, 0xB5, 0xB4, 0xA3, 0xA3,
+0x01, 0x38, 0x4C, 0x4C, 0x2B, 0x2C, 0x0B, 0x99, 0xB8, 0xF2, 0xB2, 0xA3,
+0x82, 0x22, 0x52, 0x40, 0x30, 0x28, 0x18, 0xA9, 0xE9, 0xD9, 0xC8, 0xB8,
+0x99, 0x09, 0x39, 0x7A, 0x48, 0x30, 0x40, 0x01, 0x93, 0xC4, 0xC4, 0xC2,
+0xB1, 0x90, 0x1A, 0x2D, 0x3C, 0x3B, 0x4B, 0x2A, 0x08, 0xA2, 0xB5, 0xB5,
+0xA4, 0xA2, 0x93, 0x01, 0x49, 0x5B, 0x3C, 0x3B, 0x1C, 0x0A, 0xAA, 0xD0,
+0xD2, 0xC2, 0xA2, 0x93, 0x12, 0x50, 0x58, 0x49, 0x18, 0x18, 0x88, 0xC8,
+0xC0, 0xD0, 0xB0, 0xA8, 0x98, 0x28, 0x5A, 0x59, 0x48, 0x38, 0x38, 0x01,
+0xA2, 0xD5, 0xC2, 0xB2, 0xB0, 0x88, 0x1B, 0x3D, 0x3D, 0x3B, 0x3A, 0x19,
+0x81, 0xB4, 0xB6, 0xA4, 0xB3, 0x93, 0x01, 0x38, 0x6C, 0x4B, 0x3C, 0x1B,
+0x0A, 0xA9, 0xE0, 0xC2, 0xC2, 0xB2, 0x93, 0x11, 0x50, 0x69, 0x49, 0x29,
+0x18, 0x19, 0xB8, 0xE1, 0xC1, 0xC0, 0xB1, 0x90, 0x08, 0x39, 0x6A, 0x59,
+0x39, 0x38, 0x28, 0x91, 0xC3, 0xD4, 0xC2, 0xA1, 0xA0, 0x88, 0x1A, 0x3C,
+0x3C, 0x3A, 0x3A, 0x08, 0xB3, 0xB7, 0xA5, 0xA2, 0xA3, 0x02, 0x28, 0x5A,
+0x4C, 0x3B, 0x2C, 0x0A, 0x9A, 0xD8, 0xE2, 0xC2, 0xB2, 0xA3, 0x11, 0x40,
+0x7A, 0x49, 0x29, 0x39, 0x09, 0x98, 0xD1, 0xD1, 0xC1, 0xB1, 0xA0, 0x80,
+0x18, 0x6A, 0x5A, 0x39, 0x49, 0x39, 0x08, 0x91, 0xE3, 0xD3, 0xB2, 0xB1,
+0xA1, 0x19, 0x2B, 0x4C, 0x3B, 0x3A, 0x29, 0x80, 0xB3, 0xB7, 0xA4, 0xA3,
+0x93, 0x11, 0x39, 0x6C, 0x3C, 0x2B, 0x1B, 0x9A, 0xD8, 0xF2, 0xC2, 0xB2,
+0xA2, 0x02, 0x48, 0x69, 0x5A, 0x4A, 0x29, 0x19, 0x88, 0xB0, 0xF2, 0xB1,
+0xD2, 0xA1, 0x80, 0x08, 0x39, 0x5A, 0x6A, 0x3A, 0x39, 0x29, 0x80, 0xB2,
+0xE4, 0xB2, 0xC2, 0xA1, 0x90, 0x19, 0x3A, 0x3D, 0x4B, 0x3A, 0x09, 0x81,
+0xA2, 0xA5, 0xA3, 0xA3, 0x03, 0x38, 0x7B, 0x4B, 0x2C, 0x1A, 0x8B, 0xD8,
+0xE1, 0xD2, 0xB2, 0xA2, 0x82, 0x38, 0x79, 0x6A, 0x4A, 0x29, 0x19, 0x88,
+0xB1, 0xD2, 0xD2, 0xC2, 0xB1, 0xA1, 0x80, 0x28, 0x5A, 0x5A, 0x4A, 0x39,
+0x29, 0x08, 0xA1, 0xD3, 0xD3, 0xB2, 0xB1, 0xA1, 0x88, 0x2A, 0x4C, 0x3C,
+0x3A, 0x3A, 0x09, 0x92, 0xB4, 0xA5, 0x93, 0x82, 0x11, 0x49, 0x4A, 0x3C,
+0x1C, 0x8A, 0xD9, 0xF2, 0xB1, 0xC2, 0xB2, 0x92, 0x21, 0x7A, 0x6A, 0x4A,
+0x3A, 0x29, 0x08, 0xA0, 0xD2, 0xE2, 0xC2, 0xB2, 0xA1, 0x90, 0x18, 0x49,
+0x6B, 0x4A, 0x3A, 0x39, 0x19, 0x80, 0xC2, 0xC4, 0xD3, 0xB2, 0xA1, 0x91,
+0x09, 0x3A, 0x4C, 0x3B, 0x3A, 0x2A, 0x08, 0x92, 0xA3, 0x96, 0x81, 0x02,
+0x38, 0x5B, 0x4B, 0x1C, 0x8A, 0xC8, 0xF1, 0xD2, 0xC2, 0xA2, 0x91, 0x10,
+0x59, 0x6A, 0x4A, 0x4A, 0x3A, 0x19, 0x88, 0xC1, 0xE3, 0xC2, 0xC2, 0xB2,
+0x91, 0x08, 0x39, 0x6B, 0x5B, 0x3A, 0x4A, 0x19, 0x08, 0xA1, 0xC3, 0xD3,
+0xC3, 0xB2, 0xA1, 0x80, 0x19, 0x3A, 0x4C, 0x3B, 0x3A, 0x19, 0x80, 0xA3,
+0x93, 0x84, 0x10, 0x30, 0x4A, 0x4C, 0x1A, 0x9B, 0xE0, 0xF2, 0xC1, 0xC2,
+0xC2, 0xA2, 0x01, 0x49, 0x6A, 0x6B, 0x3A, 0x3A, 0x29, 0x09, 0xB1, 0xE4,
+0xC2, 0xC2, 0xB2, 0xB2, 0x81, 0x29, 0x5B, 0x6B, 0x3A, 0x4A, 0x3A, 0x19,
+0x88, 0xC2, 0xC4, 0xC3, 0xB2, 0xB2, 0x91, 0x08, 0x2A, 0x4B, 0x4B, 0x3B,
+0x29, 0x19, 0x81, 0x93, 0x82, 0x12, 0x38, 0x7A, 0x2A, 0x3B, 0x8B, 0xE9,
+0xF2, 0xE2, 0xC2, 0xB2, 0xB2, 0x82, 0x28, 0x7B, 0x6A, 0x5B, 0x3A, 0x2A,
+0x08, 0x90, 0xD2, 0xD3, 0xC2, 0xB2, 0xC2, 0xA2, 0x00, 0x39, 0x5C, 0x5B,
+0x3A, 0x3A, 0x2A, 0x08, 0x90, 0xD3, 0xD3, 0xC3, 0xB2, 0xB2, 0x91, 0x18,
+0x2A, 0x4B, 0x4B, 0x2A, 0x29, 0x18, 0x00, 0x01, 0x20, 0x38, 0x6A, 0x3A,
+0x1A, 0x89, 0xF0, 0xF1, 0xE3, 0xC2, 0xB2, 0xA2, 0x91, 0x10, 0x7A, 0x6B,
+0x3A, 0x5B, 0x3A, 0x1A, 0x08, 0xC1, 0xD3, 0xD3, 0xB2, 0xB2, 0xA2, 0x80,
+0x28, 0x5C, 0x5B, 0x4B, 0x3A, 0x2A, 0x29, 0x88, 0xC2, 0xC3, 0xD3, 0xC3,
+0xA2, 0xA1, 0x80, 0x18, 0x2A, 0x4B, 0x2A, 0x29, 0x18, 0x28, 0x00, 0x20,
+0x59, 0x4A, 0x4A, 0x3B, 0x0A, 0xB8, 0xF3, 0xF2, 0xD2, 0xB2, 0xC3, 0xA2,
+0x00, 0x38, 0x7C, 0x5B, 0x3A, 0x4B, 0x2A, 0x19, 0xA0, 0xE3, 0xC3, 0xD3,
+0xB2, 0xA2, 0x91, 0x18, 0x3A, 0x5C, 0x5B, 0x3A, 0x4B, 0x2A, 0x08, 0x90,
+0xC2, 0xC3, 0xC3, 0xB2, 0xB2, 0x91, 0x18, 0x3B, 0x4C, 0x3B, 0x3A, 0x3A,
+0x29, 0x28, 0x28, 0x38, 0x5A, 0x4A, 0x4B, 0x0A, 0xB0, 0xF3, 0xF2, 0xC2,
+0xD3, 0xB2, 0xB3, 0x81, 0x38, 0x6C, 0x5B, 0x4B, 0x3A, 0x3A, 0x1A, 0x90,
+0xD2, 0xD4, 0xC3, 0xB2, 0xC3, 0xA2, 0x00, 0x29, 0x5B, 0x5B, 0x4B, 0x2A,
+0x29, 0x19, 0x88, 0xC2, 0xC4, 0xC3, 0xA2, 0xA1, 0x91, 0x80, 0x19, 0x3A,
+0x4C, 0x2A, 0x3A, 0x29, 0x18, 0x28, 0x18, 0x49, 0x4A, 0x2A, 0x2A, 0xB8,
+0xF2, 0xF3, 0xD2, 0xD3, 0xB2, 0xB3, 0xA2, 0x20, 0x6B, 0x6B, 0x5B, 0x4B,
+0x2A, 0x19, 0x88, 0xA1, 0xE3, 0xC3, 0xD3, 0xA2, 0xB2, 0x81, 0x18, 0x4B,
+0x5B, 0x5B, 0x3B, 0x3A, 0x2A, 0x08, 0xB1, 0xC4, 0xC4, 0xC3, 0xA2, 0x91,
+0x90, 0x00, 0x2A, 0x4B, 0x4B, 0x2A, 0x3A, 0x29, 0x29, 0x18, 0x28, 0x39,
+0x2A, 0x18, 0xB9, 0xF5, 0xE3, 0xE3, 0xB2, 0xD3, 0xA2, 0x91, 0x00, 0x49,
+0x5C, 0x5B, 0x4B, 0x3A, 0x3B, 0x09, 0x90, 0xE3, 0xD3, 0xC3, 0xC3, 0xA2,
+0x91, 0x00, 0x3A, 0x4C, 0x5B, 0x4B, 0x2A, 0x3A, 0x09, 0x80, 0xB1, 0xC5,
+0xC3, 0xC3, 0xA2, 0x91, 0x80, 0x08, 0x29, 0x4B, 0x3B, 0x3A, 0x3A, 0x4A,
+0x29, 0x29, 0x39, 0x3A, 0x1A, 0x90, 0xF2, 0xF3, 0xE3, 0xD3, 0xB2, 0xB3,
+0xA2, 0x81, 0x39, 0x6C, 0x4C, 0x5B, 0x4B, 0x2A, 0x19, 0x88, 0xB1, 0xC4,
+0xD3, 0xC3, 0xB3, 0xA2, 0x80, 0x18, 0x5B, 0x4B, 0x5B, 0x3B, 0x3A, 0x2A,
+0x09, 0xA1, 0xC4, 0xC4, 0xC3, 0xA2, 0x91, 0x90, 0x00, 0x19, 0x3A, 0x3C,
+0x4B, 0x3A, 0x3A, 0x39, 0x3A, 0x3A, 0x4A, 0x2A, 0x88, 0xD1, 0xE4, 0xD3,
+0xD3, 0xC3, 0xB2, 0xB3, 0x91, 0x10, 0x7B, 0x5B, 0x4B, 0x4B, 0x4B, 0x2A,
+0x09, 0x90, 0xD3, 0xC4, 0xC3, 0xB2, 0xB3, 0xA2, 0x00, 0x4A, 0x4C, 0x4B,
+0x4B, 0x2A, 0x3A, 0x09, 0x90, 0xC3, 0xC4, 0xC3, 0xB3, 0xB2, 0xA2, 0x80,
+0x18, 0x3B, 0x4C, 0x4B, 0x2A, 0x4A, 0x3A, 0x3A, 0x2A, 0x29, 0x19, 0x88,
+0xB1, 0xE5, 0xD3, 0xD3, 0xD3, 0xB3, 0xB2, 0x92, 0x00, 0x4A, 0x6C, 0x4B,
+0x4B, 0x4B, 0x2A, 0x09, 0x90, 0xD3, 0xC4, 0xC3, 0xB3, 0xB2, 0xA2, 0x81,
+0x29, 0x4C, 0x4C, 0x4B, 0x4B, 0x2A, 0x19, 0x88, 0x91, 0xD3, 0xC3, 0xB3,
+0xC3, 0xA2, 0xA1, 0x00, 0x19, 0x4B, 0x4B, 0x4B, 0x4B, 0x3A, 0x2A, 0x29,
+0x29, 0x2A, 0x08, 0xA0, 0xE4, 0xD3, 0xD3, 0xC3, 0xC3, 0xB2, 0xB3, 0x92,
+0x38, 0x5D, 0x4C, 0x4B, 0x4B, 0x3B, 0x2A, 0x09, 0xA1, 0xD4, 0xC4, 0xB3,
+0xC3, 0xA2, 0x91, 0x00, 0x3A, 0x4C, 0x4C, 0x4B, 0x2A, 0x2A, 0x19, 0x88,
+0xB2, 0xC5, 0xB3, 0xC3, 0xB2, 0xA2, 0x91, 0x18, 0x2A, 0x4B, 0x4B, 0x4B,
+0x3A, 0x4B, 0x3A, 0x3A, 0x2A, 0x19, 0x90, 0xE3, 0xD4, 0xD3, 0xC3, 0xC3,
+0xC3, 0xA2, 0x92, 0x18, 0x4A, 0x5C, 0x4B, 0x3C, 0x3A, 0x3B, 0x1A, 0x90,
+0xD3, 0xC4, 0xC4, 0xB3, 0xB2, 0xA2, 0x81, 0x29, 0x5C, 0x4B, 0x3C, 0x4B,
+0x2A, 0x19, 0x88, 0x91, 0xD3, 0xB4, 0xC3, 0xC3, 0xA2, 0x91, 0x80, 0x18,
+0x2A, 0x4B, 0x4B, 0x4B, 0x3A, 0x3A, 0x4B, 0x2A, 0x19, 0x88, 0xC2, 0xC4,
+0xD3, 0xD3, 0xC3, 0xC3, 0xB3, 0xA2, 0x01, 0x4A, 0x4C, 0x4C, 0x4B, 0x3B,
+0x4B, 0x1A, 0x08, 0xB1, 0xC4, 0xC4, 0xC3, 0xB3, 0xA2, 0x81, 0x08, 0x4A,
+0x4C, 0x4B, 0x3B, 0x4B, 0x2A, 0x09, 0x90, 0xC3, 0xC4, 0xB3, 0xC3, 0xB3,
+0xA2, 0x91, 0x08, 0x3A, 0x3C, 0x4C, 0x4B, 0x3A, 0x4B, 0x2A, 0x3A, 0x2A,
+0x09, 0x90, 0xD3, 0xD4, 0xC4, 0xC3, 0xC3, 0xA2, 0xA2, 0x81, 0x18, 0x6B,
+0x4C, 0x4B, 0x3B, 0x4B, 0x3B, 0x09, 0xA0, 0xC4, 0xC4, 0xC3, 0xB3, 0xB3,
+0xA2, 0x81, 0x29, 0x5C, 0x3C, 0x4B, 0x3B, 0x4B, 0x1A, 0x08, 0xA1, 0xC4,
+0xB4, 0xC3, 0xB3, 0xA2, 0x91, 0x80, 0x19, 0x3A, 0x4D, 0x3B, 0x4B, 0x4B,
+0x3A, 0x2A, 0x2A, 0x19, 0x90, 0xC2, 0xC5, 0xC4, 0xD3, 0xB3, 0xC3, 0xA2,
+0x92, 0x00, 0x4A, 0x4D, 0x4C, 0x3B, 0x4B, 0x3B, 0x1A, 0x90, 0xB2, 0xC6,
+0xC3, 0xB4, 0xB3, 0xA2, 0x91, 0x18, 0x4A, 0x4D, 0x3B, 0x3C, 0x4B, 0x2A,
+0x09, 0x90, 0xB3, 0xC4, 0xB4, 0xC3, 0xB3, 0xA2, 0x91, 0x08, 0x29, 0x3C,
+0x5B, 0x3C, 0x3A, 0x4B, 0x3B, 0x2A, 0x19, 0x08, 0xB1, 0xC5, 0xC4, 0xD3,
+0xB3, 0xC3, 0xB3, 0xA2, 0x81, 0x49, 0x4D, 0x4C, 0x4B, 0x3B, 0x3B, 0x2B,
+0x88, 0xB2, 0xC5, 0xC4, 0xB4, 0xB3, 0xC3, 0x92, 0x80, 0x29, 0x5B, 0x3C,
+0x3C, 0x4B, 0x3B, 0x1A, 0x80, 0xA1, 0xC4, 0xB4, 0xB3, 0xB4, 0xB2, 0x92,
+0x80, 0x19, 0x4B, 0x3C, 0x4C, 0x3B, 0x4B, 0x3A, 0x3B, 0x2A, 0x09, 0x91,
+0xE3, 0xC4, 0xC4, 0xB3, 0xC3, 0xB3, 0xA2, 0x81, 0x18, 0x6B, 0x4D, 0x4B,
+0x3C, 0x3B, 0x3B, 0x1A, 0x90, 0xD3, 0xB5, 0xC4, 0xB3, 0xB3, 0xA2, 0x81,
+0x18, 0x4C, 0x4C, 0x3C, 0x3B, 0x3B, 0x2A, 0x09, 0xA1, 0xB4, 0xC5, 0xB3,
+0xB4, 0xB3, 0xA2, 0x91, 0x08, 0x3A, 0x3D, 0x4C, 0x3B, 0x4B, 0x3B, 0x3A,
+0x3B, 0x19, 0x88, 0xC2, 0xC5, 0xC4, 0xC3, 0xB3, 0xC3, 0xB3, 0x92, 0x00,
+0x4A, 0x4D, 0x4C, 0x3B, 0x3C, 0x3B, 0x2A, 0x09, 0xB1, 0xC6, 0xB4, 0xB4,
+0xC3, 0xB3, 0x92, 0x00, 0x3A, 0x3D, 0x4C, 0x3C, 0x3B, 0x2A, 0x1A, 0x80,
+0xA1, 0xC5, 0xB4, 0xB3, 0xB4, 0xA2, 0x91, 0x80, 0x18, 0x3B, 0x4D, 0x3C,
+0x4B, 0x3B, 0x3B, 0x3A, 0x2A, 0x09, 0xA1, 0xC4, 0xC5, 0xC3, 0xC4, 0xB3,
+0xB3, 0xA2, 0x81, 0x28, 0x5C, 0x3C, 0x4C, 0x3C, 0x3B, 0x2A, 0x1A, 0xA0,
+0xC4, 0xB4, 0xB4, 0xB4, 0xB3, 0xA2, 0x81, 0x29, 0x4C, 0x3D, 0x4C, 0x3B,
+0x2B, 0x19, 0x08, 0x90, 0xC3, 0xB5, 0xB4, 0xB3, 0xC3, 0xA2, 0x92, 0x08,
+0x2A, 0x4B, 0x3D, 0x4B, 0x3B, 0x4B, 0x3B, 0x2A, 0x19, 0x90, 0xC3, 0xC5,
+0xC4, 0xC3, 0xB3, 0xB4, 0xA2, 0x92, 0x00, 0x5B, 0x4C, 0x3C, 0x3C, 0x3B,
+0x3B, 0x1A, 0x88, 0xC3, 0xC5, 0xB4, 0xB4, 0xB3, 0xB3, 0x92, 0x18, 0x4B,
+0x4D, 0x3C, 0x3C, 0x3B, 0x3B, 0x1A, 0x08, 0xA1, 0xB5, 0xB4, 0xB4, 0xB3,
+0xC3, 0x92, 0x80, 0x19, 0x3B, 0x4D, 0x3C, 0x4B, 0x3B, 0x3B, 0x4B, 0x2A,
+0x09, 0xA1, 0xC4, 0xC4, 0xB4, 0xC4, 0xB3, 0xB3, 0xA2, 0x01, 0x29, 0x4D,
+0x4C, 0x3C, 0x3B, 0x3C, 0x1A, 0x09, 0xA1, 0xB4, 0xC5, 0xB4, 0xB4, 0xB3,
+0x92, 0x80, 0x18, 0x4B, 0x3D, 0x3C, 0x3B, 0x3C, 0x1A, 0x08, 0xA1, 0xB4,
+0xB5, 0xB4, 0xB4, 0xB3, 0xA2, 0x91, 0x80, 0x29, 0x3C, 0x3D, 0x4C, 0x3B,
+0x4B, 0x3B, 0x2A, 0x19, 0x88, 0xB2, 0xD5, 0xB4, 0xC4, 0xB3, 0xB3, 0xB3,
+0x92, 0x10, 0x4C, 0x4D, 0x3C, 0x3C, 0x3B, 0x3B, 0x1A, 0x88, 0xC2, 0xB6,
+0xB4, 0xB4, 0xB3, 0xA3, 0x91, 0x00, 0x4B, 0x3D, 0x3D, 0x3C, 0x3B, 0x3B,
+0x1A, 0x80, 0xB2, 0xB6, 0xB4, 0xB4, 0xB4, 0xB3, 0xA2, 0x91, 0x08, 0x3A,
+0x3D, 0x4C, 0x3B, 0x3C, 0x4B, 0x2A, 0x2A, 0x09, 0xA1, 0xC4, 0xC4, 0xB4,
+0xC3, 0xB4, 0xB3, 0x92, 0x00, 0x29, 0x4C, 0x4D, 0x3B, 0x3C, 0x2B, 0x2A,
+0x09, 0xB1, 0xB5, 0xC5, 0xB4, 0xB4, 0xA3, 0x91, 0x81, 0x29, 0x3C, 0x3D,
+0x3C, 0x3C, 0x2B, 0x19, 0x88, 0x91, 0xB3, 0xB6, 0xB4, 0xB4, 0xA3, 0xB2,
+0xA2, 0x80, 0x29, 0x3C, 0x3D, 0x4C, 0x3B, 0x3B, 0x4B, 0x3B, 0x2A, 0x98,
+0xC3, 0xC5, 0xB4, 0xC4, 0xB3, 0xB3, 0xA3, 0x81, 0x28, 0x4D, 0x3C, 0x3D,
+0x3B, 0x3C, 0x2B, 0x09, 0x90, 0xC4, 0xB4, 0xB5, 0xB4, 0xA3, 0xA2, 0x81,
+0x18, 0x3B, 0x3F, 0x3C, 0x3C, 0x2B, 0x2A, 0x1A, 0x80, 0xA2, 0xB5, 0xB5,
+0xB4, 0xB4, 0xB3, 0xA2, 0x91, 0x18, 0x2A, 0x3D, 0x3C, 0x3C, 0x4C, 0x3B,
+0x2A, 0x2A, 0x09, 0xA1, 0xC4, 0xB5, 0xC4, 0xB3, 0xB4, 0xB3, 0x92, 0x00,
+0x4A, 0x4D, 0x3C, 0x3C, 0x3B, 0x2C, 0x2A, 0x09, 0xA1, 0xB4, 0xB5, 0xB5,
+0xB4, 0xA3, 0x91, 0x00, 0x29, 0x3D, 0x3D, 0x3C, 0x2C, 0x2A, 0x19, 0x09,
+0x91, 0xB3, 0xA6, 0xB3, 0xB4, 0xB3, 0xB3, 0xA2, 0x90, 0x29, 0x3D, 0x3D,
+0x3C, 0x4C, 0x3B, 0x3B, 0x3B, 0x19, 0x88, 0xC2, 0xC6, 0xB4, 0xB4, 0xC3,
+0xA3, 0xA2, 0x81, 0x28, 0x4D, 0x3C, 0x3C, 0x3C, 0x2C, 0x2A, 0x09, 0x90,
+0xB3, 0xB6, 0xB5, 0xB4, 0xA3, 0xA2, 0x81, 0x08, 0x4B, 0x3D, 0x3C, 0x2C,
+0x3B, 0x3B, 0x1A, 0x80, 0xA2, 0xB5, 0xA6, 0xC3, 0xB3, 0xB3, 0xB3, 0x91,
+0x80, 0x3A, 0x3E, 0x3C, 0x3C, 0x4B, 0x3B, 0x3B, 0x2A, 0x09, 0xA1, 0xC5,
+0xC5, 0xB4, 0xB4, 0xB3, 0xB3, 0x92, 0x10, 0x4B, 0x3D, 0x4D, 0x3C, 0x2B,
+0x3B, 0x1A, 0x88, 0xB2, 0xB5, 0xB6, 0xB4, 0xA4, 0xA2, 0x81, 0x80, 0x19,
+0x3C, 0x3D, 0x2C, 0x3B, 0x3B, 0x2B, 0x08, 0x91, 0xA5, 0xB4, 0xB5, 0xB4,
+0xB3, 0xB3, 0xA2, 0x80, 0x19, 0x3C, 0x3D, 0x3D, 0x4B, 0x3B, 0x4B, 0x3B,
+0x1A, 0x90, 0xC3, 0xC5, 0xB4, 0xB4, 0xB4, 0xB3, 0x92, 0x81, 0x29, 0x4D,
+0x3C, 0x3C, 0x2C, 0x3B, 0x2B, 0x09, 0xA1, 0xB5, 0xB5, 0xB5, 0xA4, 0xA2,
+0x92, 0x80, 0x18, 0x3C, 0x3D, 0x2D, 0x3B, 0x3B, 0x2B, 0x19, 0x80, 0x92,
+0xB5, 0xA5, 0xB4, 0xB4, 0xB3, 0xB2, 0xA2, 0x80, 0x2A, 0x3D, 0x4D, 0x3C,
+0x3B, 0x4B, 0x3B, 0x1A, 0x08, 0xA1, 0xC4, 0xC5, 0xB4, 0xB3, 0xB4, 0xA3,
+0x81, 0x18, 0x4B, 0x3D, 0x3D, 0x3C, 0x2B, 0x3B, 0x1A, 0x88, 0xB2, 0xB7,
+0xB5, 0xA4, 0xB3, 0xA3, 0xA2, 0x00, 0x2A, 0x3D, 0x2E, 0x3B, 0x2C, 0x2A,
+0x2A, 0x19, 0x80, 0xA4, 0xB5, 0xA5, 0xB3, 0xC3, 0xB3, 0xA2, 0x90, 0x08,
+0x4B, 0x3D, 0x3D, 0x4B, 0x3B, 0x3C, 0x2A, 0x09, 0x80, 0xC2, 0xB5, 0xC5,
+0xB4, 0xA3, 0xA2, 0x92, 0x00, 0x3A, 0x3D, 0x3D, 0x3D, 0x2C, 0x2A, 0x1A,
+0x09, 0x91, 0xB4, 0xB6, 0xA4, 0xB3, 0xA4, 0xA2, 0x81, 0x08, 0x3B, 0x2F,
+0x3C, 0x2C, 0x3B, 0x2A, 0x2A, 0x08, 0x81, 0xA4, 0xB5, 0xB5, 0xB4, 0xB3,
+0xB3, 0xA1, 0x80, 0x19, 0x3C, 0x3E, 0x3C, 0x4C, 0x3B, 0x3B, 0x2A, 0x09,
+0xA1, 0xC5, 0xB4, 0xB5, 0xB3, 0xB4, 0xA3, 0x81, 0x18, 0x4B, 0x3E, 0x3C,
+0x2C, 0x3B, 0x2B, 0x1A, 0x88, 0xB3, 0xA7, 0xB4, 0xA5, 0xB3, 0xA3, 0x91,
+0x80, 0x19, 0x2D, 0x2D, 0x3B, 0x2D, 0x2A, 0x2A, 0x29, 0x80, 0x93, 0xB5,
+0xA6, 0xC3, 0xB4, 0xB3, 0xB2, 0xA2, 0x80, 0x2A, 0x3D, 0x3D, 0x4C, 0x3B,
+0x3B, 0x3B, 0x1A, 0x90, 0xC3, 0xB6, 0xB5, 0xB4, 0xB4, 0xA3, 0xA2, 0x81,
+0x29, 0x3D, 0x3D, 0x2D, 0x3B, 0x2B, 0x1A, 0x08, 0x91, 0xB4, 0xA7, 0xB4,
+0xA4, 0xB3, 0xA3, 0x91, 0x08, 0x1B, 0x2D, 0x3D, 0x2C, 0x3B, 0x3B, 0x3B,
+0x18, 0x81, 0xA4, 0xA6, 0xB4, 0xB4, 0xB4, 0xB2, 0xA2, 0x91, 0x09, 0x4B,
+0x3E, 0x3C, 0x3C, 0x4B, 0x3B, 0x1A, 0x08, 0xA1, 0xC4, 0xB5, 0xB4, 0xB4,
+0xA4, 0xA2, 0x81, 0x18, 0x3B, 0x3E, 0x2D, 0x3B, 0x2C, 0x1A, 0x19, 0x80,
+0xA2, 0xA5, 0xA5, 0xB4, 0xA4, 0xB3, 0x92, 0x90, 0x09, 0x2B, 0x2F, 0x2C,
+0x3B, 0x3C, 0x3B, 0x29, 0x18, 0x81, 0xA4, 0xB6, 0xB5, 0xB4, 0xC3, 0xA2,
+0x91, 0x80, 0x19, 0x3C, 0x3D, 0x4C, 0x3B, 0x3C, 0x2A, 0x1A, 0x90, 0xC3,
+0xB5, 0xB4, 0xB5, 0xA3, 0xB3, 0x92, 0x00, 0x2A, 0x3D, 0x2E, 0x3B, 0x2D,
+0x1A, 0x19, 0x08, 0x80, 0xA3, 0xA7, 0xA4, 0xA4, 0xA2, 0xB3, 0xA2, 0x90,
+0x1A, 0x2E, 0x2D, 0x2B, 0x3C, 0x3B, 0x3A, 0x39, 0x18, 0x92, 0xA7, 0xB4,
+0xB5, 0xC3, 0xB3, 0xB2, 0xA2, 0x08, 0x3B, 0x3F, 0x3C, 0x3C, 0x4B, 0x2B,
+0x19, 0x88, 0xA2, 0xC5, 0xB4, 0xB5, 0xA4, 0xA2, 0x92, 0x00, 0x19, 0x3B,
+0x2E, 0x2C, 0x2C, 0x2A, 0x2B, 0x1A, 0x00, 0x92, 0xA6, 0xA5, 0xA4, 0xA4,
+0xA2, 0xA2, 0xA1, 0x98, 0x0A, 0x2D, 0x2E, 0x3B, 0x3C, 0x4B, 0x3A, 0x29,
+0x18, 0x92, 0xB5, 0xB6, 0xB4, 0xC3, 0xB3, 0xA1, 0x91, 0x19, 0x4C, 0x3D,
+0x3C, 0x3B, 0x3C, 0x2A, 0x09, 0x90, 0xB4, 0xB5, 0xB5, 0xA4, 0xB3, 0xA3,
+0x81, 0x18, 0x2B, 0x2E, 0x2C, 0x2C, 0x2C, 0x1A, 0x19, 0x08, 0x81, 0x94,
+0xA5, 0xA5, 0xA4, 0xB3, 0xB3, 0xA2, 0xA0, 0x89, 0x1D, 0x2D, 0x3C, 0x3D,
+0x3B, 0x4B, 0x29, 0x29, 0x00, 0xB3, 0xB7, 0xB5, 0xC3, 0xB3, 0xA2, 0x91,
+0x08, 0x3B, 0x3E, 0x3D, 0x3C, 0x3B, 0x3B, 0x1A, 0x88, 0xB3, 0xB6, 0xB5,
+0xB5, 0xA4, 0x92, 0x91, 0x00, 0x19, 0x2B, 0x2E, 0x2C, 0x2C, 0x2B, 0x1A,
+0x29, 0x08, 0x02, 0x94, 0x96, 0xA4, 0xB4, 0xA3, 0xB2, 0xB2, 0xA8, 0x99,
+0x1D, 0x2D, 0x3D, 0x3C, 0x4B, 0x3A, 0x29, 0x18, 0x92, 0xB5, 0xB5, 0xB5,
+0xC3, 0xB3, 0xB2, 0x91, 0x08, 0x4C, 0x3C, 0x3D, 0x3B, 0x3C, 0x1A, 0x19,
+0x90, 0xB3, 0xB6, 0xA5, 0xB3, 0xA4, 0xA3, 0x81, 0x08, 0x2B, 0x2E, 0x2C,
+0x2C, 0x2C, 0x2B, 0x1A, 0x18, 0x01, 0x02, 0x95, 0x95, 0xA3, 0xA5, 0xB2,
+0xB2, 0xC1, 0xA0, 0x8A, 0x1C, 0x3D, 0x3D, 0x4C, 0x4B, 0x3A, 0x19, 0x00,
+0x91, 0xB5, 0xB5, 0xC4, 0xB3, 0xB2, 0xA2, 0x00, 0x2A, 0x3D, 0x3D, 0x3C,
+0x3B, 0x3B, 0x2B, 0x88, 0xA2, 0xB5, 0xA6, 0xB4, 0xA4, 0xA3, 0x92, 0x80,
+0x09, 0x2B, 0x2E, 0x1D, 0x2B, 0x2B, 0x3B, 0x2A, 0x28, 0x11, 0x04, 0x96,
+0x95, 0xB3, 0xB5, 0xC3, 0xB2, 0xA0, 0xA8, 0x0A, 0x2D, 0x3D, 0x4C, 0x4B,
+0x3A, 0x3A, 0x29, 0x80, 0xB3, 0xB7, 0xB4, 0xC4, 0xB3, 0xA2, 0x80, 0x19,
+0x3C, 0x3D, 0x3C, 0x3C, 0x2B, 0x2A, 0x19, 0x90, 0xB4, 0xA5, 0xA4, 0xB4,
+0xA4, 0x92, 0x91, 0x80, 0x1A, 0x1C, 0x2D, 0x1C, 0x2B, 0x2B, 0x2A, 0x39,
+0x20, 0x22, 0x05, 0x96, 0xA4, 0xB4, 0xB4, 0xC2, 0xB1, 0xA0, 0x89, 0x1B,
+0x3E, 0x3D, 0x4C, 0x3A, 0x4B, 0x29, 0x08, 0x92, 0xB4, 0xC5, 0xB4, 0xB3,
+0xB2, 0xA2, 0x08, 0x3B, 0x3E, 0x3D, 0x3C, 0x3B, 0x2B, 0x19, 0x88, 0xB3,
+0xA6, 0xB4, 0xA5, 0xA3, 0xA3, 0x92, 0x08, 0x1A, 0x1D, 0x1C, 0x1C, 0x2C,
+0x2B, 0x2B, 0x29, 0x38, 0x12, 0x05, 0x84, 0xA6, 0xA4, 0xC3, 0xC3, 0xB1,
+0xA1, 0x99, 0x0A, 0x2D, 0x3D, 0x4C, 0x4B, 0x3A, 0x3A, 0x18, 0x81, 0xC3,
+0xB6, 0xB4, 0xC3, 0xB3, 0xA1, 0x91, 0x19, 0x3C, 0x3D, 0x3D, 0x3B, 0x3B,
+0x2B, 0x19, 0x91, 0xB4, 0xA7, 0xA4, 0xA3, 0xA3, 0xA2, 0x81, 0x09, 0x1C,
+0x1D, 0x1C, 0x1C, 0x2B, 0x2B, 0x3A, 0x49, 0x38, 0x22, 0x04, 0x96, 0xA5,
+0xB3, 0xC4, 0xC2, 0xB1, 0x90, 0x99, 0x2B, 0x3E, 0x3C, 0x4C, 0x3A, 0x3A,
+0x39, 0x80, 0xA3, 0xB7, 0xB4, 0xB4, 0xC3, 0xA2, 0x90, 0x08, 0x2A, 0x3E,
+0x3C, 0x3C, 0x2B, 0x2A, 0x09, 0x91, 0xA3, 0xA6, 0xA5, 0xA4, 0xA3, 0x92,
+0x91, 0x88, 0x09, 0x1D, 0x1D, 0x1C, 0x1B, 0x3B, 0x3C, 0x3A, 0x38, 0x31,
+0x13, 0x87, 0xA4, 0xB5, 0xB4, 0xC2, 0xB2, 0xB0, 0x98, 0x1B, 0x3E, 0x3D,
+0x3C, 0x4A, 0x3A, 0x3A, 0x18, 0x92, 0xB4, 0xB6, 0xB4, 0xC3, 0xA2, 0xA1,
+0x80, 0x2A, 0x3E, 0x3D, 0x3C, 0x2B, 0x2A, 0x1A, 0x00, 0x91, 0xA4, 0xA5,
+0xA5, 0xA3, 0xA4, 0xA2, 0x91, 0x98, 0x0A, 0x1D, 0x1D, 0x2C, 0x1B, 0x3A,
+0x3B, 0x59, 0x38, 0x11, 0x84, 0x95, 0xB4, 0xB5, 0xC3, 0xC2, 0xB1, 0x90,
+0x89, 0x2B, 0x3E, 0x3C, 0x5B, 0x4B, 0x29, 0x29, 0x80, 0xB3, 0xB6, 0xB5,
+0xB3, 0xC3, 0xA2, 0x90, 0x08, 0x3B, 0x3F, 0x2C, 0x3B, 0x3B, 0x3B, 0x09,
+0x81, 0xA3, 0xA7, 0xA4, 0xA4, 0xA4, 0x92, 0x91, 0x88, 0x0A, 0x0C, 0x1C,
+0x1D, 0x2B, 0x2C, 0x3A, 0x4A, 0x38, 0x20, 0x03, 0x96, 0xA5, 0xB4, 0xC4,
+0xB2, 0xC2, 0x90, 0x98, 0x1A, 0x3D, 0x3C, 0x4C, 0x4B, 0x3A, 0x19, 0x00,
+0xA2, 0xB5, 0xB5, 0xB4, 0xB3, 0xB2, 0x91, 0x08, 0x3C, 0x2D, 0x3C, 0x3C,
+0x2B, 0x2A, 0x09, 0x80, 0xA4, 0xA4, 0xA5, 0x94, 0xA3, 0xA3, 0xA2, 0x90,
+0x89, 0x0C, 0x0E, 0x1C, 0x1B, 0x2C, 0x4B, 0x3A, 0x39, 0x40, 0x11, 0x84,
+0x95, 0xB4, 0xB4, 0xD3, 0xC2, 0xA1, 0x98, 0x1A, 0x2D, 0x3C, 0x4C, 0x4B,
+0x2A, 0x29, 0x00, 0x92, 0xB4, 0xB5, 0xB4, 0xB4, 0xA2, 0xA1, 0x80, 0x2B,
+0x3D, 0x3D, 0x2C, 0x3B, 0x2B, 0x19, 0x08, 0xA2, 0xA6, 0x94, 0xA4, 0xA4,
+0x93, 0x91, 0x91, 0x89, 0x8B, 0x0D, 0x0C, 0x1C, 0x1C, 0x3B, 0x4A, 0x4A,
+0x38, 0x30, 0x12, 0x96, 0xA5, 0xB4, 0xD3, 0xB2, 0xB1, 0xA0, 0x0A, 0x2D,
+0x3D, 0x3C, 0x4C, 0x2A, 0x29, 0x18, 0x81, 0xA3, 0xB6, 0xB4, 0xB4, 0xB3,
+0xB2, 0x80, 0x2A, 0x2D, 0x3D, 0x2C, 0x3B, 0x2C, 0x09, 0x80, 0x92, 0xA4,
+0x94, 0x94, 0xA4, 0x93, 0x92, 0x91, 0x98, 0x9A, 0x8D, 0x8C, 0x0C, 0x1C,
+0x2B, 0x4B, 0x5A, 0x39, 0x21, 0x22, 0x84, 0x96, 0xB4, 0xC4, 0xB2, 0xB1,
+0xB0, 0x98, 0x1C, 0x3D, 0x3D, 0x3C, 0x4B, 0x29, 0x18, 0x00, 0xA3, 0xB6,
+0xB5, 0xB4, 0xB3, 0xA2, 0x91, 0x09, 0x3C, 0x2E, 0x3B, 0x2D, 0x2A, 0x1A,
+0x08, 0x80, 0xA3, 0x96, 0x93, 0x94, 0x93, 0xA3, 0x92, 0x98, 0x9A, 0x8D,
+0x8D, 0x0C, 0x1C, 0x1B, 0x3B, 0x5A, 0x49, 0x48, 0x20, 0x12, 0x95, 0xA4,
+0xC4, 0xC3, 0xC2, 0xA1, 0x98, 0x0A, 0x2C, 0x3D, 0x3C, 0x4B, 0x3A, 0x29,
+0x00, 0xA3, 0xA6, 0xB4, 0xB5, 0xB3, 0xB3, 0x91, 0x09, 0x2B, 0x2F, 0x2C,
+0x3B, 0x2C, 0x1A, 0x08, 0x80, 0xA3, 0x95, 0x94, 0x94, 0x94, 0x92, 0x92,
+0x90, 0xA8, 0xAA, 0x9C, 0x8D, 0x0C, 0x2C, 0x2C, 0x4A, 0x4A, 0x49, 0x28,
+0x02, 0x84, 0xA4, 0xB4, 0xC4, 0xB2, 0xB1, 0xA8, 0x0A, 0x2D, 0x2E, 0x4B,
+0x3B, 0x4B, 0x29, 0x18, 0x92, 0xA5, 0xB5, 0xA4, 0xB3, 0xB3, 0xA1, 0x90,
+0x1A, 0x2E, 0x2D, 0x2B, 0x2B, 0x2B, 0x09, 0x00, 0x92, 0x96, 0x95, 0x83,
+0x94, 0x93, 0xA3, 0xA2, 0xB0, 0xC9, 0xCA, 0xAB, 0x8D, 0x1D, 0x3C, 0x3C,
+0x5B, 0x39, 0x48, 0x10, 0x83, 0xA5, 0xB5, 0xB4, 0xD3, 0xB2, 0x90, 0x89,
+0x1B, 0x3D, 0x3E, 0x3B, 0x4B, 0x2A, 0x18, 0x81, 0xA4, 0xA5, 0xB4, 0xB4,
+0xA3, 0x91, 0x88, 0x2A, 0x2D, 0x2D, 0x2B, 0x2C, 0x1A, 0x09, 0x08, 0x81,
+0x93, 0x96, 0x84, 0x83, 0x83, 0xA3, 0xA3, 0xD1, 0xC0, 0xC8, 0xA9, 0x8C,
+0x1C, 0x2D, 0x3C, 0x5B, 0x4A, 0x39, 0x28, 0x01, 0xA5, 0xA5, 0xC3, 0xC3,
+0xB2, 0xA1, 0x98, 0x1B, 0x2E, 0x3C, 0x3C, 0x4B, 0x2A, 0x29, 0x00, 0xA3,
+0xA6, 0xB4, 0xA5, 0xA2, 0xA2, 0x80, 0x09, 0x2B, 0x2F, 0x2C, 0x2B, 0x2B,
+0x1A, 0x88, 0x81, 0x93, 0x96, 0x94, 0x84, 0x82, 0x82, 0xA2, 0xA1, 0xC0,
+0xB9, 0xBB, 0x9D, 0x0D, 0x1C, 0x3C, 0x4C, 0x4A, 0x39, 0x38, 0x11, 0x94,
+0xA6, 0xB4, 0xC4, 0xB2, 0xB2, 0xA0, 0x09, 0x2D, 0x3D, 0x3C, 0x3C, 0x2A,
+0x29, 0x18, 0xA2, 0xA6, 0xA4, 0xB3, 0xA4, 0xA2, 0x91, 0x09, 0x2B, 0x2E,
+0x2C, 0x2C, 0x1B, 0x1A, 0x08, 0x80, 0x82, 0x94, 0x84, 0x04, 0x83, 0x84,
+0xA2, 0xB3, 0xD1, 0xD0, 0xA8, 0xAA, 0x0C, 0x1D, 0x3C, 0x3D, 0x4A, 0x4A,
+0x39, 0x10, 0x82, 0xA6, 0xB4, 0xB5, 0xC3, 0xA1, 0xA1, 0x09, 0x2C, 0x2D,
+0x3C, 0x3B, 0x4B, 0x2A, 0x18, 0x91, 0xA5, 0xA5, 0xB3, 0xA5, 0xA2, 0x91,
+0x08, 0x1A, 0x2C, 0x2D, 0x1C, 0x1A, 0x1A, 0x09, 0x80, 0x81, 0x84, 0x84,
+0x03, 0x85, 0x83, 0x93, 0xC3, 0xC2, 0xD1, 0xC0, 0xA8, 0x9A, 0x1C, 0x2D,
+0x4C, 0x4B, 0x3A, 0x49, 0x18, 0x02, 0xA4, 0xB6, 0xB4, 0xB4, 0xB2, 0xA1,
+0x98, 0x2B, 0x2E, 0x3D, 0x3C, 0x3B, 0x2A, 0x18, 0x91, 0xA5, 0xA4, 0xA4,
+0xB3, 0xA4, 0x91, 0x80, 0x2A, 0x2D, 0x2D, 0x1B, 0x2B, 0x1B, 0x1A, 0x88,
+0x81, 0x83, 0x86, 0x04, 0x03, 0x84, 0x83, 0xB3, 0xD3, 0xD1, 0xC0, 0xC0,
+0xA8, 0x8A, 0x2D, 0x3D, 0x4C, 0x3A, 0x4A, 0x28, 0x81, 0x94, 0xB5, 0xB5,
+0xB3, 0xC3, 0xA1, 0x90, 0x0A, 0x3D, 0x2E, 0x3B, 0x3B, 0x4B, 0x19, 0x00,
+0xB3, 0xA7, 0xA4, 0xB3, 0xA3, 0x92, 0x80, 0x19, 0x2D, 0x2D, 0x2C, 0x1B,
+0x1B, 0x09, 0x88, 0x80, 0x93, 0x04, 0x04, 0x13, 0x04, 0x84, 0x93, 0xD3,
+0xD2, 0xC1, 0xB0, 0xA9, 0x8B, 0x1D, 0x3D, 0x3D, 0x5B, 0x3A, 0x28, 0x10,
+0x93, 0xA6, 0xB5, 0xB4, 0xB3, 0xC2, 0xA1, 0x09, 0x2C, 0x3D, 0x2D, 0x3B,
+0x3A, 0x2A, 0x08, 0xA3, 0xA6, 0xA5, 0xB3, 0xA4, 0x92, 0x91, 0x08, 0x2B,
+0x2D, 0x2D, 0x1C, 0x1A, 0x1A, 0x09, 0x88, 0x82, 0x82, 0x05, 0x03, 0x04,
+0x03, 0x94, 0xB3, 0xE3, 0xC1, 0xC0, 0xA8, 0x9A, 0x1D, 0x2D, 0x3C, 0x5B,
+0x3A, 0x39, 0x28, 0x93, 0xA7, 0xA5, 0xB3, 0xC3, 0xB2, 0xA1, 0x98, 0x2B,
+0x2F, 0x3C, 0x3D, 0x3B, 0x2A, 0x19, 0x91, 0xA5, 0xA4, 0xB4, 0xA4, 0x92,
+0x81, 0x88, 0x19, 0x2C, 0x2D, 0x2C, 0x1B, 0x0A, 0x09, 0x88, 0x00, 0x02,
+0x13, 0x05, 0x05, 0x83, 0x84, 0xB3, 0xC4, 0xD2, 0xC1, 0xA0, 0x99, 0x0C,
+0x2C, 0x3D, 0x4C, 0x3A, 0x3A, 0x28, 0x01, 0xA5, 0xA5, 0xB4, 0xB4, 0xC3,
+0xA1, 0x80, 0x1A, 0x2D, 0x3D, 0x2C, 0x3B, 0x2A, 0x29, 0x80, 0xA3, 0xA7,
+0xA4, 0xB3, 0xA4, 0x92, 0x80, 0x08, 0x2B, 0x1E, 0x2B, 0x1C, 0x0A, 0x1A,
+0x09, 0x08, 0x01, 0x13, 0x24, 0x14, 0x14, 0x84, 0xA4, 0xB4, 0xE2, 0xC2,
+0xB0, 0xA0, 0x8A, 0x1E, 0x3C, 0x3C, 0x5B, 0x3A, 0x39, 0x18, 0x93, 0xA7,
+0xB4, 0xB5, 0xB3, 0xB2, 0xA1, 0x09, 0x2C, 0x2E, 0x3B, 0x3D, 0x3B, 0x2A,
+0x08, 0x92, 0xA5, 0xA5, 0xB3, 0xA4, 0xA3, 0x81, 0x08, 0x2B, 0x1D, 0x2C,
+0x1C, 0x1B, 0x0A, 0x09, 0x19, 0x00, 0x31, 0x42, 0x42, 0x23, 0x05, 0xA4,
+0xB5, 0xC4, 0xD2, 0xB1, 0xB1, 0x89, 0x1C, 0x2D, 0x4C, 0x3B, 0x5B, 0x29,
+0x18, 0x01, 0xA4, 0xB5, 0xB5, 0xB3, 0xC3, 0x91, 0x88, 0x2B, 0x2E, 0x3C,
+0x2C, 0x2A, 0x2A, 0x08, 0x81, 0xA4, 0xA5, 0xA4, 0xA3, 0xA3, 0x92, 0x80,
+0x09, 0x1C, 0x1D, 0x1C, 0x0B, 0x0A, 0x89, 0x08, 0x28, 0x30, 0x51, 0x51,
+0x31, 0x13, 0x85, 0xB4, 0xC5, 0xD3, 0xB1, 0xC1, 0xA0, 0x89, 0x2C, 0x3D,
+0x4D, 0x3B, 0x4A, 0x29, 0x00, 0x92, 0xA5, 0xB4, 0xB4, 0xC3, 0xA2, 0x90,
+0x1A, 0x2C, 0x2D, 0x3C, 0x2C, 0x2A, 0x18, 0x08, 0x92, 0xA5, 0xA4, 0xA4,
+0x93, 0x91, 0x81, 0x88, 0x0A, 0x1C, 0x0D, 0x0B, 0x0B, 0x8A, 0x19, 0x2A,
+0x79, 0x38, 0x50, 0x30, 0x31, 0x83, 0xA6, 0xC5, 0xD3, 0xC2, 0xA1, 0xA0,
+0x89, 0x2B, 0x3E, 0x3D, 0x4B, 0x3A, 0x29, 0x10, 0x92, 0xA6, 0xB5, 0xB4,
+0xB3, 0xB2, 0xA1, 0x88, 0x2C, 0x2E, 0x3C, 0x2C, 0x2A, 0x19, 0x00, 0x81,
+0xA3, 0xA6, 0x94, 0x92, 0x92, 0x81, 0x88, 0x89, 0x0B, 0x0E, 0x8B, 0x9A,
+0x8A, 0x0A, 0x4B, 0x6A, 0x49, 0x48, 0x48, 0x30, 0x01, 0xA5, 0xB4, 0xC4,
+0xD2, 0xB2, 0xA0, 0x89, 0x1B, 0x3E, 0x3D, 0x3C, 0x3A, 0x4A, 0x18, 0x81,
+0xA4, 0xB5, 0xB5, 0xB3, 0xB3, 0xA1, 0x88, 0x2B, 0x2F, 0x2C, 0x3B, 0x2C,
+0x19, 0x18, 0x91, 0xA5, 0xA4, 0xA4, 0x93, 0x92, 0x81, 0x08, 0x1A, 0x1C,
+0x1D, 0x8B, 0x8A, 0x9A, 0x89, 0x19, 0x59, 0x59, 0x59, 0x48, 0x38, 0x11,
+0xA3, 0xB7, 0xC4, 0xC3, 0xC2, 0xA1, 0x98, 0x09, 0x2D, 0x3C, 0x4C, 0x4B,
+0x2A, 0x18, 0x81, 0xA3, 0xA6, 0xB4, 0xB4, 0xB3, 0xA1, 0x90, 0x2A, 0x2F,
+0x3C, 0x2C, 0x3B, 0x2A, 0x19, 0x80, 0xA3, 0xA5, 0xA5, 0xA3, 0x93, 0x81,
+0x80, 0x19, 0x0B, 0x0D, 0x8B, 0xAA, 0x9A, 0xA9, 0x2A, 0x5C, 0x5A, 0x59,
+0x59, 0x28, 0x20, 0x92, 0xB6, 0xB5, 0xD3, 0xB2, 0xC2, 0xA0, 0x88, 0x3B,
+0x3F, 0x3C, 0x4C, 0x2A, 0x29, 0x18, 0x91, 0xA5, 0xB4, 0xB4, 0xB3, 0xB2,
+0x91, 0x09, 0x2D, 0x3D, 0x2C, 0x3B, 0x2B, 0x19, 0x80, 0xA3, 0xA6, 0xA4,
+0x94, 0x92, 0x92, 0x00, 0x08, 0x2B, 0x0D, 0x0B, 0x9B, 0xAA, 0xA9, 0x89,
+0x4A, 0x7B, 0x7A, 0x39, 0x49, 0x38, 0x18, 0xA2, 0xB6, 0xD4, 0xC3, 0xC2,
+0xA1, 0x90, 0x19, 0x3C, 0x3D, 0x4C, 0x3B, 0x29, 0x18, 0x91, 0xA4, 0xB5,
+0xB5, 0xB3, 0xB3, 0xA2, 0x88, 0x2B, 0x2F, 0x3C, 0x2C, 0x2A, 0x1A, 0x08,
+0x92, 0xA4, 0xA4, 0x94, 0x92, 0x82, 0x01, 0x19, 0x1B, 0x8B, 0x9C, 0xBA,
+0xE9, 0xB0, 0xA0, 0x18, 0x6A, 0x6A, 0x5A, 0x39, 0x49, 0x28, 0x91, 0xB4,
+0xC5, 0xD3, 0xB2, 0xC2, 0xA1, 0x88, 0x2A, 0x3E, 0x4C, 0x3B, 0x3A, 0x29,
+0x00, 0xA3, 0xB6, 0xB5, 0xB4, 0xB3, 0xA2, 0x90, 0x19, 0x2D, 0x2C, 0x2C,
+0x3B, 0x2B, 0x18, 0x80, 0xA4, 0x95, 0xA3, 0x94, 0x82, 0x01, 0x08, 0x09,
+0x8B, 0xBB, 0xE9, 0xC8, 0xC0, 0xA0, 0x08, 0x49, 0x6C, 0x5A, 0x4A, 0x39,
+0x3A, 0x00, 0xA2, 0xC5, 0xC4, 0xD3, 0xB2, 0xB2, 0x90, 0x19, 0x3C, 0x3D,
+0x4C, 0x3A, 0x2A, 0x18, 0x81, 0xB3, 0xA7, 0xB3, 0xB4, 0xC3, 0x91, 0x88,
+0x1A, 0x2D, 0x3C, 0x2C, 0x2A, 0x1A, 0x00, 0x81, 0x93, 0x95, 0x83, 0x82,
+0x11, 0x08, 0x19, 0x9B, 0xDB, 0xF8, 0xD1, 0xB1, 0xB1, 0xA1, 0x10, 0x7A,
+0x6B, 0x4A, 0x4A, 0x3A, 0x29, 0x80, 0xC3, 0xC4, 0xD3, 0xC3, 0xB2, 0xA1,
+0x08, 0x3B, 0x3E, 0x4C, 0x3B, 0x3A, 0x29, 0x18, 0xA2, 0xB5, 0xB6, 0xB4,
+0xB3, 0xB2, 0x91, 0x09, 0x2C, 0x3C, 0x2D, 0x2A, 0x1A, 0x08, 0x81, 0xA4,
+0x94, 0x93, 0x83, 0x11, 0x18, 0x19, 0x0B, 0x9C, 0xDA, 0xF0, 0xC1, 0xB1,
+0x91, 0x18, 0x4A, 0x7B, 0x4A, 0x5A, 0x3A, 0x29, 0x18, 0xA1, 0xC5, 0xD3,
+0xC3, 0xB2, 0xA1, 0x90, 0x2A, 0x3D, 0x4D, 0x4B, 0x3B, 0x29, 0x19, 0x81,
+0xB3, 0xB7, 0xB4, 0xB3, 0xB3, 0xA1, 0x80, 0x2B, 0x2E, 0x2C, 0x3B, 0x2C,
+0x19, 0x00, 0x81, 0x93, 0x95, 0x83, 0x11, 0x10, 0x08, 0x0A, 0xD9, 0xE0,
+0xD1, 0xC1, 0xB1, 0xB2, 0x80, 0x38, 0x6D, 0x5B, 0x4A, 0x4A, 0x3A, 0x19,
+0x90, 0xC3, 0xC5, 0xC3, 0xB2, 0xB2, 0xA1, 0x08, 0x3B, 0x3F, 0x4C, 0x4B,
+0x2A, 0x29, 0x08, 0x91, 0xB4, 0xB5, 0xB4, 0xB3, 0xB2, 0x91, 0x09, 0x2B,
+0x2E, 0x2B, 0x3B, 0x3B, 0x09, 0x02, 0x93, 0x86, 0x12, 0x11, 0x30, 0x3A,
+0x1B, 0xCA, 0xF8, 0xF1, 0xC1, 0xC2, 0xA1, 0x91, 0x10, 0x5A, 0x6B, 0x5B,
+0x3A, 0x3A, 0x29, 0x08, 0xC2, 0xC4, 0xD3, 0xC3, 0xB2, 0xB2, 0x91, 0x29,
+0x3D, 0x4C, 0x4B, 0x3B, 0x29, 0x19, 0x81, 0xB3, 0xB6, 0xB4, 0xB3, 0xC3,
+0x91, 0x88, 0x2B, 0x2D, 0x2C, 0x3B, 0x2B, 0x19, 0x00, 0x83, 0x84, 0x13,
+0x22, 0x30, 0x39, 0x89, 0xD8, 0xF1, 0xF0, 0xD2, 0xC2, 0xB2, 0x91, 0x00,
+0x39, 0x5C, 0x6B, 0x3A, 0x4A, 0x2A, 0x08, 0x91, 0xD3, 0xC4, 0xC3, 0xB2,
+0xB2, 0xA1, 0x08, 0x4B, 0x4D, 0x3C, 0x3A, 0x4B, 0x19, 0x00, 0x91, 0xB4,
+0xB5, 0xC3, 0xB3, 0xB2, 0x91, 0x09, 0x2C, 0x2C, 0x2C, 0x2A, 0x2A, 0x18,
+0x01, 0x21, 0x12, 0x32, 0x50, 0x39, 0x09, 0xA8, 0xF1, 0xF0, 0xD1, 0xC2,
+0xB2, 0xA1, 0x91, 0x38, 0x6C, 0x5B, 0x5B, 0x3A, 0x3A, 0x19, 0x90, 0xD3,
+0xC4, 0xC3, 0xC3, 0xB2, 0x91, 0x80, 0x2A, 0x4C, 0x4C, 0x3B, 0x3A, 0x3A,
+0x19, 0x91, 0xB4, 0xB5, 0xB4, 0xB3, 0xB2, 0xA1, 0x88, 0x2B, 0x2E, 0x2C,
+0x2B, 0x2A, 0x18, 0x10, 0x11, 0x23, 0x51, 0x48, 0x39, 0x29, 0x99, 0xF1,
+0xE1, 0xE2, 0xC2, 0xB2, 0xB2, 0x91, 0x10, 0x5A, 0x6B, 0x5B, 0x3A, 0x3A,
+0x3A, 0x09, 0xC2, 0xC4, 0xC4, 0xC3, 0xB2, 0xA2, 0x90, 0x18, 0x4C, 0x3C,
+0x4B, 0x4B, 0x2A, 0x29, 0x08, 0xA2, 0xB4, 0xB5, 0xC3, 0xB3, 0xB2, 0xA1,
+0x08, 0x1B, 0x2C, 0x2C, 0x3B, 0x3A, 0x29, 0x30, 0x40, 0x40, 0x58, 0x4A,
+0x29, 0x09, 0xC0, 0xF2, 0xD2, 0xC2, 0xC2, 0xB2, 0xA2, 0x81, 0x38, 0x5D,
+0x5B, 0x4B, 0x3A, 0x3A, 0x19, 0xA0, 0xC4, 0xC4, 0xC3, 0xB2, 0xB2, 0xA2,
+0x80, 0x3A, 0x4D, 0x4C, 0x3B, 0x3A, 0x3A, 0x19, 0x80, 0xB3, 0xB6, 0xB4,
+0xC3, 0xA2, 0x90, 0x88, 0x09, 0x1B, 0x2B, 0x2C, 0x2A, 0x39, 0x38, 0x60,
+0x69, 0x39, 0x5A, 0x29, 0x09, 0xA0, 0xE2, 0xE3, 0xD2, 0xB2, 0xC3, 0xB2,
+0x81, 0x18, 0x5A, 0x5C, 0x4B, 0x3A, 0x3A, 0x2A, 0x08, 0xB1, 0xD5, 0xC4,
+0xC3, 0xA2, 0xA1, 0x91, 0x18, 0x3A, 0x4D, 0x3B, 0x4B, 0x3A, 0x19, 0x00,
+0x91, 0xC3, 0xB5, 0xC3, 0xB2, 0xA2, 0x90, 0x98, 0x09, 0x1B, 0x3B, 0x3C,
+0x4A, 0x39, 0x79, 0x39, 0x6A, 0x4A, 0x3A, 0x2A, 0x89, 0xC1, 0xE3, 0xD2,
+0xD3, 0xB2, 0xA2, 0x91, 0x00, 0x49, 0x5C, 0x4B, 0x5B, 0x2A, 0x29, 0x09,
+0xA1, 0xD3, 0xC4, 0xC3, 0xB2, 0xB3, 0x91, 0x08, 0x3A, 0x4D, 0x4B, 0x4B,
+0x2A, 0x29, 0x19, 0x00, 0xA1, 0xB5, 0xC3, 0xC3, 0xB2, 0xA2, 0xA0, 0x88,
+0x09, 0x1B, 0x3A, 0x4B, 0x49, 0x59, 0x49, 0x6A, 0x3A, 0x4A, 0x2A, 0x09,
+0xB0, 0xE4, 0xD3, 0xC2, 0xC3, 0xB2, 0xA2, 0x81, 0x39, 0x5C, 0x5B, 0x4B,
+0x4B, 0x3A, 0x2A, 0x88, 0xB1, 0xC5, 0xC3, 0xC3, 0xB2, 0xA2, 0x91, 0x18,
+0x4B, 0x4C, 0x4B, 0x3B, 0x3A, 0x29, 0x19, 0x91, 0xC3, 0xB5, 0xC3, 0xB2,
+0xB2, 0xB1, 0xA1, 0x88, 0x0A, 0x19, 0x3A, 0x6A, 0x5A, 0x59, 0x4A, 0x6B,
+0x3A, 0x2A, 0x19, 0x89, 0xD2, 0xE3, 0xD3, 0xB2, 0xC3, 0xA2, 0x91, 0x00,
+0x5A, 0x5C, 0x4B, 0x4B, 0x2A, 0x29, 0x09, 0x90, 0xD3, 0xC4, 0xC3, 0xB2,
+0xB3, 0x91, 0x80, 0x29, 0x4C, 0x4C, 0x4B, 0x2A, 0x29, 0x19, 0x08, 0x91,
+0xC3, 0xC4, 0xB3, 0xC2, 0xA2, 0xA0, 0x91, 0x88, 0x19, 0x19, 0x5A, 0x5A,
+0x4A, 0x4A, 0x5B, 0x3A, 0x4B, 0x1A, 0x88, 0xB1, 0xE4, 0xD3, 0xC3, 0xC3,
+0xA2, 0x91, 0x00, 0x29, 0x6B, 0x5B, 0x4B, 0x4B, 0x2A, 0x19, 0x88, 0xB1,
+0xC5, 0xC3, 0xC3, 0xA2, 0xA1, 0x81, 0x08, 0x3A, 0x4C, 0x4B, 0x5B, 0x2A,
+0x29, 0x19, 0x08, 0xA1, 0xC3, 0xC4, 0xB2, 0xB2, 0xC2, 0xB2, 0xB2, 0xA1,
+0x01, 0x29, 0x6A, 0x6B, 0x4A, 0x5B, 0x4B, 0x2A, 0x2A, 0x19, 0x98, 0xD2,
+0xD4, 0xC3, 0xC3, 0xA2, 0xB2, 0x92, 0x18, 0x5A, 0x4C, 0x5B, 0x3B, 0x3A,
+0x3B, 0x09, 0xA1, 0xD3, 0xC4, 0xC3, 0xC3, 0xA2, 0xA1, 0x81, 0x19, 0x4A,
+0x4B, 0x4B, 0x5B, 0x2A, 0x29, 0x19, 0x08, 0x90, 0xE3, 0xC3, 0xB2, 0xB2,
+0xC2, 0xB2, 0xA2, 0x91, 0x01, 0x49, 0x7B, 0x4A, 0x4B, 0x5B, 0x3B, 0x2A,
+0x09, 0x88, 0xD2, 0xD4, 0xC3, 0xC3, 0xB3, 0xA2, 0x91, 0x00, 0x39, 0x5D,
+0x4B, 0x4B, 0x4B, 0x2A, 0x1A, 0x80, 0xB1, 0xC5, 0xC3, 0xC3, 0xA2, 0xA2,
+0x80, 0x08, 0x4A, 0x4B, 0x4B, 0x4B, 0x3A, 0x2A, 0x29, 0x19, 0x90, 0xC2,
+0xD4, 0xB2, 0xC3, 0xC2, 0xA2, 0xA1, 0xA2, 0x81, 0x10, 0x6A, 0x6B, 0x4B,
+0x5B, 0x3B, 0x4B, 0x1A, 0x88, 0x90, 0xE3, 0xC3, 0xC3, 0xC3, 0xB3, 0xA2,
+0x81, 0x28, 0x4C, 0x4C, 0x4B, 0x4B, 0x2A, 0x2A, 0x09, 0xA1, 0xD3, 0xC4,
+0xC3, 0xB3, 0xA2, 0xA1, 0x81, 0x29, 0x4B, 0x4C, 0x4B, 0x4B, 0x3A, 0x2A,
+0x19, 0x08, 0xA1, 0xC2, 0xD3, 0xD3, 0xB2, 0xB2, 0xC3, 0xA2, 0x92, 0x00,
+0x49, 0x5A, 0x5C, 0x4B, 0x4B, 0x3B, 0x2A, 0x1A, 0x98, 0xE3, 0xC4, 0xC3,
+0xC3, 0xB3, 0xA2, 0x92, 0x18, 0x4A, 0x4C, 0x4C, 0x3B, 0x4B, 0x2A, 0x09,
+0x80, 0xC2, 0xC4, 0xB3, 0xC3, 0xC3, 0xA2, 0x91, 0x18, 0x3A, 0x4C, 0x4B,
+0x4B, 0x3A, 0x3B, 0x3A, 0x09, 0xA1, 0xD3, 0xD3, 0xC3, 0xD3, 0xA2, 0xB2,
+0xA2, 0x91, 0x81, 0x38, 0x5C, 0x5B, 0x4B, 0x4B, 0x4B, 0x2A, 0x1A, 0x98,
+0xC2, 0xC4, 0xC3, 0xC3, 0xB3, 0xB3, 0xA2, 0x81, 0x49, 0x4D, 0x4C, 0x3B,
+0x4B, 0x2A, 0x2A, 0x88, 0xA1, 0xC4, 0xC4, 0xC3, 0xB3, 0xA2, 0x91, 0x80,
+0x19, 0x4A, 0x4C, 0x4B, 0x4B, 0x2A, 0x3A, 0x19, 0x08, 0x90, 0xC2, 0xD3,
+0xD3, 0xC3, 0xB2, 0xB3, 0xA2, 0x91, 0x10, 0x49, 0x5C, 0x5B, 0x4B, 0x4B,
+0x3B, 0x1A, 0x09, 0xB1, 0xD4, 0xC4, 0xC3, 0xB3, 0xB3, 0xA2, 0x92, 0x28,
+0x4C, 0x4C, 0x4B, 0x3B, 0x3B, 0x2A, 0x19, 0xA0, 0xC4, 0xC4, 0xB4, 0xC3,
+0xA2, 0xA2, 0x80, 0x08, 0x29, 0x4C, 0x4B, 0x4B, 0x4B, 0x2A, 0x29, 0x19,
+0x88, 0xA1, 0xD3, 0xD3, 0xD3, 0xC3, 0xA2, 0xB2, 0x92, 0x00, 0x18, 0x6A,
+0x5B, 0x4B, 0x4B, 0x3B, 0x3B, 0x1A, 0x88, 0xD2, 0xC4, 0xD3, 0xB3, 0xB4,
+0xA2, 0xA2, 0x81, 0x39, 0x4D, 0x4C, 0x3B, 0x4B, 0x3B, 0x1A, 0x08, 0xB1,
+0xB5, 0xC4, 0xC3, 0xB3, 0xA2, 0x91, 0x80, 0x29, 0x4C, 0x4C, 0x3B, 0x4B,
+0x3A, 0x2A, 0x29, 0x09, 0xA1, 0xC3, 0xE3, 0xC3, 0xD3, 0xB2, 0xB3, 0xB3,
+0xA2, 0x01, 0x59, 0x5C, 0x4B, 0x4B, 0x4B, 0x3B, 0x2B, 0x09, 0xA0, 0xD4,
+0xC4, 0xB3, 0xC3, 0xB3, 0xA3, 0x81, 0x29, 0x4C, 0x4C, 0x4B, 0x3C, 0x3B,
+0x2A, 0x09, 0xA1, 0xC3, 0xB5, 0xC3, 0xB3, 0xC3, 0xA2, 0x91, 0x18, 0x2A,
+0x4C, 0x4B, 0x4B, 0x4B, 0x2A, 0x29, 0x09, 0x80, 0xC2, 0xC3, 0xD3, 0xC3,
+0xC3, 0xB2, 0xB3, 0xA2, 0x92, 0x20, 0x5C, 0x5B, 0x4C, 0x4B, 0x3B, 0x3B,
+0x1A, 0x98, 0xC2, 0xC5, 0xC3, 0xB4, 0xB3, 0xA2, 0x92, 0x80, 0x39, 0x4E,
+0x3C, 0x4B, 0x3B, 0x3B, 0x2A, 0x88, 0xB2, 0xC5, 0xB4, 0xC3, 0xB3, 0xA2,
+0x91, 0x08, 0x3A, 0x3D, 0x4C, 0x4B, 0x4B, 0x2A, 0x3A, 0x2A, 0x19, 0x90,
+0xC2, 0xD4, 0xC3, 0xB2, 0xC3, 0xB3, 0xB2, 0xA3, 0x01, 0x49, 0x5C, 0x5B,
+0x4C, 0x3B, 0x3B, 0x2B, 0x09, 0xB1, 0xC4, 0xC4, 0xB4, 0xC3, 0xB3, 0x92,
+0x81, 0x29, 0x4C, 0x3C, 0x4C, 0x3B, 0x3B, 0x2A, 0x09, 0xA1, 0xC4, 0xB4,
+0xB4, 0xC3, 0xB3, 0xA2, 0x80, 0x08, 0x2A, 0x4C, 0x4C, 0x4B, 0x3B, 0x3A,
+0x3A, 0x2A, 0x88, 0xB1, 0xD4, 0xC4, 0xC3, 0xB2, 0xC3, 0xB3, 0x92, 0x81,
+0x28, 0x6B, 0x4C, 0x4B, 0x4B, 0x3B, 0x2B, 0x1A, 0x90, 0xD2, 0xC5, 0xB3,
+0xC4, 0xB3, 0xA3, 0x91, 0x00, 0x3A, 0x4D, 0x4C, 0x3B, 0x3B, 0x3B, 0x1A,
+0x80, 0xB2, 0xC5, 0xB4, 0xC3, 0xB3, 0xB3, 0x91, 0x80, 0x19, 0x4C, 0x4B,
+0x4C, 0x3B, 0x3A, 0x4B, 0x2A, 0x19, 0x88, 0xB2, 0xE3, 0xC3, 0xD3, 0xC3,
+0xB3, 0xA2, 0xA2, 0x01, 0x49, 0x5C, 0x4C, 0x3B, 0x3C, 0x2A, 0x2A, 0x89,
+0xA1, 0xD4, 0xC4, 0xB3, 0xB4, 0xB3, 0x92, 0x00, 0x29, 0x4C, 0x3D, 0x4B,
+0x3C, 0x3B, 0x2A, 0x09, 0x91, 0xC3, 0xC4, 0xB4, 0xB3, 0xC3, 0xA2, 0x91,
+0x08, 0x19, 0x4B, 0x4C, 0x4B, 0x4B, 0x3A, 0x2A, 0x19, 0x08, 0xA0, 0xD3,
+0xD3, 0xD3, 0xC3, 0xB3, 0xC3, 0x92, 0x81, 0x18, 0x5A, 0x4C, 0x4B, 0x3C,
+0x3B, 0x3B, 0x1A, 0x88, 0xD2, 0xC4, 0xB4, 0xB4, 0xB3, 0xB3, 0x92, 0x18,
+0x4B, 0x4D, 0x3C, 0x3B, 0x3B, 0x3B, 0x2A, 0x88, 0xC3, 0xB5, 0xC4, 0xB3,
+0xB4, 0xB2, 0xA2, 0x91, 0x18, 0x3B, 0x4D, 0x4B, 0x4B, 0x4B, 0x2A, 0x29,
+0x19, 0x88, 0xB1, 0xD4, 0xD3, 0xC3, 0xC3, 0xB3, 0xA2, 0x92, 0x00, 0x49,
+0x5C, 0x4B, 0x3C, 0x4B, 0x2B, 0x2A, 0x89, 0xB2, 0xC4, 0xC4, 0xB4, 0xB3,
+0xB3, 0xA3, 0x00, 0x29, 0x4D, 0x3C, 0x3C, 0x3B, 0x3B, 0x3B, 0x19, 0xA1,
+0xC5, 0xB4, 0xB4, 0xC3, 0xB3, 0xA2, 0xA1, 0x80, 0x29, 0x4D, 0x3C, 0x5B,
+0x3B, 0x3A, 0x3A, 0x2A, 0x88, 0xA1, 0xE4, 0xC3, 0xD3, 0xC3, 0xB3, 0xA2,
+0xA2, 0x01, 0x28, 0x5C, 0x5B, 0x3C, 0x4B, 0x2B, 0x2A, 0x09, 0xA0, 0xC3,
+0xC5, 0xB4, 0xC3, 0xA3, 0xA2, 0x81, 0x08, 0x4A, 0x3D, 0x4C, 0x3C, 0x3B,
+0x3B, 0x09, 0x80, 0xB2, 0xB5, 0xB4, 0xB4, 0xC3, 0xA2, 0x91, 0x90, 0x18,
+0x3C, 0x4C, 0x4B, 0x4B, 0x3B, 0x3A, 0x3A, 0x09, 0x90, 0xD3, 0xC4, 0xD3,
+0xC3, 0xA2, 0xB2, 0xA3, 0x81, 0x28, 0x6B, 0x4C, 0x4B, 0x3B, 0x3C, 0x3B,
+0x1A, 0x98, 0xC2, 0xC5, 0xB4, 0xB4, 0xB3, 0xB3, 0x92, 0x00, 0x3A, 0x4E,
+0x3C, 0x3C, 0x3B, 0x3B, 0x2A, 0x09, 0x91, 0xC4, 0xB5, 0xB3, 0xB4, 0xB2,
+0xB3, 0xA1, 0x00, 0x3B, 0x4D, 0x4C, 0x4B, 0x3B, 0x3A, 0x2A, 0x29, 0x09,
+0xB1, 0xD4, 0xD3, 0xC3, 0xC3, 0xB3, 0xB3, 0x92, 0x00, 0x49, 0x5C, 0x4C,
+0x3B, 0x3C, 0x3B, 0x2B, 0x09, 0xB1, 0xC5, 0xB4, 0xC4, 0xB3, 0xA4, 0x91,
+0x91, 0x00, 0x3A, 0x3D, 0x3D, 0x3B, 0x3C, 0x2A, 0x19, 0x80, 0xB2, 0xB6,
+0xB4, 0xB4, 0xC3, 0xA2, 0x91, 0x90, 0x08, 0x3A, 0x4D, 0x4C, 0x4B, 0x3B,
+0x3A, 0x2A, 0x19, 0x90, 0xD2, 0xC4, 0xC3, 0xC3, 0xC3, 0xB3, 0x92, 0x91,
+0x10, 0x4A, 0x5C, 0x3C, 0x4B, 0x3B, 0x2B, 0x1A, 0x88, 0xC2, 0xC4, 0xB4,
+0xB4, 0xB4, 0xB3, 0x92, 0x00, 0x3A, 0x3D, 0x3D, 0x3C, 0x3C, 0x2A, 0x2A,
+0x08, 0x90, 0xB4, 0xB5, 0xB4, 0xC3, 0xB3, 0xA2, 0xA1, 0x80, 0x3A, 0x3D,
+0x4C, 0x4B, 0x4B, 0x3A, 0x3B, 0x2A, 0x08, 0xA0, 0xE3, 0xC4, 0xC3, 0xC3,
+0xB3, 0xA2, 0xA2, 0x01, 0x49, 0x4C, 0x4C, 0x3B, 0x3C, 0x3B, 0x2B, 0x09,
+0xB1, 0xC5, 0xB4, 0xB4, 0xB4, 0xB3, 0xA3, 0x91, 0x18, 0x4C, 0x3C, 0x3D,
+0x3B, 0x3C, 0x2A, 0x19, 0x90, 0xB3, 0xB6, 0xB4, 0xB4, 0xC3, 0xA2, 0xA1,
+0x81, 0x2A, 0x3B, 0x4E, 0x4B, 0x4B, 0x3B, 0x3A, 0x2A, 0x19, 0xA0, 0xD3,
+0xC4, 0xC3, 0xC3, 0xC3, 0xB3, 0x92, 0x81, 0x18, 0x5A, 0x4C, 0x3C, 0x4B,
+0x3B, 0x2B, 0x1A, 0x88, 0xC2, 0xC5, 0xB4, 0xB4, 0xB3, 0xB3, 0x92, 0x00,
+0x3A, 0x3E, 0x3D, 0x3C, 0x3B, 0x3B, 0x2A, 0x88, 0xA2, 0xB6, 0xB5, 0xB4,
+0xC3, 0xB3, 0xA2, 0x90, 0x00, 0x3B, 0x4C, 0x4C, 0x3B, 0x4B, 0x3A, 0x3B,
+0x19, 0x88, 0xC2, 0xC4, 0xD3, 0xC3, 0xB3, 0xC3, 0xA3, 0x91, 0x10, 0x4A,
+0x5C, 0x3C, 0x4B, 0x3C, 0x2B, 0x19, 0x89, 0xA2, 0xD3, 0xB5, 0xB4, 0xB3,
+0xB3, 0xA3, 0x81, 0x3A, 0x3D, 0x3E, 0x3C, 0x3C, 0x3B, 0x2A, 0x19, 0x90,
+0xB4, 0xB5, 0xB4, 0xB4, 0xC3, 0xA2, 0x91, 0x80, 0x19, 0x3C, 0x4B, 0x4C,
+0x4B, 0x3B, 0x3A, 0x2A, 0x09, 0xA1, 0xD3, 0xC4, 0xC3, 0xC3, 0xB3, 0xB3,
+0x92, 0x00, 0x39, 0x5C, 0x4C, 0x3C, 0x4B, 0x2C, 0x2A, 0x09, 0x90, 0xB2,
+0xB5, 0xB5, 0xB4, 0xB3, 0xB3, 0x92, 0x00, 0x4B, 0x3D, 0x3D, 0x3C, 0x3B,
+0x3B, 0x1A, 0x80, 0xB3, 0xB6, 0xB5, 0xB4, 0xB3, 0xC3, 0xA2, 0x80, 0x19,
+0x3B, 0x4D, 0x3C, 0x4B, 0x4B, 0x2A, 0x19, 0x08, 0x90, 0xB2, 0xC5, 0xC3,
+0xC3, 0xB3, 0xC3, 0xA3, 0x91, 0x10, 0x4A, 0x4C, 0x3C, 0x3C, 0x3C, 0x3B,
+0x1A, 0x09, 0xB2, 0xC4, 0xB5, 0xB4, 0xB4, 0xB3, 0xA3, 0x91, 0x18, 0x3C,
+0x3E, 0x3C, 0x3C, 0x3B, 0x3B, 0x19, 0x80, 0xC3, 0xB6, 0xB4, 0xB4, 0xB3,
+0xB2, 0x91, 0x80, 0x2A, 0x4C, 0x3D, 0x4B, 0x4B, 0x2A, 0x2A, 0x18, 0x88,
+0xA1, 0xC4, 0xD3, 0xC3, 0xB3, 0xC3, 0xB3, 0x92, 0x81, 0x28, 0x5C, 0x4C,
+0x3C, 0x3B, 0x3C, 0x2B, 0x19, 0x98, 0xC3, 0xB5, 0xB4, 0xB5, 0xB3, 0xB3,
+0x92, 0x08, 0x3A, 0x3F, 0x3D, 0x3C, 0x3B, 0x3B, 0x2A, 0x80, 0xA2, 0xB5,
+0xB5, 0xB4, 0xC3, 0xA2, 0x91, 0x90, 0x08, 0x4B, 0x3C, 0x4C, 0x3B, 0x4B,
+0x3A, 0x2A, 0x08, 0x90, 0xC3, 0xC4, 0xC3, 0xD3, 0xB3, 0xB3, 0xA2, 0x92,
+0x10, 0x5B, 0x4D, 0x4B, 0x3C, 0x3C, 0x2B, 0x19, 0x88, 0xA1, 0xC5, 0xB4,
+0xB4, 0xB4, 0xB3, 0xA3, 0x80, 0x18, 0x3C, 0x3E, 0x3C, 0x3C, 0x3B, 0x2A,
+0x19, 0x91, 0xB3, 0xB6, 0xB4, 0xB4, 0xC3, 0xA2, 0x90, 0x00, 0x3B, 0x3C,
+0x4D, 0x3B, 0x4B, 0x2A, 0x29, 0x19, 0x08, 0xB2, 0xD3, 0xC4, 0xC3, 0xC3,
+0xB3, 0xC3, 0x92, 0x81, 0x39, 0x4C, 0x3C, 0x4C, 0x3C, 0x3B, 0x2B, 0x09,
+0x90, 0xB3, 0xB7, 0xB4, 0xB5, 0xB3, 0xB3, 0x92, 0x08, 0x3B, 0x3F, 0x3C,
+0x3C, 0x3C, 0x2A, 0x19, 0x08, 0xA2, 0xB4, 0xB5, 0xB4, 0xC3, 0xB3, 0xB2,
+0x91, 0x08, 0x3B, 0x3E, 0x4C, 0x4B, 0x2A, 0x3A, 0x3A, 0x1A, 0x80, 0xB1,
+0xC5, 0xC3, 0xC4, 0xB3, 0xC3, 0x92, 0x91, 0x10, 0x4B, 0x4C, 0x3C, 0x3C,
+0x3C, 0x3B, 0x1A, 0x88, 0xA2, 0xC4, 0xB5, 0xB4, 0xB4, 0xB3, 0xA3, 0x80,
+0x19, 0x3C, 0x3E, 0x3C, 0x3C, 0x3B, 0x2A, 0x19, 0x81, 0xB3, 0xB6, 0xB5,
+0xB3, 0xC3, 0xB2, 0x91, 0x08, 0x2A, 0x4D, 0x3C, 0x4B, 0x3B, 0x3A, 0x3B,
+0x19, 0x80, 0xB2, 0xC5, 0xC4, 0xC3, 0xB3, 0xC3, 0xB3, 0x92, 0x00, 0x39,
+0x4D, 0x3D, 0x3C, 0x3C, 0x3B, 0x3B, 0x1A, 0x80, 0xD3, 0xB5, 0xB5, 0xB4,
+0xB3, 0xB3, 0x92, 0x08, 0x3B, 0x3F, 0x3D, 0x3B, 0x3C, 0x2A, 0x19, 0x80,
+0xA2, 0xB5, 0xB5, 0xB4, 0xC3, 0xA2, 0x91, 0x80, 0x2A, 0x3C, 0x3D, 0x4B,
+0x3B, 0x4B, 0x2A, 0x29, 0x08, 0x90, 0xC3, 0xC4, 0xC3, 0xB4, 0xC3, 0xB3,
+0x92, 0x80, 0x18, 0x5B, 0x3D, 0x4C, 0x3C, 0x3B, 0x2C, 0x19, 0x88, 0xA2,
+0xB4, 0xB6, 0xB4, 0xB4, 0xB3, 0x92, 0x80, 0x2A, 0x3D, 0x3D, 0x3D, 0x3B,
+0x3B, 0x2A, 0x08, 0xA2, 0xB5, 0xB5, 0xB4, 0xB4, 0xA2, 0xA1, 0x91, 0x18,
+0x2C, 0x4C, 0x3C, 0x3B, 0x3A, 0x3B, 0x29, 0x19, 0xA1, 0xC4, 0xC4, 0xC3,
+0xB4, 0xC3, 0xB3, 0xB3, 0x92, 0x00, 0x4A, 0x4D, 0x3C, 0x3C, 0x3C, 0x3B,
+0x2B, 0x09, 0x91, 0xC4, 0xB5, 0xB5, 0xB4, 0xB3, 0xA3, 0x80, 0x08, 0x4B,
+0x3E, 0x3C, 0x3C, 0x3B, 0x2B, 0x08, 0x91, 0xB4, 0xB5, 0xB4, 0xB4, 0xB3,
+0xA2, 0x91, 0x09, 0x3A, 0x3D, 0x3D, 0x4B, 0x3B, 0x2A, 0x29, 0x19, 0x80,
+0xA1, 0xC5, 0xC3, 0xB4, 0xC3, 0xB4, 0xA2, 0xA2, 0x81, 0x39, 0x4C, 0x3E,
+0x3C, 0x3C, 0x3B, 0x3B, 0x1A, 0x90, 0xC3, 0xB7, 0xB4, 0xB4, 0xB4, 0xA2,
+0x92, 0x08, 0x29, 0x3E, 0x3C, 0x3C, 0x3C, 0x3B, 0x1A, 0x00, 0xA1, 0xB5,
+0xB5, 0xB4, 0xB3, 0xA2, 0x91, 0x80, 0x2A, 0x3C, 0x3E, 0x3B, 0x4B, 0x3B,
+0x2A, 0x19, 0x80, 0xA2, 0xC4, 0xB4, 0xC3, 0xC4, 0xB3, 0xB3, 0xB3, 0x92,
+0x00, 0x5B, 0x3D, 0x3D, 0x3C, 0x3C, 0x3B, 0x3B, 0x09, 0xA2, 0xC4, 0xB6,
+0xB4, 0xB4, 0xB3, 0xB3, 0x81, 0x19, 0x3D, 0x3D, 0x3D, 0x3B, 0x3B, 0x2A,
+0x08, 0xA2, 0xB5, 0xB6, 0xB4, 0xB3, 0xC3, 0xA2, 0x91, 0x08, 0x4B, 0x3C,
+0x3C, 0x4B, 0x3B, 0x2A, 0x19, 0x08, 0x91, 0xB3, 0xC4, 0xC4, 0xB4, 0xC3,
+0xB3, 0xB3, 0xA3, 0x80, 0x28, 0x3F, 0x3C, 0x3D, 0x4B, 0x3C, 0x3B, 0x1A,
+0x80, 0xB2, 0xB6, 0xC5, 0xA4, 0xB2, 0xB3, 0x92, 0x08, 0x3A, 0x3F, 0x3C,
+0x3C, 0x3B, 0x3B, 0x2A, 0x88, 0xB3, 0xB7, 0xB4, 0xB4, 0xB3, 0xA2, 0x91,
+0x08, 0x1A, 0x4C, 0x3C, 0x3C, 0x3B, 0x3A, 0x2A, 0x08, 0x80, 0xB3, 0xB4,
+0xC4, 0xB5, 0xB2, 0xB5, 0xB2, 0xA3, 0x91, 0x80, 0x4A, 0x3E, 0x3D, 0x3C,
+0x3C, 0x4B, 0x1A, 0x18, 0x90, 0xB4, 0xB5, 0xB5, 0xB3, 0xC4, 0x92, 0x80,
+0x19, 0x3C, 0x3D, 0x3C, 0x3C, 0x2A, 0x2A, 0x08, 0xA2, 0xB5, 0xB5, 0xB3,
+0xC4, 0xA2, 0xA2, 0x00, 0x2A, 0x3C, 0x3D, 0x3B, 0x3C, 0x2A, 0x2A, 0x08,
+0x80, 0x92, 0xB3, 0xB5, 0xB4, 0xC4, 0xB3, 0xB4, 0xA2, 0xB2, 0x92, 0x2A,
+0x3C, 0x3F, 0x3D, 0x3C, 0x3B, 0x3B, 0x19, 0x80, 0xB5, 0xB6, 0xB5, 0xB4,
+0xC3, 0xA2, 0xA2, 0x00, 0x3B, 0x3E, 0x3D, 0x3C, 0x3B, 0x2A, 0x08, 0x91,
+0xB4, 0xB5, 0xB4, 0xB4, 0xB3, 0xA2, 0x80, 0x29, 0x2C, 0x4C, 0x2C, 0x3A,
+0x2C, 0x19, 0x08, 0x91, 0xA2, 0xA4, 0xB3, 0xB4, 0xB4, 0xB3, 0xB4, 0xA2,
+0xA1, 0x80, 0x09, 0x3C, 0x3F, 0x3D, 0x3D, 0x4B, 0x3B, 0x2A, 0x19, 0xB2,
+0xB6, 0xB5, 0xB5, 0xB3, 0xC3, 0x92, 0x80, 0x19, 0x3D, 0x3D, 0x3C, 0x3C,
+0x2A, 0x2A, 0x08, 0xB2, 0xB6, 0xB5, 0xB4, 0xB3, 0xA2, 0x91, 0x18, 0x3B,
+0x3D, 0x3D, 0x2B, 0x4B, 0x1A, 0x18, 0x88, 0x92, 0xA2, 0xA5, 0xB2, 0xA5,
+0xB2, 0xA4, 0xB2, 0xB2, 0xA2, 0xA0, 0x28, 0x2F, 0x4D, 0x2D, 0x3A, 0x3C,
+0x3A, 0x2A, 0x80, 0xA2, 0xB7, 0xB5, 0xB4, 0xC3, 0xB3, 0x91, 0x08, 0x3B,
+0x3F, 0x3C, 0x3C, 0x3B, 0x2A, 0x18, 0xA1, 0xB4, 0xB6, 0xB4, 0xB3, 0xB3,
+0x92, 0x88, 0x3A, 0x3E, 0x2C, 0x4B, 0x2B, 0x2A, 0x19, 0x90, 0x92, 0xA4,
+0xB3, 0xA6, 0xA2, 0xA4, 0xA1, 0xB3, 0xA1, 0xC2, 0x80, 0x99, 0x19, 0x3F,
+0x3F, 0x3C, 0x4C, 0x2A, 0x3A, 0x19, 0x90, 0xB5, 0xB5, 0xB5, 0xC3, 0xB3,
+0xA2, 0x80, 0x2A, 0x3D, 0x3D, 0x3C, 0x4B, 0x3B, 0x2A, 0x80, 0xB2, 0xB7,
+0xB4, 0xB4, 0xA2, 0xB3, 0x00, 0x19, 0x3C, 0x3C, 0x3D, 0x2B, 0x2A, 0x2A,
+0x08, 0x91, 0xB3, 0xA5, 0xA3, 0xB3, 0xA5, 0x91, 0xB3, 0xA1, 0xC3, 0xB0,
+0x91, 0x0C, 0x2A, 0x3F, 0x3E, 0x4D, 0x3B, 0x3A, 0x29, 0x88, 0xA5, 0xD4,
+0xB5, 0xB3, 0xC3, 0x92, 0x90, 0x29, 0x3D, 0x3D, 0x3C, 0x3B, 0x3B, 0x2A,
+0x80, 0xB3, 0xB7, 0xB4, 0xB4, 0xB3, 0xA3, 0x80, 0x19, 0x4B, 0x2E, 0x3B,
+0x3B, 0x2C, 0x19, 0x88, 0xA2, 0xA4, 0xA4, 0xA3, 0xB4, 0x93, 0xA1, 0x92,
+0x90, 0xD0, 0x01, 0xB9, 0x2A, 0x0B, 0x4F, 0x2D, 0x5C, 0x2B, 0x39, 0x19,
+0x00, 0xC3, 0xB6, 0xB5, 0xC3, 0xB4, 0xA2, 0x91, 0x18, 0x3D, 0x3C, 0x3D,
+0x3B, 0x2C, 0x29, 0x88, 0xA2, 0xB5, 0xB5, 0xB4, 0xA3, 0xA2, 0x91, 0x29,
+0x3B, 0x3F, 0x2C, 0x3B, 0x2B, 0x1A, 0x08, 0xB2, 0xB5, 0xA5, 0xB3, 0xA4,
+0x92, 0x81, 0x00, 0x09, 0x29, 0x0B, 0x2C, 0x1B, 0x1E, 0x2B, 0x3C, 0x3E,
+0x4B, 0x3B, 0x18, 0x01, 0xB3, 0xB7, 0xB7, 0xB4, 0xB3, 0xB3, 0x91, 0x08,
+0x4C, 0x2E, 0x4B, 0x2C, 0x3A, 0x1A, 0x08, 0xB2, 0xB6, 0xB4, 0xB5, 0xA3,
+0xA2, 0x81, 0x19, 0x3A, 0x3E, 0x2C, 0x3B, 0x2C, 0x09, 0x88, 0x92, 0xC2,
+0xA5, 0xA3, 0xA3, 0x92, 0x92, 0x82, 0x1A, 0x88, 0x1C, 0x0A, 0x1C, 0x2C,
+0x2D, 0x2C, 0x4B, 0x3C, 0x3A, 0x29, 0x01, 0xB3, 0xB7, 0xB7, 0xB5, 0xB3,
+0xB3, 0x81, 0x19, 0x3D, 0x3D, 0x3D, 0x2C, 0x3A, 0x2B, 0x08, 0xA1, 0xB6,
+0xB4, 0xB5, 0xA4, 0xA2, 0x81, 0x08, 0x3A, 0x2E, 0x4B, 0x2C, 0x2A, 0x1A,
+0x09, 0xA1, 0xB3, 0xB6, 0xA4, 0xA3, 0x92, 0x81, 0x10, 0x2B, 0x4A, 0x1D,
+0x19, 0x1C, 0x19, 0x1B, 0x2B, 0x3B, 0x2E, 0x49, 0x1A, 0x12, 0xA1, 0xA7,
+0xB5, 0xB6, 0xB3, 0xB3, 0xA2, 0x08, 0x4C, 0x2D, 0x3C, 0x3C, 0x2B, 0x3B,
+0x88, 0xA2, 0xB6, 0xA5, 0xC4, 0xA3, 0xA2, 0x82, 0x09, 0x39, 0x2F, 0x4B,
+0x2C, 0x2A, 0x0A, 0x08, 0x90, 0xB3, 0xB4, 0xA5, 0xA3, 0xA4, 0x81, 0x81,
+0x18, 0x1A, 0x19, 0x1E, 0x09, 0x1B, 0x1A, 0x2D, 0x3C, 0x2B, 0x6B, 0x19,
+0x00, 0xA2, 0xA7, 0xB4, 0xB6, 0xB3, 0xA3, 0xA1, 0x10, 0x2E, 0x4C, 0x2D,
+0x3A, 0x2C, 0x19, 0x09, 0x91, 0xC3, 0xA6, 0xC3, 0xA4, 0xA2, 0x81, 0x80,
+0x29, 0x3C, 0x3D, 0x2C, 0x2B, 0x2A, 0x89, 0x80, 0xC2, 0xA4, 0xB4, 0x94,
+0xA2, 0x93, 0x81, 0x81, 0x1A, 0x08, 0x2D, 0x0B, 0x3C, 0x1D, 0x3C, 0x2C,
+0x3B, 0x4B, 0x19, 0x18, 0xA4, 0xA5, 0xB6, 0xB5, 0xB3, 0xA3, 0xA1, 0x10,
+0x2C, 0x3F, 0x3C, 0x2D, 0x3A, 0x1B, 0x08, 0x80, 0xC3, 0xB5, 0xB5, 0xA4,
+0xB3, 0x92, 0x81, 0x29, 0x3D, 0x3C, 0x2D, 0x2A, 0x2B, 0x0A, 0x08, 0xA0,
+0xA5, 0xB3, 0xA5, 0xA4, 0x92, 0x93, 0x90, 0x82, 0x09, 0x1A, 0x2E, 0x1C,
+0x3B, 0x2F, 0x2A, 0x2C, 0x19, 0x29, 0x80, 0xB4, 0xA6, 0xB4, 0xB5, 0xB4,
+0xB3, 0x92, 0x08, 0x29, 0x3F, 0x3C, 0x2D, 0x2A, 0x1A, 0x19, 0xA0, 0xA4,
+0xC4, 0xA4, 0xB4, 0xA3, 0x92, 0x81, 0x29, 0x3C, 0x3C, 0x2E, 0x1A, 0x2A,
+0x1B, 0x88, 0x80, 0xC3, 0xA4, 0xA4, 0xA4, 0xA3, 0xA3, 0xA3, 0x92, 0x00,
+0x1B, 0x2E, 0x2D, 0x2C, 0x2C, 0x3C, 0x3B, 0x3C, 0x1A, 0x00, 0x92, 0xB6,
+0xA7, 0xB3, 0xB4, 0xB3, 0xB3, 0x00, 0x2A, 0x3F, 0x3D, 0x3C, 0x2C, 0x2A,
+0x09, 0x90, 0xB3, 0xB5, 0xB5, 0xA4, 0xB3, 0xA3, 0x92, 0x28, 0x3D, 0x4C,
+0x2D, 0x2A, 0x2B, 0x1A, 0x89, 0x80, 0xC2, 0xA5, 0xB3, 0xA5, 0xA3, 0xA3,
+0x82, 0x90, 0x01, 0x1A, 0x2D, 0x2C, 0x2D, 0x2C, 0x3B, 0x2D, 0x2A, 0x19,
+0x08, 0xA3, 0xB6, 0xA7, 0xB3, 0xB4, 0xB3, 0xA3, 0x00, 0x4B, 0x3D, 0x3E,
+0x3C, 0x2C, 0x2A, 0x09, 0x88, 0xB2, 0xB5, 0xB5, 0xA4, 0xB3, 0xA3, 0x92,
+0x00, 0x4A, 0x3D, 0x3C, 0x2D, 0x2A, 0x2B, 0x0A, 0x90, 0xA1, 0xB5, 0xA4,
+0xB4, 0xA4, 0x93, 0xA2, 0x01, 0x90, 0x18, 0x2B, 0x3E, 0x1E, 0x3A, 0x2D,
+0x3B, 0x2C, 0x19, 0x08, 0x92, 0xB4, 0xB7, 0xB5, 0xB4, 0xA3, 0xA2, 0x00,
+0x19, 0x4C, 0x3D, 0x3C, 0x2C, 0x2A, 0x1A, 0x08, 0xB1, 0xB4, 0xB6, 0xB4,
+0xA4, 0xA2, 0x92, 0x81, 0x29, 0x4B, 0x3E, 0x3B, 0x2D, 0x1A, 0x19, 0x0A,
+0x90, 0xB3, 0xC4, 0xA5, 0xB3, 0x94, 0xA2, 0xA3, 0x81, 0x91, 0x3A, 0x2E,
+0x2C, 0x3D, 0x2C, 0x3B, 0x3C, 0x1A, 0x19, 0xA2, 0xB4, 0xB7, 0xA5, 0xB3,
+0xB3, 0xB3, 0x81, 0x19, 0x4C, 0x3E, 0x3C, 0x3C, 0x2B, 0x2A, 0x09, 0x90,
+0xC3, 0xB5, 0xB5, 0xB4, 0xA3, 0xA2, 0x82, 0x29, 0x4B, 0x3C, 0x3D, 0x3C,
+0x2C, 0x1A, 0x09, 0x90, 0xA1, 0xB4, 0xA4, 0xB4, 0xA4, 0xA3, 0xA3, 0xA3,
+0x91, 0x39, 0x2D, 0x3D, 0x2E, 0x3B, 0x2D, 0x3A, 0x2B, 0x19, 0x90, 0xB4,
+0xA7, 0xB3, 0xB5, 0xB3, 0xB3, 0xA3, 0x18, 0x3B, 0x3F, 0x3D, 0x3C, 0x3B,
+0x2C, 0x19, 0x98, 0xB3, 0xC4, 0xB5, 0xA4, 0xA2, 0xB3, 0x82, 0x08, 0x4A,
+0x3C, 0x3C, 0x2D, 0x2A, 0x2B, 0x2A, 0x2B, 0xA0, 0x92, 0xC4, 0xA5, 0xA4,
+0xB3, 0xB5, 0xA3, 0xA2, 0x81, 0x2A, 0x3D, 0x2D, 0x3D, 0x3C, 0x3C, 0x2B,
+0x19, 0x08, 0x91, 0xB5, 0xB5, 0xB5, 0xB4, 0xA2, 0xA3, 0x80, 0x29, 0x4D,
+0x2C, 0x4B, 0x2C, 0x2A, 0x2A, 0x88, 0xA1, 0xB4, 0xB5, 0xB4, 0xB4, 0xA3,
+0x92, 0x00, 0x19, 0x4B, 0x3C, 0x3D, 0x2B, 0x2C, 0x2A, 0x1A, 0x88, 0x90,
+0xB5, 0xB4, 0xA6, 0xB3, 0xA4, 0xA2, 0xA3, 0x91, 0x18, 0x3D, 0x2D, 0x3C,
+0x3D, 0x3C, 0x2C, 0x19, 0x08, 0x91, 0xC3, 0xB5, 0xB5, 0xB3, 0xA4, 0xA2,
+0x00, 0x19, 0x4C, 0x3C, 0x3D, 0x2B, 0x2A, 0x2A, 0x09, 0x90, 0xC4, 0xB4,
+0xB5, 0xB4, 0xA3, 0xA2, 0x81, 0x18, 0x2A, 0x4C, 0x3C, 0x3C, 0x2C, 0x2A,
+0x2B, 0x09, 0x88, 0xA2, 0xB4, 0xB6, 0xA5, 0xB3, 0xA4, 0xB2, 0x82, 0x80,
+0x4B, 0x3D, 0x2D, 0x4B, 0x2D, 0x2A, 0x2A, 0x09, 0x91, 0xB4, 0xB5, 0xB5,
+0xB4, 0xB3, 0xA3, 0x91, 0x18, 0x4B, 0x3D, 0x3D, 0x3C, 0x3B, 0x2B, 0x19,
+0x88, 0xB2, 0xB6, 0xB4, 0xB4, 0xB4, 0xA3, 0xA2, 0x00, 0x18, 0x4C, 0x3C,
+0x3C, 0x2C, 0x3B, 0x1A, 0x2A, 0x89, 0xA2, 0xC4, 0xA5, 0xB3, 0xB6, 0xA3,
+0xB3, 0x92, 0x91, 0x29, 0x3E, 0x3D, 0x3D, 0x2C, 0x2A, 0x3B, 0x09, 0x80,
+0xB3, 0xB7, 0xB4, 0xB5, 0xB3, 0xA4, 0x91, 0x18, 0x2A, 0x3D, 0x3C, 0x3D,
+0x3B, 0x2B, 0x19, 0x88, 0xB2, 0xB5, 0xB5, 0xB4, 0xB4, 0xA3, 0xB2, 0x82,
+0x08, 0x3A, 0x3D, 0x3D, 0x3B, 0x3D, 0x2B, 0x2B, 0x08, 0x98, 0xA4, 0xB4,
+0xB5, 0xB5, 0xB4, 0xA3, 0xB3, 0x81, 0x00, 0x2C, 0x4D, 0x3C, 0x2D, 0x3A,
+0x2C, 0x19, 0x19, 0xA1, 0xB4, 0xB5, 0xB5, 0xB4, 0xB3, 0xA2, 0x81, 0x29,
+0x3C, 0x3D, 0x3C, 0x3C, 0x3B, 0x2B, 0x19, 0x90, 0xC3, 0xB5, 0xB5, 0xB3,
+0xA4, 0xA2, 0x91, 0x00, 0x3A, 0x3C, 0x3E, 0x3B, 0x3D, 0x2B, 0x2A, 0x1A,
+0x08, 0x90, 0xA5, 0xD3, 0xA6, 0xC3, 0xA4, 0xB2, 0x92, 0x91, 0x29, 0x3C,
+0x3E, 0x3C, 0x2C, 0x3A, 0x2C, 0x08, 0x80, 0xB2, 0xB6, 0xB5, 0xB4, 0xA3,
+0xB2, 0x92, 0x08, 0x4B, 0x3C, 0x3E, 0x3B, 0x2C, 0x29, 0x0A, 0x81, 0xB1,
+0xA6, 0xB3, 0xC5, 0xA3, 0xB3, 0xA2, 0x91, 0x18, 0x3A, 0x3E, 0x3C, 0x3D,
+0x3B, 0x2C, 0x2A, 0x1A, 0x81, 0xB1, 0xA6, 0xB4, 0xB5, 0xB4, 0xB3, 0xA3,
+0x80, 0x00, 0x3D, 0x3C, 0x3E, 0x3C, 0x2B, 0x3A, 0x2B, 0x08, 0xB2, 0xB6,
+0xB5, 0xB5, 0xB3, 0xB4, 0xA2, 0x81, 0x19, 0x4B, 0x3E, 0x3C, 0x3B, 0x2B,
+0x2A, 0x19, 0x90, 0xA3, 0xC6, 0xA4, 0xC3, 0xB3, 0xB3, 0x92, 0x91, 0x3A,
+0x4B, 0x2F, 0x3A, 0x3D, 0x2B, 0x3A, 0x2C, 0x08, 0x08, 0xC3, 0xB4, 0xB6,
+0xB4, 0xB3, 0xB3, 0xA3, 0x91, 0x2A, 0x4C, 0x3F, 0x2B, 0x4C, 0x2B, 0x19,
+0x08, 0x80, 0xC3, 0xB5, 0xB5, 0xB3, 0xB4, 0x92, 0x80, 0x08, 0x4B, 0x3C,
+0x3D, 0x3C, 0x3B, 0x2B, 0x19, 0x08, 0xB2, 0xB5, 0xB5, 0xB4, 0xB4, 0xB3,
+0xB3, 0x92, 0x18};
@@ -0,0 +1,138 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file chat_history.c
+/// \brief History of received chat messages (fixed size ring arena)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// The messages are kept as records in a ring of CHAT_HISTORY_SIZE bytes,
+/// the oldest ones are removed to make room for a new one. A record is:
+/// - text length (2 bytes, MSB first)
+/// - source station (CHAT_HISTORY_ERROR for a MAC error message)
+/// - text (without end of string, can wrap at end of arena)
+/// The LCD thread uses it to display again the receive console.
+//////////////////////////////////////////////////////////////////////////////////
+#include "stm32f7xx_hal.h"
+
+#include <stdio.h>
+#include <string.h>
+#include "main.h"
+
+#define RECORD_HEADER			3						// length and station bytes
+
+static uint8_t arena[CHAT_HISTORY_SIZE];	// records ring
+static uint16_t oldest;									// offset of oldest record
+static uint16_t used;										// bytes of records
+static char recordText[CHAT_HISTORY_TEXT];	// text of record (with end of string)
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Write a byte at an offset of the ring
+//////////////////////////////////////////////////////////////////////////////////
+static void ArenaPut(uint16_t offset,uint8_t byte)
+{
+	arena[offset % CHAT_HISTORY_SIZE] = byte;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Read a byte at an offset of the ring
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t ArenaGet(uint16_t offset)
+{
+	return arena[offset % CHAT_HISTORY_SIZE];
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get the text length of the record at an offset
+//////////////////////////////////////////////////////////////////////////////////
+static uint16_t RecordLength(uint16_t offset)
+{
+	return (ArenaGet(offset) << 8) | ArenaGet(offset + 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Add a message to the history (oldest messages removed if needed)
+/// \param addr The source station (or CHAT_HISTORY_ERROR)
+/// \param msgPtr The message (chain of blocks, see CHAIN_NEXT)
+//////////////////////////////////////////////////////////////////////////////////
+void ChatHistoryAdd(uint8_t addr,const char * msgPtr)
+{
+	const char * blockPtr;
+	const char * charPtr;
+	uint16_t length = 0;
+	uint16_t offset;
+
+	for(blockPtr = msgPtr;blockPtr != NULL;blockPtr = CHAIN_NEXT(blockPtr))
+	{
+		length += strlen(blockPtr);
+	}
+	if(length > (CHAT_HISTORY_TEXT - 1))		// keep the start of long ones
+	{
+		length = CHAT_HISTORY_TEXT - 1;
+	}
+	while((used + RECORD_HEADER + length) > CHAT_HISTORY_SIZE)
+	{
+		offset = RECORD_HEADER + RecordLength(oldest);	// remove oldest
+		oldest = (oldest + offset) % CHAT_HISTORY_SIZE;
+		used -= offset;
+	}
+	offset = oldest + used;
+	ArenaPut(offset++,length >> 8);
+	ArenaPut(offset++,length & 0xFF);
+	ArenaPut(offset++,addr);
+	used += RECORD_HEADER + length;
+	for(blockPtr = msgPtr;(blockPtr != NULL) && (length > 0);blockPtr = CHAIN_NEXT(blockPtr))
+	{
+		charPtr = blockPtr;
+		while((*charPtr != 0) && (length > 0))
+		{
+			ArenaPut(offset++,*charPtr++);
+			length--;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Display the last messages of a station (and the error messages)
+/// \param peer The station (BROADCAST_ADDRESS for all stations)
+/// \param count The max number of messages
+/// \param show Function displaying one message
+//////////////////////////////////////////////////////////////////////////////////
+void ChatHistoryShow(uint8_t peer,uint8_t count,
+	void (*show)(uint8_t addr,const char * text))
+{
+	uint16_t offset = oldest;
+	uint16_t end = oldest + used;
+	uint16_t found = 0;
+	uint16_t length;
+	uint16_t i;
+	uint8_t addr;
+
+	while(offset != end)										// count the messages to skip
+	{
+		addr = ArenaGet(offset + 2);
+		if((peer == BROADCAST_ADDRESS) || (addr == peer) || (addr == CHAT_HISTORY_ERROR))
+		{
+			found++;
+		}
+		offset += RECORD_HEADER + RecordLength(offset);
+	}
+	for(offset = oldest;offset != end;offset += RECORD_HEADER + length)
+	{
+		length = RecordLength(offset);
+		addr = ArenaGet(offset + 2);
+		if((peer != BROADCAST_ADDRESS) && (addr != peer) && (addr != CHAT_HISTORY_ERROR))
+		{
+			continue;
+		}
+		if(found-- > count)											// older than the last ones
+		{
+			continue;
+		}
+		for(i=0;i<length;i++)
+		{
+			recordText[i] = ArenaGet(offset + RECORD_HEADER + i);
+		}
+		recordText[length] = 0;
+		show(addr,recordText);
+	}
+}
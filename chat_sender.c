@@ -24,6 +24,13 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 
 	if((GPIO_Pin == GPIO_PIN_8))
 	{
+#if PROFILE != 0
+		if(ext_kbChar == PROFILE_DUMP_KEY)			// not for chat: profile display
+		{
+			ProfileRequest();
+			return;
+		}
+#endif
 		if(ext_kbChar != 0)
 		{
 		queueMsg.addr = ext_kbChar;
@@ -48,6 +55,9 @@ void ChatSender(void *argument)
 	char * msg;													// any string pointer
 	char msgToSend[255];								// keep message to send
 	uint8_t msgToSendPtr=0;							// counter of received bytes
+	uint8_t msgLength;									// size of message to send
+	uint8_t chunk;											// size of one block of it
+	void ** linkPtr;										// where to link next block
 	osStatus_t retCode;									// return error code
 	//------------------------------------------------------------------------------
 	// Initialize the keyboard
@@ -92,18 +102,33 @@ void ChatSender(void *argument)
 					osWaitForever);
 				CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
 
-				// prepare message to send
+				// prepare message to send (one chained block per MAC segment)
 				msgToSend[msgToSendPtr] = 0;	// end of C string
+				msgLength = msgToSendPtr;
+				msgToSendPtr = 0;
+				linkPtr = &queueMsg.anyPtr;
+				do
+				{
+					chunk = msgLength - msgToSendPtr;
+					if(chunk > CHAIN_DATA_SIZE)
+					{
+						chunk = CHAIN_DATA_SIZE;
+					}
+					//----------------------------------------------------------------------
+					// MEMORY ALLOCATION
+					//----------------------------------------------------------------------
+					msg = osMemoryPoolAlloc(memPool,osWaitForever);
+					memcpy(msg,&msgToSend[msgToSendPtr],chunk);
+					msg[chunk] = 0;
+					CHAIN_NEXT(msg) = NULL;
+					*linkPtr = msg;								// link to previous block
+					linkPtr = &CHAIN_NEXT(msg);
+					msgToSendPtr += chunk;
+				}while(msgToSendPtr < msgLength);
 				msgToSendPtr = 0;
-				//------------------------------------------------------------------------
-				// MEMORY ALLOCATION
-				//------------------------------------------------------------------------
-				msg = osMemoryPoolAlloc(memPool,osWaitForever);
 				queueMsg.addr = gTokenInterface.destinationAddress;
 				queueMsg.sapi = CHAT_SAPI;
 				queueMsg.type = DATA_IND;
-				queueMsg.anyPtr = msg;
-				memcpy(msg,msgToSend,strlen(msgToSend)+1);
 				//------------------------------------------------------------------------
 				// QUEUE SEND
 				//------------------------------------------------------------------------
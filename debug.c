@@ -14,6 +14,190 @@
 
 extern uint8_t gInBuffer[256];											// generic byte receive buffer
 
+#define DEBUG_MAX_PAYLOAD		(MAX_BLOCK_SIZE-8)	// fits in a PHY frame with CRC-16
+#define DEBUG_NO_PEER				0xFF					// no virtual station is sending
+
+//--------------------------------------------------------------------------------
+// Script of the virtual stations (the first DEBUG_PEERS are simulated)
+//--------------------------------------------------------------------------------
+struct debugPeer_t
+{
+	uint8_t		address;							///< station address (not mine, not debug)
+	uint8_t		sapi;									///< SAPI of the messages
+	uint8_t		dstAddress;						///< my address or broadcast
+	uint16_t	period;								///< ms between messages (0 = never send)
+	uint8_t		size;									///< payload size (bytes)
+	uint8_t		errorRate;						///< % of frames sent or answered in error
+	uint16_t	delay;								///< hop delay of the station (ms)
+};
+
+static const struct debugPeer_t debugPeers[] = {
+	{ 0, CHAT_SAPI, MYADDRESS,					1000, 20,  0, 10},
+	{ 5, CHAT_SAPI, MYADDRESS,					 500, 60, 10, 10},
+	{ 7, CHAT_SAPI, BROADCAST_ADDRESS,	2000, 30,  0,  0},
+	{ 9, TIME_SAPI, BROADCAST_ADDRESS,	1000, 10,  0,  0},
+};
+
+#if DEBUG_PEERS > 4
+#error DEBUG_PEERS is larger than the script of virtual stations (debugPeers)
+#endif
+
+static uint32_t peerLastSend[DEBUG_PEERS+1];	// tick of last message sent
+static uint32_t randomSeed = 1;
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get a pseudo random percentage
+/// \return A value between 0 and 99
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t DebugRandom(void)
+{
+	randomSeed = (randomSeed * 1103515245) + 12345;
+	return (randomSeed >> 16) % 100;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Find the simulated virtual station of an address
+/// \param address The station address
+/// \return The index in the script or DEBUG_NO_PEER
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t DebugPeerFind(uint8_t address)
+{
+#if DEBUG_PEERS > 0
+	uint8_t i;
+
+	for(i=0;i<DEBUG_PEERS;i++)
+	{
+		if((debugPeers[i].address == address) &&
+			(address != gTokenInterface.debugAddress))	// debug station has priority
+		{
+			return i;
+		}
+	}
+#endif
+	return DEBUG_NO_PEER;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Find the next virtual station with a message to send
+/// \param first The first index of the script to check
+/// \return The index in the script or DEBUG_NO_PEER
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t DebugPeerDue(uint8_t first)
+{
+#if DEBUG_PEERS > 0
+	uint32_t now = osKernelGetTickCount();
+	uint8_t i;
+
+	for(i=first;i<DEBUG_PEERS;i++)
+	{
+		if((debugPeers[i].period != 0) &&
+			(debugPeers[i].address != gTokenInterface.debugAddress) &&
+			((now - peerLastSend[i]) >= debugPeers[i].period))
+		{
+			peerLastSend[i] = now;
+			return i;
+		}
+	}
+#endif
+	return DEBUG_NO_PEER;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get the time of a frame around the simulated ring
+/// \return The sum of the hop delays (ms)
+//////////////////////////////////////////////////////////////////////////////////
+static uint32_t DebugRingDelay(void)
+{
+	uint32_t delay = DEBUG_HOP_DELAY;
+#if DEBUG_PEERS > 0
+	uint8_t i;
+
+	for(i=0;i<DEBUG_PEERS;i++)
+	{
+		delay += debugPeers[i].delay;
+	}
+#endif
+	return delay;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Build a message from a simulated station
+/// \param srcByte The SRC byte of the frame
+/// \param dstByte The DST byte of the frame
+/// \param textPtr The text of the message
+/// \param length The size of the text
+/// \param error Send the frame with a bad frame check
+/// \return The MAC frame
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t * DebugBuildMsg(uint8_t srcByte,uint8_t dstByte,
+	const uint8_t * textPtr,uint8_t length,bool_t error)
+{
+	uint8_t * msg;
+
+	//------------------------------------------------------------------------------
+	// MEMORY ALLOCATION
+	//------------------------------------------------------------------------------
+	msg = osMemoryPoolAlloc(memPool,osWaitForever);
+	msg[0] = srcByte;
+	msg[1] = dstByte;
+	msg[2] = length;
+	memcpy(&msg[3],textPtr,length);
+	MacFrameSeal(msg);
+	if(error != FALSE)
+	{
+		if(gTokenInterface.crc16 != FALSE)
+		{
+			msg[msg[2]+2] ^= 0x01;				// wrong CRC-16
+		}
+		else
+		{
+			msg[msg[2]+3] += 0x04;				// wrong 6 bits sum
+		}
+	}
+	return msg;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Build a message of the debug station to this station
+/// \param textPtr The text of the message
+/// \param length The size of the text
+/// \return The MAC frame (with a bad frame check if a send error is asked)
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t * DebugBuildDebugMsg(const uint8_t * textPtr,uint8_t length)
+{
+	return DebugBuildMsg(
+		(gTokenInterface.debugAddress << 3) | gTokenInterface.debugSAPI,
+		(gTokenInterface.myAddress << 3) | gTokenInterface.debugSAPI,
+		textPtr,length,gTokenInterface.needSendCRCError);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Build a message of a virtual station (text padded to its size)
+/// \param peer The index of the station in the script
+/// \return The MAC frame (with a bad frame check at the error rate)
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t * DebugBuildPeerMsg(uint8_t peer)
+{
+	const struct debugPeer_t * peerPtr = &debugPeers[peer];
+	uint8_t text[DEBUG_MAX_PAYLOAD];
+	uint8_t length;
+	uint8_t size;
+	uint8_t i;
+
+	size = (peerPtr->size > DEBUG_MAX_PAYLOAD) ? DEBUG_MAX_PAYLOAD : peerPtr->size;
+	length = snprintf((char *)text,sizeof(text),"Load from %d ",peerPtr->address+1);
+	if(length > size)
+	{
+		length = size;
+	}
+	for(i=length;i<size;i++)
+	{
+		text[i] = 'a' + (i % 26);						// filler
+	}
+	return DebugBuildMsg((peerPtr->address << 3) | peerPtr->sapi,
+		(peerPtr->dstAddress << 3) | peerPtr->sapi,text,size,
+		DebugRandom() < peerPtr->errorRate);
+}
 
 //////////////////////////////////////////////////////////////////////////////////
 // THREAD DEBUG
@@ -24,11 +208,16 @@ void DebugStation(void *argument)
 	uint8_t * tokenPtr=0;
 	uint8_t * qPtr;
 	uint8_t checksum;
-	uint8_t statusByte;
-	uint8_t i;
 	uint8_t * msg;
 	uint8_t lastDebugAddress=0;
 	uint8_t waitForDataback=0;
+	uint8_t sendPeer=DEBUG_NO_PEER;		// virtual station waiting a databack
+	uint8_t peerRetries=0;
+	uint8_t peer;
+	uint32_t delay;
+#if DEBUG_PEERS > 0
+	uint8_t i;
+#endif
 	const uint8_t debugMsg[] = "Msg from debug !";
 	osStatus_t retCode;
 
@@ -39,6 +228,8 @@ void DebugStation(void *argument)
 		isDEST,          		          	// a DEST. frame is received
 		isERROR,           				  		// a BAD frame is received
 		isBROADCAST,
+		isPEER_DEST,									// a frame to a virtual station
+		isPEER_SOURCE,								// a frame of a virtual station
 	}frameType;
 	//------------------------------------------------------------------------------
 	for (;;)						// loop until doomsday
@@ -58,7 +249,7 @@ void DebugStation(void *argument)
 			frameType = isTOKEN;
 		}
 		//----------------------------------------------------------------------------
-		else if ((qPtr[1]>>3) == gTokenInterface.debugAddress)  // is a dest. frame
+		else if (MAC_ADDR(qPtr[1]) == gTokenInterface.debugAddress)  // is a dest. frame
 		{
 			if(gTokenInterface.debugOnline != FALSE)
 			{
@@ -70,12 +261,22 @@ void DebugStation(void *argument)
 			}
 		}
 		//----------------------------------------------------------------------------
-		else if (qPtr[0]>>3 ==  gTokenInterface.debugAddress) 	// is it a source frame
+		else if (MAC_ADDR(qPtr[0]) ==  gTokenInterface.debugAddress) 	// is it a source frame
 		{
 			frameType = isSOURCE;
 		}
 		//----------------------------------------------------------------------------
-		else if (qPtr[1]>>3 == BROADCAST_ADDRESS) 	// is it a broadcast
+		else if ((peer = DebugPeerFind(MAC_ADDR(qPtr[1]))) != DEBUG_NO_PEER)
+		{
+			frameType = isPEER_DEST;
+		}
+		//----------------------------------------------------------------------------
+		else if ((peer = DebugPeerFind(MAC_ADDR(qPtr[0]))) != DEBUG_NO_PEER)
+		{
+			frameType = isPEER_SOURCE;
+		}
+		//----------------------------------------------------------------------------
+		else if (MAC_ADDR(qPtr[1]) == BROADCAST_ADDRESS) 	// is it a broadcast
 		{
 			frameType = isBROADCAST;
 		}
@@ -98,63 +299,108 @@ void DebugStation(void *argument)
 				qPtr[lastDebugAddress+1] = 0;	// update last
 				lastDebugAddress = gTokenInterface.debugAddress;	// set new<->last
 			}
+#if DEBUG_PEERS > 0
+			for(i=0;i<DEBUG_PEERS;i++)						// virtual stations are online
+			{
+				if(debugPeers[i].address != gTokenInterface.debugAddress)
+				{
+					qPtr[debugPeers[i].address+1] =
+						(1 << TIME_SAPI) | (1 << debugPeers[i].sapi);
+				}
+			}
+#endif
 			//--------------------------------------------------------------------------
 			if(gTokenInterface.debugMsgToSend != FALSE)
 			{
 				waitForDataback = 1;
 				gTokenInterface.debugMsgToSend = FALSE;
 				tokenPtr = qPtr;	// keep copy of token
-				//------------------------------------------------------------------------
-				// MEMORY ALLOCATION				
-				//------------------------------------------------------------------------
-				msg = osMemoryPoolAlloc(memPool,osWaitForever);													
-				msg[0] = (gTokenInterface.debugAddress << 3) | gTokenInterface.debugSAPI;
-				msg[1] = (gTokenInterface.myAddress << 3) | gTokenInterface.debugSAPI;
-				msg[2] = sizeof(debugMsg)-1;
-				memcpy(&msg[3],debugMsg,sizeof(debugMsg)-1);
-				checksum = 0;
-				for(i=0;i<(msg[2]+3);i++)	// calculate checksum
-					checksum += msg[i];
+				msg = DebugBuildDebugMsg(debugMsg,sizeof(debugMsg)-1);
 				if(gTokenInterface.needSendCRCError != FALSE)
 				{
-					checksum += 1;
-					printf(">> Debug send pseudo error <<\r\n");
+					TRACE_TEXT(LOG_INFO,LOG_DEBUG,">> Debug send pseudo error <<\r\n");
 				}
 				else
 				{
-					printf(">> Debug send message ok <<\r\n");
+					TRACE_TEXT(LOG_INFO,LOG_DEBUG,">> Debug send message ok <<\r\n");
 				}
-				checksum = checksum << 2;
-				msg[sizeof(debugMsg) -1 + 3] = checksum;
 				queueMsg.anyPtr = msg;
 			}
+			//--------------------------------------------------------------------------
+			else if((sendPeer = DebugPeerDue(0)) != DEBUG_NO_PEER)
+			{
+				tokenPtr = qPtr;	// keep copy of token
+				peerRetries = 0;
+				queueMsg.anyPtr = DebugBuildPeerMsg(sendPeer);
+			}
+			break;
+		//****************************************************************************
+		case isPEER_DEST:
+			if(DebugRandom() < debugPeers[peer].errorRate)	// pseudo error
+			{
+				qPtr[qPtr[2] + 3] |= 0x02;	// set RD bit
+				qPtr[qPtr[2] + 3] &= 0xFE;	// clear ACK bit
+			}
+			else if(MacFrameCheck(qPtr) != FALSE)	// checksum OK
+			{
+				qPtr[qPtr[2] + 3] |= 0x03;	// set RD & ACK bits
+			}
+			else									// checksum real error
+			{
+				TRACE_TEXT(LOG_ERROR,LOG_DEBUG,">> Debug peer error detected <<\r\n");
+				qPtr[qPtr[2] + 3] |= 0x02;	// set RD bit
+				qPtr[qPtr[2] + 3] &= 0xFE;	// clear ACK bit
+			}
+			break;
+		//****************************************************************************
+		case isPEER_SOURCE:
+			if(peer != sendPeer)						// not sent by simulation
+			{
+				break;
+			}
+			checksum = qPtr[qPtr[2] + 3];
+			//------------------------------------------------------------------------
+			// MEMORY RELEASE
+			//------------------------------------------------------------------------
+			retCode = osMemoryPoolFree(memPool,qPtr);
+			CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+			if(((checksum & 0x03) == 0x02) &&	// RD but not ACK
+				(peerRetries < MAC_RETRY_MAX))
+			{
+				peerRetries++;
+				queueMsg.anyPtr = DebugBuildPeerMsg(sendPeer);
+			}
+			else if((sendPeer = DebugPeerDue(sendPeer+1)) != DEBUG_NO_PEER)
+			{
+				peerRetries = 0;								// next station sends
+				queueMsg.anyPtr = DebugBuildPeerMsg(sendPeer);
+			}
+			else
+			{
+				queueMsg.anyPtr = tokenPtr;			// token goes on
+			}
 			break;
 		//****************************************************************************
 		case isDEST:
-			statusByte = qPtr[qPtr[2] + 3];
 			//--------------------------------------------------------------------------
 			if((gTokenInterface.needReceiveCRCError != FALSE) &&		// pseudo error
 					((qPtr[1] && 0x03) == gTokenInterface.debugSAPI))
 			{
-				printf(">> Debug answer pseudo error <<\r\n");
+				TRACE_TEXT(LOG_INFO,LOG_DEBUG,">> Debug answer pseudo error <<\r\n");
 				qPtr[qPtr[2] + 3] |= 0x02;	// set RD bit
 				qPtr[qPtr[2] + 3] &= 0xFE;	// clear ACK bit
 			}
 			//--------------------------------------------------------------------------
 			else if((qPtr[1] && 0x03) == gTokenInterface.debugSAPI)		// control is OK
 			{
-				checksum = 0;
-				for(i=0;i<(qPtr[2]+3);i++)	// calculate checksum
-					checksum += qPtr[i];
-				checksum = checksum << 2;
-				if(checksum == (statusByte & 0xFC))	// checksum OK
+				if(MacFrameCheck(qPtr) != FALSE)	// checksum OK
 				{
-					printf(">> Debug answer ok <<\r\n");
+					TRACE_TEXT(LOG_INFO,LOG_DEBUG,">> Debug answer ok <<\r\n");
 					qPtr[qPtr[2] + 3] |= 0x03;	// set RD & ACK bits
 				}
 				else								// checksum real error
 				{
-					printf(">> Debug answer error detected <<\r\n");
+					TRACE_TEXT(LOG_ERROR,LOG_DEBUG,">> Debug answer error detected <<\r\n");
 					qPtr[qPtr[2] + 3] |= 0x02;	// set RD bit
 					qPtr[qPtr[2] + 3] &= 0xFE;	// clear ACK bit
 				}
@@ -191,28 +437,15 @@ void DebugStation(void *argument)
 				//------------------------------------------------------------------------
 				retCode = osMemoryPoolFree(memPool,qPtr);
 				CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);				
-				//------------------------------------------------------------------------
-				// MEMORY ALLOCATION				
-				//------------------------------------------------------------------------
-				msg = osMemoryPoolAlloc(memPool,osWaitForever);													
-				msg[0] = (gTokenInterface.debugAddress << 3) | gTokenInterface.debugSAPI;
-				msg[1] = (gTokenInterface.myAddress << 3) | gTokenInterface.debugSAPI;
-				msg[2] = sizeof(debugMsg)-1;
-				memcpy(&msg[3],debugMsg,sizeof(debugMsg)-1);
-				checksum = 0;
-				for(i=0;i<(msg[2]+3);i++)	// calculate checksum
-					checksum += msg[i];
+				msg = DebugBuildDebugMsg(debugMsg,sizeof(debugMsg)-1);
 				if(gTokenInterface.needSendCRCError != FALSE)
 				{
-					printf(">> Debug RE-send pseudo error <<\r\n");
-					checksum += 1;
+					TRACE_TEXT(LOG_INFO,LOG_DEBUG,">> Debug RE-send pseudo error <<\r\n");
 				}
 				else
 				{
-					printf(">> Debug RE-send without error <<\r\n");
+					TRACE_TEXT(LOG_INFO,LOG_DEBUG,">> Debug RE-send without error <<\r\n");
 				}
-				checksum = checksum << 2;
-				msg[sizeof(debugMsg) -1 + 3] = checksum;
 				queueMsg.anyPtr = msg;
 				break;
 			}
@@ -220,7 +453,11 @@ void DebugStation(void *argument)
 		default:	// IS Error or unknow
 			break;
 		}
-		osDelay(300);						// wait 500 ms for simulation delay
+		delay = DebugRingDelay();
+		if(delay != 0)
+		{
+			osDelay(delay);				// wait for simulation delay
+		}
 		qPtr = queueMsg.anyPtr;
 		if(qPtr[0] == TOKEN_TAG)
 		{
@@ -230,7 +467,7 @@ void DebugStation(void *argument)
 		//----------------------------------------------------------------------------
 		// DEBUG DISPLAY FRAME				
 		//----------------------------------------------------------------------------
-		DebugMacFrame('R',qPtr);
+		TRACE_MAC_FRAME(LOG_PHY,'R',qPtr);
 		//----------------------------------------------------------------------------
 		// QUEUE SEND	(send message to mac receiver)
 		//----------------------------------------------------------------------------
@@ -0,0 +1,238 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file glyph_cache.c
+/// \brief Cache of decoded glyphs of the antialiased (mcufont) fonts
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// The RLE fonts are decoded (dictionary lookups) for each character drawn.
+/// A cached font is a copy of the font with its own render functions: the
+/// first time a glyph is drawn, the runs of alpha pixels given by the decoder
+/// are kept in an atlas slot, then the glyph is drawn again from the slot with
+/// the same runs. The atlas is GLYPH_CACHE_SETS x GLYPH_CACHE_WAYS slots of
+/// GLYPH_CACHE_RUNS runs (4 bytes each), a glyph is stored in the set given by
+/// its character and replaces the least recently used glyph of the set.
+/// Glyphs with too many runs are decoded each time.
+//////////////////////////////////////////////////////////////////////////////////
+#include "stm32f7xx_hal.h"
+
+#include "main.h"
+#include "resources_manager.h"
+#include "src/gdisp/mcufont/mcufont.h"
+
+//--------------------------------------------------------------------------------
+// A cached font (copy of original font with cache render functions)
+//--------------------------------------------------------------------------------
+struct glyphFont_t
+{
+	struct mf_font_s	font;							///< copy, must be first
+	font_t						original;					///< decoded font
+	uint8_t						index;						///< spreads fonts in sets
+};
+
+//--------------------------------------------------------------------------------
+// A run of pixels of same alpha (relative to glyph origin)
+//--------------------------------------------------------------------------------
+struct glyphRun_t
+{
+	int8_t						x;
+	int8_t						y;
+	uint8_t						count;
+	uint8_t						alpha;
+};
+
+//--------------------------------------------------------------------------------
+// An atlas slot descriptor
+//--------------------------------------------------------------------------------
+struct glyphSlot_t
+{
+	const struct mf_font_s *	font;			///< NULL if slot free
+	mf_char						character;
+	uint8_t						width;						///< advance returned by decoder
+	uint8_t						runs;							///< runs in atlas
+	uint32_t					lastUse;					///< for LRU replacement
+};
+
+//--------------------------------------------------------------------------------
+// Decoding of a glyph in a slot
+//--------------------------------------------------------------------------------
+struct glyphCapture_t
+{
+	mf_pixel_callback_t	callback;				///< drawing callback of caller
+	void *						state;
+	int16_t						x0;
+	int16_t						y0;
+	struct glyphRun_t *	runPtr;					///< runs of slot
+	uint8_t						runs;
+	bool_t						overflow;					///< glyph cannot be cached
+};
+
+static struct glyphFont_t fonts[GLYPH_CACHE_FONTS];
+static uint8_t fontCount;
+static struct glyphSlot_t slots[GLYPH_CACHE_SETS][GLYPH_CACHE_WAYS];
+static struct glyphRun_t atlas[GLYPH_CACHE_SETS][GLYPH_CACHE_WAYS][GLYPH_CACHE_RUNS];
+static uint32_t useCount;								// LRU clock
+static osMutexId_t glyphMutex;					// draws from GUI and timer threads
+
+static const osMutexAttr_t glyphMutex_attr = {
+	.name = "GLYPH CACHE",
+	.attr_bits = osMutexPrioInherit
+};
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Decoder callback: draw a run and keep it in the slot
+//////////////////////////////////////////////////////////////////////////////////
+static void GlyphCapture(int16_t x,int16_t y,uint8_t count,uint8_t alpha,
+	void * state)
+{
+	struct glyphCapture_t * capPtr = state;
+	int16_t dx = x - capPtr->x0;
+	int16_t dy = y - capPtr->y0;
+
+	capPtr->callback(x,y,count,alpha,capPtr->state);
+	if((capPtr->runs == GLYPH_CACHE_RUNS) ||
+		(dx < INT8_MIN) || (dx > INT8_MAX) || (dy < INT8_MIN) || (dy > INT8_MAX))
+	{
+		capPtr->overflow = TRUE;
+		return;
+	}
+	capPtr->runPtr[capPtr->runs].x = dx;
+	capPtr->runPtr[capPtr->runs].y = dy;
+	capPtr->runPtr[capPtr->runs].count = count;
+	capPtr->runPtr[capPtr->runs].alpha = alpha;
+	capPtr->runs++;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Width of a character (given by the original font)
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t GlyphWidth(const struct mf_font_s * font,mf_char character)
+{
+	font_t original = ((const struct glyphFont_t *)font)->original;
+
+	return original->character_width(original,character);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Draw a character from the atlas (decoded and kept if not found)
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t GlyphRender(const struct mf_font_s * font,int16_t x0,int16_t y0,
+	mf_char character,mf_pixel_callback_t callback,void * state)
+{
+	const struct glyphFont_t * fontPtr = (const struct glyphFont_t *)font;
+	uint8_t set = (character + fontPtr->index) % GLYPH_CACHE_SETS;
+	struct glyphSlot_t * slotPtr = NULL;
+	struct glyphRun_t * runPtr;
+	struct glyphCapture_t capture;
+	uint8_t width;
+	uint8_t way;
+	uint8_t i;
+	osStatus_t retCode;
+
+	retCode = osMutexAcquire(glyphMutex,osWaitForever);
+	CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+	useCount++;
+	for(way=0;way<GLYPH_CACHE_WAYS;way++)		// look for glyph in set
+	{
+		if((slots[set][way].font == font) &&
+			(slots[set][way].character == character))
+		{
+			slotPtr = &slots[set][way];
+			break;
+		}
+	}
+	if(slotPtr != NULL)											// found: draw runs
+	{
+		slotPtr->lastUse = useCount;
+		runPtr = atlas[set][way];
+		for(i=0;i<slotPtr->runs;i++)
+		{
+			callback(x0 + runPtr[i].x,y0 + runPtr[i].y,runPtr[i].count,
+				runPtr[i].alpha,state);
+		}
+		width = slotPtr->width;
+	}
+	else																		// decode in oldest slot
+	{
+		slotPtr = &slots[set][0];
+		runPtr = atlas[set][0];
+		for(way=1;way<GLYPH_CACHE_WAYS;way++)
+		{
+			if(slots[set][way].lastUse < slotPtr->lastUse)
+			{
+				slotPtr = &slots[set][way];
+				runPtr = atlas[set][way];
+			}
+		}
+		capture.callback = callback;
+		capture.state = state;
+		capture.x0 = x0;
+		capture.y0 = y0;
+		capture.runPtr = runPtr;
+		capture.runs = 0;
+		capture.overflow = FALSE;
+		width = fontPtr->original->render_character(fontPtr->original,x0,y0,
+			character,GlyphCapture,&capture);
+		if(capture.overflow == FALSE)				// keep it
+		{
+			slotPtr->font = font;
+			slotPtr->character = character;
+			slotPtr->width = width;
+			slotPtr->runs = capture.runs;
+			slotPtr->lastUse = useCount;
+		}
+		else																// slot free, reused first
+		{
+			slotPtr->font = NULL;
+			slotPtr->lastUse = 0;
+		}
+	}
+	retCode = osMutexRelease(glyphMutex);
+	CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+	return width;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Create the glyph cache mutex (before kernel start)
+//////////////////////////////////////////////////////////////////////////////////
+void GlyphCacheInit(void)
+{
+	glyphMutex = osMutexNew(&glyphMutex_attr);
+	if(glyphMutex == NULL)
+	{
+		CheckRetCode(osErrorNoMemory,__LINE__,__FILE__,CONTINUE);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get the cached version of a font (to use instead of the font)
+/// \param font The font (from gdispOpenFont)
+/// \return The cached font (the font itself if no more cached fonts or if
+/// GlyphCacheInit failed)
+//////////////////////////////////////////////////////////////////////////////////
+font_t GlyphCacheFont(font_t font)
+{
+	uint8_t i;
+
+	if((font == NULL) || (glyphMutex == NULL))	// no cache (error reported)
+	{
+		return font;
+	}
+	for(i=0;i<fontCount;i++)								// already cached
+	{
+		if(fonts[i].original == font)
+		{
+			return &fonts[i].font;
+		}
+	}
+	if(fontCount == GLYPH_CACHE_FONTS)
+	{
+		return font;
+	}
+	fonts[fontCount].font = *font;
+	fonts[fontCount].font.character_width = GlyphWidth;
+	fonts[fontCount].font.render_character = GlyphRender;
+	fonts[fontCount].original = font;
+	fonts[fontCount].index = fontCount * (GLYPH_CACHE_SETS / GLYPH_CACHE_FONTS);
+	return &fonts[fontCount++].font;
+}
@@ -41,6 +41,7 @@ GHandle lblADDR;
 GHandle btnSAPIPlus;
 GHandle btnADDRESSPlus;
 GHandle btnBack;
+GHandle lblMonitor;
 GHandle ghLabel_11;
 GHandle ghRadiobutton;
 GHandle ghRadiobutton_1;
@@ -166,6 +167,7 @@ static bool_t _createPagestartup(void)
 	wi.customStyle = 0;
 	ghImagebox = gwinImageCreate(0, &wi.g);
 	gwinImageOpenFile(ghImagebox, gstudioGetImageFilePath(token_w));
+	gstudioCacheImage(&((GImageObject*)ghImagebox)->image);
 
 	return TRUE;
 }
@@ -701,6 +703,23 @@ static bool_t _createPageconfigDisplay(void)
 	btnBack = gwinButtonCreate(0, &wi);
 	gwinSetFont(btnBack, gstudioGetFont(arial__14));
 
+	// lblMonitor
+	wi.g.show = TRUE;
+	wi.g.x = 7;
+	wi.g.y = 243;
+	wi.g.width = 380;
+	wi.g.height = 25;
+	wi.g.parent = ghPageContainerConfigDisplay;
+	wi.text = "CPU load: -";
+	wi.customDraw = 0;
+	wi.customParam = 0;
+	#if GWIN_WIDGET_TAGS
+		wi.tag = LBLMONITOR_TAG;
+	#endif
+	wi.customStyle = &white_on_gray;
+	lblMonitor = gwinLabelCreate(0, &wi);
+	gwinSetFont(lblMonitor, gstudioGetFont(arial_12));
+
 	return TRUE;
 }
 
@@ -1036,35 +1055,49 @@ static bool_t _createPageaddressSelectDisplay(void)
 	return TRUE;
 }
 
-void guiShowPage(guiPage page)
+static GHandle _pageContainer(guiPage page)
 {
-	// Hide all pages
-	gwinHide(ghPageContainerStartup);
-	gwinHide(ghPageContainerMainDisplay);
-	gwinHide(ghPageContainerConfigDisplay);
-	gwinHide(ghPageContainerAddressSelectDisplay);
-
-	// Show the selected page
 	switch (page) {
 		case STARTUP:
-			gwinShow(ghPageContainerStartup);
-			break;
+			return ghPageContainerStartup;
 
 		case MAINDISPLAY:
-			gwinShow(ghPageContainerMainDisplay);
-			break;
+			return ghPageContainerMainDisplay;
 
 		case CONFIGDISPLAY:
-			gwinShow(ghPageContainerConfigDisplay);
-			break;
+			return ghPageContainerConfigDisplay;
 
 		case ADDRESSSELECTDISPLAY:
-			gwinShow(ghPageContainerAddressSelectDisplay);
-			break;
+			return ghPageContainerAddressSelectDisplay;
 
 		default:
-			break;
+			return 0;
+	}
+}
+
+void guiShowPage(guiPage page)
+{
+	// Current page (-1 before first switch, all pages can be visible)
+	static int currentPage = -1;
+
+	// Nothing to redraw if the page is already shown
+	if ((int)page == currentPage || !_pageContainer(page)) {
+		return;
+	}
+
+	// Hide the current page only
+	if (currentPage < 0) {
+		gwinHide(ghPageContainerStartup);
+		gwinHide(ghPageContainerMainDisplay);
+		gwinHide(ghPageContainerConfigDisplay);
+		gwinHide(ghPageContainerAddressSelectDisplay);
+	} else {
+		gwinHide(_pageContainer((guiPage)currentPage));
 	}
+
+	// Show the selected page
+	gwinShow(_pageContainer(page));
+	currentPage = page;
 }
 
 bool_t guiInit(void)
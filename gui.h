@@ -47,6 +47,7 @@ typedef enum guiPage {
 #define BTNSAPIPLUS_TAG 0
 #define BTNADDRESSPLUS_TAG 0
 #define BTNBACK_TAG 0
+#define LBLMONITOR_TAG 0
 #define GHLABEL_11_TAG 0
 #define GHRADIOBUTTON_TAG 0
 #define GHRADIOBUTTON_1_TAG 1
@@ -105,6 +106,7 @@ extern GHandle lblADDR;
 extern GHandle btnSAPIPlus;
 extern GHandle btnADDRESSPlus;
 extern GHandle btnBack;
+extern GHandle lblMonitor;
 extern GHandle ghLabel_11;
 extern GHandle ghRadiobutton;
 extern GHandle ghRadiobutton_1;
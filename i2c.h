@@ -48,6 +48,7 @@
 #include "main.h"
 
 /* USER CODE BEGIN Includes */
+#include "Driver_I2C.h"
 
 /* USER CODE END Includes */
 
@@ -62,6 +63,10 @@ extern void _Error_Handler(char *, int);
 void MX_I2C3_Init(void);
 
 /* USER CODE BEGIN Prototypes */
+void I2cBusLock(void);
+void I2cBusUnlock(void);
+void I2cBusEvent(uint32_t event);
+void I2cBusWait(ARM_DRIVER_I2C * drvPtr);
 
 /* USER CODE END Prototypes */
 
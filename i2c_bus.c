@@ -0,0 +1,94 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file i2c_bus.c
+/// \brief I2C3 bus arbiter (touch controller and audio codec)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// The touch driver (uGFX) and the WM8994 audio codec share I2C3. Each
+/// transaction is made with the bus mutex taken, so the other threads (ring)
+/// keep running. A thread waits the end of a transfer on a thread flag set by
+/// the driver callback instead of polling the driver status.
+//////////////////////////////////////////////////////////////////////////////////
+#include "stm32f7xx_hal.h"
+
+#include <stdio.h>
+#include "i2c.h"
+
+#define I2C_DONE_FLAG			0x8000			// thread flag: I2C transfer done
+#define I2C_POLL_TIME			2						// max wait of a missed event (ms)
+
+static osMutexId_t i2cMutex;						// bus owner
+static osThreadId_t i2cOwner;						// thread waiting for transfer
+
+static const osMutexAttr_t i2cMutex_attr = {
+	.name = "I2C BUS",
+	.attr_bits = osMutexRecursive | osMutexPrioInherit
+};
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Create the bus mutex (before kernel start)
+//////////////////////////////////////////////////////////////////////////////////
+void I2cBusInit(void)
+{
+	i2cMutex = osMutexNew(&i2cMutex_attr);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Take the bus for a transaction (can be nested)
+//////////////////////////////////////////////////////////////////////////////////
+void I2cBusLock(void)
+{
+	osStatus_t retCode;
+
+	if(osKernelGetState() != osKernelRunning)	// init before kernel start
+	{
+		return;
+	}
+	retCode = osMutexAcquire(i2cMutex,osWaitForever);
+	CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+	i2cOwner = osThreadGetId();
+	osThreadFlagsClear(I2C_DONE_FLAG);				// old event of last transfer
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Release the bus
+//////////////////////////////////////////////////////////////////////////////////
+void I2cBusUnlock(void)
+{
+	osStatus_t retCode;
+
+	if(osKernelGetState() != osKernelRunning)
+	{
+		return;
+	}
+	retCode = osMutexRelease(i2cMutex);
+	CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief I2C driver callback (interrupt): wake-up the bus owner
+/// \param event The I2C events
+//////////////////////////////////////////////////////////////////////////////////
+void I2cBusEvent(uint32_t event)
+{
+	if(i2cOwner != NULL)
+	{
+		osThreadFlagsSet(i2cOwner,I2C_DONE_FLAG);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Wait the end of a transfer (sleeping)
+/// \param drvPtr The I2C driver
+//////////////////////////////////////////////////////////////////////////////////
+void I2cBusWait(ARM_DRIVER_I2C * drvPtr)
+{
+	while(drvPtr->GetStatus().busy)
+	{
+		if(osKernelGetState() == osKernelRunning)
+		{
+			osThreadFlagsWait(I2C_DONE_FLAG,osFlagsWaitAny,I2C_POLL_TIME);
+		}
+	}
+}
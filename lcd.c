@@ -10,9 +10,206 @@
 #include <stdio.h>
 #include <string.h>
 #include "main.h"
+#include "resources_manager.h"
 
 GListener 	gl;
 
+#define LCD_TEXT_SIZE			512				// console text kept until next redraw
+#define LCD_TIME					0x01			// dirty: time label
+#define LCD_LIST					0x02			// dirty: online stations label
+#define LCD_MONITOR				0x04			// dirty: load report label
+#define LCD_TEXT					0x08			// dirty: consoles text
+#define LIST_STATIONS			15				// cells of online stations label
+#define LIST_CAPTION_WIDTH	120			// width of "Online stations:" (pixels)
+#define LIST_CELL_WIDTH		23				// width of a station cell (pixels)
+
+//--------------------------------------------------------------------------------
+// Console text waiting for the next redraw
+//--------------------------------------------------------------------------------
+struct lcdText_t
+{
+	uint16_t	length;								///< length of text
+	char			text[LCD_TEXT_SIZE];	///< text with escape codes
+};
+
+static struct lcdText_t sendText;				// text for cnslSend
+static struct lcdText_t receiveText;		// text for cnslReceive
+static char timeStr[30] = "Time is: ";		// text of lblTime (not copied)
+static uint16_t listState;								// online stations (bit 0 is station 1)
+static uint16_t listShown;							// stations drawn on lblList
+static char monitorStr[MAX_BLOCK_SIZE];	// text of lblMonitor (not copied)
+static uint8_t dirty;										// widgets to redraw
+
+static const char listCell[LIST_STATIONS][3] = {
+	"1","2","3","4","5","6","7","8","9","10","11","12","13","14","15"};
+
+//static const char escapeBlack[] = {0x1B,'0',0};
+static const char escapeRed[] = {0x1B,'1',0};
+static const char escapeGreen[] = {0x1B,'2',0};
+static const char escapeBold[] = {0x1B,'b',0};
+static const char escapeNoBold[] = {0x1B,'B',0};
+static const char escapeUnderline[] = {0x1B,'u',0};
+static const char escapeNoUnderline[] = {0x1B,'U',0};
+static const char escapeBlue[] = {0x1B,'4',0};
+//static const char escapeWhite[] = {0x1B,'7',0};
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Display the waiting text of a console
+/// \param textPtr The waiting text
+/// \param console The console
+//////////////////////////////////////////////////////////////////////////////////
+static void LcdTextFlush(struct lcdText_t * textPtr,GHandle console)
+{
+	if(textPtr->length != 0)
+	{
+		gwinPutString(console,textPtr->text);
+		textPtr->length = 0;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Add text to a console for the next redraw
+/// \param textPtr The waiting text
+/// \param console The console (if the text is full)
+/// \param string The text to add
+//////////////////////////////////////////////////////////////////////////////////
+static void LcdTextPut(struct lcdText_t * textPtr,GHandle console,const char * string)
+{
+	size_t size = strlen(string);
+
+	if((textPtr->length + size) >= LCD_TEXT_SIZE)	// no more place
+	{
+		LcdTextFlush(textPtr,console);
+	}
+	if(size >= LCD_TEXT_SIZE)									// too long to wait
+	{
+		gwinPutString(console,string);
+		return;
+	}
+	memcpy(&textPtr->text[textPtr->length],string,size+1);
+	textPtr->length += size;
+	dirty |= LCD_TEXT;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Add a received message to the receive console
+/// \param addr The source station (or CHAT_HISTORY_ERROR)
+/// \param text The message
+//////////////////////////////////////////////////////////////////////////////////
+static void LcdShowMsg(uint8_t addr,const char * text)
+{
+	char tempStr[30];
+
+	if(addr == CHAT_HISTORY_ERROR)						// MAC error
+	{
+		LcdTextPut(&receiveText,cnslReceive,escapeRed);
+		LcdTextPut(&receiveText,cnslReceive,escapeBold);
+		LcdTextPut(&receiveText,cnslReceive,text);
+		LcdTextPut(&receiveText,cnslReceive,escapeNoBold);
+		return;
+	}
+	sprintf(tempStr,"%s%sMsg from : %d\r\n%s%s",escapeBlue,escapeUnderline,
+		addr+1,escapeNoUnderline,escapeGreen);
+	LcdTextPut(&receiveText,cnslReceive,tempStr);
+	LcdTextPut(&receiveText,cnslReceive,text);
+	LcdTextPut(&receiveText,cnslReceive,"\r\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Show the main page, its receive console is displayed again from the
+/// history (messages of the selected destination)
+//////////////////////////////////////////////////////////////////////////////////
+static void LcdShowMain(void)
+{
+	gTokenInterface.currentView = MAINDISPLAY;
+	guiShowPage(MAINDISPLAY);
+	receiveText.length = 0;										// waiting text is in history
+	gwinClear(cnslReceive);
+	ChatHistoryShow(gTokenInterface.destinationAddress,CHAT_HISTORY_SHOW,LcdShowMsg);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Draw the cell of a station on the online stations label
+/// \param gw The label
+/// \param station The station index (0 for station 1)
+//////////////////////////////////////////////////////////////////////////////////
+static void LcdListCell(GWidgetObject * gw,uint8_t station)
+{
+	gdispGFillStringBox(gw->g.display,
+		gw->g.x + LIST_CAPTION_WIDTH + (station * LIST_CELL_WIDTH),gw->g.y,
+		LIST_CELL_WIDTH,gw->g.height,
+		((listState & (1 << station)) != 0) ? listCell[station] : "",
+		gw->g.font,gw->pstyle->enabled.text,gw->pstyle->background,justifyCenter);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Custom draw of the online stations label (caption and all cells)
+//////////////////////////////////////////////////////////////////////////////////
+static void LcdListDraw(GWidgetObject * gw,void * param)
+{
+	uint8_t i;
+
+	gdispGFillStringBox(gw->g.display,gw->g.x,gw->g.y,
+		LIST_CAPTION_WIDTH,gw->g.height,gw->text,
+		gw->g.font,gw->pstyle->enabled.text,gw->pstyle->background,justifyLeft);
+	gdispGFillArea(gw->g.display,gw->g.x + LIST_CAPTION_WIDTH,gw->g.y,
+		gw->g.width - LIST_CAPTION_WIDTH,gw->g.height,gw->pstyle->background);
+	for(i=0;i<LIST_STATIONS;i++)
+	{
+		if((listState & (1 << i)) != 0)
+		{
+			LcdListCell(gw,i);
+		}
+	}
+	listShown = listState;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Redraw the cells of the stations changed since last drawing
+//////////////////////////////////////////////////////////////////////////////////
+static void LcdListUpdate(void)
+{
+	uint16_t changed = listState ^ listShown;
+	uint8_t i;
+
+	if(gwinGetVisible(lblList) == FALSE)		// drawn when page is shown
+	{
+		return;
+	}
+	for(i=0;i<LIST_STATIONS;i++)
+	{
+		if((changed & (1 << i)) != 0)
+		{
+			LcdListCell((GWidgetObject *)lblList,i);
+		}
+	}
+	listShown = listState;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Redraw all widgets changed since last redraw
+//////////////////////////////////////////////////////////////////////////////////
+static void LcdRedraw(void)
+{
+	PROFILE_BEGIN(PROF_LCD_PUT);
+	LcdTextFlush(&sendText,cnslSend);
+	LcdTextFlush(&receiveText,cnslReceive);
+	if((dirty & LCD_TIME) != 0)
+	{
+		gwinSetText(lblTime, timeStr, FALSE);
+	}
+	if((dirty & LCD_LIST) != 0)
+	{
+		LcdListUpdate();
+	}
+	if((dirty & LCD_MONITOR) != 0)
+	{
+		gwinSetText(lblMonitor, monitorStr, FALSE);
+	}
+	dirty = 0;
+	PROFILE_END(PROF_LCD_PUT);
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 // THREAD LCD
 //////////////////////////////////////////////////////////////////////////////////
@@ -22,28 +219,22 @@ void LCD(void *argument)
 	GEvent* pe;														// uGFX event
 	char tmpMsg[] = {0,0,0,0,0};							// to send chars
 	char * msgPtr;												// any pointer of string
+	char * nextPtr;												// next block of chained string
 	char tempStr[30];											// temp string usage
-	char smallStr[5];
+	uint16_t listNew;											// new online stations
+	uint32_t lastRedraw;									// tick of last redraw
+	uint32_t elapsed;
+	uint32_t timeout;
 	osStatus_t	retCode;
 	uint8_t i;
 	GHandle tmpHndl;
 	
-//	const char escapeBlack[] = {0x1B,'0',0};
-	const char escapeRed[] = {0x1B,'1',0};
-	const char escapeGreen[] = {0x1B,'2',0};
-	const char escapeBold[] = {0x1B,'b',0};
-	const char escapeNoBold[] = {0x1B,'B',0};
-	const char escapeUnderline[] = {0x1B,'u',0};
-	const char escapeNoUnderline[] = {0x1B,'U',0};
-	const char escapeBlue[] = {0x1B,'4',0};
-//	const char escapeWhite[] = {0x1B,'7',0};
-
 	//------------------------------------------------------------------------------
 	// Init the LCD and create Touch thread after
 	//------------------------------------------------------------------------------
 	gfxInit();											// init LCD screen	
 	gdispClear(White);							// clear it
-	gwinSetDefaultFont(gdispOpenFont("DejaVuSans12_aa"));
+	gwinSetDefaultFont(GlyphCacheFont(gdispOpenFont("DejaVuSans12_aa")));
 	gwinSetDefaultStyle(&WhiteWidgetStyle, FALSE);
 	guiInit();											// create interface
 	geventListenerInit(&gl);				// init listener
@@ -56,6 +247,8 @@ void LCD(void *argument)
 	gwinSetBgColor(cnslSend,White);
 	gwinSetColor(cnslReceive,Black);
 	gwinSetBgColor(cnslReceive,White);
+	gwinSetCustomDraw(lblList,LcdListDraw,0);
+	gwinSetText(lblList, "Online stations:", FALSE);
 	sprintf(tempStr,"%d",gTokenInterface.destinationAddress+1);
 	gwinSetText(btnDestination, tempStr, TRUE);
 	sprintf(tempStr,"%d",gTokenInterface.debugAddress+1);
@@ -82,9 +275,27 @@ void LCD(void *argument)
 	gwinSetText(lblDebug, tempStr, TRUE);	
 #endif
 	
+	lastRedraw = osKernelGetTickCount();
 	//------------------------------------------------------------------------------
 	for(;;)													// loop until doomsday
 	{
+		//----------------------------------------------------------------------------
+		// REDRAW (all messages of a frame period are merged in one redraw)
+		//----------------------------------------------------------------------------
+		timeout = osWaitForever;
+		if(dirty != 0)
+		{
+			elapsed = osKernelGetTickCount() - lastRedraw;
+			if(elapsed >= LCD_FRAME_PERIOD)
+			{
+				LcdRedraw();
+				lastRedraw += elapsed;
+			}
+			else
+			{
+				timeout = LCD_FRAME_PERIOD - elapsed;	// wait until end of frame
+			}
+		}
 		//----------------------------------------------------------------------------
 		// QUEUE READ										
 		//----------------------------------------------------------------------------
@@ -92,7 +303,11 @@ void LCD(void *argument)
 			queue_lcd_id,
 			&queueMsg,
 			NULL,
-			osWaitForever); 	
+			timeout); 	
+		if(retCode == osErrorTimeout)					// end of frame
+		{
+			continue;
+		}
     CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);						
 		switch(queueMsg.type)								// check message
 		{
@@ -108,8 +323,7 @@ void LCD(void *argument)
 					if((tmpHndl == btnToken)||						// leave startup window
 						(tmpHndl == btnStart))
 					{
-						gTokenInterface.currentView = MAINDISPLAY;
-						guiShowPage(MAINDISPLAY);
+						LcdShowMain();
 					}
 					//----------------------------------------------------------------------
 					if(tmpHndl == btnDestination)					// enter address select window
@@ -127,8 +341,7 @@ void LCD(void *argument)
 					if((tmpHndl == btnBack)||							// leave config window
 						(tmpHndl == btnSendDebug))
 					{
-						gTokenInterface.currentView = MAINDISPLAY;
-						guiShowPage(MAINDISPLAY);
+						LcdShowMain();
 					}
 					//----------------------------------------------------------------------
 					if(tmpHndl == btnSelect)							// destination changed
@@ -142,8 +355,7 @@ void LCD(void *argument)
 							sprintf(tempStr,"All");
 						}
 						gwinSetText(btnDestination, tempStr, TRUE);	// display it on widget
-						gTokenInterface.currentView = MAINDISPLAY;
-						guiShowPage(MAINDISPLAY);
+						LcdShowMain();
 					}
 					//----------------------------------------------------------------------
 					if(tmpHndl == btnSAPIMinus)						// SAPI changed
@@ -267,8 +479,21 @@ void LCD(void *argument)
 			case TIME_MSG:														// needs to display the time
 				
 				msgPtr = queueMsg.anyPtr;
-				sprintf(tempStr,"Time is: %s",msgPtr);	// create string
-				gwinSetText(lblTime, tempStr, TRUE);		// display it on widget
+				for(i=9;(*msgPtr != 0) && (i < (sizeof(timeStr)-1));i++)	// after "Time is: "
+				{
+					if(timeStr[i] != *msgPtr)							// only changed chars
+					{
+						timeStr[i] = *msgPtr;
+						dirty |= LCD_TIME;									// redraw only if needed
+					}
+					msgPtr++;
+				}
+				if(timeStr[i] != 0)											// shorter than last one
+				{
+					timeStr[i] = 0;
+					dirty |= LCD_TIME;
+				}
+				msgPtr = queueMsg.anyPtr;
 				//------------------------------------------------------------------------
 				// MEMORY RELEASE	(time frame from timeReceiver)
 				//------------------------------------------------------------------------
@@ -284,9 +509,20 @@ void LCD(void *argument)
 				}				
 			break;
 			//--------------------------------------------------------------------------
+			case MONITOR_MSG:													// stack and CPU load report
+				msgPtr = queueMsg.anyPtr;
+				strncpy(monitorStr,msgPtr,sizeof(monitorStr)-1);
+				dirty |= LCD_MONITOR;
+				//------------------------------------------------------------------------
+				// MEMORY RELEASE	(report from monitor)
+				//------------------------------------------------------------------------
+				retCode = osMemoryPoolFree(memPool,msgPtr);
+				CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+			break;
+			//--------------------------------------------------------------------------
 			case CHAR_MSG:														// a char has been pressed
 				msgPtr = queueMsg.anyPtr;
-				gwinPutString(cnslSend,msgPtr);					// display char
+				LcdTextPut(&sendText,cnslSend,msgPtr);	// display char
 				//------------------------------------------------------------------------
 				// MEMORY RELEASE	(character from chatSender)
 				//------------------------------------------------------------------------
@@ -295,24 +531,27 @@ void LCD(void *argument)
 			break;
 			//--------------------------------------------------------------------------
 			case CHAT_MSG:														// a message is incoming
+				msgPtr = queueMsg.anyPtr;
+				ChatHistoryAdd(queueMsg.addr,msgPtr);
 				if(gTokenInterface.currentView != MAINDISPLAY)
 				{
-					guiShowPage(MAINDISPLAY);
+					LcdShowMain();												// with the new message
+				}
+				else if((gTokenInterface.destinationAddress == BROADCAST_ADDRESS) ||
+					(gTokenInterface.destinationAddress == queueMsg.addr))	// shown peer
+				{
+					ChatHistoryShow(queueMsg.addr,1,LcdShowMsg);	// new message
+				}
+				while(msgPtr != NULL)										// all blocks of message
+				{
+					nextPtr = CHAIN_NEXT(msgPtr);
+					//----------------------------------------------------------------------
+					// MEMORY RELEASE	(message from chatReceiver)
+					//----------------------------------------------------------------------
+					retCode = osMemoryPoolFree(memPool,msgPtr);
+					CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+					msgPtr = nextPtr;
 				}
-				msgPtr = queueMsg.anyPtr;
-				sprintf(tempStr,"Msg from : %d\r\n",queueMsg.addr+1);
-				gwinPutString(cnslReceive,escapeBlue);
-				gwinPutString(cnslReceive,escapeUnderline);
-				gwinPutString(cnslReceive,tempStr);
-				gwinPutString(cnslReceive,escapeNoUnderline);
-				gwinPutString(cnslReceive,escapeGreen);
-				gwinPutString(cnslReceive,msgPtr);
-				gwinPutString(cnslReceive,"\r\n");
-				//------------------------------------------------------------------------
-				// MEMORY RELEASE	(message from chatReceiver)
-				//------------------------------------------------------------------------
-				retCode = osMemoryPoolFree(memPool,msgPtr);
-				CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);		
 				//------------------------------------------------------------------------
 				// set event flag to audio player
 				//------------------------------------------------------------------------
@@ -324,15 +563,17 @@ void LCD(void *argument)
 			break;
 			//--------------------------------------------------------------------------
 			case MAC_ERROR:											// a communication error occurs
+				msgPtr = queueMsg.anyPtr;
+				CHAIN_NEXT(msgPtr) = NULL;								// single block message
+				ChatHistoryAdd(CHAT_HISTORY_ERROR,msgPtr);
 				if(gTokenInterface.currentView != MAINDISPLAY)
 				{
-					guiShowPage(MAINDISPLAY);
+					LcdShowMain();
+				}
+				else
+				{
+					LcdShowMsg(CHAT_HISTORY_ERROR,msgPtr);
 				}
-				msgPtr = queueMsg.anyPtr;
-				gwinPutString(cnslReceive,escapeRed);
-				gwinPutString(cnslReceive,escapeBold);
-				gwinPutString(cnslReceive,msgPtr);
-				gwinPutString(cnslReceive,escapeNoBold);
 				//------------------------------------------------------------------------
 				// MEMORY RELEASE	(message from macSenderReceiver)
 				//------------------------------------------------------------------------
@@ -350,27 +591,19 @@ void LCD(void *argument)
 			//--------------------------------------------------------------------------
 			case TOKEN_LIST:									// token list update
 				
-				sprintf(tempStr,"Online stations: ");	// create string
-				for(i=0;i<15;i++)
+				listNew = 0;
+				for(i=0;i<LIST_STATIONS;i++)
 				{
-					//----------------------------------------------------------------------
-					// Not connected station
-					//----------------------------------------------------------------------
-					if((gTokenInterface.station_list[i] & (1 << CHAT_SAPI)) == 0)
+					if((gTokenInterface.station_list[i] & (1 << CHAT_SAPI)) != 0)
 					{
-						// station not connected
-					}
-					//----------------------------------------------------------------------
-					// Any station number connected (CHAT_SAPI)
-					//----------------------------------------------------------------------
-					else
-					{
-						sprintf(smallStr,"%d, ",i+1);
-						strcat(tempStr,smallStr);						
+						listNew |= 1 << i;											// station connected (CHAT_SAPI)
 					}
 				}
-				tempStr[strlen(tempStr)-2] = 0;								// discare last ', '
-				gwinSetText(lblList, tempStr, TRUE);				// display it on widget
+				if(listNew != listState)									// redraw only if changed
+				{
+					listState = listNew;
+					dirty |= LCD_LIST;
+				}
 			break;
 	//------------------------------------------------------------------------------
 	default:
@@ -0,0 +1,133 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file mac_compress.c
+/// \brief Static dictionary compression of MAC payloads
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// Chat text is 7 bits ASCII, so the byte values 0x80 to 0xFE are free to
+/// code the 127 strings of a fixed dictionary (most common words and letter
+/// pairs in english and french chats). No RAM is used except the stack.
+//////////////////////////////////////////////////////////////////////////////////
+#include "stm32f7xx_hal.h"
+
+#include <string.h>
+#include "main.h"
+
+#define DICT_CODE				0x80				// first dictionary code
+#define DICT_SIZE				127					// codes 0x80 to 0xFE
+
+//--------------------------------------------------------------------------------
+// Dictionary (the order gives the code, never change it without all stations)
+//--------------------------------------------------------------------------------
+static const char * const dictionary[DICT_SIZE] = {
+	" the ","the "," de "," and","ing "," le ",
+	" la ","tion"," to "," is ","ent "," les",
+	" des"," est"," pas"," que"," you"," for",
+	" not"," are","ment","Hello","salut","merci",
+	"Salut","e, ","e. ","s, ","s. ",". ",
+	", ","? ","! ","e ","s ","t ",
+	"d ","n ","r ","y ","a ","o ",
+	"u "," t"," a"," s"," d"," c",
+	" p"," m"," l"," i"," o"," w",
+	" e"," b"," f"," h"," n"," q",
+	" v","th","he","in","er","an",
+	"re","on","at","en","nd","ti",
+	"es","or","te","of","ed","is",
+	"it","al","ar","st","to","nt",
+	"ng","se","ha","as","ou","io",
+	"le","ve","co","me","de","hi",
+	"ri","ro","ic","ne","ea","ra",
+	"ce","li","ch","ll","be","ma",
+	"si","om","ur","qu","ai","ui",
+	"us","el","et","ie","ge","pa",
+	"un","la","ct","ec","em","il",
+	"ss",
+};
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Compress a payload with the static dictionary
+/// \param srcPtr The text to compress
+/// \param length The size of the text
+/// \param dstPtr Where to write the compressed payload
+/// \return The size of the compressed payload or 0 if the text can't be
+/// compressed (not ASCII or not smaller)
+//////////////////////////////////////////////////////////////////////////////////
+uint8_t MacCompress(const uint8_t * srcPtr,uint8_t length,uint8_t * dstPtr)
+{
+	uint32_t in = 0;										// position in text
+	uint32_t out = 0;										// position in payload
+	uint32_t i;
+	uint32_t size;											// size of dictionary string
+	uint32_t bestSize;									// longest string matched
+	uint8_t bestCode;
+
+	while(in < length)
+	{
+		if(srcPtr[in] >= DICT_CODE)						// not a 7 bits char
+		{
+			return 0;
+		}
+		bestSize = 1;
+		bestCode = srcPtr[in];
+		for(i=0;i<DICT_SIZE;i++)
+		{
+			if(dictionary[i][0] != srcPtr[in])	// quick first char check
+			{
+				continue;
+			}
+			size = strlen(dictionary[i]);
+			if((size > bestSize) && (size <= (length - in)) &&
+				(memcmp(dictionary[i],&srcPtr[in],size) == 0))
+			{
+				bestSize = size;
+				bestCode = DICT_CODE + i;
+			}
+		}
+		if(out >= (uint32_t)(length - 1))		// not smaller -> give up
+		{
+			return 0;
+		}
+		dstPtr[out++] = bestCode;
+		in += bestSize;
+	}
+	return out;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Expand a payload compressed with the static dictionary
+/// \param srcPtr The compressed payload
+/// \param length The size of the compressed payload
+/// \param dstPtr Where to write the text
+/// \param maxSize The size available at dstPtr
+/// \return The size of the text (truncated to maxSize)
+//////////////////////////////////////////////////////////////////////////////////
+uint8_t MacExpand(const uint8_t * srcPtr,uint8_t length,uint8_t * dstPtr,
+	uint8_t maxSize)
+{
+	uint32_t in;												// position in payload
+	uint32_t out = 0;										// position in text
+	const char * strPtr;
+
+	for(in=0;in<length;in++)
+	{
+		if((srcPtr[in] < DICT_CODE) ||				// plain char
+			(srcPtr[in] - DICT_CODE >= DICT_SIZE))
+		{
+			if(out >= maxSize)
+			{
+				break;
+			}
+			dstPtr[out++] = srcPtr[in];
+		}
+		else																	// dictionary code
+		{
+			strPtr = dictionary[srcPtr[in] - DICT_CODE];
+			while((*strPtr != 0) && (out < maxSize))
+			{
+				dstPtr[out++] = *strPtr++;
+			}
+		}
+	}
+	return out;
+}
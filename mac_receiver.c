@@ -1,5 +1,346 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file mac_receiver.c
+/// \brief MAC receiver thread
+/// \author Pascal Sartoretti (sap at hevs dot ch)
+/// \version 1.0 - original
+/// \date  2018-02
+//////////////////////////////////////////////////////////////////////////////////
+#include "stm32f7xx_hal.h"
 
+#include <stdio.h>
+#include <string.h>
+#include "main.h"
+
+//--------------------------------------------------------------------------------
+// SAPI demultiplexing table (indexed by SAPI number)
+//--------------------------------------------------------------------------------
+struct sapiEntry_t
+{
+	osMessageQueueId_t	queueId;			///< application queue (if any)
+	sapiHandler_t				handler;			///< application callback (if any)
+};
+static struct sapiEntry_t sapiTable[MAX_SAPI];
+static volatile uint8_t sapiBitmap;		// one bit per registered SAPI
+
+//--------------------------------------------------------------------------------
+// Reassembly of a segmented message (segments of one source at a time)
+//--------------------------------------------------------------------------------
+static uint8_t * reasmHead;						// first block of the message
+static uint8_t * reasmTail;						// last block of the message
+static uint8_t reasmSrc;							// SRC byte of the message
+static uint8_t reasmNext;							// next segment number expected
+static uint8_t reasmLast[MAX_BLOCK_SIZE];	// last accepted frame
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Bind a SAPI to an application queue
+/// \param sapi The SAPI number (0-7)
+/// \param queueId The queue receiving the DATA_IND messages of this SAPI
+/// \return FALSE if the SAPI is out of range
+//////////////////////////////////////////////////////////////////////////////////
+bool_t MacSapiRegisterQueue(uint8_t sapi,osMessageQueueId_t queueId)
+{
+	if(sapi >= MAX_SAPI)
+	{
+		return FALSE;
+	}
+	sapiTable[sapi].handler = NULL;
+	sapiTable[sapi].queueId = queueId;
+	sapiBitmap |= (1 << sapi);							// advertised in next token
+	return TRUE;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Bind a SAPI to an application callback
+/// \param sapi The SAPI number (0-7)
+/// \param handler The function called in MAC receiver context for each
+/// DATA_IND message of this SAPI (it owns the memory block of the message)
+/// \return FALSE if the SAPI is out of range
+//////////////////////////////////////////////////////////////////////////////////
+bool_t MacSapiRegisterHandler(uint8_t sapi,sapiHandler_t handler)
+{
+	if(sapi >= MAX_SAPI)
+	{
+		return FALSE;
+	}
+	sapiTable[sapi].queueId = NULL;
+	sapiTable[sapi].handler = handler;
+	sapiBitmap |= (1 << sapi);							// advertised in next token
+	return TRUE;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Remove the binding of a SAPI
+/// \param sapi The SAPI number (0-7)
+//////////////////////////////////////////////////////////////////////////////////
+void MacSapiUnregister(uint8_t sapi)
+{
+	if(sapi < MAX_SAPI)
+	{
+		sapiBitmap &= ~(1 << sapi);						// not advertised anymore
+		sapiTable[sapi].queueId = NULL;
+		sapiTable[sapi].handler = NULL;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get the SAPI bitmap of this station (as advertised in the token)
+/// \return One bit set for each registered SAPI
+//////////////////////////////////////////////////////////////////////////////////
+uint8_t MacSapiBitmap(void)
+{
+	return sapiBitmap;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Give a received payload to the application bound to a SAPI
+/// \param queueMsg The DATA_IND message (memory block is given to application)
+/// \return FALSE if no application is bound to the SAPI
+//////////////////////////////////////////////////////////////////////////////////
+static bool_t MacSapiDispatch(struct queueMsg_t * queueMsg,uint8_t sapi)
+{
+	struct sapiEntry_t * entry = &sapiTable[sapi & (MAX_SAPI-1)];
+	osStatus_t retCode;
+
+	if(entry->handler != NULL)							// callback application
+	{
+		entry->handler(queueMsg);
+		return TRUE;
+	}
+	if(entry->queueId != NULL)							// queue application
+	{
+		//----------------------------------------------------------------------------
+		// QUEUE SEND	(send payload to application layer)
+		//----------------------------------------------------------------------------
+		retCode = osMessageQueuePut(
+			entry->queueId,
+			queueMsg,
+			osPriorityNormal,
+			osWaitForever);
+		CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+		return TRUE;
+	}
+	return FALSE;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Copy the text of a received frame as a C string
+/// \param dstPtr Where to write the text (a memory pool block)
+/// \param framePtr The MAC frame
+/// \param offset The number of payload bytes to skip (segment byte)
+//////////////////////////////////////////////////////////////////////////////////
+static void MacPayload(uint8_t * dstPtr,uint8_t * framePtr,uint8_t offset)
+{
+	uint8_t length = MacPayloadLength(framePtr) - offset;
+	uint8_t * srcPtr = &framePtr[3 + offset];
+
+	if((framePtr[1] & MAC_COMPRESSED) != 0)	// compressed payload
+	{
+		length = MacExpand(srcPtr,length,dstPtr,MAX_BLOCK_SIZE - 6);
+	}
+	else
+	{
+		memcpy(dstPtr,srcPtr,length);
+	}
+	dstPtr[length] = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Add a received segment to the message in reassembly
+/// \param framePtr The segmented MAC frame (checksum already checked)
+/// \param msgPtr Set to the chain of the complete message (NULL if not complete)
+/// \return FALSE if the segment is rejected (frame not acknowledged)
+///
+/// A frame equal to the last accepted one is a retransmission (the sender did
+/// not see the ACK) and is acknowledged again without being added. Any other
+/// first segment starts a new message.
+//////////////////////////////////////////////////////////////////////////////////
+static bool_t MacReassemble(uint8_t * framePtr,uint8_t ** msgPtr)
+{
+	uint8_t * msg;											// new block of chain
+	uint8_t segment;
+
+	*msgPtr = NULL;
+	segment = framePtr[3] & ~MAC_SEG_LAST;
+	if(MacPayloadLength(framePtr) == 0)		// no segment byte
+	{
+		return FALSE;
+	}
+	if(memcmp(framePtr,reasmLast,framePtr[2] + 3) == 0)	// retransmission
+	{
+		return TRUE;												// already added
+	}
+	if(segment == 0)											// first segment -> new message
+	{
+		PoolChainFree(reasmHead);						// drop any uncomplete one
+		reasmHead = NULL;
+		reasmSrc = framePtr[0];
+		reasmNext = 0;
+	}
+	if((reasmHead == NULL) && (segment != 0))	// not in a message
+	{
+		return FALSE;
+	}
+	if(framePtr[0] != reasmSrc)						// another source: sender retries
+	{
+		return FALSE;
+	}
+	if(segment != reasmNext)							// lost segment
+	{
+		PoolChainFree(reasmHead);
+		reasmHead = NULL;
+		reasmSrc = 0;
+		reasmNext = 0;
+		return FALSE;
+	}
+	//------------------------------------------------------------------------------
+	// MEMORY ALLOCATION	(one block per segment)
+	//------------------------------------------------------------------------------
+	msg = osMemoryPoolAlloc(memPool,osWaitForever);
+	MacPayload(msg,framePtr,1);					// without segment byte
+	CHAIN_NEXT(msg) = NULL;
+	if(reasmHead == NULL)
+	{
+		reasmHead = msg;
+	}
+	else
+	{
+		CHAIN_NEXT(reasmTail) = msg;
+	}
+	reasmTail = msg;
+	reasmNext++;
+	memcpy(reasmLast,framePtr,framePtr[2] + 3);
+	if((framePtr[3] & MAC_SEG_LAST) != 0)	// message complete
+	{
+		*msgPtr = reasmHead;
+		reasmHead = NULL;
+		reasmSrc = 0;
+		reasmNext = 0;
+	}
+	return TRUE;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// THREAD MAC RECEIVER
+//////////////////////////////////////////////////////////////////////////////////
 void MacReceiver(void *argument)
 {
-	// TODO
+	struct queueMsg_t queueMsg;					// queue message
+	struct queueMsg_t appMsg;						// message to application
+	uint8_t * qPtr;											// received frame
+	uint8_t * msg;											// payload to application
+	uint8_t * statusPtr;								// status byte of frame
+	uint8_t srcAddr;
+	uint8_t dstAddr;
+	uint8_t dstSapi;
+	uint8_t length;
+	osStatus_t retCode;									// return error code
+
+	//------------------------------------------------------------------------------
+	for (;;)														// loop until doomsday
+	{
+		//----------------------------------------------------------------------------
+		// QUEUE READ
+		//----------------------------------------------------------------------------
+		retCode = osMessageQueueGet(
+			queue_macR_id,
+			&queueMsg,
+			NULL,
+			osWaitForever);
+    CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+		qPtr = queueMsg.anyPtr;
+		//----------------------------------------------------------------------------
+		// TOKEN FRAME (give it to mac sender)
+		//----------------------------------------------------------------------------
+		if(qPtr[0] == TOKEN_TAG)
+		{
+			queueMsg.type = TOKEN;
+			retCode = osMessageQueuePut(
+				queue_macS_id,
+				&queueMsg,
+				osPriorityNormal,
+				osWaitForever);
+			CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+			continue;
+		}
+		//----------------------------------------------------------------------------
+		// DATA FRAME
+		//----------------------------------------------------------------------------
+		srcAddr = MAC_ADDR(qPtr[0]);
+		dstAddr = MAC_ADDR(qPtr[1]);
+		dstSapi = MAC_SAPI(qPtr[1]);
+		length = qPtr[2];
+		statusPtr = &qPtr[length + 3];
+		if((dstAddr == gTokenInterface.myAddress) ||	// is destination my address
+			(dstAddr == BROADCAST_ADDRESS))							// or a broadcast frame
+		{
+			if(((sapiBitmap & (1 << dstSapi)) != 0) &&	// SAPI is bound
+				((gTokenInterface.connected != FALSE) ||	// and station connected
+				(dstSapi == TIME_SAPI)))									// (time is always read)
+			{
+				*statusPtr |= 0x02;												// set RD bit
+				if(MacFrameCheck(qPtr) != FALSE)				// checksum OK
+				{
+					if((qPtr[0] & MAC_SEGMENT) != 0)				// segmented message
+					{
+						if(MacReassemble(qPtr,&msg) != FALSE)	// segment accepted
+						{
+							*statusPtr |= 0x01;									// set ACK bit
+						}
+						else
+						{
+							*statusPtr &= 0xFE;									// clear ACK bit (retry)
+						}
+					}
+					else
+					{
+						*statusPtr |= 0x01;										// set ACK bit
+						//--------------------------------------------------------------------
+						// MEMORY ALLOCATION	(payload as C string for application)
+						//--------------------------------------------------------------------
+						msg = osMemoryPoolAlloc(memPool,osWaitForever);
+						MacPayload(msg,qPtr,0);
+						CHAIN_NEXT(msg) = NULL;
+					}
+					appMsg.type = DATA_IND;
+					appMsg.anyPtr = msg;
+					appMsg.addr = srcAddr;
+					appMsg.sapi = MAC_SAPI(qPtr[0]);
+					if((msg != NULL) &&
+						(MacSapiDispatch(&appMsg,dstSapi) == FALSE))	// unbound meanwhile
+					{
+						PoolChainFree(msg);
+					}
+				}
+				else
+				{
+					*statusPtr &= 0xFE;											// clear ACK bit
+				}
+			}
+		}
+		//----------------------------------------------------------------------------
+		// SOURCE IS ME (give databack to mac sender) OR FORWARD TO PHY
+		//----------------------------------------------------------------------------
+		if(srcAddr == gTokenInterface.myAddress)
+		{
+			queueMsg.type = DATABACK;
+			queueMsg.addr = srcAddr;
+			queueMsg.sapi = MAC_SAPI(qPtr[0]);
+			retCode = osMessageQueuePut(
+				queue_macS_id,
+				&queueMsg,
+				osPriorityNormal,
+				osWaitForever);
+			CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+		}
+		else
+		{
+			queueMsg.type = TO_PHY;
+			retCode = osMessageQueuePut(
+				queue_phyS_id,
+				&queueMsg,
+				osPriorityNormal,
+				osWaitForever);
+			CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+		}
+	}
 }
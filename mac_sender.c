@@ -1,5 +1,392 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file mac_sender.c
+/// \brief MAC sender thread
+/// \author Pascal Sartoretti (sap at hevs dot ch)
+/// \version 1.0 - original
+/// \date  2018-02
+//////////////////////////////////////////////////////////////////////////////////
+#include "stm32f7xx_hal.h"
 
+#include <stdio.h>
+#include <string.h>
+#include "main.h"
+#include "ext_led.h"
+
+osMessageQueueId_t queue_macData_id;			// messages waiting for the token
+static uint32_t timeSentTick;							// tick when last time frame was sent
+
+const osMessageQueueAttr_t queue_macData_attr = {
+	.name = "MAC_DATA    "
+};
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief SAPI bitmap this station advertises in the token
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t MacOwnSapis(void)
+{
+	if(gTokenInterface.connected != FALSE)
+	{
+		return MacSapiBitmap();								// all bound applications
+	}
+	return MacSapiBitmap() & (1 << TIME_SAPI);	// only time when disconnected
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Send a frame (token or data) to the physical layer
+/// \param framePtr pointer to the MAC frame
+//////////////////////////////////////////////////////////////////////////////////
+static void MacToPhy(uint8_t * framePtr)
+{
+	struct queueMsg_t queueMsg;					// queue message
+	osStatus_t retCode;
+
+	queueMsg.type = TO_PHY;
+	queueMsg.anyPtr = framePtr;
+	//------------------------------------------------------------------------------
+	// QUEUE SEND	(send frame to physical layer sender)
+	//------------------------------------------------------------------------------
+	retCode = osMessageQueuePut(
+		queue_phyS_id,
+		&queueMsg,
+		osPriorityNormal,
+		osWaitForever);
+	CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Send an error string to the LCD
+/// \param text The string to display
+/// \param addr The station concerned by the error
+//////////////////////////////////////////////////////////////////////////////////
+static void MacError(const char * text,uint8_t addr)
+{
+	struct queueMsg_t queueMsg;					// queue message
+	char * msg;
+	osStatus_t retCode;
+
+	//------------------------------------------------------------------------------
+	// MEMORY ALLOCATION
+	//------------------------------------------------------------------------------
+	msg = osMemoryPoolAlloc(memPool,osWaitForever);
+	sprintf(msg,"%s %d\r\n",text,addr+1);
+	queueMsg.type = MAC_ERROR;
+	queueMsg.anyPtr = msg;
+	queueMsg.addr = addr;
+	//------------------------------------------------------------------------------
+	// QUEUE SEND	(send error to LCD)
+	//------------------------------------------------------------------------------
+	retCode = osMessageQueuePut(
+		queue_lcd_id,
+		&queueMsg,
+		osPriorityNormal,
+		osWaitForever);
+	CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Build the frame of one block of a chained message and send it
+/// \param dataMsg The DATA_IND message (destination address and SAPI)
+/// \param blockPtr The block to send (released here)
+/// \param segment The segment byte or 0xFF if the message is not segmented
+/// \return The sent frame (kept by the MAC sender until its databack)
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t * MacSendBlock(struct queueMsg_t * dataMsg,uint8_t * blockPtr,
+	uint8_t segment)
+{
+	uint8_t * msg;											// frame to send
+	uint8_t * dataPtr;									// where text is placed
+	uint8_t length;
+#if MAC_COMPRESSION != 0
+	uint8_t zLength;										// compressed size
+#endif
+	osStatus_t retCode;
+
+	length = strlen((char *)blockPtr);
+	//------------------------------------------------------------------------------
+	// MEMORY ALLOCATION	(frame kept for a resend)
+	//------------------------------------------------------------------------------
+	msg = osMemoryPoolAlloc(memPool,osWaitForever);
+	PROFILE_BEGIN(PROF_MAC_BUILD);
+	msg[0] = (gTokenInterface.myAddress << 3) | dataMsg->sapi;
+	msg[1] = (dataMsg->addr << 3) | dataMsg->sapi;
+	dataPtr = &msg[3];
+	if(segment != 0xFF)										// segmented message
+	{
+		msg[0] |= MAC_SEGMENT;
+		*dataPtr++ = segment;
+	}
+#if MAC_COMPRESSION != 0
+	zLength = 0;
+	if((dataMsg->sapi == CHAT_SAPI) && (gTokenInterface.compress != FALSE))
+	{
+		zLength = MacCompress(blockPtr,length,dataPtr);
+	}
+	if(zLength != 0)											// payload is smaller
+	{
+		msg[1] |= MAC_COMPRESSED;
+		length = zLength;
+	}
+	else
+#endif
+	{
+		memcpy(dataPtr,blockPtr,length);
+	}
+	if((dataMsg->sapi == TIME_SAPI) && (dataPtr[0] == TIME_SYNC_TAG))
+	{
+		TimeSyncStamp(dataPtr);							// time when frame leaves
+		timeSentTick = osKernelGetTickCount();
+	}
+	msg[2] = (dataPtr - &msg[3]) + length;
+	MacFrameSeal(msg);										// RD = 0, ACK = 0
+	PROFILE_END(PROF_MAC_BUILD);
+	//------------------------------------------------------------------------------
+	// MEMORY RELEASE	(block from application)
+	//------------------------------------------------------------------------------
+	retCode = osMemoryPoolFree(memPool,blockPtr);
+	CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+	MacToPhy(msg);
+	return msg;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Send the next block of the current message (if any)
+/// \param dataMsg The DATA_IND message (anyPtr is the remaining chain)
+/// \param segIndex The number of segments already sent
+/// \return The sent frame or NULL if the message is completely sent
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t * MacSendNext(struct queueMsg_t * dataMsg,uint8_t * segIndex)
+{
+	uint8_t * blockPtr = dataMsg->anyPtr;
+	uint8_t segment;
+
+	if(blockPtr == NULL)
+	{
+		return NULL;
+	}
+	dataMsg->anyPtr = CHAIN_NEXT(blockPtr);
+	if(((*segIndex == 0) && (dataMsg->anyPtr == NULL)) ||	// fits in one frame
+		(gTokenInterface.segment == FALSE))		// or one message per block
+	{
+		segment = 0xFF;
+	}
+	else
+	{
+		segment = *segIndex;
+		if(dataMsg->anyPtr == NULL)
+		{
+			segment |= MAC_SEG_LAST;
+		}
+	}
+	(*segIndex)++;
+	return MacSendBlock(dataMsg,blockPtr,segment);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// THREAD MAC SENDER
+//////////////////////////////////////////////////////////////////////////////////
 void MacSender(void *argument)
 {
-	// TODO
+	struct queueMsg_t queueMsg;					// queue message
+	struct queueMsg_t dataMsg;					// message waiting for token
+	uint8_t * qPtr;											// current frame
+	uint8_t * msg;											// any frame pointer
+	uint8_t * tokenPtr = NULL;					// token kept during a send
+	uint8_t * sentPtr = NULL;						// frame waiting for its databack
+	uint8_t segIndex = 0;								// segments sent of dataMsg
+	uint8_t retries = 0;								// resends of sentPtr
+	uint8_t waitTokens = 0;							// tokens to let go before resend
+	uint8_t status;											// RD and ACK of databack
+	uint8_t dstAddr;										// destination of databack
+	uint8_t i;
+	osStatus_t retCode;									// return error code
+
+	dataMsg.anyPtr = NULL;
+	queue_macData_id = osMessageQueueNew(4,sizeof(struct queueMsg_t),&queue_macData_attr);
+	//------------------------------------------------------------------------------
+	for (;;)														// loop until doomsday
+	{
+		//----------------------------------------------------------------------------
+		// QUEUE READ
+		//----------------------------------------------------------------------------
+		retCode = osMessageQueueGet(
+			queue_macS_id,
+			&queueMsg,
+			NULL,
+			osWaitForever);
+    CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+		qPtr = queueMsg.anyPtr;
+		switch(queueMsg.type)
+		{
+			//**************************************************************************
+			case NEW_TOKEN:													// create a new token
+				//------------------------------------------------------------------------
+				// MEMORY ALLOCATION
+				//------------------------------------------------------------------------
+				msg = osMemoryPoolAlloc(memPool,osWaitForever);
+				memset(msg,0,TOKENSIZE-2);
+				msg[0] = TOKEN_TAG;
+				msg[gTokenInterface.myAddress+1] = MacOwnSapis();
+#if MAC_CRC16 != 0
+				msg[TOKEN_OPTIONS] |= TOKEN_OPT_CRC16;	// propose CRC-16 to the ring
+#endif
+#if MAC_COMPRESSION != 0
+				msg[TOKEN_OPTIONS] |= TOKEN_OPT_COMPRESS;	// propose compression
+#endif
+#if MAC_SEGMENTATION != 0
+				msg[TOKEN_OPTIONS] |= TOKEN_OPT_SEGMENT;	// propose segmentation
+#endif
+#if TIME_BINARY != 0
+				msg[TOKEN_OPTIONS] |= TOKEN_OPT_TIME;	// propose binary time
+#endif
+				MacToPhy(msg);
+			break;
+			//**************************************************************************
+			case START:															// station connected
+				gTokenInterface.connected = TRUE;
+				Ext_LED_PWM(8,100);
+			break;
+			//--------------------------------------------------------------------------
+			case STOP:															// station disconnected
+				gTokenInterface.connected = FALSE;
+				Ext_LED_PWM(8,0);
+			break;
+			//**************************************************************************
+			case DATA_IND:													// keep it until token
+				retCode = osMessageQueuePut(
+					queue_macData_id,
+					&queueMsg,
+					osPriorityNormal,
+					osWaitForever);
+				CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+			break;
+			//**************************************************************************
+			case TOKEN:															// token is for us
+				qPtr[gTokenInterface.myAddress+1] = MacOwnSapis();
+#if MAC_CRC16 == 0
+				qPtr[TOKEN_OPTIONS] &= ~TOKEN_OPT_CRC16;	// refuse CRC-16 for the ring
+#endif
+				gTokenInterface.crc16 = (qPtr[TOKEN_OPTIONS] & TOKEN_OPT_CRC16) != 0;
+#if MAC_COMPRESSION == 0
+				qPtr[TOKEN_OPTIONS] &= ~TOKEN_OPT_COMPRESS;	// refuse compression
+#endif
+				gTokenInterface.compress = (qPtr[TOKEN_OPTIONS] & TOKEN_OPT_COMPRESS) != 0;
+#if MAC_SEGMENTATION == 0
+				qPtr[TOKEN_OPTIONS] &= ~TOKEN_OPT_SEGMENT;	// refuse segmentation
+#endif
+				gTokenInterface.segment = (qPtr[TOKEN_OPTIONS] & TOKEN_OPT_SEGMENT) != 0;
+#if TIME_BINARY == 0
+				qPtr[TOKEN_OPTIONS] &= ~TOKEN_OPT_TIME;	// refuse binary time
+#endif
+				gTokenInterface.timeBinary = (qPtr[TOKEN_OPTIONS] & TOKEN_OPT_TIME) != 0;
+				for(i=0;i<15;i++)
+				{
+					gTokenInterface.station_list[i] = qPtr[i+1];
+				}
+				queueMsg.type = TOKEN_LIST;
+				queueMsg.anyPtr = NULL;
+				retCode = osMessageQueuePut(
+					queue_lcd_id,
+					&queueMsg,
+					osPriorityNormal,
+					osWaitForever);
+				CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+				//------------------------------------------------------------------------
+				// frame to send again ?
+				//------------------------------------------------------------------------
+				if(sentPtr != NULL)
+				{
+					if(waitTokens > 0)										// backoff not elapsed
+					{
+						waitTokens--;
+						MacToPhy(qPtr);
+					}
+					else																	// same frame again
+					{
+						tokenPtr = qPtr;
+						MacToPhy(sentPtr);
+					}
+					break;
+				}
+				//------------------------------------------------------------------------
+				// any message to send ?
+				//------------------------------------------------------------------------
+				if(osMessageQueueGet(queue_macData_id,&dataMsg,NULL,0) != osOK)
+				{
+					MacToPhy(qPtr);												// no -> release token
+					break;
+				}
+				tokenPtr = qPtr;												// keep token
+				segIndex = 0;
+				retries = 0;
+				sentPtr = MacSendNext(&dataMsg,&segIndex);
+			break;
+			//**************************************************************************
+			case DATABACK:													// our frame is back
+				status = qPtr[qPtr[2]+3] & 0x03;
+				dstAddr = MAC_ADDR(qPtr[1]);
+				if(qPtr != sentPtr)											// not the kept frame
+				{
+					//----------------------------------------------------------------------
+					// MEMORY RELEASE	(databack from physical layer)
+					//----------------------------------------------------------------------
+					retCode = osMemoryPoolFree(memPool,qPtr);
+					CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+				}
+				if(sentPtr == NULL)											// nothing was sent
+				{
+					break;
+				}
+				if((MAC_SAPI(sentPtr[0]) == TIME_SAPI) && (sentPtr[3] == TIME_SYNC_TAG))
+				{
+					TimeSyncRingTrip(osKernelGetTickCount() - timeSentTick);
+				}
+				if((dstAddr != BROADCAST_ADDRESS) && (status == 0x02))	// RD=1, ACK=0
+				{
+					retries++;
+					if(retries <= MAC_RETRY_MAX)
+					{
+						sentPtr[sentPtr[2]+3] &= 0xFC;			// same frame, RD = ACK = 0
+						waitTokens = (1 << (retries - 1)) - 1;	// 0, 1, 3, 7... tokens
+						if(waitTokens == 0)
+						{
+							MacToPhy(sentPtr);								// resend now
+						}
+						else
+						{
+							MacToPhy(tokenPtr);								// resend later
+							tokenPtr = NULL;
+						}
+						break;
+					}
+					MacError("MAC error: too many retries to station",dstAddr);
+					PoolChainFree(dataMsg.anyPtr);				// drop next segments
+					dataMsg.anyPtr = NULL;
+				}
+				else if((dstAddr != BROADCAST_ADDRESS) && ((status & 0x02) == 0))	// RD=0
+				{
+					MacError("MAC error: no answer from station",dstAddr);
+					PoolChainFree(dataMsg.anyPtr);				// drop next segments
+					dataMsg.anyPtr = NULL;
+				}
+				//------------------------------------------------------------------------
+				// MEMORY RELEASE	(the kept frame)
+				//------------------------------------------------------------------------
+				retCode = osMemoryPoolFree(memPool,sentPtr);
+				CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+				retries = 0;
+				//------------------------------------------------------------------------
+				// next segment in the same token hold or release token
+				//------------------------------------------------------------------------
+				sentPtr = MacSendNext(&dataMsg,&segIndex);
+				if((sentPtr == NULL) && (tokenPtr != NULL))
+				{
+					MacToPhy(tokenPtr);
+					tokenPtr = NULL;
+				}
+			break;
+			//--------------------------------------------------------------------------
+			default:
+			break;
+		}
+	}
 }
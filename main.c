@@ -26,6 +26,7 @@ osMemoryPoolId_t memPool;
 // Event flag
 //--------------------------------------------------------------------------------
 osEventFlagsId_t eventFlag_id;
+osTimerId_t timer_time_id;
 //--------------------------------------------------------------------------------
 // Queues id and attributes
 //--------------------------------------------------------------------------------
@@ -89,6 +90,8 @@ osThreadId_t debug_id;
 osThreadId_t touch_id;
 osThreadId_t lcd_id;
 osThreadId_t audio_id;
+osThreadId_t trace_id;
+osThreadId_t monitor_id;
 
 extern void PhReceiver(void *argument);
 extern void PhSender(void *argument);
@@ -102,9 +105,12 @@ extern void DebugStation(void *argument);
 extern void Touch(void *argument);
 extern void LCD(void *argument);
 extern void AudioPlayer(void *argument);
+extern void Trace(void *argument);
+extern void Monitor(void *argument);
+extern void TimeTimer(void *argument);
 
 const osThreadAttr_t audio_attr = {
-  .stack_size = 512,
+  .stack_size = 1024,							// codec init, mixer and error printf
 	.priority = osPriorityAboveNormal,
 	.name = "AUDIO"
 };
@@ -175,6 +181,18 @@ const osThreadAttr_t lcd_attr = {
 	.name = "LCD"
 };
 
+const osThreadAttr_t trace_attr = {
+  .stack_size = 1024,
+	.priority = osPriorityLow,
+	.name = "TRACE"
+};
+
+const osThreadAttr_t monitor_attr = {
+  .stack_size = 1024,
+	.priority = osPriorityLow,
+	.name = "MONITOR"
+};
+
 const osThreadAttr_t tester_attr = {
   .stack_size = 256,
 	.priority = osPriorityNormal,
@@ -182,87 +200,21 @@ const osThreadAttr_t tester_attr = {
 };
 
 //////////////////////////////////////////////////////////////////////////////////
-/// \brief Display a frame of type PHY
-/// \param stringP pointer to physical frame to display
-/// It is used by PHY_SENDER and PHY_RECEIVER
-//////////////////////////////////////////////////////////////////////////////////
-void DebugFrame(char * stringP)
-{
-  uint8_t  temp;                          			// used for temp calculation
-  uint8_t  byte;                          			// used for temp byte memory
-  uint8_t  table[16] = {'0','1','2','3',
-                     '4','5','6','7',
-                     '8','9','A','B',
-                     'C','D','E','F'};
-  uint32_t size;                          			// get size of frame
-  uint32_t i;                             			// temporary counter
-
-
-  if ((uint8_t)stringP[1] == TOKEN_TAG)     // is it a TOKEN frame
-  {
-    size = TOKENSIZE;                  			// size is TOKENSIZE
-  }
-  else
-  {
-    size = stringP[3] + 6;             			// calculate size of frame
-  }
-  i = 0;
-  putchar('[');                    			    // display an open bracket
-  for(i=0;i<size;i++)
-  {
-    byte = stringP[i];                 			// get byte from frame
-    temp = (byte & 0xF0) >> 4;
-    putchar(table[temp]);           			  // display 2 hex digits
-     temp = (byte & 0x0F);
-    putchar(table[temp]);
-    putchar(' ');                   			  // insert a space
-  }
-  putchar(']');                     			  // display a closed bracket
-  putchar(0x0D);                    			  // with a <CR>
-  putchar(0x0A);                    			  // with a <CR>
-}
-
-//////////////////////////////////////////////////////////////////////////////////
-/// \brief Display a frame of type MAC to the PC serial port for debug
-/// \param preChar the char to write before the message
-/// \param strinP pointer to the message of type MAC !!!
-/// It is used by PHY_SENDER and DEBUG
+/// \brief Release all the memory blocks of a chained message
+/// \param blockPtr pointer to the first block of the chain
 //////////////////////////////////////////////////////////////////////////////////
-void DebugMacFrame(uint8_t preChar,uint8_t * stringP)
+void PoolChainFree(void * blockPtr)
 {
-	uint8_t  temp;                          // used for temp calculation
-	uint8_t  byte;                          // used for temp byte memory
-	uint8_t  table[16] = {'0','1','2','3',
-                     '4','5','6','7',
-                     '8','9','A','B',
-                     'C','D','E','F'};
-	uint32_t size;                         	// get size of frame
-	uint32_t i;                           	// temporary counter
-
-  if (stringP[0] == TOKEN_TAG)           	// is it a TOKEN frame
-  {
-    size = TOKENSIZE - 2;         				//size is TOKENSIZE
-  }
-  else
-  {
-    size = stringP[2] + 4;             		// calculate size of frame
-  }
-  i = 0;
-  putchar(preChar);
-  putchar('-');
-  putchar('[');                    				// display an open bracket
-  for(i=0;i<size;i++)
-  {
-    byte = stringP[i];                 		// get byte from frame
-    temp = (byte & 0xF0) >> 4;
-    putchar(table[temp]);           			// display 2 hex digits
-     temp = (byte & 0x0F);
-    putchar(table[temp]);
-    putchar(' ');                   			// insert a space
-  }
-  putchar(']');                     			// display a closed bracket
-  putchar('\r');                    			// with a <CR>
-  putchar('\n');                    			// and a <LF> to flush buffer
+	void * nextPtr;													// next block of the chain
+	osStatus_t retCode;
+
+	while(blockPtr != NULL)
+	{
+		nextPtr = CHAIN_NEXT(blockPtr);
+		retCode = osMemoryPoolFree(memPool,blockPtr);
+		CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+		blockPtr = nextPtr;
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -276,9 +228,9 @@ void CheckRetCode(uint32_t retCode,uint32_t lineNumber,char * fileName,uint8_t m
 {
   if(retCode != osOK)											// if an error occur
   {
-		printf("At line : %d\r\n",lineNumber);	// display line error
-		printf("On file : %s \r\n",fileName);
-		printf("Error   : %d\r\n",retCode);			// displays error number
+		TRACE_PRINTF(LOG_ERROR,LOG_SYSTEM,"At line : %d\r\n",lineNumber);
+		TRACE_PRINTF(LOG_ERROR,LOG_SYSTEM,"On file : %s \r\n",fileName);
+		TRACE_PRINTF(LOG_ERROR,LOG_SYSTEM,"Error   : %d\r\n",retCode);
 		if (mode != CONTINUE)										// if mode is not CONTINUE (0)
     {
 			while(1){}														// stays here forever
@@ -364,15 +316,20 @@ int main(void)
 	gTokenInterface.debugSAPI = 1;
 	gTokenInterface.debugOnline = TRUE;
 	gTokenInterface.destinationAddress = 1;
+	ProfileInit();													// cycle counter (profiler, monitor)
+	MacCrcInit();														// CRC-16 frame check
+	GlyphCacheInit();												// decoded glyphs of LCD fonts
 
 	//------------------------------------------------------------------------------
 	// Create memory pool
 	//------------------------------------------------------------------------------
-	memPool = osMemoryPoolNew(8,MAX_BLOCK_SIZE,NULL);
+	memPool = osMemoryPoolNew(16,MAX_BLOCK_SIZE,NULL);	// room for chained msg
 	//------------------------------------------------------------------------------
 	// Create event flag
 	//------------------------------------------------------------------------------
 	eventFlag_id = osEventFlagsNew(NULL);
+	timer_time_id = osTimerNew(TimeTimer,osTimerPeriodic,NULL,NULL);
+	I2cBusInit();														// touch and audio codec bus
 	//------------------------------------------------------------------------------
 	// Create queues
 	//------------------------------------------------------------------------------
@@ -387,11 +344,16 @@ int main(void)
 	queue_lcd_id = osMessageQueueNew(4,sizeof(struct queueMsg_t),&queue_lcd_attr);
 	queue_keyboard_id = osMessageQueueNew(4,sizeof(struct queueMsg_t),&queue_keyboard_attr);
 	queue_usartR_id = osMessageQueueNew(4,sizeof(struct queueMsg_t),&queue_usartR_attr);
+	//------------------------------------------------------------------------------
+	// Bind applications to their SAPI (advertised in the token)
+	//------------------------------------------------------------------------------
+	MacSapiRegisterQueue(CHAT_SAPI,queue_chatR_id);
+	MacSapiRegisterQueue(TIME_SAPI,queue_timeR_id);
 
 	//------------------------------------------------------------------------------
 	// Create Threads
 	//------------------------------------------------------------------------------
-  // audio_id = osThreadNew(AudioPlayer, NULL, &audio_attr);
+  audio_id = osThreadNew(AudioPlayer, NULL, &audio_attr);
   debug_id = osThreadNew(DebugStation, NULL, &debug_attr);
   phy_rec_id = osThreadNew(PhReceiver, NULL, &phy_rec_attr);
   phy_snd_id = osThreadNew(PhSender, NULL, &phy_snd_attr);
@@ -403,6 +365,12 @@ int main(void)
   chat_snd_id = osThreadNew(ChatSender, NULL, &chat_snd_attr);
   touch_id = osThreadNew(Touch, NULL, &touch_attr);
   lcd_id = osThreadNew(LCD, NULL, &lcd_attr);
+#if MONITOR != 0																// TIM6 sampling and reports
+  monitor_id = osThreadNew(Monitor, NULL, &monitor_attr);
+#endif
+#if (LOG_LEVEL >= LOG_INFO) || (PROFILE != 0)	// deferred traces are used
+  trace_id = osThreadNew(Trace, NULL, &trace_attr);
+#endif
 
 	//------------------------------------------------------------------------------
 	// Start kernel and never returns
@@ -19,6 +19,26 @@
 #define DEBUG_MODE				1					// mode is physical line (0) or debug (1)
 #define MYADDRESS   			3					// your address choice (table number)
 #define MAX_BLOCK_SIZE 		100				// size max for a frame
+#define MAC_COMPRESSION		0					// offer compression of chat payloads (1) or not (0)
+#define MAC_CRC16					0					// offer CRC-16 frame check (1) or not (0)
+#define MAC_SEGMENTATION	0					// offer segmented long messages (1) or not (0)
+#define TIME_BINARY				0					// offer binary time frames (1) or not (0)
+#define MAC_CRC_HW				1					// CRC-16 by CRC unit (1) or by table (0)
+#define MAC_RETRY_MAX			4					// resends of a frame before a MAC error
+#define TIME_PERIOD				1000			// time broadcast period (ms)
+#define DEBUG_HOP_DELAY		300				// debug station delay per frame (ms)
+#define DEBUG_PEERS				0					// virtual stations of debug script (0-4)
+#define TRACE_CAPTURE			0					// frames traced as hex text (0) or capture (1)
+#define LOG_LEVEL					LOG_VERBOSE	// highest level of traces kept in build
+#define LOG_MODULES				(LOG_SYSTEM | LOG_DEBUG | LOG_PHY | LOG_MONITOR)
+#define MONITOR						0					// stack and CPU load monitor off (0) or on (1)
+#define MONITOR_PERIOD		5000			// stack and CPU load report period (ms)
+#define LCD_FRAME_PERIOD	33				// min time between LCD redraws (ms)
+#define CHAT_HISTORY_SIZE	4096			// bytes of received messages history
+#define CHAT_HISTORY_TEXT	256				// max length of a message in history
+#define CHAT_HISTORY_SHOW	8					// messages displayed again on console
+#define PROFILE						0					// hot path profiler off (0) or on (1)
+#define PROFILE_DUMP_KEY	0x10			// keyboard key (CTRL-P) to display profile
 
 //--------------------------------------------------------------------------------
 // Constants to NOT change for the system working
@@ -28,9 +48,30 @@
 #define BROADCAST_ADDRESS	0x0F			// broadcast address
 #define TOKEN_TAG					0xFF			// tag of tokenring frame
 #define TOKENSIZE					19				// size of a token frame
+#define TOKEN_OPTIONS			16				// token byte of broadcast address: options
+#define TOKEN_OPT_CRC16		0x01			// all stations check frames with CRC-16
+#define TOKEN_OPT_COMPRESS	0x02			// all stations expand compressed chat frames
+#define TOKEN_OPT_SEGMENT	0x04			// all stations reassemble segmented frames
+#define TOKEN_OPT_TIME		0x08			// all stations read binary time frames
 #define STX 							0x02			// any frame start char
 #define ETX								0x03			// any frame end char
 #define CONTINUE					0x0				// for check return code halt
+#define MAC_SEGMENT				0x80			// SRC flag: payload starts with segment byte
+#define MAC_SEG_LAST			0x80			// segment byte flag: last segment of message
+#define MAC_COMPRESSED		0x80			// DST flag: payload is dictionary compressed
+#define TIME_SYNC_TAG			0xF4			// first byte of a binary time payload
+#define TIME_SYNC_SIZE		7					// size of a binary time payload
+#define TIME_START				(12*3600L)	// time of day at reset (12:00:00)
+#define TIME_TEXT_SIZE		12				// clock text " hh:mm:ss  " with end of string
+#define CHAT_HISTORY_ERROR	0xFF			// history station of a MAC error message
+#define LOG_OFF						0					// trace level: no trace at all
+#define LOG_ERROR					1					// trace level: errors only
+#define LOG_INFO					2					// trace level: + protocol events
+#define LOG_VERBOSE				3					// trace level: + every frame
+#define LOG_SYSTEM				0x01			// trace module: return codes
+#define LOG_DEBUG					0x02			// trace module: debug station
+#define LOG_PHY						0x04			// trace module: PHY frames
+#define LOG_MONITOR				0x08			// trace module: stack and CPU load
 
 //--------------------------------------------------------------------------------
 // identifiers used in more the one file (thread)
@@ -50,12 +91,73 @@ extern osMessageQueueId_t  queue_chatS_id;
 extern osMessageQueueId_t  queue_keyboard_id;
 extern osMessageQueueId_t  queue_usartR_id;
 extern osEventFlagsId_t  	eventFlag_id;
+extern osTimerId_t				timer_time_id;
 //--------------------------------------------------------------------------------
 // functions used in more than one file
 //--------------------------------------------------------------------------------
 void CheckRetCode(uint32_t retCode,uint32_t lineNumber,char * fileName,uint8_t mode);
-void DebugFrame(char * stringP);
+void DebugFrame(uint8_t preChar,char * stringP);
 void DebugMacFrame(uint8_t preChar,uint8_t * stringP);
+void PoolChainFree(void * blockPtr);
+void TraceText(const char * text);
+void I2cBusInit(void);
+void GlyphCacheInit(void);
+void ChatHistoryAdd(uint8_t addr,const char * msgPtr);
+void ChatHistoryShow(uint8_t peer,uint8_t count,
+	void (*show)(uint8_t addr,const char * text));
+
+//--------------------------------------------------------------------------------
+// Trace macros: the test is constant, so disabled traces are removed by the
+// compiler with their arguments (no call, no format string, no stack)
+//--------------------------------------------------------------------------------
+#define LOG_ON(level,module)	(((level) <= LOG_LEVEL) && (((module) & LOG_MODULES) != 0))
+#define TRACE_PRINTF(level,module,...)	\
+	do { if(LOG_ON(level,module)) { printf(__VA_ARGS__); } } while(0)
+#define TRACE_TEXT(level,module,text)		\
+	do { if(LOG_ON(level,module)) { TraceText(text); } } while(0)
+#define TRACE_FRAME(module,preChar,framePtr)	\
+	do { if(LOG_ON(LOG_VERBOSE,module)) { DebugFrame(preChar,(char *)(framePtr)); } } while(0)
+#define TRACE_MAC_FRAME(module,preChar,framePtr)	\
+	do { if(LOG_ON(LOG_VERBOSE,module)) { DebugMacFrame(preChar,framePtr); } } while(0)
+
+//--------------------------------------------------------------------------------
+// Profiler zones (cycles measured with the DWT cycle counter)
+//--------------------------------------------------------------------------------
+#define PROF_UART_RX			0					// HAL_UART_RxCpltCallback
+#define PROF_RS232_SEND		1					// rs232_send
+#define PROF_PHY_ROUTE		2					// PhReceiver frame routing
+#define PROF_MAC_BUILD		3					// MAC frame build
+#define PROF_CHECKSUM			4					// MAC checksum
+#define PROF_CRC16				5					// MAC CRC-16
+#define PROF_LCD_PUT			6					// LCD redraw of changed widgets
+#define PROF_ZONES				7					// number of zones
+
+void ProfileInit(void);
+void ProfileAdd(uint8_t zone,uint32_t cycles);
+void ProfileRequest(void);
+void ProfileDump(void);
+#if PROFILE != 0
+#define PROFILE_BEGIN(zone)		uint32_t profStart_##zone = DWT->CYCCNT
+#define PROFILE_END(zone)			ProfileAdd(zone,DWT->CYCCNT - profStart_##zone)
+#else
+#define PROFILE_BEGIN(zone)
+#define PROFILE_END(zone)
+#endif
+
+//--------------------------------------------------------------------------------
+// Fields of the MAC frame control bytes (SRC and DST)
+//--------------------------------------------------------------------------------
+#define MAC_ADDR(ctrl)		(((ctrl) >> 3) & 0x0F)	// station address
+#define MAC_SAPI(ctrl)		((ctrl) & 0x07)					// SAPI number
+
+//--------------------------------------------------------------------------------
+// Messages between application and MAC layers are chains of memory pool blocks.
+// Each block holds one MAC segment as a C string and the pointer to the next
+// block (NULL for the last one) at the end of the block.
+//--------------------------------------------------------------------------------
+#define CHAIN_LINK_OFFSET	(MAX_BLOCK_SIZE - sizeof(void *))
+#define CHAIN_DATA_SIZE		(MAX_BLOCK_SIZE - 9)	// segment text (PHY frame fits a block)
+#define CHAIN_NEXT(blockPtr)	(*(void **)&((uint8_t *)(blockPtr))[CHAIN_LINK_OFFSET])
 
 //--------------------------------------------------------------------------------
 // structure for system usage
@@ -69,6 +171,10 @@ struct TOKENINTERFACE
 	bool_t		broadcastTime;				///< is broadcast time active
 	bool_t		needReceiveCRCError;	///< debug has to receive error
 	bool_t		needSendCRCError;			///< debug has to send error
+	bool_t		crc16;								///< frames are checked with CRC-16
+	bool_t		compress;							///< chat frames can be compressed
+	bool_t		segment;							///< long messages can be segmented
+	bool_t		timeBinary;						///< time is sent in binary frames
 	uint32_t	debugSAPI;						///< current debug SAPI
 	uint32_t	debugAddress;					///< current debug address
 	bool_t		debugMsgToSend;				///< did debug have to send a message
@@ -81,10 +187,10 @@ extern struct TOKENINTERFACE gTokenInterface;
 // Events usage
 //--------------------------------------------------------------------------------
 #define	RS232_TX_EVENT 			0x0001			// ready for next byte to send
-#define	BROADCAST_TIME_EVT 	0x0002			// time to send or not
 #define AUDIO_MSG_EVT	 			0x0020			// audio message to play
 #define AUDIO_ERROR_EVT 		0x0040			// audio error to play
 #define AUDIO_CLOCK_EVT 		0x0080			// audio clock to play
+#define AUDIO_BUF_EVT 			0x0100			// audio buffer free to mix
 
 //--------------------------------------------------------------------------------
 // Types of messages transmitted in the queues
@@ -103,6 +209,7 @@ enum msgType_e
 	TIME_MSG,								///< a time message is sent to LCD
 	CHAR_MSG,								///< a single char is sent to the LCD
 	CHAT_MSG,								///< a chat message is sent to the LCD
+	MONITOR_MSG,						///< a load report is sent to the LCD
 	FROM_PHY,								///< a message arriving from physical layer
 	TO_PHY									///< a message sent to physical layer
 };
@@ -117,3 +224,30 @@ struct queueMsg_t
 	uint8_t	addr;						///< the source or destination address
 	uint8_t sapi;						///< the source or destination SAPI
 };
+
+//--------------------------------------------------------------------------------
+// SAPI demultiplexing (MAC receiver to application layers)
+//--------------------------------------------------------------------------------
+#define MAX_SAPI					8					// number of SAPI (0-7)
+
+typedef void (*sapiHandler_t)(struct queueMsg_t * queueMsg);
+
+bool_t MacSapiRegisterQueue(uint8_t sapi,osMessageQueueId_t queueId);
+bool_t MacSapiRegisterHandler(uint8_t sapi,sapiHandler_t handler);
+void MacSapiUnregister(uint8_t sapi);
+uint8_t MacSapiBitmap(void);
+uint8_t MacChecksum(uint8_t * framePtr);
+void MacCrcInit(void);
+uint16_t MacCrc16(const uint8_t * dataPtr,uint32_t length);
+uint8_t MacPayloadLength(uint8_t * framePtr);
+void MacFrameSeal(uint8_t * framePtr);
+bool_t MacFrameCheck(uint8_t * framePtr);
+uint32_t TimeSyncNow(void);
+void TimeSyncEncode(uint8_t * payloadPtr);
+void TimeSyncStamp(uint8_t * payloadPtr);
+void TimeSyncRingTrip(uint32_t ms);
+bool_t TimeSyncReceive(const uint8_t * payloadPtr,uint8_t srcAddr);
+void TimeSyncText(char * textPtr,uint32_t seconds,uint32_t lastSeconds);
+uint8_t MacCompress(const uint8_t * srcPtr,uint8_t length,uint8_t * dstPtr);
+uint8_t MacExpand(const uint8_t * srcPtr,uint8_t length,uint8_t * dstPtr,
+	uint8_t maxSize);
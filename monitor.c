@@ -0,0 +1,207 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file monitor.c
+/// \brief Stack and CPU load monitor thread
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// The CPU load is measured by the idle thread: it counts the cycles it runs
+/// (DWT cycle counter), the rest of the time was used by threads and irq.
+/// The share of each thread is sampled by the TIM6 interrupt (about 900 Hz,
+/// not a multiple of the kernel tick) which counts the running thread.
+/// The stack high-water of each thread needs OS_STACK_WATERMARK in RTX_Config.h.
+/// Nothing is built if MONITOR is 0 (no idle thread, TIM6 interrupt or thread).
+//////////////////////////////////////////////////////////////////////////////////
+#include "stm32f7xx_hal.h"
+
+#include <stdio.h>
+#include <string.h>
+#include "main.h"
+
+#if MONITOR != 0
+
+#define MONITOR_THREADS		24					// max threads in reports
+#define IDLE_LOOP_MAX			100					// cycles of an idle loop not preempted
+
+//--------------------------------------------------------------------------------
+// Run-time samples of a thread
+//--------------------------------------------------------------------------------
+struct monitorThread_t
+{
+	osThreadId_t	id;								///< thread (NULL if slot is free)
+	uint32_t			samples;					///< times found running by TIM6
+};
+
+static struct monitorThread_t monitorThreads[MONITOR_THREADS];
+static volatile uint32_t idleCycles;		// cycles spent in idle thread
+static volatile uint32_t monitorSamples;	// all TIM6 samples
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief RTX idle thread (replaces the weak one of RTX_Config.c)
+/// Counts its running cycles, a long loop means it was preempted.
+//////////////////////////////////////////////////////////////////////////////////
+void osRtxIdleThread(void *argument)
+{
+	uint32_t last = DWT->CYCCNT;
+	uint32_t now;
+
+	for (;;)
+	{
+		now = DWT->CYCCNT;
+		if((now - last) < IDLE_LOOP_MAX)
+		{
+			idleCycles += now - last;
+		}
+		last = now;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Sampling interrupt: count the running thread
+//////////////////////////////////////////////////////////////////////////////////
+void TIM6_DAC_IRQHandler(void)
+{
+	osThreadId_t id;
+	uint32_t i;
+
+	TIM6->SR = 0;														// clear update flag
+	id = osThreadGetId();										// thread interrupted
+	monitorSamples++;
+	for(i=0;i<MONITOR_THREADS;i++)
+	{
+		if(monitorThreads[i].id == NULL)			// first sample of thread
+		{
+			monitorThreads[i].id = id;
+		}
+		if(monitorThreads[i].id == id)
+		{
+			monitorThreads[i].samples++;
+			return;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Start the sampling timer TIM6 (APB1 timer clock is 108 MHz)
+//////////////////////////////////////////////////////////////////////////////////
+static void MonitorTimerInit(void)
+{
+	__HAL_RCC_TIM6_CLK_ENABLE();						// enable timer 6 clock
+	TIM6->PSC = 10799;											// 10 kHz count
+	TIM6->ARR = 10;													// 909 Hz update
+	TIM6->DIER = TIM_DIER_UIE;							// interrupt on update
+	HAL_NVIC_SetPriority(TIM6_DAC_IRQn,15,0);
+	HAL_NVIC_EnableIRQ(TIM6_DAC_IRQn);
+	TIM6->CR1 = TIM_CR1_CEN;								// start the timer
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get the run-time samples of a thread since last call
+/// \param id The thread
+/// \return The number of samples
+//////////////////////////////////////////////////////////////////////////////////
+static uint32_t MonitorTakeSamples(osThreadId_t id)
+{
+	uint32_t samples = 0;
+	uint32_t i;
+
+	__disable_irq();
+	for(i=0;i<MONITOR_THREADS;i++)
+	{
+		if(monitorThreads[i].id == id)
+		{
+			samples = monitorThreads[i].samples;
+			monitorThreads[i].samples = 0;
+			break;
+		}
+	}
+	__enable_irq();
+	return samples;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// THREAD MONITOR
+//////////////////////////////////////////////////////////////////////////////////
+void Monitor(void *argument)
+{
+	struct queueMsg_t queueMsg;					// queue message
+	osThreadId_t threads[MONITOR_THREADS];
+	char * msg;
+	const char * minName = "";
+	uint32_t minFree;										// lowest free stack
+	uint32_t lastCycles;
+	uint32_t lastIdle;
+	uint32_t cycles;
+	uint32_t idle;
+	uint32_t load;
+	uint32_t allSamples;
+	uint32_t samples;
+	uint32_t size;
+	uint32_t space;
+	uint32_t count;
+	uint32_t i;
+	osStatus_t retCode;									// return error code
+
+	MonitorTimerInit();
+	lastCycles = DWT->CYCCNT;
+	lastIdle = idleCycles;
+	//------------------------------------------------------------------------------
+	for (;;)														// loop until doomsday
+	{
+		osDelay(MONITOR_PERIOD);
+		cycles = DWT->CYCCNT - lastCycles;
+		idle = idleCycles - lastIdle;
+		lastCycles += cycles;
+		lastIdle += idle;
+		load = 100 - (uint32_t)(((uint64_t)idle * 100) / cycles);
+		__disable_irq();											// no sample lost between
+		allSamples = monitorSamples;
+		monitorSamples = 0;
+		__enable_irq();
+		if(allSamples == 0)
+		{
+			allSamples = 1;
+		}
+		TRACE_PRINTF(LOG_INFO,LOG_MONITOR,"CPU load: %u %%\r\n"
+			"Thread          stack used/size   cpu\r\n",load);
+		minFree = 0xFFFFFFFF;
+		count = osThreadEnumerate(threads,MONITOR_THREADS);
+		for(i=0;i<count;i++)
+		{
+			size = osThreadGetStackSize(threads[i]);
+			space = osThreadGetStackSpace(threads[i]);	// never used (watermark)
+			samples = MonitorTakeSamples(threads[i]);
+			if((size != 0) && (space < minFree))
+			{
+				minFree = space;
+				minName = osThreadGetName(threads[i]);
+			}
+			TRACE_PRINTF(LOG_INFO,LOG_MONITOR,"%-14s %6u/%-6u %5u %%\r\n",
+				osThreadGetName(threads[i]),size - space,size,
+				(samples * 100) / allSamples);
+		}
+		//----------------------------------------------------------------------------
+		// MEMORY ALLOCATION	(report for the configuration page)
+		//----------------------------------------------------------------------------
+		msg = osMemoryPoolAlloc(memPool,0);
+		if(msg == NULL)												// report is not important
+		{
+			continue;
+		}
+		snprintf(msg,MAX_BLOCK_SIZE,"CPU load: %u %%  Min free stack: %u (%s)",
+			load,minFree,minName);
+		queueMsg.type = MONITOR_MSG;
+		queueMsg.anyPtr = msg;
+		//----------------------------------------------------------------------------
+		// QUEUE SEND	(send report to lcd)
+		//----------------------------------------------------------------------------
+		retCode = osMessageQueuePut(
+			queue_lcd_id,
+			&queueMsg,
+			osPriorityNormal,
+			osWaitForever);
+		CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+	}
+}
+
+#endif
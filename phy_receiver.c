@@ -27,6 +27,7 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 	static uint8_t secondSTX;									// STX repeated control
   uint32_t 	size;														// size of builded frame
 	osStatus_t retCode;
+	PROFILE_BEGIN(PROF_UART_RX);
 
 	//------------------------------------------------------------------------------
 	// RECEIVED CHAR
@@ -45,6 +46,7 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 			{
 				secondSTX = 0;				    					// clear secondSTX flag
 				HAL_UART_Receive_IT(&ext_uart,&recByte,1);	// enable uart receiver 1 char
+				PROFILE_END(PROF_UART_RX);
 
 				return;															// and quit
 			}
@@ -60,6 +62,7 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 			gInBuffer[0] = STX;										// set first STX received
 			recPtr = 1;														// set byte counter at 1
 			HAL_UART_Receive_IT(&ext_uart,&recByte,1);	// enable uart receiver 1 char
+			PROFILE_END(PROF_UART_RX);
 			return;																// and quit
 		}
   }
@@ -96,6 +99,7 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 		}
   }
 	HAL_UART_Receive_IT(&ext_uart,&recByte,1);	// enable uart receiver 1 char
+	PROFILE_END(PROF_UART_RX);
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -123,12 +127,11 @@ void PhReceiver(void *argument)
 			osWaitForever); 	
     CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);				
 		qPtr = queueMsg.anyPtr;
+		PROFILE_BEGIN(PROF_PHY_ROUTE);
     //----------------------------------------------------------------------------
 		// DEBUG DISPLAY FRAME
     //----------------------------------------------------------------------------
-    putchar('R');                				    // insert a R for Receive       
-    putchar(':');                				    // insert a :                   	
-    DebugFrame((char*)qPtr);					  		// display frame on TERMINAL    		
+    TRACE_FRAME(LOG_PHY,'R',qPtr);				  		// display frame on TERMINAL
 		if (qPtr[1] == TOKEN_TAG)    						// is it a token frame ?
 		{
 		  size = TOKENSIZE;       							// yes -> token frame size
@@ -146,10 +149,11 @@ void PhReceiver(void *argument)
 		queueMsg.anyPtr = msg;
 		queueMsg.type = FROM_PHY;
 		if((msg[0] == TOKEN_TAG) ||				// is a token frame
-			((msg[1]>>3) == gTokenInterface.myAddress) ||	// is destination my address
-			((msg[0]>>3) == gTokenInterface.myAddress) ||	// is source my address
-			((msg[1]>>3) == BROADCAST_ADDRESS))	// is a broadcast frame
+			(MAC_ADDR(msg[1]) == gTokenInterface.myAddress) ||	// is destination my address
+			(MAC_ADDR(msg[0]) == gTokenInterface.myAddress) ||	// is source my address
+			(MAC_ADDR(msg[1]) == BROADCAST_ADDRESS))	// is a broadcast frame
 		{
+			PROFILE_END(PROF_PHY_ROUTE);
 			//--------------------------------------------------------------------------
 			// QUEUE SEND	(send received frame to mac layer receiver)
 			//--------------------------------------------------------------------------
@@ -162,6 +166,7 @@ void PhReceiver(void *argument)
 		}
 		else
 		{
+			PROFILE_END(PROF_PHY_ROUTE);
 			//--------------------------------------------------------------------------
 			// QUEUE SEND	(send received frame to physical layer sender)
 			//--------------------------------------------------------------------------
@@ -32,6 +32,7 @@ void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
 void rs232_send(uint8_t byte, uint8_t counter)
 {
 	int32_t	eventFlag;											// current flag
+	PROFILE_BEGIN(PROF_RS232_SEND);
 	
 	//------------------------------------------------------------------------------
 	//	EVENT GET wait 10 ticks max
@@ -72,6 +73,7 @@ void rs232_send(uint8_t byte, uint8_t counter)
 				CheckRetCode(eventFlag | 0x7FFFFFFF,__LINE__,__FILE__,CONTINUE);	
 		HAL_UART_Transmit_IT(&ext_uart,&byte, 1);	// send second STX
   }	    
+	PROFILE_END(PROF_RS232_SEND);
 }
 
 
@@ -105,7 +107,7 @@ void PhSender(void *argument)
 		//----------------------------------------------------------------------------
 		// DEBUG DISPLAY FRAME				
 		//----------------------------------------------------------------------------
-		DebugMacFrame('S',qPtr);		
+		TRACE_MAC_FRAME(LOG_PHY,'S',qPtr);
 		//----------------------------------------------------------------------------
 		// QUEUE SEND	(send frame to debug station)
 		//----------------------------------------------------------------------------
@@ -138,18 +140,21 @@ void PhSender(void *argument)
 		//----------------------------------------------------------------------------
 		// DEBUG DISPLAY FRAME				
 		//----------------------------------------------------------------------------
-		putchar('S');                				  // insert a S for Send         	
-		putchar(':');                			    // insert a :                  
-		DebugFrame((char *)msg);							// for debug info only
+		TRACE_FRAME(LOG_PHY,'S',msg);					// for debug info only
 		for(i=0;i<size;i++)
 		{
 			rs232_send(msg[i],i);
 		}
 		//----------------------------------------------------------------------------
 		// MEMORY RELEASE	(received frame : mac layer style)
+		// our own data frames are kept by the MAC sender until their databack
 		//----------------------------------------------------------------------------
-		retCode = osMemoryPoolFree(memPool,qPtr);
-		CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+		if((qPtr[0] == TOKEN_TAG) ||
+			(MAC_ADDR(qPtr[0]) != gTokenInterface.myAddress))
+		{
+			retCode = osMemoryPoolFree(memPool,qPtr);
+			CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+		}
 		//----------------------------------------------------------------------------
 		// MEMORY RELEASE	(created frame : phy layer style)
 		//----------------------------------------------------------------------------
@@ -0,0 +1,124 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file profile.c
+/// \brief Hot path profiler (DWT cycle counter)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// A zone is measured with PROFILE_BEGIN(zone) ... PROFILE_END(zone) (see
+/// main.h). Each zone keeps the number of calls, the min, max and sum of the
+/// cycles and a histogram. The results are displayed by the trace thread when
+/// the PROFILE_DUMP_KEY is pressed on the keyboard.
+//////////////////////////////////////////////////////////////////////////////////
+#include "stm32f7xx_hal.h"
+
+#include <stdio.h>
+#include <string.h>
+#include "main.h"
+
+#define PROF_BINS					8						// histogram bins (x4 cycles each)
+#define PROF_BIN0					256					// upper limit of first bin (cycles)
+
+//--------------------------------------------------------------------------------
+// Statistics of a zone
+//--------------------------------------------------------------------------------
+struct profZone_t
+{
+	uint32_t	count;								///< number of measures
+	uint32_t	min;									///< min cycles
+	uint32_t	max;									///< max cycles
+	uint64_t	sum;									///< sum of cycles (for mean)
+	uint32_t	bins[PROF_BINS];			///< histogram
+};
+
+static struct profZone_t profZones[PROF_ZONES];
+static const char * const profNames[PROF_ZONES] = {
+	"UART RX irq",
+	"rs232_send",
+	"PHY routing",
+	"MAC build",
+	"Checksum",
+	"CRC-16",
+	"LCD redraw"};
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Start the cycle counter (before kernel start)
+/// It is also used by the CPU load monitor.
+//////////////////////////////////////////////////////////////////////////////////
+void ProfileInit(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;	// enable DWT
+	DWT->LAR = 0xC5ACCE55;									// unlock DWT (Cortex-M7)
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;		// start cycle counter
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Add a measure to a zone (can be called from interrupt)
+/// \param zone The zone number
+/// \param cycles The number of cycles of the measure
+//////////////////////////////////////////////////////////////////////////////////
+void ProfileAdd(uint8_t zone,uint32_t cycles)
+{
+	struct profZone_t * zonePtr = &profZones[zone];
+	uint32_t limit = PROF_BIN0;
+	uint32_t bin = 0;
+	uint32_t primask;
+
+	while((bin < (PROF_BINS-1)) && (cycles >= limit))
+	{
+		bin++;
+		limit <<= 2;
+	}
+	primask = __get_PRIMASK();							// zones of threads and irq
+	__disable_irq();
+	if((zonePtr->count == 0) || (cycles < zonePtr->min))
+	{
+		zonePtr->min = cycles;
+	}
+	if(cycles > zonePtr->max)
+	{
+		zonePtr->max = cycles;
+	}
+	zonePtr->count++;
+	zonePtr->sum += cycles;
+	zonePtr->bins[bin]++;
+	__set_PRIMASK(primask);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Display the statistics of all zones (and clear them)
+/// It is called by the TRACE thread
+//////////////////////////////////////////////////////////////////////////////////
+void ProfileDump(void)
+{
+	struct profZone_t zone;
+	uint32_t cyclesPerUs = SystemCoreClock / 1000000;
+	uint32_t mean;
+	uint32_t primask;
+	uint32_t i;
+	uint32_t j;
+
+	printf("Zone           count      min      max     mean  (cycles, %u/us)\r\n",
+		cyclesPerUs);
+	for(i=0;i<PROF_ZONES;i++)
+	{
+		primask = __get_PRIMASK();						// coherent copy of zone
+		__disable_irq();
+		zone = profZones[i];
+		memset(&profZones[i],0,sizeof(profZones[i]));
+		__set_PRIMASK(primask);
+		if(zone.count == 0)
+		{
+			continue;
+		}
+		mean = zone.sum / zone.count;
+		printf("%-12s %7u %8u %8u %8u\r\n  bins:",profNames[i],
+			zone.count,zone.min,zone.max,mean);
+		for(j=0;j<PROF_BINS;j++)							// <256, <1k, <4k ... cycles
+		{
+			printf(" %u",zone.bins[j]);
+		}
+		printf("\r\n");
+	}
+}
@@ -1,5 +1,17 @@
 #include "resources_manager.h"
 
+#if IMAGE_CACHE_SIZE > 0
+#if IMAGE_CACHE_ADDR < (LCD_FRAME_ADDR + LCD_FRAME_COUNT * LCD_FRAME_SIZE)
+#error "Image cache overlaps the LCD frame buffers"
+#endif
+#if (IMAGE_CACHE_ADDR + IMAGE_CACHE_SIZE) > (SDRAM_ADDR + SDRAM_SIZE)
+#error "Image cache is out of the SDRAM"
+#endif
+#if GFX_OS_HEAP_SIZE == 0
+#error "gfxAddHeapBlock needs the uGFX heap (GFX_OS_HEAP_SIZE of gfxconf.h)"
+#endif
+#endif
+
 typedef struct ImageInfo {
 	gdispImage* pointer;
 	const char* filePath;
@@ -10,6 +22,7 @@ gdispImage imgtoken_w;
 
 static ImageInfo _imagesArray[2];
 static font_t _fontsArray[2];
+static size_t _imageCacheUsed;
 
 bool_t guiResourcesManagerInit(void)
 {
@@ -26,11 +39,17 @@ bool_t guiResourcesManagerInit(void)
 		gdispImageOpenFile(gstudioGetImage(i), gstudioGetImageFilePath(i));
 	}
 
-	// Cache images
+	// Cache images (decoded once in native pixel format, drawn as blits)
+#if IMAGE_CACHE_SIZE > 0
+	gfxAddHeapBlock((void*)IMAGE_CACHE_ADDR, IMAGE_CACHE_SIZE);
+#endif
+	for (i = 0; i < 2; i++) {
+		gstudioCacheImage(gstudioGetImage(i));
+	}
 
-	// Open fonts
-	_fontsArray[0] = gdispOpenFont("arial_12_arial12_aa");
-	_fontsArray[1] = gdispOpenFont("arial__14_arial14_aa");
+	// Open fonts (glyphs decoded once in cache)
+	_fontsArray[0] = GlyphCacheFont(gdispOpenFont("arial_12_arial12_aa"));
+	_fontsArray[1] = GlyphCacheFont(gdispOpenFont("arial__14_arial14_aa"));
 
 	return TRUE;
 }
@@ -50,3 +69,19 @@ GFXINLINE font_t gstudioGetFont(int fontIndex)
 	return _fontsArray[fontIndex];
 }
 
+bool_t gstudioCacheImage(gdispImage* image)
+{
+	size_t size = (size_t)image->width * image->height * sizeof(pixel_t);
+
+	// Keep the decoded images within the cache budget
+	if (_imageCacheUsed + size > IMAGE_CACHE_SIZE) {
+		return FALSE;
+	}
+	if (gdispImageCache(image) != GDISP_IMAGE_ERR_OK) {
+		return FALSE;
+	}
+	_imageCacheUsed += size;
+
+	return TRUE;
+}
+
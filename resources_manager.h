@@ -11,6 +11,24 @@
 #define arial_12 0
 #define arial__14 1
 
+// SDRAM of the board and LCD frame buffers of the LTDC driver (uGFX board file)
+#define SDRAM_ADDR 0xC0000000		// FMC SDRAM bank 1
+#define SDRAM_SIZE (8*1024*1024)	// 16 bits wide SDRAM (8 MB)
+#define LCD_FRAME_ADDR SDRAM_ADDR	// frame buffer of layer 1
+#define LCD_FRAME_SIZE (480*272*2)	// 480 x 272 RGB565
+#define LCD_FRAME_COUNT 2		// room for both LTDC layers
+
+// Decoded images cache (SDRAM after the LCD frame buffers, added to uGFX heap,
+// so the uGFX heap of gfxconf.h must be used: GFX_OS_HEAP_SIZE not 0 with RTX5)
+#define IMAGE_CACHE_ADDR 0xC0200000	// start of cache region
+#define IMAGE_CACHE_SIZE (1024*1024)	// memory budget of cached images (0: no cache)
+
+// Decoded glyphs cache of antialiased fonts (atlas of 4 bytes runs, see glyph_cache.c)
+#define GLYPH_CACHE_FONTS 3		// max number of cached fonts
+#define GLYPH_CACHE_SETS 16		// glyph sets (selected by character)
+#define GLYPH_CACHE_WAYS 4		// glyphs per set (LRU replacement)
+#define GLYPH_CACHE_RUNS 64		// max runs of a glyph (atlas is 16 KB)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -19,6 +37,8 @@ extern "C" {
 	gdispImage* gstudioGetImage(int imageIndex);
 	const char* gstudioGetImageFilePath(int imageIndex);
 	font_t gstudioGetFont(int fontIndex);
+	bool_t gstudioCacheImage(gdispImage* image);
+	font_t GlyphCacheFont(font_t font);
 
 #ifdef __cplusplus
 }
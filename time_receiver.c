@@ -11,6 +11,7 @@
 #include <string.h>
 #include "main.h"
 
+static char clockText[TIME_TEXT_SIZE] = " 12:00:00  ";	// displayed time
 
 //////////////////////////////////////////////////////////////////////////////////
 // THREAD TIME RECEIVER
@@ -18,6 +19,8 @@
 void TimeReceiver(void *argument)
 {
 	struct queueMsg_t queueMsg;					// queue message
+	uint32_t seconds;										// network time (s of day)
+	uint32_t lastSeconds = 0xFFFFFFFF;	// last displayed time
 	osStatus_t retCode;									// return error code
 	
 	//------------------------------------------------------------------------------
@@ -32,6 +35,13 @@ void TimeReceiver(void *argument)
 			NULL,
 			osWaitForever); 	
     CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);
+		if(TimeSyncReceive(queueMsg.anyPtr,queueMsg.addr) != FALSE)	// binary time
+		{
+			seconds = TimeSyncNow() / 1000;			// corrected local clock
+			TimeSyncText(clockText,seconds,lastSeconds);
+			lastSeconds = seconds;
+			memcpy(queueMsg.anyPtr,clockText,sizeof(clockText));	// text for LCD
+		}
 		queueMsg.type = TIME_MSG;
 		//----------------------------------------------------------------------------
 		// QUEUE SEND	(send the time message on LCD)
@@ -0,0 +1,273 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file time_sync.c
+/// \brief Network time (binary time frames and local clock discipline)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// A time frame payload is TIME_SYNC_SIZE bytes, all with bit 7 set (the MAC
+/// payload stays a C string):
+/// - TIME_SYNC_TAG
+/// - network time (milliseconds of the day, 4 x 7 bits, MSB first)
+/// - last ring trip time of a time frame (ms, 2 x 7 bits, MSB first)
+///
+/// The time is stamped again by the MAC sender when the frame really leaves,
+/// so the one-way delay to a receiver is only a part of the ring trip. It is
+/// estimated at half of it. Receivers correct their offset and drift from the
+/// remaining error, the station that broadcasts the time is the reference.
+///
+/// The binary frames are sent only if all stations read them (TOKEN_OPT_TIME),
+/// otherwise the time is sent as the clock text " hh:mm:ss  " also displayed
+/// by the receivers (TimeSyncText).
+//////////////////////////////////////////////////////////////////////////////////
+#include "stm32f7xx_hal.h"
+
+#include <stdio.h>
+#include <string.h>
+#include "main.h"
+
+#define DAY_MS						(24*3600*1000L)	// milliseconds in a day
+#define DAY_US						(DAY_MS*1000LL)	// microseconds in a day
+#define SYNC_STEP_MAX			1000				// error (ms) set at once, not slewed
+#define SYNC_DRIFT_MAX		500					// max drift correction (ppm)
+#define SYNC_DRIFT_TIME		16000				// drift measure period (ms)
+#define CLOCK_HOUR				1						// position of hours in clock text
+#define CLOCK_MIN					4						// position of minutes in clock text
+#define CLOCK_SEC					7						// position of seconds in clock text
+
+static int64_t syncOffset = TIME_START * 1000000LL;	// network - local tick (us, mod day)
+static int32_t syncDrift;								// local clock correction (ppm)
+static uint32_t syncTick;								// local tick of last correction
+static bool_t synced;										// a time frame was received
+static uint32_t ringTrip;								// last ring trip of a time frame
+static int32_t driftError;							// errors sum since drift update
+static uint32_t driftElapsed;						// time since drift update
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Write a value in 7 bits bytes (bit 7 set, never 0)
+/// \param dstPtr Where to write
+/// \param value The value
+/// \param size The number of bytes
+//////////////////////////////////////////////////////////////////////////////////
+static void TimeSyncPut(uint8_t * dstPtr,uint32_t value,uint8_t size)
+{
+	while(size > 0)
+	{
+		size--;
+		*dstPtr++ = 0x80 | ((value >> (7 * size)) & 0x7F);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Read a value of 7 bits bytes
+/// \param srcPtr Where to read
+/// \param size The number of bytes
+/// \return The value
+//////////////////////////////////////////////////////////////////////////////////
+static uint32_t TimeSyncGet(const uint8_t * srcPtr,uint8_t size)
+{
+	uint32_t value = 0;
+
+	while(size > 0)
+	{
+		size--;
+		value = (value << 7) | (*srcPtr++ & 0x7F);
+	}
+	return value;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get the network time at a local tick
+/// \param tick The kernel tick
+/// \return Milliseconds of the day
+//////////////////////////////////////////////////////////////////////////////////
+static uint32_t TimeSyncAt(uint32_t tick)
+{
+	int64_t time;
+
+	time = ((int64_t)tick * 1000) + syncOffset +		// in us (keep drift fractions)
+		(((int64_t)(int32_t)(tick - syncTick) * syncDrift) / 1000);
+	time %= DAY_US;
+	if(time < 0)
+	{
+		time += DAY_US;
+	}
+	return (uint32_t)(time / 1000);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get the network time
+/// \return Milliseconds of the day
+//////////////////////////////////////////////////////////////////////////////////
+uint32_t TimeSyncNow(void)
+{
+	return TimeSyncAt(osKernelGetTickCount());
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Build a time frame payload (with its end of string)
+/// \param payloadPtr Where to write (TIME_SYNC_SIZE + 1 bytes)
+//////////////////////////////////////////////////////////////////////////////////
+void TimeSyncEncode(uint8_t * payloadPtr)
+{
+	payloadPtr[0] = TIME_SYNC_TAG;
+	TimeSyncPut(&payloadPtr[1],TimeSyncNow(),4);
+	TimeSyncPut(&payloadPtr[5],(ringTrip > 0x3FFF) ? 0x3FFF : ringTrip,2);
+	payloadPtr[TIME_SYNC_SIZE] = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Stamp the network time in a time frame payload (MAC sender)
+/// \param payloadPtr The payload in the MAC frame
+//////////////////////////////////////////////////////////////////////////////////
+void TimeSyncStamp(uint8_t * payloadPtr)
+{
+	TimeSyncPut(&payloadPtr[1],TimeSyncNow(),4);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Set the ring trip time of our last time frame (MAC sender)
+/// \param ms Time from send to databack
+//////////////////////////////////////////////////////////////////////////////////
+void TimeSyncRingTrip(uint32_t ms)
+{
+	ringTrip = ms;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Correct the local clock with a received time frame
+/// \param payloadPtr The payload of the frame
+/// \param srcAddr The source station
+/// \return FALSE if it is not a binary time frame
+//////////////////////////////////////////////////////////////////////////////////
+bool_t TimeSyncReceive(const uint8_t * payloadPtr,uint8_t srcAddr)
+{
+	uint32_t tick = osKernelGetTickCount();
+	uint32_t elapsed;
+	int32_t remote;
+	int32_t error;
+
+	if((payloadPtr[0] != TIME_SYNC_TAG) || (strlen((char *)payloadPtr) != TIME_SYNC_SIZE))
+	{
+		return FALSE;
+	}
+	if((srcAddr == gTokenInterface.myAddress) ||	// own frame
+		(gTokenInterface.broadcastTime != FALSE))		// or we are the reference
+	{
+		return TRUE;
+	}
+	remote = TimeSyncGet(&payloadPtr[1],4) + (TimeSyncGet(&payloadPtr[5],2) / 2);
+	error = remote - (int32_t)TimeSyncAt(tick);
+	if(error > (DAY_MS / 2))								// around midnight
+	{
+		error -= DAY_MS;
+	}
+	else if(error < -(DAY_MS / 2))
+	{
+		error += DAY_MS;
+	}
+	elapsed = tick - syncTick;
+	if((synced == FALSE) || (error > SYNC_STEP_MAX) || (error < -SYNC_STEP_MAX))
+	{
+		syncOffset = (((int64_t)remote - tick) * 1000) % DAY_US;	// set time at once
+		syncDrift = 0;
+		driftError = 0;
+		driftElapsed = 0;
+	}
+	else
+	{
+		syncOffset = (syncOffset + (((int64_t)(int32_t)elapsed * syncDrift) / 1000) +
+			((int64_t)error * 1000)) % DAY_US;
+		driftError += error;										// ms errors are too coarse
+		driftElapsed += elapsed;								// for a drift on one frame
+		if(driftElapsed >= SYNC_DRIFT_TIME)			// frequency correction
+		{
+			syncDrift += (((int64_t)driftError * 1000000) / driftElapsed) / 2;
+			if(syncDrift > SYNC_DRIFT_MAX)
+			{
+				syncDrift = SYNC_DRIFT_MAX;
+			}
+			else if(syncDrift < -SYNC_DRIFT_MAX)
+			{
+				syncDrift = -SYNC_DRIFT_MAX;
+			}
+			driftError = 0;
+			driftElapsed = 0;
+		}
+	}
+	syncTick = tick;
+	synced = TRUE;
+	return TRUE;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Write a 2 digits value in a clock text
+/// \param textPtr The clock text
+/// \param pos Position of the tens digit
+/// \param value The value (0-99)
+//////////////////////////////////////////////////////////////////////////////////
+static void ClockDigits(char * textPtr,uint8_t pos,uint32_t value)
+{
+	textPtr[pos] = '0' + (value / 10);
+	textPtr[pos+1] = '0' + (value % 10);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Add one second to a clock text (only changed digits are written)
+/// \param textPtr The clock text
+//////////////////////////////////////////////////////////////////////////////////
+static void ClockIncrement(char * textPtr)
+{
+	if(++textPtr[CLOCK_SEC+1] <= '9')			// seconds units
+	{
+		return;
+	}
+	textPtr[CLOCK_SEC+1] = '0';
+	if(++textPtr[CLOCK_SEC] <= '5')				// seconds tens
+	{
+		return;
+	}
+	textPtr[CLOCK_SEC] = '0';
+	if(++textPtr[CLOCK_MIN+1] <= '9')			// minutes units
+	{
+		return;
+	}
+	textPtr[CLOCK_MIN+1] = '0';
+	if(++textPtr[CLOCK_MIN] <= '5')				// minutes tens
+	{
+		return;
+	}
+	textPtr[CLOCK_MIN] = '0';
+	textPtr[CLOCK_HOUR+1]++;							// hours
+	if((textPtr[CLOCK_HOUR] == '2') && (textPtr[CLOCK_HOUR+1] == '4'))
+	{
+		textPtr[CLOCK_HOUR] = '0';					// midnight
+		textPtr[CLOCK_HOUR+1] = '0';
+	}
+	else if(textPtr[CLOCK_HOUR+1] > '9')
+	{
+		textPtr[CLOCK_HOUR+1] = '0';
+		textPtr[CLOCK_HOUR]++;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Update a clock text " hh:mm:ss  " (TIME_TEXT_SIZE bytes)
+/// \param textPtr The clock text of the caller
+/// \param seconds Seconds since midnight
+/// \param lastSeconds Seconds of the text (only changed digits are written
+/// if one second later)
+//////////////////////////////////////////////////////////////////////////////////
+void TimeSyncText(char * textPtr,uint32_t seconds,uint32_t lastSeconds)
+{
+	if(seconds == (lastSeconds + 1))
+	{
+		ClockIncrement(textPtr);
+	}
+	else if(seconds != lastSeconds)
+	{
+		ClockDigits(textPtr,CLOCK_HOUR,seconds / 3600);
+		ClockDigits(textPtr,CLOCK_MIN,(seconds / 60) % 60);
+		ClockDigits(textPtr,CLOCK_SEC,seconds % 60);
+	}
+}
@@ -0,0 +1,316 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file audio_wav.c
+/// \brief Audio driver for a Linux host (Board_Audio.h API, output to WAV file)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// Replaces Audio_746G_Discovery.c to run the audio player on a PC. The output
+/// stream is written to the WAV file given by the AUDIO_WAV environment
+/// variable (audio.wav by default). A thread plays the part of the SAI: it
+/// takes the time of the samples sent and calls the driver callback with
+/// AUDIO_EVENT_SEND_COMPLETE at the end of each buffer. While no data is sent,
+/// silence is written (the SAI keeps running as the codec clock).
+/// The input stream is not supported.
+///
+/// The callback is called with the interrupts of the host masked
+/// (HostIrqLock, given by the harness in tools/host, see its Makefile).
+//////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include "../Board_Audio.h"
+
+#define WAV_HEADER_SIZE		44					// size of a PCM WAV header
+#define IDLE_PERIOD_MS		1						// silence written when idle (ms)
+
+// Interrupt masking of the harness (optional, audio.c masks the callback)
+void HostIrqLock(void) __attribute__((weak));
+void HostIrqUnlock(void) __attribute__((weak));
+
+//--------------------------------------------------------------------------------
+// State of the output stream
+//--------------------------------------------------------------------------------
+static struct
+{
+	FILE *								file;					///< WAV file
+	Audio_SignalEvent_t		cbEvent;			///< driver callback
+	pthread_t							thread;				///< SAI simulation
+	pthread_mutex_t				lock;					///< protects fields below
+	const int16_t *				dataPtr;			///< samples to send (NULL if none)
+	uint32_t							num;					///< number of samples to send
+	uint32_t							txCount;			///< samples sent of last buffer
+	uint32_t							frequency;		///< sample rate
+	uint32_t							written;			///< samples in file
+	uint8_t								volume;				///< 0..100
+	bool									mute;					///< output muted
+	bool									running;			///< stream started
+	bool									paused;				///< stream paused
+	bool									initialized;	///< thread is running
+	bool									exit;					///< thread must end
+} wav = {.frequency = 16000,.volume = 100};
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Write a 32 bits or 16 bits little endian value
+//////////////////////////////////////////////////////////////////////////////////
+static void WavPut(uint32_t value,uint8_t size)
+{
+	while(size-- > 0)
+	{
+		fputc(value & 0xFF,wav.file);
+		value >>= 8;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Write the WAV header (sizes of the samples written)
+//////////////////////////////////////////////////////////////////////////////////
+static void WavHeader(void)
+{
+	uint32_t size = wav.written * 2;
+
+	fseek(wav.file,0,SEEK_SET);
+	fwrite("RIFF",1,4,wav.file);
+	WavPut(size + WAV_HEADER_SIZE - 8,4);
+	fwrite("WAVEfmt ",1,8,wav.file);
+	WavPut(16,4);														// fmt chunk size
+	WavPut(1,2);														// PCM
+	WavPut(1,2);														// mono
+	WavPut(wav.frequency,4);
+	WavPut(wav.frequency * 2,4);						// bytes per second
+	WavPut(2,2);														// bytes per sample
+	WavPut(16,2);														// bits per sample
+	fwrite("data",1,4,wav.file);
+	WavPut(size,4);
+	fseek(wav.file,0,SEEK_END);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Write samples (with volume) to the WAV file
+/// \param dataPtr The samples (NULL for silence)
+/// \param num The number of samples
+//////////////////////////////////////////////////////////////////////////////////
+static void WavWrite(const int16_t * dataPtr,uint32_t num)
+{
+	int32_t sample;
+	uint32_t i;
+
+	for(i=0;i<num;i++)
+	{
+		sample = 0;
+		if((dataPtr != NULL) && (wav.mute == false))
+		{
+			sample = (dataPtr[i] * wav.volume) / 100;
+		}
+		WavPut((uint16_t)sample,2);
+	}
+	wav.written += num;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Wait the play time of samples
+/// \param num The number of samples
+//////////////////////////////////////////////////////////////////////////////////
+static void WavWait(uint32_t num)
+{
+	struct timespec time;
+	uint64_t ns = ((uint64_t)num * 1000000000) / wav.frequency;
+
+	time.tv_sec = ns / 1000000000;
+	time.tv_nsec = ns % 1000000000;
+	nanosleep(&time,NULL);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief SAI simulation thread
+//////////////////////////////////////////////////////////////////////////////////
+static void * WavThread(void * argument)
+{
+	const int16_t * dataPtr;
+	uint32_t num;
+
+	while(wav.exit == false)
+	{
+		pthread_mutex_lock(&wav.lock);
+		if((wav.running == false) || (wav.paused != false))
+		{
+			pthread_mutex_unlock(&wav.lock);
+			WavWait(wav.frequency * IDLE_PERIOD_MS / 1000);
+			continue;
+		}
+		dataPtr = wav.dataPtr;
+		num = wav.num;
+		if(dataPtr == NULL)										// codec clock only
+		{
+			num = wav.frequency * IDLE_PERIOD_MS / 1000;
+		}
+		WavWrite(dataPtr,num);
+		pthread_mutex_unlock(&wav.lock);
+		WavWait(num);
+		if(dataPtr == NULL)
+		{
+			continue;
+		}
+		pthread_mutex_lock(&wav.lock);
+		wav.txCount = num;
+		if(wav.dataPtr == dataPtr)						// not replaced meanwhile
+		{
+			wav.dataPtr = NULL;
+		}
+		pthread_mutex_unlock(&wav.lock);
+		if(wav.cbEvent != NULL)								// like an interrupt
+		{
+			if(HostIrqLock != NULL)
+			{
+				HostIrqLock();
+			}
+			wav.cbEvent(AUDIO_EVENT_SEND_COMPLETE);
+			if(HostIrqUnlock != NULL)
+			{
+				HostIrqUnlock();
+			}
+		}
+	}
+	return NULL;
+}
+
+int32_t Audio_Initialize(Audio_SignalEvent_t cb_event)
+{
+	const char * name = getenv("AUDIO_WAV");
+
+	if(wav.initialized != false)
+	{
+		return 0;
+	}
+	wav.file = fopen((name != NULL) ? name : "audio.wav","wb");
+	if(wav.file == NULL)
+	{
+		return -1;
+	}
+	wav.cbEvent = cb_event;
+	WavHeader();
+	pthread_mutex_init(&wav.lock,NULL);
+	if(pthread_create(&wav.thread,NULL,WavThread,NULL) != 0)
+	{
+		return -1;
+	}
+	wav.initialized = true;
+	return 0;
+}
+
+int32_t Audio_Uninitialize(void)
+{
+	if(wav.initialized == false)
+	{
+		return 0;
+	}
+	wav.exit = true;
+	pthread_join(wav.thread,NULL);
+	WavHeader();														// final sizes
+	fclose(wav.file);
+	wav.initialized = false;
+	wav.exit = false;
+	return 0;
+}
+
+int32_t Audio_SendData(const void *data, uint32_t num)
+{
+	pthread_mutex_lock(&wav.lock);
+	wav.dataPtr = data;
+	wav.num = num;
+	wav.txCount = 0;
+	pthread_mutex_unlock(&wav.lock);
+	return 0;
+}
+
+int32_t Audio_ReceiveData(void *data, uint32_t num)
+{
+	return -1;
+}
+
+uint32_t Audio_GetDataTxCount(void)
+{
+	return wav.txCount;
+}
+
+uint32_t Audio_GetDataRxCount(void)
+{
+	return 0;
+}
+
+int32_t Audio_Start(uint8_t stream)
+{
+	if(stream != AUDIO_STREAM_OUT)
+	{
+		return -1;
+	}
+	wav.running = true;
+	wav.paused = false;
+	return 0;
+}
+
+int32_t Audio_Stop(uint8_t stream)
+{
+	if(stream != AUDIO_STREAM_OUT)
+	{
+		return -1;
+	}
+	pthread_mutex_lock(&wav.lock);
+	wav.running = false;
+	wav.dataPtr = NULL;
+	WavHeader();														// file can be read now
+	fflush(wav.file);
+	pthread_mutex_unlock(&wav.lock);
+	return 0;
+}
+
+int32_t Audio_Pause(uint8_t stream)
+{
+	wav.paused = true;
+	return (stream == AUDIO_STREAM_OUT) ? 0 : -1;
+}
+
+int32_t Audio_Resume(uint8_t stream)
+{
+	wav.paused = false;
+	return (stream == AUDIO_STREAM_OUT) ? 0 : -1;
+}
+
+int32_t Audio_SetVolume(uint8_t stream, uint8_t channel, uint8_t volume)
+{
+	if((stream != AUDIO_STREAM_OUT) || (volume > 100))
+	{
+		return -1;
+	}
+	wav.volume = volume;
+	return 0;
+}
+
+int32_t Audio_SetMute(uint8_t stream, uint8_t channel, bool mute)
+{
+	wav.mute = mute;
+	return (stream == AUDIO_STREAM_OUT) ? 0 : -1;
+}
+
+int32_t Audio_SetDataFormat(uint8_t stream, uint8_t format)
+{
+	if((stream != AUDIO_STREAM_OUT) || (format != AUDIO_DATA_16_MONO))
+	{
+		return -1;														// only format of the cues
+	}
+	return 0;
+}
+
+int32_t Audio_SetFrequency(uint8_t stream, uint32_t frequency)
+{
+	if((stream != AUDIO_STREAM_OUT) || (frequency == 0))
+	{
+		return -1;
+	}
+	wav.frequency = frequency;
+	return 0;
+}
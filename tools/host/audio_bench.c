@@ -0,0 +1,138 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file audio_bench.c
+/// \brief Host benchmark of the audio decoder and mixer (time per sample)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// audio.c is included to call its static functions. The message cue is
+/// decoded by one voice (AdpcmDecode), then mixed with all voices playing
+/// (AudioMix). The time per output sample is given in ns, in host cycles
+/// (x86 time stamp counter) and in % of the 16 kHz sample period.
+///
+/// Usage: audio_bench [max ns per mixed sample]	(exit 1 if over budget)
+//////////////////////////////////////////////////////////////////////////////////
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "audio.c"
+
+#define BENCH_SAMPLES			(16000 * 600)	// samples timed (10 min of audio)
+#define BENCH_PERIOD_NS		62500					// sample period at 16 kHz
+
+static volatile int32_t benchSink;				// keeps results alive
+
+//--------------------------------------------------------------------------------
+// Result of a benchmark
+//--------------------------------------------------------------------------------
+struct benchTime_t
+{
+	uint64_t	ns;
+	uint64_t	cycles;
+	uint64_t	samples;
+};
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get the time (ns) and the cycle counter (0 if none)
+//////////////////////////////////////////////////////////////////////////////////
+static void BenchNow(uint64_t * nsPtr,uint64_t * cyclesPtr)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC,&time);
+	*nsPtr = (uint64_t)time.tv_sec * 1000000000 + time.tv_nsec;
+#if defined(__x86_64__) || defined(__i386__)
+	*cyclesPtr = __rdtsc();
+#else
+	*cyclesPtr = 0;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Time the decoding of the message cue by one voice
+//////////////////////////////////////////////////////////////////////////////////
+static void BenchDecode(struct benchTime_t * timePtr)
+{
+	uint64_t ns;
+	uint64_t cycles;
+	uint32_t size;
+
+	timePtr->samples = 0;
+	BenchNow(&ns,&cycles);
+	while(timePtr->samples < BENCH_SAMPLES)
+	{
+		AudioStart(audio_msg,sizeof(audio_msg),AUDIO_GAIN_MSG);
+		do
+		{
+			size = AdpcmDecode(&voices[0],mixVoice);
+			timePtr->samples += size;
+			benchSink += mixVoice[0];
+		} while(size == AUDIO_BUF_SAMPLES);
+		voices[0].gain = 0;
+	}
+	BenchNow(&timePtr->ns,&timePtr->cycles);
+	timePtr->ns -= ns;
+	timePtr->cycles -= cycles;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Time the mix of all voices playing the message cue
+//////////////////////////////////////////////////////////////////////////////////
+static void BenchMix(struct benchTime_t * timePtr)
+{
+	uint64_t ns;
+	uint64_t cycles;
+	uint32_t size;
+	uint8_t v;
+
+	timePtr->samples = 0;
+	BenchNow(&ns,&cycles);
+	while(timePtr->samples < BENCH_SAMPLES)
+	{
+		for(v=0;v<AUDIO_VOICES;v++)
+		{
+			AudioStart(audio_msg,sizeof(audio_msg),AUDIO_GAIN_MSG / AUDIO_VOICES);
+		}
+		while((size = AudioMix(audioBuf[0])) != 0)
+		{
+			timePtr->samples += size;
+			benchSink += audioBuf[0][0];
+		}
+	}
+	BenchNow(&timePtr->ns,&timePtr->cycles);
+	timePtr->ns -= ns;
+	timePtr->cycles -= cycles;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Print a result
+/// \return The time per sample (ns)
+//////////////////////////////////////////////////////////////////////////////////
+static double BenchPrint(const char * name,struct benchTime_t * timePtr)
+{
+	double ns = (double)timePtr->ns / timePtr->samples;
+
+	printf("%-22s %8.2f ns/sample %8.2f cycles/sample %6.3f %% of 16 kHz\n",name,
+		ns,(double)timePtr->cycles / timePtr->samples,(ns * 100) / BENCH_PERIOD_NS);
+	return ns;
+}
+
+int main(int argc,char * argv[])
+{
+	struct benchTime_t decode;
+	struct benchTime_t mix;
+	double budget = (argc > 1) ? atof(argv[1]) : 0;
+	double ns;
+
+	BenchDecode(&decode);
+	BenchMix(&mix);
+	BenchPrint("ADPCM decode (1 voice)",&decode);
+	ns = BenchPrint("mix (4 voices)",&mix);
+	if((budget > 0) && (ns > budget))
+	{
+		printf("FAILED: mix over %.2f ns/sample\n",budget);
+		return 1;
+	}
+	return 0;
+}
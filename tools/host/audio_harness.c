@@ -0,0 +1,123 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file audio_harness.c
+/// \brief Host test of the audio thread (cues mixed to a WAV file)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// Runs the audio thread of audio.c with the WAV driver (tools/audio_wav.c)
+/// and plays the 3 cues, overlapping like on the board. The WAV file is then
+/// read back: the test fails if the output has no sound or is clipped.
+///
+/// Usage: audio_harness [file.wav]	(audio.wav by default)
+//////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "main.h"
+#include "Board_Audio.h"
+
+#define HARNESS_RATE			16000				// sample rate of the cues
+#define HARNESS_MIN_SOUND	(HARNESS_RATE / 2)	// min samples not silent
+#define HARNESS_MAX_CLIP	(HARNESS_RATE / 100)	// max samples at full scale
+
+//--------------------------------------------------------------------------------
+// Cues to play (event and time after start)
+//--------------------------------------------------------------------------------
+struct harnessCue_t
+{
+	uint32_t	event;									///< AUDIO_xxx_EVT
+	uint32_t	time;										///< ms since last cue
+};
+
+static const struct harnessCue_t harnessCues[] = {
+	{ AUDIO_MSG_EVT,		100},
+	{ AUDIO_CLOCK_EVT,	300},						// mixed with message
+	{ AUDIO_ERROR_EVT,	200},						// 3 voices at the same time
+	{ AUDIO_CLOCK_EVT,	2500},					// alone after the others
+	{ 0,								1500},					// end
+};
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Thread running the audio player
+//////////////////////////////////////////////////////////////////////////////////
+static void * HarnessAudio(void * argument)
+{
+	AudioPlayer(argument);
+	return NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Count the samples of the WAV file not silent and at full scale
+/// \return FALSE if the file cannot be read
+//////////////////////////////////////////////////////////////////////////////////
+static bool HarnessCheck(const char * name,uint32_t * soundPtr,uint32_t * clipPtr,
+	uint32_t * totalPtr)
+{
+	FILE * file = fopen(name,"rb");
+	uint8_t bytes[2];
+	int16_t sample;
+
+	*soundPtr = 0;
+	*clipPtr = 0;
+	*totalPtr = 0;
+	if((file == NULL) || (fseek(file,44,SEEK_SET) != 0))	// after WAV header
+	{
+		return false;
+	}
+	while(fread(bytes,1,2,file) == 2)
+	{
+		sample = (int16_t)(bytes[0] | (bytes[1] << 8));
+		(*totalPtr)++;
+		if((sample > 64) || (sample < -64))
+		{
+			(*soundPtr)++;
+		}
+		if((sample == 32767) || (sample == -32768))
+		{
+			(*clipPtr)++;
+		}
+	}
+	fclose(file);
+	return true;
+}
+
+int main(int argc,char * argv[])
+{
+	const char * name = (argc > 1) ? argv[1] : "audio.wav";
+	pthread_t thread;
+	uint32_t sound;
+	uint32_t clip;
+	uint32_t total;
+	uint32_t i;
+
+	setenv("AUDIO_WAV",name,1);
+	eventFlag_id = osEventFlagsNew(NULL);
+	if(pthread_create(&thread,NULL,HarnessAudio,NULL) != 0)
+	{
+		return 1;
+	}
+	for(i=0;i<sizeof(harnessCues)/sizeof(harnessCues[0]);i++)
+	{
+		osDelay(harnessCues[i].time);
+		if(harnessCues[i].event != 0)
+		{
+			osEventFlagsSet(eventFlag_id,harnessCues[i].event);
+		}
+	}
+	Audio_Stop(AUDIO_STREAM_OUT);
+	Audio_Uninitialize();
+	if(HarnessCheck(name,&sound,&clip,&total) == false)
+	{
+		fprintf(stderr,"%s: cannot read\n",name);
+		return 1;
+	}
+	printf("%s: %u samples, %u with sound, %u clipped\n",name,total,sound,clip);
+	if((sound < HARNESS_MIN_SOUND) || (clip > HARNESS_MAX_CLIP))
+	{
+		printf("FAILED\n");
+		return 1;
+	}
+	printf("OK\n");
+	return 0;
+}
@@ -0,0 +1,54 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file cmsis_os2.h
+/// \brief Host subset of CMSIS-RTOS2 (audio harness, see Makefile)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// Event flags and mutexes on POSIX threads, enough for the audio thread and
+/// the glyph cache (host_os.c).
+//////////////////////////////////////////////////////////////////////////////////
+#ifndef CMSIS_OS2_H_
+#define CMSIS_OS2_H_
+
+#include <stdint.h>
+
+#define osWaitForever				0xFFFFFFFFU
+#define osFlagsWaitAny			0x00000000U
+#define osFlagsWaitAll			0x00000001U
+#define osFlagsNoClear			0x00000002U
+#define osFlagsErrorTimeout	0xFFFFFFFEU
+#define osMutexPrioInherit	0x00000002U
+
+typedef enum
+{
+	osOK = 0,
+	osError = -1,
+	osErrorTimeout = -2,
+	osErrorNoMemory = -5
+} osStatus_t;
+
+typedef void * osEventFlagsId_t;
+typedef void * osMutexId_t;
+
+typedef struct
+{
+	const char *	name;
+} osEventFlagsAttr_t;
+
+typedef struct
+{
+	const char *	name;
+	uint32_t			attr_bits;
+} osMutexAttr_t;
+
+osEventFlagsId_t osEventFlagsNew(const osEventFlagsAttr_t * attr);
+uint32_t osEventFlagsSet(osEventFlagsId_t ef_id,uint32_t flags);
+uint32_t osEventFlagsWait(osEventFlagsId_t ef_id,uint32_t flags,
+	uint32_t options,uint32_t timeout);
+osStatus_t osDelay(uint32_t ticks);
+osMutexId_t osMutexNew(const osMutexAttr_t * attr);
+osStatus_t osMutexAcquire(osMutexId_t mutex_id,uint32_t timeout);
+osStatus_t osMutexRelease(osMutexId_t mutex_id);
+
+#endif
@@ -0,0 +1,166 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file compress_test.c
+/// \brief Host test of the chat payload compression (mac_compress.c)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// Each message of a small chat corpus (english and french) and random 7 bits
+/// texts of all segment sizes are compressed and expanded again: the text
+/// must be the same and a compressed payload must be smaller than the text.
+/// Texts with 8 bits chars must not be compressed, and an expanded text must
+/// be cut to the size given. The compression ratio of the corpus is given.
+///
+/// Usage: compress_test [max ratio % of corpus]	(exit 1 if over)
+//////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include "main.h"
+
+#define TEST_RANDOM				2000					// random texts per size
+#define TEXT_SIZE					(MAX_BLOCK_SIZE - 9)	// text of a full segment
+
+static const char * const corpus[] = {
+	"Hello everybody, is the ring working for you?",
+	"Yes, the token is coming back every second.",
+	"Salut, est-ce que tu as vu le message de la station 4 ?",
+	"Merci pour le test, je ne recois pas les messages de la station 2.",
+	"The station list is not the same on my screen, can you send the token again?",
+	"Je pense que le probleme est dans le checksum des trames.",
+	"ok",
+	"See you later, I am going to restart the board.",
+	"Les deux stations sont connectees et le temps est correct.",
+	"Is the time broadcast enabled on your station?",
+};
+
+static uint32_t failures;
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Compress and expand a text
+/// \return The size of the compressed payload (size of text if not compressed)
+//////////////////////////////////////////////////////////////////////////////////
+static uint32_t TestRoundTrip(const uint8_t * textPtr,uint8_t length)
+{
+	uint8_t zText[MAX_BLOCK_SIZE];
+	uint8_t text[MAX_BLOCK_SIZE];
+	uint8_t zLength;
+	uint8_t xLength;
+
+	zLength = MacCompress(textPtr,length,zText);
+	if(zLength == 0)											// sent as it is
+	{
+		return length;
+	}
+	xLength = MacExpand(zText,zLength,text,sizeof(text));
+	if((zLength >= length) || (xLength != length) ||
+		(memcmp(text,textPtr,length) != 0))
+	{
+		printf("FAILED: round trip of \"%.*s\" (%u -> %u -> %u bytes)\n",
+			length,textPtr,length,zLength,xLength);
+		failures++;
+	}
+	return zLength;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Test the messages of the corpus
+/// \return The compression ratio (%)
+//////////////////////////////////////////////////////////////////////////////////
+static double TestCorpus(void)
+{
+	uint32_t textBytes = 0;
+	uint32_t payloadBytes = 0;
+	uint32_t i;
+
+	for(i=0;i<(sizeof(corpus) / sizeof(corpus[0]));i++)
+	{
+		textBytes += strlen(corpus[i]);
+		payloadBytes += TestRoundTrip((const uint8_t *)corpus[i],strlen(corpus[i]));
+	}
+	printf("corpus: %u bytes of text, %u bytes of payload (%.1f %%)\n",textBytes,
+		payloadBytes,(payloadBytes * 100.0) / textBytes);
+	return (payloadBytes * 100.0) / textBytes;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Test random texts (printable 7 bits chars, spaces and vowels
+/// more frequent to use the dictionary)
+//////////////////////////////////////////////////////////////////////////////////
+static void TestRandom(void)
+{
+	static const char chars[] = "     eeeaaoiunrst,.?!HSdlcmpqvwbfh'0123456789";
+	uint8_t text[TEXT_SIZE];
+	uint32_t compressed = 0;
+	uint32_t count = 0;
+	uint32_t length;
+	uint32_t i;
+	uint32_t j;
+
+	for(length=1;length<=TEXT_SIZE;length++)
+	{
+		for(i=0;i<TEST_RANDOM;i++)
+		{
+			for(j=0;j<length;j++)
+			{
+				text[j] = chars[rand() % (sizeof(chars) - 1)];
+			}
+			compressed += (TestRoundTrip(text,length) < length);
+			count++;
+		}
+	}
+	printf("random: %u of %u texts compressed\n",compressed,count);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Test the texts not compressed and the cut of expanded texts
+//////////////////////////////////////////////////////////////////////////////////
+static void TestLimits(void)
+{
+	const uint8_t * textPtr = (const uint8_t *)corpus[0];
+	uint8_t length = strlen(corpus[0]);
+	uint8_t zText[MAX_BLOCK_SIZE];
+	uint8_t text[MAX_BLOCK_SIZE];
+	uint8_t zLength;
+	uint8_t size;
+
+	memcpy(text,textPtr,length);
+	text[5] = 0xE9;												// 8 bits char (latin-1)
+	if(MacCompress(text,length,zText) != 0)
+	{
+		printf("FAILED: 8 bits text compressed\n");
+		failures++;
+	}
+	if(MacCompress((const uint8_t *)"ab",2,zText) != 0)
+	{
+		printf("FAILED: text compressed to the same size\n");
+		failures++;
+	}
+	zLength = MacCompress(textPtr,length,zText);
+	for(size=0;size<length;size++)
+	{
+		memset(text,0,sizeof(text));
+		if((MacExpand(zText,zLength,text,size) != size) ||
+			(memcmp(text,textPtr,size) != 0) || (text[size] != 0))
+		{
+			printf("FAILED: expand cut to %u bytes\n",size);
+			failures++;
+			break;
+		}
+	}
+}
+
+int main(int argc,char * argv[])
+{
+	double maxRatio = (argc > 1) ? atof(argv[1]) : 0;
+	double ratio;
+
+	srand(1);
+	ratio = TestCorpus();
+	TestRandom();
+	TestLimits();
+	if((maxRatio > 0) && (ratio > maxRatio))
+	{
+		printf("FAILED: corpus over %.1f %%\n",maxRatio);
+		failures++;
+	}
+	return failures != 0;
+}
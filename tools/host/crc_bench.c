@@ -0,0 +1,235 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file crc_bench.c
+/// \brief Host test and benchmark of the MAC frame checks (mac_crc.c)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// The table CRC-16 of mac_crc.c is checked with the CCITT check value
+/// ("123456789" -> 0x29B1) and against a bit by bit CRC-16 (the calculation
+/// done by the CRC unit with MAC_CRC_HW = 1) for all frame sizes. Frames are
+/// sealed and checked with both frame checks, and the single bit errors and
+/// swapped bytes not detected are counted. Then the time per frame of the
+/// 6 bits sum, the table CRC-16 and the bit by bit CRC-16 is given.
+///
+/// Built with PROFILE = 1 (crc_profile), the frame checks are also measured
+/// by the profiler zones of mac_crc.c, displayed at the end (times include
+/// the clock reads of the profiler).
+///
+/// Usage: crc_bench [max ns per frame of CRC-16]	(exit 1 if over budget)
+//////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <time.h>
+#include "main.h"
+
+#define BENCH_FRAMES			2000000				// frames timed per frame check
+#define BENCH_LENGTH			(MAX_BLOCK_SIZE - 9)	// payload of a full segment
+#define CRC16_CHECK				0x29B1				// CCITT CRC of "123456789"
+
+struct TOKENINTERFACE gTokenInterface;
+static volatile uint32_t benchSink;				// keeps results alive
+static uint32_t failures;
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Bit by bit CRC-16 CCITT (as the CRC unit, MSB first)
+//////////////////////////////////////////////////////////////////////////////////
+static uint16_t CrcBitwise(const uint8_t * dataPtr,uint32_t length)
+{
+	uint16_t crc = 0xFFFF;
+	uint32_t i;
+	uint8_t bit;
+
+	for(i=0;i<length;i++)
+	{
+		crc ^= dataPtr[i] << 8;
+		for(bit=0;bit<8;bit++)
+		{
+			crc = ((crc & 0x8000) != 0) ? (crc << 1) ^ 0x1021 : crc << 1;
+		}
+	}
+	return crc;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Count a failed check
+//////////////////////////////////////////////////////////////////////////////////
+static void BenchExpect(bool_t ok,const char * what)
+{
+	if(ok == FALSE)
+	{
+		printf("FAILED: %s\n",what);
+		failures++;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Build a data frame of random payload (sealed with the frame check)
+//////////////////////////////////////////////////////////////////////////////////
+static void BenchFrame(uint8_t * framePtr,uint8_t length)
+{
+	uint8_t i;
+
+	framePtr[0] = (3 << 3) | 1;						// station 3 to 4, chat SAPI
+	framePtr[1] = (4 << 3) | 1;
+	framePtr[2] = length;
+	for(i=0;i<length;i++)
+	{
+		framePtr[3+i] = rand();
+	}
+	MacFrameSeal(framePtr);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Check the CRC-16 values
+//////////////////////////////////////////////////////////////////////////////////
+static void BenchCheckCrc(void)
+{
+	uint8_t data[MAX_BLOCK_SIZE];
+	uint32_t length;
+	uint32_t i;
+
+	BenchExpect(MacCrc16((const uint8_t *)"123456789",9) == CRC16_CHECK,
+		"CRC-16 check value");
+	for(length=0;length<=MAX_BLOCK_SIZE;length++)
+	{
+		for(i=0;i<length;i++)
+		{
+			data[i] = rand();
+		}
+		BenchExpect(MacCrc16(data,length) == CrcBitwise(data,length),
+			"table CRC-16 differs from bit by bit CRC-16");
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Seal and check frames, count the errors not detected
+/// \param crc16 Frame check used (6 bits sum or CRC-16)
+//////////////////////////////////////////////////////////////////////////////////
+static void BenchCheckFrames(bool_t crc16)
+{
+	uint8_t frame[MAX_BLOCK_SIZE];
+	uint8_t length;
+	uint32_t flips = 0;
+	uint32_t swaps = 0;
+	uint32_t flipsMissed = 0;
+	uint32_t swapsMissed = 0;
+	uint32_t size;
+	uint32_t i;
+	uint8_t bit;
+	uint8_t tmp;
+
+	gTokenInterface.crc16 = crc16;
+	for(length=2;length<=BENCH_LENGTH;length++)
+	{
+		BenchFrame(frame,length);
+		BenchExpect(MacFrameCheck(frame) != FALSE,"sealed frame rejected");
+		BenchExpect(MacPayloadLength(frame) == length,"payload length");
+		size = frame[2] + 3;								// checked bytes (+ CRC)
+		for(i=0;i<size;i++)									// single bit errors
+		{
+			if(i == 2)												// (not in LEN)
+			{
+				continue;
+			}
+			for(bit=0;bit<8;bit++)
+			{
+				frame[i] ^= 1 << bit;
+				flipsMissed += (MacFrameCheck(frame) != FALSE);
+				flips++;
+				frame[i] ^= 1 << bit;
+			}
+		}
+		for(i=3;i<(uint32_t)(length+2);i++)		// swapped payload bytes
+		{
+			if(frame[i] == frame[i+1])
+			{
+				continue;
+			}
+			tmp = frame[i]; frame[i] = frame[i+1]; frame[i+1] = tmp;
+			swapsMissed += (MacFrameCheck(frame) != FALSE);
+			swaps++;
+			tmp = frame[i]; frame[i] = frame[i+1]; frame[i+1] = tmp;
+		}
+	}
+	printf("%-14s missed %5u of %6u bit errors, %5u of %5u swapped bytes\n",
+		(crc16 != FALSE) ? "CRC-16" : "6 bits sum",flipsMissed,flips,
+		swapsMissed,swaps);
+	if(crc16 != FALSE)
+	{
+		BenchExpect((flipsMissed == 0) && (swapsMissed == 0),
+			"CRC-16 missed an error");
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get the time (ns)
+//////////////////////////////////////////////////////////////////////////////////
+static uint64_t BenchNow(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC,&time);
+	return (uint64_t)time.tv_sec * 1000000000 + time.tv_nsec;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Time a frame check on full segment frames
+/// \return The time per frame (ns)
+//////////////////////////////////////////////////////////////////////////////////
+static double BenchTime(const char * name,uint8_t check)
+{
+	uint8_t frame[MAX_BLOCK_SIZE];
+	uint64_t ns;
+	uint32_t i;
+	double frameNs;
+
+	gTokenInterface.crc16 = FALSE;
+	BenchFrame(frame,BENCH_LENGTH);
+	ns = BenchNow();
+	for(i=0;i<BENCH_FRAMES;i++)
+	{
+		frame[3] = i;												// not hoisted
+		switch(check)
+		{
+			case 0:
+				benchSink += MacChecksum(frame);
+				break;
+			case 1:
+				benchSink += MacCrc16(frame,BENCH_LENGTH + 3);
+				break;
+			default:
+				benchSink += CrcBitwise(frame,BENCH_LENGTH + 3);
+				break;
+		}
+	}
+	frameNs = (double)(BenchNow() - ns) / BENCH_FRAMES;
+	printf("%-20s %8.2f ns/frame %6.3f ns/byte (%u bytes)\n",name,frameNs,
+		frameNs / (BENCH_LENGTH + 3),BENCH_LENGTH + 3);
+	return frameNs;
+}
+
+int main(int argc,char * argv[])
+{
+	double budget = (argc > 1) ? atof(argv[1]) : 0;
+	double ns;
+
+	srand(1);
+#if PROFILE != 0
+	ProfileInit();
+#endif
+	BenchCheckCrc();
+	BenchCheckFrames(FALSE);
+	BenchCheckFrames(TRUE);
+	BenchTime("6 bits sum",0);
+	ns = BenchTime("CRC-16 table",1);
+	BenchTime("CRC-16 bit by bit",2);
+	if((budget > 0) && (ns > budget))
+	{
+		printf("FAILED: CRC-16 over %.2f ns/frame\n",budget);
+		failures++;
+	}
+#if PROFILE != 0
+	ProfileDump();
+#endif
+	return failures != 0;
+}
@@ -0,0 +1,226 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file glyph_test.c
+/// \brief Host test of the glyph cache (glyph_cache.c)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// The fonts are given by a stub decoder (render_character) drawing a few
+/// runs computed from the character, and counting its calls. Each character
+/// drawn with a cached font must give the same runs and width as the decoder,
+/// and the decoder must be called only when the glyph is not in the atlas:
+/// hit at another position, LRU replacement in a set, glyphs of too many runs
+/// or too far from the origin (int8 offsets) decoded each time without
+/// replacing the other glyphs of the set, fonts kept apart, font table full.
+//////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include "main.h"
+#include "resources_manager.h"
+
+#define TEST_MANY_RUNS		0x100					// glyph of GLYPH_CACHE_RUNS + 1 runs
+#define TEST_FAR					0x101					// glyph with a run 200 pixels right
+#define TEST_FONTS				(GLYPH_CACHE_FONTS + 1)
+#define TEST_SET(base,k)	((base) + (k) * GLYPH_CACHE_SETS)	// chars of a set
+
+//--------------------------------------------------------------------------------
+// Runs drawn for a character
+//--------------------------------------------------------------------------------
+struct testRun_t
+{
+	int16_t	x;
+	int16_t	y;
+	uint8_t	count;
+	uint8_t	alpha;
+};
+
+struct testDraw_t
+{
+	struct testRun_t	runs[GLYPH_CACHE_RUNS * 2];
+	uint32_t					count;
+	uint8_t						width;
+};
+
+static struct mf_font_s testFonts[TEST_FONTS];
+static uint32_t decodes;								// calls of the decoder
+static uint32_t failures;
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Stub decoder: width of a character
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t TestWidth(const struct mf_font_s * font,mf_char character)
+{
+	return (character % 9) + 3;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Stub decoder: draw a character (runs depend on font and character)
+//////////////////////////////////////////////////////////////////////////////////
+static uint8_t TestRender(const struct mf_font_s * font,int16_t x0,int16_t y0,
+	mf_char character,mf_pixel_callback_t callback,void * state)
+{
+	uint32_t runs = (character % 8) + 1;
+	int16_t dx = 0;
+	uint32_t i;
+
+	if(character == TEST_MANY_RUNS)
+	{
+		runs = GLYPH_CACHE_RUNS + 1;
+	}
+	if(character == TEST_FAR)
+	{
+		dx = 200;
+	}
+	decodes++;
+	for(i=0;i<runs;i++)
+	{
+		callback(x0 + dx + (i % 4) * 3,y0 + (i / 4) - 2,(character % 7) + 1,
+			(uint8_t)(character * 16 + i + font->flags),state);
+	}
+	return TestWidth(font,character);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Drawing callback: record the run
+//////////////////////////////////////////////////////////////////////////////////
+static void TestRecord(int16_t x,int16_t y,uint8_t count,uint8_t alpha,
+	void * state)
+{
+	struct testDraw_t * drawPtr = state;
+
+	if(drawPtr->count < (GLYPH_CACHE_RUNS * 2))
+	{
+		drawPtr->runs[drawPtr->count].x = x;
+		drawPtr->runs[drawPtr->count].y = y;
+		drawPtr->runs[drawPtr->count].count = count;
+		drawPtr->runs[drawPtr->count].alpha = alpha;
+		drawPtr->count++;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Draw a character with a cached font and check it
+/// \param font The cached font
+/// \param original The font given to GlyphCacheFont
+/// \param decoded TRUE if the decoder must be called (glyph not in atlas)
+//////////////////////////////////////////////////////////////////////////////////
+static void TestDraw(font_t font,font_t original,int16_t x0,int16_t y0,
+	mf_char character,bool_t decoded)
+{
+	struct testDraw_t draw;
+	struct testDraw_t expected;
+	uint32_t before;
+
+	memset(&draw,0,sizeof(draw));
+	memset(&expected,0,sizeof(expected));
+	expected.width = original->render_character(original,x0,y0,character,
+		TestRecord,&expected);
+	before = decodes;
+	draw.width = font->render_character(font,x0,y0,character,TestRecord,&draw);
+	if((draw.width != expected.width) ||
+		(font->character_width(font,character) != expected.width) ||
+		(draw.count != expected.count) ||
+		(memcmp(draw.runs,expected.runs,sizeof(draw.runs)) != 0))
+	{
+		printf("FAILED: char 0x%03X at %d,%d not drawn as by the decoder\n",
+			character,x0,y0);
+		failures++;
+	}
+	if((decodes - before) != ((decoded != FALSE) ? 1 : 0))
+	{
+		printf("FAILED: char 0x%03X %s\n",character,
+			(decoded != FALSE) ? "not decoded" : "decoded again");
+		failures++;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Check a cached font
+//////////////////////////////////////////////////////////////////////////////////
+static void TestFont(font_t font,font_t original,bool_t cached)
+{
+	if((font == original) == (cached != FALSE))
+	{
+		printf("FAILED: font %s %s\n",original->short_name,
+			(cached != FALSE) ? "not cached" : "cached");
+		failures++;
+	}
+}
+
+int main(void)
+{
+	font_t fonts[TEST_FONTS];
+	uint8_t i;
+	uint8_t k;
+
+	for(i=0;i<TEST_FONTS;i++)
+	{
+		testFonts[i].short_name = "test";
+		testFonts[i].flags = i;									// runs differ by font
+		testFonts[i].character_width = TestWidth;
+		testFonts[i].render_character = TestRender;
+	}
+	GlyphCacheInit();
+	fonts[0] = GlyphCacheFont(&testFonts[0]);
+	TestFont(fonts[0],&testFonts[0],TRUE);
+	TestFont(GlyphCacheFont(&testFonts[0]),fonts[0],FALSE);	// same copy
+	//------------------------------------------------------------------------------
+	// hit at another position
+	//------------------------------------------------------------------------------
+	TestDraw(fonts[0],&testFonts[0],10,20,'A',TRUE);
+	TestDraw(fonts[0],&testFonts[0],50,-60,'A',FALSE);
+	//------------------------------------------------------------------------------
+	// LRU: 5 chars of a set, the oldest one is replaced ('A' used again)
+	//------------------------------------------------------------------------------
+	for(k=1;k<GLYPH_CACHE_WAYS;k++)
+	{
+		TestDraw(fonts[0],&testFonts[0],0,0,TEST_SET('A',k),TRUE);
+	}
+	TestDraw(fonts[0],&testFonts[0],0,0,'A',FALSE);
+	TestDraw(fonts[0],&testFonts[0],0,0,TEST_SET('A',GLYPH_CACHE_WAYS),TRUE);
+	TestDraw(fonts[0],&testFonts[0],0,0,'A',FALSE);
+	for(k=2;k<=GLYPH_CACHE_WAYS;k++)
+	{
+		TestDraw(fonts[0],&testFonts[0],0,0,TEST_SET('A',k),FALSE);
+	}
+	TestDraw(fonts[0],&testFonts[0],0,0,TEST_SET('A',1),TRUE);
+	//------------------------------------------------------------------------------
+	// too many runs: decoded each time, only the oldest glyph of the set lost
+	//------------------------------------------------------------------------------
+	for(k=1;k<=GLYPH_CACHE_WAYS;k++)
+	{
+		TestDraw(fonts[0],&testFonts[0],0,0,TEST_SET(TEST_MANY_RUNS,k),TRUE);
+	}
+	TestDraw(fonts[0],&testFonts[0],5,5,TEST_MANY_RUNS,TRUE);
+	TestDraw(fonts[0],&testFonts[0],5,5,TEST_MANY_RUNS,TRUE);
+	for(k=2;k<=GLYPH_CACHE_WAYS;k++)
+	{
+		TestDraw(fonts[0],&testFonts[0],0,0,TEST_SET(TEST_MANY_RUNS,k),FALSE);
+	}
+	TestDraw(fonts[0],&testFonts[0],0,0,TEST_SET(TEST_MANY_RUNS,1),TRUE);
+	for(k=2;k<=GLYPH_CACHE_WAYS;k++)						// (it took the free slot)
+	{
+		TestDraw(fonts[0],&testFonts[0],0,0,TEST_SET(TEST_MANY_RUNS,k),FALSE);
+	}
+	//------------------------------------------------------------------------------
+	// run offset out of int8: decoded each time, not drawn at a wrapped offset
+	//------------------------------------------------------------------------------
+	TestDraw(fonts[0],&testFonts[0],100,100,TEST_FAR,TRUE);
+	TestDraw(fonts[0],&testFonts[0],100,100,TEST_FAR,TRUE);
+	//------------------------------------------------------------------------------
+	// fonts kept apart (same char decoded for each font), font table full
+	//------------------------------------------------------------------------------
+	TestDraw(fonts[0],&testFonts[0],10,20,'z',TRUE);
+	for(i=1;i<TEST_FONTS;i++)
+	{
+		fonts[i] = GlyphCacheFont(&testFonts[i]);
+		TestFont(fonts[i],&testFonts[i],i < GLYPH_CACHE_FONTS);
+	}
+	for(i=1;i<GLYPH_CACHE_FONTS;i++)
+	{
+		TestDraw(fonts[i],&testFonts[i],10,20,'z',TRUE);
+		TestDraw(fonts[i],&testFonts[i],10,20,'z',FALSE);
+	}
+	TestDraw(fonts[0],&testFonts[0],10,20,'z',FALSE);
+	printf("glyph cache: %u decoder calls, %u failures\n",decodes,failures);
+	return failures != 0;
+}
@@ -0,0 +1,209 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file host_os.c
+/// \brief Host services of the tests (event flags, mutexes, interrupt masking)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// The event flags follow CMSIS-RTOS2: a wait returns the flags before they
+/// are cleared, or osFlagsErrorTimeout. A tick is 1 ms. The interrupts
+/// masked by audio.c are a recursive mutex also taken by the audio driver
+/// around its callback (the SAI interrupt of the board). The cycle counter
+/// counts the ns of CLOCK_MONOTONIC (32 bits, as the DWT one).
+//////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include "main.h"
+
+//--------------------------------------------------------------------------------
+// An event flags object
+//--------------------------------------------------------------------------------
+struct hostFlags_t
+{
+	pthread_mutex_t		lock;
+	pthread_cond_t		cond;
+	uint32_t					flags;
+};
+
+static pthread_once_t irqOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t irqLock;						// recursive
+static __thread uint32_t irqDepth;			// masking depth of the thread
+
+osEventFlagsId_t eventFlag_id;
+uint32_t SystemCoreClock = 1000000000;		// 1 cycle = 1 ns
+HostCoreDebug_Type hostCoreDebug;
+static HostDWT_Type hostDwt;
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get the cycle counter (DWT->CYCCNT is read on each access)
+//////////////////////////////////////////////////////////////////////////////////
+HostDWT_Type * HostDwt(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC,&time);
+	hostDwt.CYCCNT = (uint32_t)((uint64_t)time.tv_sec * 1000000000 + time.tv_nsec);
+	return &hostDwt;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Create the interrupt masking mutex (first use)
+//////////////////////////////////////////////////////////////////////////////////
+static void HostIrqInit(void)
+{
+	pthread_mutexattr_t attr;
+
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr,PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&irqLock,&attr);
+	pthread_mutexattr_destroy(&attr);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Mask the interrupts (can be nested)
+//////////////////////////////////////////////////////////////////////////////////
+void HostIrqLock(void)
+{
+	pthread_once(&irqOnce,HostIrqInit);
+	pthread_mutex_lock(&irqLock);
+	irqDepth++;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Unmask the interrupts (one level)
+//////////////////////////////////////////////////////////////////////////////////
+void HostIrqUnlock(void)
+{
+	irqDepth--;
+	pthread_mutex_unlock(&irqLock);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Get the masking of the calling thread (PRIMASK)
+//////////////////////////////////////////////////////////////////////////////////
+uint32_t HostIrqMasked(void)
+{
+	return irqDepth != 0;
+}
+
+void CheckRetCode(uint32_t retCode,uint32_t lineNumber,char * fileName,uint8_t mode)
+{
+	if(retCode != osOK)
+	{
+		fprintf(stderr,"Error %d at line %u of %s\n",(int)retCode,lineNumber,fileName);
+		if(mode != CONTINUE)
+		{
+			exit(1);
+		}
+	}
+}
+
+osEventFlagsId_t osEventFlagsNew(const osEventFlagsAttr_t * attr)
+{
+	struct hostFlags_t * efPtr = calloc(1,sizeof(struct hostFlags_t));
+
+	if(efPtr != NULL)
+	{
+		pthread_mutex_init(&efPtr->lock,NULL);
+		pthread_cond_init(&efPtr->cond,NULL);
+	}
+	return efPtr;
+}
+
+uint32_t osEventFlagsSet(osEventFlagsId_t ef_id,uint32_t flags)
+{
+	struct hostFlags_t * efPtr = ef_id;
+
+	pthread_mutex_lock(&efPtr->lock);
+	efPtr->flags |= flags;
+	flags = efPtr->flags;
+	pthread_cond_broadcast(&efPtr->cond);
+	pthread_mutex_unlock(&efPtr->lock);
+	return flags;
+}
+
+uint32_t osEventFlagsWait(osEventFlagsId_t ef_id,uint32_t flags,
+	uint32_t options,uint32_t timeout)
+{
+	struct hostFlags_t * efPtr = ef_id;
+	struct timespec end;
+	uint32_t result;
+
+	clock_gettime(CLOCK_REALTIME,&end);
+	end.tv_sec += timeout / 1000;
+	end.tv_nsec += (timeout % 1000) * 1000000L;
+	if(end.tv_nsec >= 1000000000L)
+	{
+		end.tv_sec++;
+		end.tv_nsec -= 1000000000L;
+	}
+	pthread_mutex_lock(&efPtr->lock);
+	for (;;)
+	{
+		result = efPtr->flags & flags;
+		if(((options & osFlagsWaitAll) != 0) ? (result == flags) : (result != 0))
+		{
+			break;
+		}
+		if(timeout == osWaitForever)
+		{
+			pthread_cond_wait(&efPtr->cond,&efPtr->lock);
+		}
+		else if((timeout == 0) ||
+			(pthread_cond_timedwait(&efPtr->cond,&efPtr->lock,&end) != 0))
+		{
+			pthread_mutex_unlock(&efPtr->lock);
+			return osFlagsErrorTimeout;
+		}
+	}
+	result = efPtr->flags;
+	if((options & osFlagsNoClear) == 0)
+	{
+		efPtr->flags &= ~flags;
+	}
+	pthread_mutex_unlock(&efPtr->lock);
+	return result;
+}
+
+osStatus_t osDelay(uint32_t ticks)
+{
+	struct timespec time;
+
+	time.tv_sec = ticks / 1000;
+	time.tv_nsec = (ticks % 1000) * 1000000L;
+	nanosleep(&time,NULL);
+	return osOK;
+}
+
+osMutexId_t osMutexNew(const osMutexAttr_t * attr)
+{
+	pthread_mutex_t * mutexPtr = malloc(sizeof(pthread_mutex_t));
+
+	if(mutexPtr != NULL)
+	{
+		pthread_mutex_init(mutexPtr,NULL);
+	}
+	return mutexPtr;
+}
+
+osStatus_t osMutexAcquire(osMutexId_t mutex_id,uint32_t timeout)
+{
+	if(mutex_id == NULL)
+	{
+		return osError;
+	}
+	pthread_mutex_lock(mutex_id);
+	return osOK;
+}
+
+osStatus_t osMutexRelease(osMutexId_t mutex_id)
+{
+	if(mutex_id == NULL)
+	{
+		return osError;
+	}
+	pthread_mutex_unlock(mutex_id);
+	return osOK;
+}
@@ -0,0 +1,87 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file main.h
+/// \brief Host replacement of main.h for the host tests (see Makefile)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// Gives the modules tested on the host (audio.c, mac_crc.c, mac_compress.c,
+/// glyph_cache.c) the definitions they use from the application header,
+/// without the board, GUI and queues.
+/// The values must stay the same as in the application main.h.
+//////////////////////////////////////////////////////////////////////////////////
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#include "stm32f7xx_hal.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "cmsis_os2.h"
+
+#define MAX_BLOCK_SIZE 		100				// size max for a frame
+#define MAC_CRC_HW				0					// CRC-16 by table (no CRC unit)
+#define CONTINUE					0x0				// for check return code halt
+
+#define AUDIO_MSG_EVT	 			0x0020			// audio message to play
+#define AUDIO_ERROR_EVT 		0x0040			// audio error to play
+#define AUDIO_CLOCK_EVT 		0x0080			// audio clock to play
+#define AUDIO_BUF_EVT 			0x0100			// audio buffer free to mix
+
+//--------------------------------------------------------------------------------
+// Boolean type of uGFX (gfx.h)
+//--------------------------------------------------------------------------------
+typedef int8_t bool_t;
+#define TRUE							(-1)
+#define FALSE							0
+
+//--------------------------------------------------------------------------------
+// Profiler zones (PROFILE given by the Makefile, time in ns on the host)
+//--------------------------------------------------------------------------------
+#ifndef PROFILE
+#define PROFILE						0					// hot path profiler off (0) or on (1)
+#endif
+#define PROF_UART_RX			0					// HAL_UART_RxCpltCallback
+#define PROF_RS232_SEND		1					// rs232_send
+#define PROF_PHY_ROUTE		2					// PhReceiver frame routing
+#define PROF_MAC_BUILD		3					// MAC frame build
+#define PROF_CHECKSUM			4					// MAC checksum
+#define PROF_CRC16				5					// MAC CRC-16
+#define PROF_LCD_PUT			6					// LCD redraw of changed widgets
+#define PROF_ZONES				7					// number of zones
+
+void ProfileInit(void);
+void ProfileAdd(uint8_t zone,uint32_t cycles);
+void ProfileDump(void);
+#if PROFILE != 0
+#define PROFILE_BEGIN(zone)		uint32_t profStart_##zone = DWT->CYCCNT
+#define PROFILE_END(zone)			ProfileAdd(zone,DWT->CYCCNT - profStart_##zone)
+#else
+#define PROFILE_BEGIN(zone)
+#define PROFILE_END(zone)
+#endif
+
+//--------------------------------------------------------------------------------
+// structure for system usage (fields used by the tested modules)
+//--------------------------------------------------------------------------------
+struct TOKENINTERFACE
+{
+	bool_t		crc16;								///< frames are checked with CRC-16
+};
+extern struct TOKENINTERFACE gTokenInterface;
+extern osEventFlagsId_t  	eventFlag_id;
+
+void CheckRetCode(uint32_t retCode,uint32_t lineNumber,char * fileName,uint8_t mode);
+void AudioPlayer(void *argument);
+uint8_t MacChecksum(uint8_t * framePtr);
+uint16_t MacCrc16(const uint8_t * dataPtr,uint32_t length);
+uint8_t MacPayloadLength(uint8_t * framePtr);
+void MacFrameSeal(uint8_t * framePtr);
+bool_t MacFrameCheck(uint8_t * framePtr);
+void GlyphCacheInit(void);
+uint8_t MacCompress(const uint8_t * srcPtr,uint8_t length,uint8_t * dstPtr);
+uint8_t MacExpand(const uint8_t * srcPtr,uint8_t length,uint8_t * dstPtr,
+	uint8_t maxSize);
+
+#endif
@@ -0,0 +1,26 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file resources_manager.h
+/// \brief Host replacement of resources_manager.h (glyph cache test)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// Only the glyph cache part is given. The values must stay the same as in
+/// the application resources_manager.h.
+//////////////////////////////////////////////////////////////////////////////////
+#ifndef _RESOURCES_MANAGER_H
+#define _RESOURCES_MANAGER_H
+
+#include "src/gdisp/mcufont/mcufont.h"
+
+typedef const struct mf_font_s * font_t;
+
+// Decoded glyphs cache of antialiased fonts (atlas of 4 bytes runs, see glyph_cache.c)
+#define GLYPH_CACHE_FONTS 3		// max number of cached fonts
+#define GLYPH_CACHE_SETS 16		// glyph sets (selected by character)
+#define GLYPH_CACHE_WAYS 4		// glyphs per set (LRU replacement)
+#define GLYPH_CACHE_RUNS 64		// max runs of a glyph (atlas is 16 KB)
+
+font_t GlyphCacheFont(font_t font);
+
+#endif // _RESOURCES_MANAGER_H
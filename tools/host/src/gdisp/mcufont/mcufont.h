@@ -0,0 +1,39 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file mcufont.h
+/// \brief Host replacement of the uGFX mcufont header (glyph cache test)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// Only the font structure and the render callback used by glyph_cache.c are
+/// given. They must stay the same as in uGFX 2.9 (mf_font.h).
+//////////////////////////////////////////////////////////////////////////////////
+#ifndef _MCUFONT_H_
+#define _MCUFONT_H_
+
+#include <stdint.h>
+
+typedef uint16_t mf_char;
+
+typedef void (*mf_pixel_callback_t)(int16_t x,int16_t y,uint8_t count,
+	uint8_t alpha,void * state);
+
+struct mf_font_s
+{
+	const char *	full_name;
+	const char *	short_name;
+	uint8_t				width;
+	uint8_t				height;
+	uint8_t				min_x_advance;
+	uint8_t				max_x_advance;
+	int8_t				baseline_x;
+	uint8_t				baseline_y;
+	uint8_t				line_height;
+	uint8_t				flags;
+	uint16_t			fallback_character;
+	uint8_t (*character_width)(const struct mf_font_s * font,mf_char character);
+	uint8_t (*render_character)(const struct mf_font_s * font,int16_t x0,
+		int16_t y0,mf_char character,mf_pixel_callback_t callback,void * state);
+};
+
+#endif
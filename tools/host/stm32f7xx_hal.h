@@ -0,0 +1,75 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file stm32f7xx_hal.h
+/// \brief Host replacement of the HAL header (host tests, see Makefile)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// Only the types, the interrupt masking and the cycle counter used by the
+/// tested modules are given. The interrupts are masked with a recursive mutex
+/// shared with the audio driver callback (see host_os.c and tools/audio_wav.c).
+/// The DWT cycle counter of the profiler (profile.c) is the host monotonic
+/// clock in ns, so SystemCoreClock is 1 GHz and the profile is in ns.
+//////////////////////////////////////////////////////////////////////////////////
+#ifndef __STM32F7xx_HAL_H
+#define __STM32F7xx_HAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//--------------------------------------------------------------------------------
+// Cycle counter (DWT) and its enable bits
+//--------------------------------------------------------------------------------
+typedef struct
+{
+	uint32_t	CTRL;
+	uint32_t	CYCCNT;
+	uint32_t	LAR;
+} HostDWT_Type;
+
+typedef struct
+{
+	uint32_t	DEMCR;
+} HostCoreDebug_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk				0x00000001U
+#define CoreDebug_DEMCR_TRCENA_Msk		0x01000000U
+#define DWT							(HostDwt())				// CYCCNT read from host clock
+#define CoreDebug				(&hostCoreDebug)
+
+extern uint32_t SystemCoreClock;
+extern HostCoreDebug_Type hostCoreDebug;
+
+HostDWT_Type * HostDwt(void);
+void HostIrqLock(void);
+void HostIrqUnlock(void);
+uint32_t HostIrqMasked(void);
+
+static inline uint32_t __get_PRIMASK(void)
+{
+	return HostIrqMasked();
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+	if((primask != 0) && (HostIrqMasked() == 0))
+	{
+		HostIrqLock();
+	}
+	while((primask == 0) && (HostIrqMasked() != 0))
+	{
+		HostIrqUnlock();
+	}
+}
+
+static inline void __disable_irq(void)
+{
+	HostIrqLock();
+}
+
+static inline void __enable_irq(void)
+{
+	__set_PRIMASK(0);
+}
+
+#endif
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""Compress an audio cue to IMA-ADPCM for the audio player (see audio.c).
+
+Usage: pcm2adpcm.py input.wav|input.c name output.c
+
+The input is a 16 kHz mono 16-bit WAV file or a C file with a table of
+16-bit samples (the old raw PCM cues). The output is a C file with the table
+'const uint8_t name[]' holding 2 samples per byte (low nibble first). The
+decoder starts with a predictor and a step index of 0, like the encoder.
+"""
+import re
+import sys
+import wave
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8] * 2
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41,
+    45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190,
+    209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724,
+    796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272,
+    2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132,
+    7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
+    22385, 24623, 27086, 29794, 32767]
+
+
+def read_samples(path):
+    """Return the signed samples of a WAV or C table file."""
+    if path.endswith(".wav"):
+        with wave.open(path, "rb") as wav:
+            if wav.getsampwidth() != 2 or wav.getnchannels() != 1:
+                sys.exit("WAV must be 16-bit mono")
+            data = wav.readframes(wav.getnframes())
+        return [int.from_bytes(data[i:i + 2], "little", signed=True)
+                for i in range(0, len(data), 2)]
+    with open(path) as src:
+        text = src.read()
+    table = text[text.index("{") + 1:text.rindex("}")]
+    values = [int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\d+", table)]
+    return [v - 0x10000 if v >= 0x8000 else v for v in values]
+
+
+def encode(samples):
+    """Encode signed samples to IMA-ADPCM nibbles (and decode them back)."""
+    predictor = 0
+    index = 0
+    nibbles = []
+    decoded = []
+    for sample in samples:
+        step = STEP_TABLE[index]
+        diff = sample - predictor
+        nibble = 0
+        if diff < 0:
+            nibble = 8
+            diff = -diff
+        delta = step >> 3
+        if diff >= step:
+            nibble |= 4
+            diff -= step
+            delta += step
+        if diff >= step >> 1:
+            nibble |= 2
+            diff -= step >> 1
+            delta += step >> 1
+        if diff >= step >> 2:
+            nibble |= 1
+            delta += step >> 2
+        predictor += -delta if nibble & 8 else delta
+        predictor = max(-32768, min(32767, predictor))
+        index = max(0, min(88, index + INDEX_TABLE[nibble]))
+        nibbles.append(nibble)
+        decoded.append(predictor)
+    return nibbles, decoded
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    samples = read_samples(sys.argv[1])
+    nibbles, decoded = encode(samples)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    data = [nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2)]
+    noise = sum((a - b) ** 2 for a, b in zip(samples, decoded))
+    signal = sum(a * a for a in samples)
+    sys.stderr.write("%d samples -> %d bytes, noise %.2f %%\n" % (
+        len(samples), len(data), 100.0 * (noise / signal) ** 0.5 if signal else 0))
+    lines = [", ".join("0x%02X" % b for b in data[i:i + 12])
+             for i in range(0, len(data), 12)]
+    with open(sys.argv[3], "w") as out:
+        out.write('#include "stm32f7xx_hal.h"\n\n')
+        out.write("// %d samples IMA-ADPCM (tools/pcm2adpcm.py)\n" % len(samples))
+        out.write("const uint8_t %s[]={\n" % sys.argv[2])
+        out.write(",\n".join(lines))
+        out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""Convert a token ring capture (TRACE_CAPTURE = 1, see trace.c) to pcapng.
+
+Usage: trcap2pcapng.py capture.bin capture.pcapng
+
+The capture is the raw stdout/ITM stream of the board. Bytes that are not
+part of a capture record (text printed by other threads) are skipped.
+
+Each packet of the pcapng file uses the link type USER0 (147) and starts
+with one byte giving the layer of the frame (0 = PHY frame with STX and ETX,
+1 = MAC frame), followed by the frame itself. The direction is stored in the
+epb_flags option and the timestamp is the kernel tick (1 ms resolution).
+"""
+import struct
+import sys
+
+SYNC = b"\xA5\x5A"
+FLAG_SENT = 0x01
+FLAG_MAC = 0x02
+FLAG_LOST = 0xFF
+LINKTYPE_USER0 = 147
+MAX_FRAME = 100
+
+
+def block(block_type, body):
+    """Build a pcapng block (body padded to 32 bits)."""
+    body += b"\x00" * (-len(body) % 4)
+    length = len(body) + 12
+    return struct.pack("<II", block_type, length) + body + struct.pack("<I", length)
+
+
+def records(data):
+    """Yield (flags, tick, frame) for each record of the capture."""
+    pos = data.find(b"TRCAP1")
+    pos = 0 if pos < 0 else pos + 6
+    while True:
+        pos = data.find(SYNC, pos)
+        if pos < 0 or pos + 7 > len(data):
+            return
+        flags = data[pos + 2]
+        value = struct.unpack_from("<I", data, pos + 3)[0]
+        if flags == FLAG_LOST:
+            sys.stderr.write("%d frames lost by the board\n" % value)
+            pos += 7
+            continue
+        if flags & ~(FLAG_SENT | FLAG_MAC) or pos + 8 > len(data):
+            pos += 1                            # not a record, resync
+            continue
+        size = data[pos + 7]
+        if size > MAX_FRAME or pos + 8 + size > len(data):
+            pos += 1
+            continue
+        yield flags, value, data[pos + 8:pos + 8 + size]
+        pos += 8 + size
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    with open(sys.argv[1], "rb") as f:
+        data = f.read()
+    out = [block(0x0A0D0D0A, struct.pack("<IHHq", 0x1A2B3C4D, 1, 0, -1)),
+           block(0x00000001, struct.pack("<HHI", LINKTYPE_USER0, 0, 0))]
+    count = 0
+    for flags, tick, frame in records(data):
+        timestamp = tick * 1000                 # ms -> us (default resolution)
+        packet = bytes([1 if flags & FLAG_MAC else 0]) + frame
+        direction = 2 if flags & FLAG_SENT else 1
+        body = struct.pack("<IIIII", 0, timestamp >> 32, timestamp & 0xFFFFFFFF,
+                           len(packet), len(packet))
+        body += packet + b"\x00" * (-len(packet) % 4)
+        body += struct.pack("<HHI", 2, 4, direction) + struct.pack("<HH", 0, 0)
+        out.append(block(0x00000006, body))
+        count += 1
+    with open(sys.argv[2], "wb") as f:
+        f.write(b"".join(out))
+    sys.stderr.write("%d frames written\n" % count)
+
+
+if __name__ == "__main__":
+    main()
@@ -97,20 +97,17 @@ void Touch(void *argument)
 				if(gTokenInterface.broadcastTime != FALSE)
 				{
 					//----------------------------------------------------------------------
-					// set event flag to broadcast time
+					// start periodic timer to broadcast time
 					//----------------------------------------------------------------------
-					retCode = osEventFlagsSet(eventFlag_id, BROADCAST_TIME_EVT);	// set flag
-					if(retCode < 0)
-					{
-						CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);									
-					}
+					retCode = osTimerStart(timer_time_id, TIME_PERIOD);
+					CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);									
 				}
 				else
 				{
 					//----------------------------------------------------------------------
-					// clear event flag to broadcast time
+					// stop periodic timer to broadcast time
 					//----------------------------------------------------------------------
-					retCode = osEventFlagsClear(eventFlag_id, BROADCAST_TIME_EVT);	// clr flag
+					retCode = osTimerStop(timer_time_id);
 					CheckRetCode(retCode,__LINE__,__FILE__,CONTINUE);									
 				}
 			}
@@ -0,0 +1,262 @@
+//////////////////////////////////////////////////////////////////////////////////
+/// \file trace.c
+/// \brief Frame trace thread (deferred display of PHY and MAC frames)
+/// \author agent (agent at local)
+/// \version 1.0
+/// \date  2026-10
+///
+/// The PHY and DEBUG threads only copy the raw frame with its tick in a ring
+/// of records. The low priority TRACE thread formats them in hex and writes
+/// them to stdout by batches. When the ring is full, frames are dropped and
+/// counted (the data path is never blocked by the trace). Constant texts of
+/// the TRACE_TEXT macro are deferred the same way (only their pointer is kept).
+///
+/// With TRACE_CAPTURE = 1 the frames are written to stdout in a compact binary
+/// log for offline analysis (tools/trcap2pcapng.py converts it to pcapng):
+/// - header: "TRCAP1"
+/// - each frame: 0xA5 0x5A, flags, tick (4 bytes, little endian), size, frame
+/// - flags: bit 0 = sent frame (else received), bit 1 = MAC frame (else PHY)
+/// - lost frames: 0xA5 0x5A, 0xFF, number of lost frames (4 bytes)
+//////////////////////////////////////////////////////////////////////////////////
+#include "stm32f7xx_hal.h"
+
+#include <stdio.h>
+#include <string.h>
+#include "main.h"
+
+#define TRACE_RECORDS			16					// frames waiting to be displayed
+#define TRACE_FLAG				0x0001			// thread flag: records available
+#define PROFILE_FLAG			0x0002			// thread flag: profile display asked
+#define CAPTURE_SYNC1			0xA5				// start of a capture record
+#define CAPTURE_SYNC2			0x5A
+#define CAPTURE_SENT			0x01				// flags: frame sent by this station
+#define CAPTURE_MAC				0x02				// flags: MAC frame (no STX and ETX)
+#define CAPTURE_LOST			0xFF				// flags: lost frames record
+
+//--------------------------------------------------------------------------------
+// A captured frame
+//--------------------------------------------------------------------------------
+struct traceRecord_t
+{
+	uint32_t	tick;									///< kernel tick at capture
+	uint8_t		preChar;							///< 'R' (receive) or 'S' (send)
+	uint8_t		sepChar;							///< ':' (PHY frame) or '-' (MAC frame)
+	uint8_t		size;									///< number of bytes in frame
+	const char * text;							///< constant text (NULL for a frame)
+	uint8_t		frame[MAX_BLOCK_SIZE];	///< raw frame
+};
+
+static struct traceRecord_t traceRing[TRACE_RECORDS];
+static volatile uint32_t traceWrite;		// records written (by frame threads)
+static volatile uint32_t traceRead;			// records displayed (by trace thread)
+static volatile uint32_t traceDropped;	// records lost (ring was full)
+extern osThreadId_t trace_id;
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Copy a frame in the trace ring (never blocks)
+/// \param preChar the char to write before the frame
+/// \param sepChar the char to write after preChar
+/// \param framePtr pointer to the frame
+/// \param size number of bytes of the frame
+/// \param text constant text to display instead of a frame (or NULL)
+//////////////////////////////////////////////////////////////////////////////////
+static void TraceRecord(uint8_t preChar,uint8_t sepChar,uint8_t * framePtr,
+	uint32_t size,const char * text)
+{
+	struct traceRecord_t * recPtr;
+
+	if(size > MAX_BLOCK_SIZE)
+	{
+		size = MAX_BLOCK_SIZE;
+	}
+	osKernelLock();													// several frame threads
+	if((traceWrite - traceRead) >= TRACE_RECORDS)
+	{
+		traceDropped++;												// ring full -> drop
+		osKernelUnlock();
+		return;
+	}
+	recPtr = &traceRing[traceWrite % TRACE_RECORDS];
+	recPtr->tick = osKernelGetTickCount();
+	recPtr->preChar = preChar;
+	recPtr->sepChar = sepChar;
+	recPtr->size = size;
+	recPtr->text = text;
+	if(framePtr != NULL)
+	{
+		memcpy(recPtr->frame,framePtr,size);
+	}
+	traceWrite++;
+	osKernelUnlock();
+	osThreadFlagsSet(trace_id,TRACE_FLAG);	// wake-up trace thread
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Display a frame of type PHY
+/// \param preChar the char to write before the frame
+/// \param stringP pointer to physical frame to display
+/// It is used by PHY_SENDER and PHY_RECEIVER
+//////////////////////////////////////////////////////////////////////////////////
+void DebugFrame(uint8_t preChar,char * stringP)
+{
+  uint32_t size;                          			// get size of frame
+
+  if ((uint8_t)stringP[1] == TOKEN_TAG)     // is it a TOKEN frame
+  {
+    size = TOKENSIZE;                  			// size is TOKENSIZE
+  }
+  else
+  {
+    size = stringP[3] + 6;             			// calculate size of frame
+  }
+	TraceRecord(preChar,':',(uint8_t *)stringP,size,NULL);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Display a frame of type MAC to the PC serial port for debug
+/// \param preChar the char to write before the message
+/// \param stringP pointer to the message of type MAC !!!
+/// It is used by PHY_SENDER and DEBUG
+//////////////////////////////////////////////////////////////////////////////////
+void DebugMacFrame(uint8_t preChar,uint8_t * stringP)
+{
+	uint32_t size;                         	// get size of frame
+
+  if (stringP[0] == TOKEN_TAG)           	// is it a TOKEN frame
+  {
+    size = TOKENSIZE - 2;         				//size is TOKENSIZE
+  }
+  else
+  {
+    size = stringP[2] + 4;             		// calculate size of frame
+  }
+	TraceRecord(preChar,'-',stringP,size,NULL);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Ask the trace thread to display the profile (can be called from irq)
+//////////////////////////////////////////////////////////////////////////////////
+void ProfileRequest(void)
+{
+	osThreadFlagsSet(trace_id,PROFILE_FLAG);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Display a constant text (by the trace thread)
+/// \param text the text, must stay valid (string literal)
+/// It is used by the TRACE_TEXT macro
+//////////////////////////////////////////////////////////////////////////////////
+void TraceText(const char * text)
+{
+	TraceRecord(0,0,NULL,0,text);
+}
+
+#if TRACE_CAPTURE != 0
+//////////////////////////////////////////////////////////////////////////////////
+/// \brief Write a record of the binary capture
+/// \param flags The record flags
+/// \param value The tick (frame) or the number of lost frames
+/// \param recPtr The captured frame (NULL for lost frames)
+//////////////////////////////////////////////////////////////////////////////////
+static void CaptureWrite(uint8_t flags,uint32_t value,struct traceRecord_t * recPtr)
+{
+	uint8_t header[8];
+
+	header[0] = CAPTURE_SYNC1;
+	header[1] = CAPTURE_SYNC2;
+	header[2] = flags;
+	header[3] = value & 0xFF;							// little endian
+	header[4] = (value >> 8) & 0xFF;
+	header[5] = (value >> 16) & 0xFF;
+	header[6] = (value >> 24) & 0xFF;
+	if(recPtr == NULL)
+	{
+		fwrite(header,1,7,stdout);
+		return;
+	}
+	header[7] = recPtr->size;
+	fwrite(header,1,8,stdout);
+	fwrite(recPtr->frame,1,recPtr->size,stdout);
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+// THREAD TRACE
+//////////////////////////////////////////////////////////////////////////////////
+void Trace(void *argument)
+{
+#if TRACE_CAPTURE == 0
+	const uint8_t table[16] = {'0','1','2','3',
+                     '4','5','6','7',
+                     '8','9','A','B',
+                     'C','D','E','F'};
+	char line[(MAX_BLOCK_SIZE * 3) + 8];		// one formatted frame
+	uint32_t pos;
+	uint32_t i;
+#endif
+	struct traceRecord_t * recPtr;
+	uint32_t lastDropped = 0;
+	uint32_t dropped;
+	uint32_t flags;
+
+#if TRACE_CAPTURE != 0
+	fwrite("TRCAP1",1,6,stdout);						// capture header
+#endif
+	//------------------------------------------------------------------------------
+	for (;;)														// loop until doomsday
+	{
+		//----------------------------------------------------------------------------
+		// THREAD FLAG WAIT (records in the ring)
+		//----------------------------------------------------------------------------
+		flags = osThreadFlagsWait(TRACE_FLAG | PROFILE_FLAG,osFlagsWaitAny,
+			osWaitForever);
+		while(traceRead != traceWrite)				// format all records
+		{
+			recPtr = &traceRing[traceRead % TRACE_RECORDS];
+			if(recPtr->text != NULL)						// text record
+			{
+#if TRACE_CAPTURE == 0
+				fputs(recPtr->text,stdout);				// not in binary capture
+#endif
+				traceRead++;
+				continue;
+			}
+#if TRACE_CAPTURE != 0
+			CaptureWrite(((recPtr->preChar == 'S') ? CAPTURE_SENT : 0) |
+				((recPtr->sepChar == '-') ? CAPTURE_MAC : 0),recPtr->tick,recPtr);
+			traceRead++;											// record can be reused
+#else
+			pos = 0;
+			line[pos++] = recPtr->preChar;
+			line[pos++] = recPtr->sepChar;
+			line[pos++] = '[';								// display an open bracket
+			for(i=0;i<recPtr->size;i++)
+			{
+				line[pos++] = table[recPtr->frame[i] >> 4];	// display 2 hex digits
+				line[pos++] = table[recPtr->frame[i] & 0x0F];
+				line[pos++] = ' ';							// insert a space
+			}
+			line[pos++] = ']';								// display a closed bracket
+			line[pos++] = '\r';
+			line[pos++] = '\n';
+			traceRead++;											// record can be reused
+			fwrite(line,1,pos,stdout);
+#endif
+		}
+		dropped = traceDropped;
+		if(dropped != lastDropped)
+		{
+#if TRACE_CAPTURE != 0
+			CaptureWrite(CAPTURE_LOST,dropped - lastDropped,NULL);
+#else
+			printf(">> Trace: %u frames dropped <<\r\n",dropped - lastDropped);
+#endif
+			lastDropped = dropped;
+		}
+		if((flags & PROFILE_FLAG) != 0)
+		{
+			ProfileDump();
+		}
+		fflush(stdout);
+	}
+}